@@ -45,8 +45,10 @@
    * - Interpolation functions
    * - Support Vector Machine functions (SVM)
    * - Bayes classifier functions
+   * - Tree ensemble functions
    * - Distance functions
    * - Quaternion functions
+   * - Estimation functions
    *
    * The library has generally separate functions for operating on 8-bit integers, 16-bit integers,
    * 32-bit integer and 32-bit floating-point values.
@@ -201,10 +203,12 @@
 #include "dsp/support_functions.h"
 #include "dsp/distance_functions.h"
 #include "dsp/svm_functions.h"
+#include "dsp/tree_functions.h"
 #include "dsp/fast_math_functions.h"
 #include "dsp/transform_functions.h"
 #include "dsp/filtering_functions.h"
 #include "dsp/quaternion_math_functions.h"
+#include "dsp/estimation_functions.h"
 
 
 
@@ -44,6 +44,9 @@
  * The parameters can be easily
  * generated from the scikit-learn object. Some examples are given in
  * DSP/Testing/PatternGeneration/Bayes.py
+ *
+ * The parameters of the q15 version are generated with
+ * DSP/PythonWrapper/mlquantization.py
  */
 
 #ifdef   __cplusplus
@@ -64,6 +67,23 @@ typedef struct
   float32_t epsilon;         /**< Additive value to variances */
 } arm_gaussian_naive_bayes_instance_f32;
 
+/**
+ * @brief Instance structure for q15 Naive Gaussian Bayesian estimator.
+ *
+ * The terms of the log-likelihoods which do not depend on the input are
+ * precomputed (for instance with PythonWrapper/mlquantization.py).
+ * invSigma and classConstants are scaled by a common power of 2 so that
+ * invSigma is in the q15 range.
+ */
+typedef struct
+{
+  uint32_t vectorDimension;  /**< Dimension of vector space */
+  uint32_t numberOfClasses;  /**< Number of different classes  */
+  const q15_t *theta;          /**< Mean values for the Gaussians */
+  const q15_t *invSigma;       /**< 1 / (2 (variance + epsilon)) */
+  const q31_t *classConstants; /**< log(prior) - sum(log(2 pi (variance + epsilon))) / 2 in Q16.15 */
+} arm_gaussian_naive_bayes_instance_q15;
+
 /**
  * @brief Naive Gaussian Bayesian Estimator
  *
@@ -81,6 +101,36 @@ uint32_t arm_gaussian_naive_bayes_predict_f32(const arm_gaussian_naive_bayes_ins
    float32_t *pOutputProbabilities,
    float32_t *pBufferB);
 
+/**
+ * @brief Naive Gaussian Bayesian Estimator on a batch of vectors
+ *
+ * @param[in]  S            points to a naive bayes instance structure
+ * @param[in]  in           points to nbVectors input vectors
+ * @param[in]  nbVectors    number of input vectors
+ * @param[out] pBuffer      points to a temporary buffer of length numberOfClasses * (vectorDimension + 2)
+ * @param[out] pResult      nbVectors predicted classes
+ * @return none
+ *
+ */
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_instance_f32 *S, 
+   const float32_t * in, 
+   uint32_t nbVectors,
+   float32_t *pBuffer,
+   uint32_t *pResult);
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator
+ *
+ * @param[in]  S                points to a naive bayes instance structure
+ * @param[in]  in               points to the elements of the input vector.
+ * @param[out] pOutputScores    points to a buffer of length numberOfClasses containing the scaled log-likelihoods in Q16.15
+ * @return The predicted class
+ *
+ */
+uint32_t arm_gaussian_naive_bayes_predict_q15(const arm_gaussian_naive_bayes_instance_q15 *S, 
+   const q15_t * in, 
+   q31_t *pOutputScores);
+
 
 #ifdef   __cplusplus
 }
@@ -287,6 +287,174 @@ extern "C"
         uint32_t numSamples);
 
 
+  /**
+   * @brief Instance structure for the floating-point numerically controlled oscillator.
+   *
+   * The oscillator is made of 4 complex rotators holding the values of the
+   * next 4 samples so that 4 samples are computed at a time. They are
+   * periodically recomputed from the phase accumulator.
+   */
+  typedef struct
+  {
+          uint32_t phase;        /**< phase of the next sample. 2^32 is one cycle. */
+          uint32_t phaseInc;     /**< phase increment per sample. */
+          float32_t stateRe[4];  /**< real parts of the oscillator for the next 4 samples. */
+          float32_t stateIm[4];  /**< imaginary parts of the oscillator for the next 4 samples. */
+          float32_t stepRe[4];   /**< real parts of exp(j.k.w) for k = 1 to 4. */
+          float32_t stepIm[4];   /**< imaginary parts of exp(j.k.w) for k = 1 to 4. */
+  } arm_nco_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 numerically controlled oscillator.
+   */
+  typedef struct
+  {
+          uint32_t phase;        /**< phase accumulator. 2^32 is one cycle. */
+          uint32_t phaseInc;     /**< phase increment per sample. */
+  } arm_nco_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 numerically controlled oscillator.
+   */
+  typedef struct
+  {
+          uint32_t phase;        /**< phase accumulator. 2^32 is one cycle. */
+          uint32_t phaseInc;     /**< phase increment per sample. */
+  } arm_nco_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point NCO.
+   * @param[out] S      points to an instance of the NCO
+   * @param[in]  freq   frequency in cycles per sample
+   * @param[in]  phase  initial phase in cycles
+   */
+  void arm_nco_init_f32(
+        arm_nco_instance_f32 * S,
+        float32_t freq,
+        float32_t phase);
+
+  /**
+   * @brief  Initialization function for the Q31 NCO.
+   * @param[out] S      points to an instance of the NCO
+   * @param[in]  freq   frequency in cycles per sample
+   * @param[in]  phase  initial phase in cycles
+   */
+  void arm_nco_init_q31(
+        arm_nco_instance_q31 * S,
+        q31_t freq,
+        q31_t phase);
+
+  /**
+   * @brief  Initialization function for the Q15 NCO.
+   * @param[out] S      points to an instance of the NCO
+   * @param[in]  freq   frequency in cycles per sample
+   * @param[in]  phase  initial phase in cycles
+   */
+  void arm_nco_init_q15(
+        arm_nco_instance_q15 * S,
+        q31_t freq,
+        q31_t phase);
+
+  /**
+   * @brief  Changes the frequency of a floating-point NCO without phase discontinuity.
+   * @param[in,out] S     points to an instance of the NCO
+   * @param[in]     freq  frequency in cycles per sample
+   */
+  void arm_nco_set_frequency_f32(
+        arm_nco_instance_f32 * S,
+        float32_t freq);
+
+  /**
+   * @brief  Changes the frequency of a Q31 NCO without phase discontinuity.
+   * @param[in,out] S     points to an instance of the NCO
+   * @param[in]     freq  frequency in cycles per sample
+   */
+  void arm_nco_set_frequency_q31(
+        arm_nco_instance_q31 * S,
+        q31_t freq);
+
+  /**
+   * @brief  Changes the frequency of a Q15 NCO without phase discontinuity.
+   * @param[in,out] S     points to an instance of the NCO
+   * @param[in]     freq  frequency in cycles per sample
+   */
+  void arm_nco_set_frequency_q15(
+        arm_nco_instance_q15 * S,
+        q31_t freq);
+
+  /**
+   * @brief  Floating-point NCO
+   * @param[in,out] S          points to an instance of the NCO
+   * @param[out]    pDst       points to the complex output vector
+   * @param[in]     blockSize  number of complex samples to generate
+   */
+  void arm_nco_f32(
+        arm_nco_instance_f32 * S,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q31 NCO
+   * @param[in,out] S          points to an instance of the NCO
+   * @param[out]    pDst       points to the complex output vector
+   * @param[in]     blockSize  number of complex samples to generate
+   */
+  void arm_nco_q31(
+        arm_nco_instance_q31 * S,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q15 NCO
+   * @param[in,out] S          points to an instance of the NCO
+   * @param[out]    pDst       points to the complex output vector
+   * @param[in]     blockSize  number of complex samples to generate
+   */
+  void arm_nco_q15(
+        arm_nco_instance_q15 * S,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point quadrature down-conversion of a real signal
+   * @param[in,out] S          points to an instance of the NCO
+   * @param[in]     pSrc       points to the real input vector
+   * @param[out]    pDst       points to the complex output vector
+   * @param[in]     blockSize  number of samples in each vector
+   */
+  void arm_mix_down_f32(
+        arm_nco_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q31 quadrature down-conversion of a real signal
+   * @param[in,out] S          points to an instance of the NCO
+   * @param[in]     pSrc       points to the real input vector
+   * @param[out]    pDst       points to the complex output vector
+   * @param[in]     blockSize  number of samples in each vector
+   */
+  void arm_mix_down_q31(
+        arm_nco_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Q15 quadrature down-conversion of a real signal
+   * @param[in,out] S          points to an instance of the NCO
+   * @param[in]     pSrc       points to the real input vector
+   * @param[out]    pDst       points to the complex output vector
+   * @param[in]     blockSize  number of samples in each vector
+   */
+  void arm_mix_down_q15(
+        arm_nco_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
 
 #ifdef   __cplusplus
 }
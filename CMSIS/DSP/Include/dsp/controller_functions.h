@@ -392,6 +392,156 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
    * @ingroup groupController
    */
 
+  /**
+   * @defgroup PIDBank PID Controller Bank
+   *
+   * Update of a bank of independent PID controllers in one call.
+   *
+   * The PID functions above process one sample of one controller per call.
+   * When a control tick has to update many loops (several motors,
+   * several axis), the bank functions update all the controllers
+   * of the bank with one call and the controllers are processed in
+   * parallel on vector architectures.
+   *
+   * Unlike the PID functions, the bank functions are using the positional form
+   * of the controller so that the integrator can be clamped (anti-windup) and the
+   * derivative term can be filtered.
+   *
+   * \par Algorithm:
+   * <pre>
+   *    P[n] = Kp * e[n]
+   *    I[n] = I[n-1] + Ki * e[n]
+   *    D[n] = Kf * D[n-1] + Kd * (e[n] - e[n-1])
+   *    y[n] = min(max(P[n] + I[n] + D[n], outMin), outMax)
+   * </pre>
+   *
+   * \par
+   * where <code>e</code> is the error (the input of the controller).
+   * \c Ki and \c Kd include the sampling period \c Ts.
+   *
+   * \par Anti-windup
+   * When the output is saturated and the integral increment <code>Ki * e[n]</code>
+   * would push it further beyond the limit, the integrator is not updated
+   * (I[n] = I[n-1]).
+   * The anti-windup is disabled with limits larger than any possible output.
+   *
+   * \par Derivative filtering
+   * The derivative term is filtered by a first order low-pass filter.
+   * For the filtered derivative <code>Kd s / (1 + Tf s)</code> discretized with the
+   * backward Euler method, the coefficients are:
+   * <pre>
+   *    Kf = Tf / (Tf + Ts)
+   *    Kd = Kd / (Tf + Ts)
+   * </pre>
+   * A value of 0 for \c Kf disables the filter (and \c Kd is then \c Kd / \c Ts).
+   *
+   * \par Coefficient and state layout
+   * The coefficients and the state are stored as structures of arrays
+   * with one element per controller in each array:
+   * <pre>
+   *    pCoeffs = {Kp[0..N-1], Ki[0..N-1], Kd[0..N-1], Kf[0..N-1], outMin[0..N-1], outMax[0..N-1]}
+   *    pState  = {I[0..N-1], e[0..N-1], D[0..N-1]}
+   * </pre>
+   * where <code>N</code> is the number of controllers.
+   * The coefficient array has a size of <code>6*N</code> and the state array a
+   * size of <code>3*N</code>.
+   * The coefficients can be modified between two updates of the bank.
+   *
+   * \par Fixed-Point Behavior
+   * The Q31 gains are in Q(1+postShift).(31-postShift) format so that gains
+   * bigger than 1 can be used. \c Kf and the output limits are in 1.31 format.
+   * The terms are computed with 64-bit accumulators and saturated to 1.31 format.
+   */
+
+  /**
+   * @brief Instance structure for the floating-point PID controller bank.
+   */
+  typedef struct
+  {
+          uint16_t numControllers;   /**< number of controllers in the bank. */
+          const float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length 6*numControllers. */
+          float32_t *pState;         /**< points to the state array. The array is of length 3*numControllers. */
+  } arm_pid_bank_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 PID controller bank.
+   */
+  typedef struct
+  {
+          uint16_t numControllers;   /**< number of controllers in the bank. */
+          uint8_t postShift;         /**< additional shift, in bits, applied to the gains Kp, Ki and Kd. */
+          const q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length 6*numControllers. */
+          q31_t *pState;             /**< points to the state array. The array is of length 3*numControllers. */
+  } arm_pid_bank_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point PID controller bank.
+   * @param[in,out] S               points to an instance of the PID bank structure.
+   * @param[in]     numControllers  number of controllers in the bank.
+   * @param[in]     pCoeffs         points to the coefficient array.
+   * @param[in]     pState          points to the state array.
+   */
+  void arm_pid_bank_init_f32(
+        arm_pid_bank_instance_f32 * S,
+        uint16_t numControllers,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief  Reset function for the floating-point PID controller bank.
+   * @param[in,out] S  points to an instance of the PID bank structure.
+   */
+  void arm_pid_bank_reset_f32(
+  const arm_pid_bank_instance_f32 * S);
+
+  /**
+   * @brief  Processing function for the floating-point PID controller bank.
+   * @param[in]  S     points to an instance of the PID bank structure.
+   * @param[in]  pSrc  points to the errors (one per controller).
+   * @param[out] pDst  points to the outputs (one per controller).
+   */
+  void arm_pid_bank_f32(
+  const arm_pid_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q31 PID controller bank.
+   * @param[in,out] S               points to an instance of the PID bank structure.
+   * @param[in]     numControllers  number of controllers in the bank.
+   * @param[in]     pCoeffs         points to the coefficient array.
+   * @param[in]     pState          points to the state array.
+   * @param[in]     postShift       shift to be applied to the products with the gains Kp, Ki and Kd.
+   */
+  void arm_pid_bank_init_q31(
+        arm_pid_bank_instance_q31 * S,
+        uint16_t numControllers,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint8_t postShift);
+
+  /**
+   * @brief  Reset function for the Q31 PID controller bank.
+   * @param[in,out] S  points to an instance of the PID bank structure.
+   */
+  void arm_pid_bank_reset_q31(
+  const arm_pid_bank_instance_q31 * S);
+
+  /**
+   * @brief  Processing function for the Q31 PID controller bank.
+   * @param[in]  S     points to an instance of the PID bank structure.
+   * @param[in]  pSrc  points to the errors (one per controller).
+   * @param[out] pDst  points to the outputs (one per controller).
+   */
+  void arm_pid_bank_q31(
+  const arm_pid_bank_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst);
+
+  /**
+   * @ingroup groupController
+   */
+
   /**
    * @defgroup park Vector Park Transform
    *
@@ -781,6 +931,181 @@ __STATIC_FORCEINLINE void arm_inv_clarke_q31(
    * @} end of inv_clarke group
    */
 
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup FOC Field Oriented Control Transform
+   *
+   * Computation, in one step, of the sine and cosine of the rotor angle,
+   * of the Clarke transform and of the Park transform of the phase currents.
+   * It is the input stage of a field oriented control loop.
+   *
+   * \par Algorithm
+   * <pre>
+   *    sinVal, cosVal = sin(theta), cos(theta)
+   *    Ialpha = Ia
+   *    Ibeta  = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib
+   *    Id     =  Ialpha * cosVal + Ibeta * sinVal
+   *    Iq     = -Ialpha * sinVal + Ibeta * cosVal
+   * </pre>
+   * The angle is in the same format as for the \ref SinCos functions
+   * and the results are the same as the ones of \ref SinCos, \ref clarke
+   * and \ref park called in sequence.
+   * The sine and cosine are also returned since they are needed by the
+   * inverse Park transform at the end of the control loop.
+   *
+   * \par Block functions
+   * The block functions process several motors with one call.
+   * Each argument is an array with one value per motor.
+   */
+
+  /**
+   * @brief  Floating-point Field Oriented Control transform.
+   * @param[in]  Ia       input three-phase coordinate <code>a</code>
+   * @param[in]  Ib       input three-phase coordinate <code>b</code>
+   * @param[in]  theta    rotor angle in degrees
+   * @param[out] pId      points to output rotor reference frame d
+   * @param[out] pIq      points to output rotor reference frame q
+   * @param[out] pSinVal  points to the sine of the rotor angle
+   * @param[out] pCosVal  points to the cosine of the rotor angle
+   */
+  void arm_foc_transform_f32(
+        float32_t Ia,
+        float32_t Ib,
+        float32_t theta,
+        float32_t * pId,
+        float32_t * pIq,
+        float32_t * pSinVal,
+        float32_t * pCosVal);
+
+  /**
+   * @brief  Q31 Field Oriented Control transform.
+   * @param[in]  Ia       input three-phase coordinate <code>a</code>
+   * @param[in]  Ib       input three-phase coordinate <code>b</code>
+   * @param[in]  theta    scaled rotor angle. [-1 0.9999] is mapped to [-180 +180] degrees
+   * @param[out] pId      points to output rotor reference frame d
+   * @param[out] pIq      points to output rotor reference frame q
+   * @param[out] pSinVal  points to the sine of the rotor angle
+   * @param[out] pCosVal  points to the cosine of the rotor angle
+   */
+  void arm_foc_transform_q31(
+        q31_t Ia,
+        q31_t Ib,
+        q31_t theta,
+        q31_t * pId,
+        q31_t * pIq,
+        q31_t * pSinVal,
+        q31_t * pCosVal);
+
+  /**
+   * @brief  Floating-point Field Oriented Control transform for several motors.
+   * @param[in]  pIa        points to the phase a currents
+   * @param[in]  pIb        points to the phase b currents
+   * @param[in]  pTheta     points to the rotor angles in degrees
+   * @param[out] pId        points to the output d coordinates
+   * @param[out] pIq        points to the output q coordinates
+   * @param[out] pSinVal    points to the sines of the rotor angles
+   * @param[out] pCosVal    points to the cosines of the rotor angles
+   * @param[in]  numMotors  number of motors
+   */
+  void arm_foc_transform_block_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+  const float32_t * pTheta,
+        float32_t * pId,
+        float32_t * pIq,
+        float32_t * pSinVal,
+        float32_t * pCosVal,
+        uint32_t numMotors);
+
+  /**
+   * @brief  Q31 Field Oriented Control transform for several motors.
+   * @param[in]  pIa        points to the phase a currents
+   * @param[in]  pIb        points to the phase b currents
+   * @param[in]  pTheta     points to the scaled rotor angles
+   * @param[out] pId        points to the output d coordinates
+   * @param[out] pIq        points to the output q coordinates
+   * @param[out] pSinVal    points to the sines of the rotor angles
+   * @param[out] pCosVal    points to the cosines of the rotor angles
+   * @param[in]  numMotors  number of motors
+   */
+  void arm_foc_transform_block_q31(
+  const q31_t * pIa,
+  const q31_t * pIb,
+  const q31_t * pTheta,
+        q31_t * pId,
+        q31_t * pIq,
+        q31_t * pSinVal,
+        q31_t * pCosVal,
+        uint32_t numMotors);
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup SVPWM Space Vector PWM
+   *
+   * Computation of the duty cycles of a three-phase inverter from the
+   * voltage vector in the stationary (alpha, beta) reference frame.
+   *
+   * The space vector modulation is implemented with the min-max
+   * injection method. It gives the same duty cycles as the sector based
+   * algorithm without any sector computation and branch.
+   *
+   * \par Algorithm
+   * <pre>
+   *    Va = Valpha
+   *    Vb = -Valpha / 2 + (sqrt(3) / 2) * Vbeta
+   *    Vc = -Valpha / 2 - (sqrt(3) / 2) * Vbeta
+   *    Voff = (max(Va,Vb,Vc) + min(Va,Vb,Vc)) / 2
+   *    Dx = 0.5 + Vx - Voff
+   * </pre>
+   * The voltages are normalized by the DC bus voltage.
+   * The modulation is linear as long as the norm of the voltage vector
+   * is lower than <code>1/sqrt(3)</code>.
+   * Beyond, the duty cycles are clamped to [0 1].
+   *
+   * The functions process several motors with one call.
+   * Each argument is an array with one value per motor.
+   */
+
+  /**
+   * @brief  Floating-point space vector PWM.
+   * @param[in]  pValpha    points to the alpha coordinates of the voltage vectors
+   * @param[in]  pVbeta     points to the beta coordinates of the voltage vectors
+   * @param[out] pDa        points to the duty cycles of phase a
+   * @param[out] pDb        points to the duty cycles of phase b
+   * @param[out] pDc        points to the duty cycles of phase c
+   * @param[in]  numMotors  number of motors
+   */
+  void arm_svpwm_f32(
+  const float32_t * pValpha,
+  const float32_t * pVbeta,
+        float32_t * pDa,
+        float32_t * pDb,
+        float32_t * pDc,
+        uint32_t numMotors);
+
+  /**
+   * @brief  Q31 space vector PWM.
+   * @param[in]  pValpha    points to the alpha coordinates of the voltage vectors
+   * @param[in]  pVbeta     points to the beta coordinates of the voltage vectors
+   * @param[out] pDa        points to the duty cycles of phase a
+   * @param[out] pDb        points to the duty cycles of phase b
+   * @param[out] pDc        points to the duty cycles of phase c
+   * @param[in]  numMotors  number of motors
+   */
+  void arm_svpwm_q31(
+  const q31_t * pValpha,
+  const q31_t * pVbeta,
+        q31_t * pDa,
+        q31_t * pDb,
+        q31_t * pDc,
+        uint32_t numMotors);
+
 
 
   
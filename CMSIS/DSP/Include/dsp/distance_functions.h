@@ -178,6 +178,116 @@ float32_t arm_jensenshannon_distance_f32(const float32_t *pA,const float32_t *pB
 
 float32_t arm_minkowski_distance_f32(const float32_t *pA,const float32_t *pB, int32_t order, uint32_t blockSize);
 
+/**
+ * @brief Metrics of the distance matrix functions
+ */
+typedef enum
+{
+  ARM_CDIST_EUCLIDEAN = 0,   /**< Euclidean distance */
+  ARM_CDIST_SQEUCLIDEAN = 1, /**< Squared Euclidean distance */
+  ARM_CDIST_COSINE = 2       /**< Cosine distance */
+} arm_cdist_metric;
+
+/**
+ * @brief Instance structure for the floating-point distance matrix.
+ */
+typedef struct
+{
+  arm_cdist_metric metric;    /**< Metric of the distances */
+  uint32_t numVectors;        /**< Number of reference vectors */
+  uint32_t vecDim;            /**< Dimension of the vectors */
+  const float32_t *pVectors;  /**< Reference vectors (numVectors rows of vecDim samples) */
+  float32_t *pNorms;          /**< Squared norms of the reference vectors (numVectors samples) */
+} arm_cdist_instance_f32;
+
+/**
+ * @brief        Initialization function for the floating-point distance matrix
+ * @param[out]   S           Instance
+ * @param[in]    metric      Metric of the distances
+ * @param[in]    pVectors    Reference vectors (numVectors rows of vecDim samples)
+ * @param[in]    numVectors  Number of reference vectors
+ * @param[in]    vecDim      Dimension of the vectors
+ * @param[out]   pNorms      Buffer of numVectors samples for the squared norms
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unknown metric
+ *
+ */
+arm_status arm_cdist_init_f32(arm_cdist_instance_f32 *S,
+  arm_cdist_metric metric,
+  const float32_t *pVectors,
+  uint32_t numVectors,
+  uint32_t vecDim,
+  float32_t *pNorms);
+
+/**
+ * @brief        Distances between query vectors and the reference vectors
+ * @param[in]    S           Instance
+ * @param[in]    pQueries    Query vectors (numQueries rows of vecDim samples)
+ * @param[in]    numQueries  Number of query vectors
+ * @param[out]   pDst        Distances (numQueries rows of numVectors samples)
+ *
+ */
+void arm_cdist_f32(const arm_cdist_instance_f32 *S,
+  const float32_t *pQueries,
+  uint32_t numQueries,
+  float32_t *pDst);
+
+/**
+ * @brief        k nearest reference vectors of a query vector
+ * @param[in]    S           Instance
+ * @param[in]    pQuery      Query vector
+ * @param[in]    k           Number of neighbours
+ * @param[out]   pScratch    Buffer of numVectors samples
+ * @param[out]   pDist       Distances of the k nearest vectors in increasing order
+ * @param[out]   pIndex      Indices of the k nearest vectors
+ *
+ */
+void arm_knn_f32(const arm_cdist_instance_f32 *S,
+  const float32_t *pQuery,
+  uint32_t k,
+  float32_t *pScratch,
+  float32_t *pDist,
+  uint32_t *pIndex);
+
+/**
+ * @brief        Dynamic time warping distance between two vectors
+ * @param[in]    pSrcA       First sequence
+ * @param[in]    lenA        Length of the first sequence
+ * @param[in]    pSrcB       Second sequence
+ * @param[in]    lenB        Length of the second sequence
+ * @param[in]    window      Half-width of the Sakoe-Chiba band
+ * @param[in]    threshold   Early abandon threshold
+ * @param[out]   pScratch    Buffer of 2 * (min(lenA,lenB) + 1) samples
+ * @return distance or F32_MAX when the computation has been abandoned
+ *
+ */
+float32_t arm_dtw_distance_f32(const float32_t *pSrcA,
+  uint32_t lenA,
+  const float32_t *pSrcB,
+  uint32_t lenB,
+  uint32_t window,
+  float32_t threshold,
+  float32_t *pScratch);
+
+/**
+ * @brief        Dynamic time warping distance between two q7 vectors
+ * @param[in]    pSrcA       First sequence
+ * @param[in]    lenA        Length of the first sequence
+ * @param[in]    pSrcB       Second sequence
+ * @param[in]    lenB        Length of the second sequence
+ * @param[in]    window      Half-width of the Sakoe-Chiba band
+ * @param[in]    threshold   Early abandon threshold
+ * @param[out]   pScratch    Buffer of 2 * (min(lenA,lenB) + 1) samples
+ * @return distance or Q31_MAX when the computation has been abandoned
+ *
+ */
+q31_t arm_dtw_distance_q7(const q7_t *pSrcA,
+  uint32_t lenA,
+  const q7_t *pSrcB,
+  uint32_t lenB,
+  uint32_t window,
+  q31_t threshold,
+  q31_t *pScratch);
+
 /**
  * @brief        Dice distance between two vectors
  *
@@ -216,6 +326,82 @@ float32_t arm_hamming_distance(const uint32_t *pA, const uint32_t *pB, uint32_t
 
 float32_t arm_jaccard_distance(const uint32_t *pA, const uint32_t *pB, uint32_t numberOfBools);
 
+/**
+ * @brief        Hamming distances between a vector and a batch of vectors
+ *
+ * @param[in]    pA              Vector of packed booleans
+ * @param[in]    pB              numVectors vectors of packed booleans
+ * @param[in]    numVectors      Number of vectors in pB
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[out]   pDst            numVectors distances
+ *
+ */
+
+void arm_hamming_distance_batch(const uint32_t *pA,
+  const uint32_t *pB,
+  uint32_t numVectors,
+  uint32_t numberOfBools,
+  float32_t *pDst);
+
+/**
+ * @brief        Jaccard distances between a vector and a batch of vectors
+ *
+ * @param[in]    pA              Vector of packed booleans
+ * @param[in]    pB              numVectors vectors of packed booleans
+ * @param[in]    numVectors      Number of vectors in pB
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[out]   pDst            numVectors distances
+ *
+ */
+
+void arm_jaccard_distance_batch(const uint32_t *pA,
+  const uint32_t *pB,
+  uint32_t numVectors,
+  uint32_t numberOfBools,
+  float32_t *pDst);
+
+/**
+ * @brief        k nearest vectors of a batch for the Hamming distance
+ *
+ * @param[in]    pA              Vector of packed booleans
+ * @param[in]    pB              numVectors vectors of packed booleans
+ * @param[in]    numVectors      Number of vectors in pB
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[in]    k               Number of neighbours
+ * @param[out]   pDist           Distances of the k nearest vectors in increasing order
+ * @param[out]   pIndex          Indices of the k nearest vectors
+ *
+ */
+
+void arm_hamming_topk(const uint32_t *pA,
+  const uint32_t *pB,
+  uint32_t numVectors,
+  uint32_t numberOfBools,
+  uint32_t k,
+  float32_t *pDist,
+  uint32_t *pIndex);
+
+/**
+ * @brief        k nearest vectors of a batch for the Jaccard distance
+ *
+ * @param[in]    pA              Vector of packed booleans
+ * @param[in]    pB              numVectors vectors of packed booleans
+ * @param[in]    numVectors      Number of vectors in pB
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[in]    k               Number of neighbours
+ * @param[out]   pDist           Distances of the k nearest vectors in increasing order
+ * @param[out]   pIndex          Indices of the k nearest vectors
+ *
+ */
+
+void arm_jaccard_topk(const uint32_t *pA,
+  const uint32_t *pB,
+  uint32_t numVectors,
+  uint32_t numberOfBools,
+  uint32_t k,
+  float32_t *pDist,
+  uint32_t *pIndex);
+
 /**
  * @brief        Kulsinski distance between two vectors
  *
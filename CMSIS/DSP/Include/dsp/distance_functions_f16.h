@@ -43,6 +43,7 @@ __attribute__((weak)) float __powisf2(float a, int b);
 #include "dsp/basic_math_functions_f16.h"
 
 #include "dsp/fast_math_functions_f16.h"
+#include "dsp/distance_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -172,6 +173,50 @@ float16_t arm_jensenshannon_distance_f16(const float16_t *pA,const float16_t *pB
 float16_t arm_minkowski_distance_f16(const float16_t *pA,const float16_t *pB, int32_t order, uint32_t blockSize);
 
 
+/**
+ * @brief Instance structure for the half-precision distance matrix.
+ */
+typedef struct
+{
+  arm_cdist_metric metric;    /**< Metric of the distances */
+  uint32_t numVectors;        /**< Number of reference vectors */
+  uint32_t vecDim;            /**< Dimension of the vectors */
+  const float16_t *pVectors;  /**< Reference vectors (numVectors rows of vecDim samples) */
+  float16_t *pNorms;          /**< Squared norms of the reference vectors (numVectors samples) */
+} arm_cdist_instance_f16;
+
+/**
+ * @brief        Initialization function for the half-precision distance matrix
+ * @param[out]   S           Instance
+ * @param[in]    metric      Metric of the distances
+ * @param[in]    pVectors    Reference vectors (numVectors rows of vecDim samples)
+ * @param[in]    numVectors  Number of reference vectors
+ * @param[in]    vecDim      Dimension of the vectors
+ * @param[out]   pNorms      Buffer of numVectors samples for the squared norms
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unknown metric
+ *
+ */
+arm_status arm_cdist_init_f16(arm_cdist_instance_f16 *S,
+  arm_cdist_metric metric,
+  const float16_t *pVectors,
+  uint32_t numVectors,
+  uint32_t vecDim,
+  float16_t *pNorms);
+
+/**
+ * @brief        Distances between query vectors and the reference vectors
+ * @param[in]    S           Instance
+ * @param[in]    pQueries    Query vectors (numQueries rows of vecDim samples)
+ * @param[in]    numQueries  Number of query vectors
+ * @param[out]   pDst        Distances (numQueries rows of numVectors samples)
+ *
+ */
+void arm_cdist_f16(const arm_cdist_instance_f16 *S,
+  const float16_t *pQueries,
+  uint32_t numQueries,
+  float16_t *pDst);
+
+
 #endif /*defined(ARM_FLOAT16_SUPPORTED)*/
 #ifdef   __cplusplus
 }
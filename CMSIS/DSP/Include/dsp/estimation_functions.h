@@ -0,0 +1,188 @@
+/******************************************************************************
+ * @file     estimation_functions.h
+ * @brief    Public header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _ESTIMATION_FUNCTIONS_H_
+#define _ESTIMATION_FUNCTIONS_H_
+
+#include "arm_math_types.h"
+#include "arm_math_memory.h"
+
+#include "dsp/none.h"
+#include "dsp/utils.h"
+
+#include "dsp/basic_math_functions.h"
+#include "dsp/matrix_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @defgroup groupEstimation Estimation Functions
+ * Recursive state and parameter estimators built on the matrix functions.
+ * All the temporary matrices are in a workspace provided by the application
+ * at initialization.
+ */
+
+/**
+ * @brief Size in samples of the workspace of the floating-point Kalman filter.
+ * @param[in] NBSTATES  dimension of the state vector
+ * @param[in] NBMEAS    dimension of the measurement vector
+ */
+#define ARM_KALMAN_WORKSPACE_SIZE_F32(NBSTATES,NBMEAS) \
+  (2*(NBSTATES)*(NBSTATES) + (NBSTATES)*(NBMEAS) + 3*(NBSTATES) + (NBMEAS))
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+          uint16_t numStates;               /**< dimension of the state vector. */
+          uint16_t numMeas;                 /**< dimension of the measurement vector. */
+          float32_t *pState;                /**< points to the state estimate. The array is of length numStates. */
+          float32_t *pSqrtCov;              /**< points to the lower triangular Cholesky factor of the state covariance. The array is of length numStates*numStates. */
+    const float32_t *pTrans;                /**< points to the state transition matrix. The array is of length numStates*numStates. */
+    const float32_t *pObs;                  /**< points to the observation matrix. The array is of length numMeas*numStates. */
+    const float32_t *pSqrtProcessNoise;     /**< points to a square root G of the process noise covariance Q = G G^t. The array is of length numStates*numStates. */
+    const float32_t *pSqrtMeasNoise;        /**< points to the lower triangular Cholesky factor of the measurement noise covariance. The array is of length numMeas*numMeas. */
+          float32_t *pWork;                 /**< points to the workspace. The array is of length ARM_KALMAN_WORKSPACE_SIZE_F32(numStates,numMeas). */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief Initialization function for the floating-point Kalman filter.
+   * @param[in,out] S                  points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     numStates          dimension of the state vector.
+   * @param[in]     numMeas            dimension of the measurement vector.
+   * @param[in]     pState             points to the state buffer. It contains the initial state estimate.
+   * @param[out]    pSqrtCov           points to the buffer for the Cholesky factor of the state covariance.
+   * @param[in]     pInitCov           points to the initial state covariance.
+   * @param[in]     pTrans             points to the state transition matrix.
+   * @param[in]     pObs               points to the observation matrix.
+   * @param[in]     pSqrtProcessNoise  points to a square root of the process noise covariance.
+   * @param[in]     pSqrtMeasNoise     points to the Cholesky factor of the measurement noise covariance.
+   * @param[in]     pWork              points to the workspace.
+   * @return        execution status
+   *                 - \ref ARM_MATH_SUCCESS                : Operation successful
+   *                 - \ref ARM_MATH_SINGULAR               : Measurement noise covariance is singular
+   *                 - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Initial covariance is not positive definite
+   */
+  arm_status arm_kalman_init_f32(
+        arm_kalman_instance_f32 * S,
+        uint16_t numStates,
+        uint16_t numMeas,
+        float32_t * pState,
+        float32_t * pSqrtCov,
+  const float32_t * pInitCov,
+  const float32_t * pTrans,
+  const float32_t * pObs,
+  const float32_t * pSqrtProcessNoise,
+  const float32_t * pSqrtMeasNoise,
+        float32_t * pWork);
+
+  /**
+   * @brief Prediction step of the floating-point Kalman filter.
+   * @param[in,out] S  points to an instance of the floating-point Kalman filter structure.
+   * @return        execution status
+   *                 - \ref ARM_MATH_SUCCESS                : Operation successful
+   */
+  arm_status arm_kalman_predict_f32(
+        arm_kalman_instance_f32 * S);
+
+  /**
+   * @brief Update step of the floating-point Kalman filter.
+   * @param[in,out] S             points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pMeasurement  points to the measurement vector.
+   * @return        execution status
+   *                 - \ref ARM_MATH_SUCCESS                : Operation successful
+   */
+  arm_status arm_kalman_update_f32(
+        arm_kalman_instance_f32 * S,
+  const float32_t * pMeasurement);
+
+  /**
+   * @brief Prediction and update steps of the floating-point Kalman filter.
+   * @param[in,out] S             points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pMeasurement  points to the measurement vector.
+   * @return        execution status
+   *                 - \ref ARM_MATH_SUCCESS                : Operation successful
+   */
+  arm_status arm_kalman_f32(
+        arm_kalman_instance_f32 * S,
+  const float32_t * pMeasurement);
+
+
+  /**
+   * @brief Instance structure for the floating-point recursive least squares estimator.
+   */
+  typedef struct
+  {
+          uint16_t numParams;   /**< number of estimated parameters. */
+          float32_t lambda;     /**< forgetting factor. */
+          float32_t *pParams;   /**< points to the parameter estimate. The array is of length numParams. */
+          float32_t *pInvCorr;  /**< points to the inverse correlation matrix. The array is of length numParams*numParams. */
+          float32_t *pWork;     /**< points to the workspace. The array is of length numParams. */
+  } arm_rls_instance_f32;
+
+  /**
+   * @brief Initialization function for the floating-point recursive least squares estimator.
+   * @param[in,out] S          points to an instance of the floating-point RLS structure.
+   * @param[in]     numParams  number of estimated parameters.
+   * @param[in]     lambda     forgetting factor (0 < lambda <= 1).
+   * @param[in]     delta      initial value of the diagonal of the inverse correlation matrix.
+   * @param[in]     pParams    points to the parameter buffer. It contains the initial estimate.
+   * @param[out]    pInvCorr   points to the inverse correlation matrix buffer.
+   * @param[in]     pWork      points to the workspace.
+   */
+  void arm_rls_init_f32(
+        arm_rls_instance_f32 * S,
+        uint16_t numParams,
+        float32_t lambda,
+        float32_t delta,
+        float32_t * pParams,
+        float32_t * pInvCorr,
+        float32_t * pWork);
+
+  /**
+   * @brief Processing function for the floating-point recursive least squares estimator.
+   * @param[in,out] S            points to an instance of the floating-point RLS structure.
+   * @param[in]     pRegressors  points to the regressor vectors. One row of numParams samples per step.
+   * @param[in]     pDesired     points to the desired outputs. One sample per step.
+   * @param[out]    pErr         points to the a priori errors. One sample per step.
+   * @param[in]     blockSize    number of steps to process.
+   */
+  void arm_rls_f32(
+  const arm_rls_instance_f32 * S,
+  const float32_t * pRegressors,
+  const float32_t * pDesired,
+        float32_t * pErr,
+        uint32_t blockSize);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _ESTIMATION_FUNCTIONS_H_ */
@@ -96,6 +96,34 @@ extern "C"
   q15_t arm_sin_q15(
   q15_t x);
 
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for a floating-point vector.
+   * @param[in]  pSrc       points to the input vector of angles in radians.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none
+   */
+  void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the sine and cosine of a floating-point vector.
+   * @param[in]  pSrc       points to the input vector of angles in radians.
+   * @param[out] pSinDst    points to the output vector of sines.
+   * @param[out] pCosDst    points to the output vector of cosines.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none
+   */
+  void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pSinDst,
+        float32_t * pCosDst,
+        uint32_t blockSize);
+
 /**
   @} end of sin group
  */
@@ -131,6 +159,19 @@ extern "C"
   q15_t arm_cos_q15(
   q15_t x);
 
+
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for a floating-point vector.
+   * @param[in]  pSrc       points to the input vector of angles in radians.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none
+   */
+  void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
 /**
   @} end of cos group
  */
@@ -160,6 +201,110 @@ extern "C"
         float32_t * pDst,
         uint32_t blockSize);
 
+/**
+  @brief         Floating-point vector of base 2 exponential values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vexp2_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of base 2 logarithm values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vlog2_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of hyperbolic tangent values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vtanh_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of sigmoid values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vsigmoid_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of power values.
+  @param[in]     pSrcA      points to the vector of bases
+  @param[in]     pSrcB      points to the vector of exponents
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vpow_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Q31 vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector of angles in Q2.29
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_atan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Q15 vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector of angles in Q2.13
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_atan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+        q15_t * pDst,
+        uint32_t blockSize);
+
  /**
    * @defgroup SQRT Square Root
    *
@@ -258,23 +403,42 @@ arm_status arm_sqrt_q15(
    * @param[in]  pIn   input vector.
    * @param[out] pOut  vector of square roots of input elements.
    * @param[in]  len   length of input vector.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @return none
+   *
+   * Negative input values give a zero output.
    */
   void arm_vsqrt_f32(
-  float32_t * pIn,
-  float32_t * pOut,
-  uint16_t len);
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint16_t len);
 
+  /**
+   * @brief  Vector Q31 square root function.
+   * @param[in]  pIn   input vector in the range [0 +1).
+   * @param[out] pOut  vector of square roots of input elements.
+   * @param[in]  len   length of input vector.
+   * @return none
+   *
+   * Negative input values give a zero output.
+   */
   void arm_vsqrt_q31(
-  q31_t * pIn,
-  q31_t * pOut,
-  uint16_t len);
+  const q31_t * pIn,
+        q31_t * pOut,
+        uint16_t len);
 
+  /**
+   * @brief  Vector Q15 square root function.
+   * @param[in]  pIn   input vector in the range [0 +1).
+   * @param[out] pOut  vector of square roots of input elements.
+   * @param[in]  len   length of input vector.
+   * @return none
+   *
+   * Negative input values give a zero output.
+   */
   void arm_vsqrt_q15(
-  q15_t * pIn,
-  q15_t * pOut,
-  uint16_t len);
+  const q15_t * pIn,
+        q15_t * pOut,
+        uint16_t len);
 
   /**
    * @} end of SQRT group
@@ -108,6 +108,58 @@ __STATIC_FORCEINLINE arm_status arm_sqrt_f16(
         float16_t * pDst,
         uint32_t blockSize);
 
+/**
+  @brief         Floating-point vector of hyperbolic tangent values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vtanh_f16(
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of sigmoid values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vsigmoid_f16(
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of power values.
+  @param[in]     pSrcA      points to the vector of bases
+  @param[in]     pSrcB      points to the vector of exponents
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_vpow_f16(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        float16_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @brief         Floating-point vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+  void arm_atan2_f16(
+  const float16_t * pSrcY,
+  const float16_t * pSrcX,
+        float16_t * pDst,
+        uint32_t blockSize);
+
 #endif /*defined(ARM_FLOAT16_SUPPORTED)*/
 #ifdef   __cplusplus
 }
@@ -33,6 +33,8 @@
 #include "dsp/none.h"
 #include "dsp/utils.h"
 
+#include "dsp/basic_math_functions.h"
+
 #ifdef   __cplusplus
 extern "C"
 {
@@ -107,6 +109,17 @@ extern "C"
  * undefining this macro size checking is eliminated and the functions
  * run a bit faster. With size checking disabled the functions always
  * return <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par Matrices with 32-bit dimensions
+ * The dimensions of the matrix structures are 16-bit. For bigger matrices,
+ * the types <code>arm_matrix_instance_f32_ext</code>,
+ * <code>arm_matrix_instance_q31_ext</code> and <code>arm_matrix_instance_q15_ext</code>
+ * have 32-bit dimensions. They are supported by a subset of the matrix
+ * functions (initialization, addition, transpose, matrix vector and matrix
+ * matrix multiplications) with the <code>_ext</code> suffix before the type.
+ * The numbers of samples and the offsets in the matrices are computed with
+ * <code>size_t</code>, so a matrix can have more than 2^32 samples on a
+ * 64-bit host.
  */
 
   /**
@@ -159,6 +172,92 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the floating-point sparse matrix structure.
+   *
+   * The matrix is stored in compressed sparse row (CSR) format. The non zero
+   * values of row i are <code>pData[pRowPtr[i]]</code> to
+   * <code>pData[pRowPtr[i+1]-1]</code> and their column indexes are in
+   * <code>pColIdx</code> at the same positions.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t *pRowPtr;    /**< points to the row offsets (numRows + 1 values). */
+    uint16_t *pColIdx;    /**< points to the column indexes of the non zero values. */
+    float32_t *pData;     /**< points to the non zero values of the matrix. */
+  } arm_spmat_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 sparse matrix structure (CSR format).
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t *pRowPtr;    /**< points to the row offsets (numRows + 1 values). */
+    uint16_t *pColIdx;    /**< points to the column indexes of the non zero values. */
+    q15_t *pData;         /**< points to the non zero values of the matrix. */
+  } arm_spmat_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse matrix structure (CSR format).
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t *pRowPtr;    /**< points to the row offsets (numRows + 1 values). */
+    uint16_t *pColIdx;    /**< points to the column indexes of the non zero values. */
+    q7_t *pData;          /**< points to the non zero values of the matrix. */
+  } arm_spmat_instance_q7;
+
+  /**
+   * @brief Size of the square tiles used by the transposition of the matrices with 32-bit dimensions.
+   */
+#define ARM_MAT_TRANS_EXT_TILE 16U
+
+  /**
+   * @brief Maximum number of samples given to one call of the basic math functions by the additions of the matrices with 32-bit dimensions.
+   */
+#define ARM_MAT_ADD_EXT_BLOCK 0x40000000U
+
+  /**
+   * @brief Number of output columns accumulated together by the Q31 multiplication of the matrices with 32-bit dimensions.
+   */
+#define ARM_MAT_MULT_EXT_BLOCK 32U
+
+  /**
+   * @brief Instance structure for the floating-point matrix structure with 32-bit dimensions.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    float32_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_instance_f32_ext;
+
+  /**
+   * @brief Instance structure for the Q31 matrix structure with 32-bit dimensions.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    q31_t *pData;         /**< points to the data of the matrix. */
+  } arm_matrix_instance_q31_ext;
+
+  /**
+   * @brief Instance structure for the Q15 matrix structure with 32-bit dimensions.
+   */
+  typedef struct
+  {
+    uint32_t numRows;     /**< number of rows of the matrix.     */
+    uint32_t numCols;     /**< number of columns of the matrix.  */
+    q15_t *pData;         /**< points to the data of the matrix. */
+  } arm_matrix_instance_q15_ext;
+
   /**
    * @brief Floating-point matrix addition.
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -735,6 +834,355 @@ void arm_mat_init_f32(
   arm_matrix_instance_f64 * d,
   uint16_t * pp);
 
+  /**
+   * @brief Floating-point eigen decomposition of a symmetric matrix.
+   * @param[in]  pSrc       points to the instance of the input symmetric matrix structure.
+   * @param[out] pEigVec    points to the instance of the output eigenvector matrix structure.
+   * @param[out] pEigVal    points to the output eigenvalues (sorted by decreasing value).
+   * @param[in]  pScratch   points to a working buffer of numRows * numRows samples.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the Jacobi iterations do not converge, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_eig_sym_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pEigVec,
+  float32_t * pEigVal,
+  float32_t * pScratch);
+
+  /**
+   * @brief Floating-point singular value decomposition.
+   * @param[in]  pSrc       points to the instance of the input M x N matrix structure (M >= N).
+   * @param[out] pU         points to the instance of the output M x N matrix structure.
+   * @param[out] pS         points to the output singular values (sorted by decreasing value).
+   * @param[out] pV         points to the instance of the output N x N matrix structure.
+   * @param[in]  pScratch   points to a working buffer of M * N samples.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the Jacobi iterations do not converge, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_svd_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pU,
+  float32_t * pS,
+  arm_matrix_instance_f32 * pV,
+  float32_t * pScratch);
+
+  /**
+   * @brief Floating-point conversion of a dense matrix to a sparse matrix.
+   * @param[in]     pSrc          points to the instance of the input dense matrix structure.
+   * @param[in,out] pDst          points to the instance of the output sparse matrix structure.
+   *                              The row offsets, column indexes and values buffers must be allocated.
+   * @param[in]     maxNonZeros   size of the column indexes and values buffers.
+   * @return The function returns ARM_MATH_LENGTH_ERROR, if there are more than maxNonZeros non zero values.
+   */
+  arm_status arm_spmat_from_mat_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_spmat_instance_f32 * pDst,
+  uint32_t maxNonZeros);
+
+  /**
+   * @brief Q15 conversion of a dense matrix to a sparse matrix.
+   * @param[in]     pSrc          points to the instance of the input dense matrix structure.
+   * @param[in,out] pDst          points to the instance of the output sparse matrix structure.
+   *                              The row offsets, column indexes and values buffers must be allocated.
+   * @param[in]     maxNonZeros   size of the column indexes and values buffers.
+   * @return The function returns ARM_MATH_LENGTH_ERROR, if there are more than maxNonZeros non zero values.
+   */
+  arm_status arm_spmat_from_mat_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  arm_spmat_instance_q15 * pDst,
+  uint32_t maxNonZeros);
+
+  /**
+   * @brief Q7 conversion of a dense matrix to a sparse matrix.
+   * @param[in]     pSrc          points to the instance of the input dense matrix structure.
+   * @param[in,out] pDst          points to the instance of the output sparse matrix structure.
+   *                              The row offsets, column indexes and values buffers must be allocated.
+   * @param[in]     maxNonZeros   size of the column indexes and values buffers.
+   * @return The function returns ARM_MATH_LENGTH_ERROR, if there are more than maxNonZeros non zero values.
+   */
+  arm_status arm_spmat_from_mat_q7(
+  const arm_matrix_instance_q7 * pSrc,
+  arm_spmat_instance_q7 * pDst,
+  uint32_t maxNonZeros);
+
+  /**
+   * @brief Floating-point sparse matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input sparse matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_spmat_vec_mult_f32(
+  const arm_spmat_instance_f32 *pSrcMat, 
+  const float32_t *pVec, 
+  float32_t *pDst);
+
+  /**
+   * @brief Q15 sparse matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input sparse matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_spmat_vec_mult_q15(
+  const arm_spmat_instance_q15 *pSrcMat, 
+  const q15_t *pVec, 
+  q15_t *pDst);
+
+  /**
+   * @brief Q7 sparse matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input sparse matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_spmat_vec_mult_q7(
+  const arm_spmat_instance_q7 *pSrcMat, 
+  const q7_t *pVec, 
+  q7_t *pDst);
+
+  /**
+   * @brief Floating-point sparse matrix and dense matrix multiplication.
+   * @param[in]  pSrcA  points to the first input sparse matrix structure
+   * @param[in]  pSrcB  points to the second input dense matrix structure
+   * @param[out] pDst   points to output dense matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_spmat_mult_dense_f32(
+  const arm_spmat_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point batched matrix multiplication.
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcB   points to the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  count   number of matrices in the batch
+   * @param[in]  stride  distance in samples between two elements of a matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_batch_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride);
+
+  /**
+   * @brief Floating-point batched matrix inverse.
+   * @param[in]  pSrc    points to the input matrix structure (modified by the function)
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  count   number of matrices in the batch
+   * @param[in]  stride  distance in samples between two elements of a matrix
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If one of the input matrices is singular, then the function returns ARM_MATH_SINGULAR.
+   */
+arm_status arm_mat_inverse_batch_f32(
+        arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride);
+
+  /**
+   * @brief Floating-point batched Cholesky decomposition of Symmetric Positive Definite Matrices.
+   * @param[in]  pSrc    points to the input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  count   number of matrices in the batch
+   * @param[in]  stride  distance in samples between two elements of a matrix
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If one of the input matrices does not have a decomposition, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+arm_status arm_mat_cholesky_batch_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride);
+
+  /**
+   * @brief  Floating-point matrix initialization with 32-bit dimensions.
+   * @param[in,out] S         points to an instance of the floating-point matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_ext_f32(
+        arm_matrix_instance_f32_ext * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        float32_t * pData);
+
+  /**
+   * @brief Floating-point matrix addition with 32-bit dimensions.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_ext_f32(
+  const arm_matrix_instance_f32_ext * pSrcA,
+  const arm_matrix_instance_f32_ext * pSrcB,
+        arm_matrix_instance_f32_ext * pDst);
+
+  /**
+   * @brief Floating-point matrix transpose with 32-bit dimensions.
+   * @param[in]  pSrc  points to the input matrix
+   * @param[out] pDst  points to the output matrix
+   * @return    The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_ext_f32(
+  const arm_matrix_instance_f32_ext * pSrc,
+        arm_matrix_instance_f32_ext * pDst);
+
+  /**
+   * @brief Floating-point matrix and vector multiplication with 32-bit dimensions.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_mat_vec_mult_ext_f32(
+  const arm_matrix_instance_f32_ext *pSrcMat, 
+  const float32_t *pVec, 
+  float32_t *pDst);
+
+  /**
+   * @brief Floating-point matrix multiplication with 32-bit dimensions.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_ext_f32(
+  const arm_matrix_instance_f32_ext * pSrcA,
+  const arm_matrix_instance_f32_ext * pSrcB,
+        arm_matrix_instance_f32_ext * pDst);
+
+  /**
+   * @brief  Q31 matrix initialization with 32-bit dimensions.
+   * @param[in,out] S         points to an instance of the Q31 matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_ext_q31(
+        arm_matrix_instance_q31_ext * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        q31_t * pData);
+
+  /**
+   * @brief Q31 matrix addition with 32-bit dimensions.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_ext_q31(
+  const arm_matrix_instance_q31_ext * pSrcA,
+  const arm_matrix_instance_q31_ext * pSrcB,
+        arm_matrix_instance_q31_ext * pDst);
+
+  /**
+   * @brief Q31 matrix transpose with 32-bit dimensions.
+   * @param[in]  pSrc  points to the input matrix
+   * @param[out] pDst  points to the output matrix
+   * @return    The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_ext_q31(
+  const arm_matrix_instance_q31_ext * pSrc,
+        arm_matrix_instance_q31_ext * pDst);
+
+  /**
+   * @brief Q31 matrix and vector multiplication with 32-bit dimensions.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_mat_vec_mult_ext_q31(
+  const arm_matrix_instance_q31_ext *pSrcMat, 
+  const q31_t *pVec, 
+  q31_t *pDst);
+
+  /**
+   * @brief Q31 matrix multiplication with 32-bit dimensions.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_ext_q31(
+  const arm_matrix_instance_q31_ext * pSrcA,
+  const arm_matrix_instance_q31_ext * pSrcB,
+        arm_matrix_instance_q31_ext * pDst);
+
+  /**
+   * @brief  Q15 matrix initialization with 32-bit dimensions.
+   * @param[in,out] S         points to an instance of the Q15 matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+void arm_mat_init_ext_q15(
+        arm_matrix_instance_q15_ext * S,
+        uint32_t nRows,
+        uint32_t nColumns,
+        q15_t * pData);
+
+  /**
+   * @brief Q15 matrix addition with 32-bit dimensions.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_add_ext_q15(
+  const arm_matrix_instance_q15_ext * pSrcA,
+  const arm_matrix_instance_q15_ext * pSrcB,
+        arm_matrix_instance_q15_ext * pDst);
+
+  /**
+   * @brief Q15 matrix transpose with 32-bit dimensions.
+   * @param[in]  pSrc  points to the input matrix
+   * @param[out] pDst  points to the output matrix
+   * @return    The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_ext_q15(
+  const arm_matrix_instance_q15_ext * pSrc,
+        arm_matrix_instance_q15_ext * pDst);
+
+  /**
+   * @brief Q15 matrix and vector multiplication with 32-bit dimensions.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to vector
+   * @param[out] pDst     points to output vector
+   */
+void arm_mat_vec_mult_ext_q15(
+  const arm_matrix_instance_q15_ext *pSrcMat, 
+  const q15_t *pVec, 
+  q15_t *pDst);
+
+  /**
+   * @brief Q15 matrix multiplication with 32-bit dimensions.
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcB   points to the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  pState  points to the array for storing intermediate results
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_ext_q15(
+  const arm_matrix_instance_q15_ext * pSrcA,
+  const arm_matrix_instance_q15_ext * pSrcB,
+        arm_matrix_instance_q15_ext * pDst,
+        q15_t * pState);
+
 #ifdef   __cplusplus
 }
 #endif
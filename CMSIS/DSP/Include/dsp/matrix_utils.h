@@ -0,0 +1,374 @@
+/******************************************************************************
+ * @file     matrix_utils.h
+ * @brief    Fixed size kernels for small matrices
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _MATRIX_UTILS_H_
+#define _MATRIX_UTILS_H_
+
+#include "arm_math_types.h"
+#include "arm_math_memory.h"
+
+#include "dsp/none.h"
+#include "dsp/utils.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+
+  Fixed size kernels for square matrices from 2x2 to 6x6.
+
+  For those sizes, the loop setup of the generic matrix functions
+  dominates the execution time. The kernels below have a dimension
+  known at compile time and the dot products are fully unrolled.
+
+  The generic functions arm_mat_mult_f32, arm_mat_trans_f32,
+  arm_mat_vec_mult_f32 and arm_mat_inverse_f32 dispatch to those kernels
+  when all the matrices are square with a dimension between 2 and 6.
+  They can also be called directly when the dimension is known by the
+  application. The output buffer must not overlap the inputs.
+
+*/
+
+/* Dot product of 2 to 6 elements read with strides SX and SY */
+#define ARM_MAT_DOT2(X,SX,Y,SY) ((X)[0] * (Y)[0] + (X)[(SX)] * (Y)[(SY)])
+#define ARM_MAT_DOT3(X,SX,Y,SY) (ARM_MAT_DOT2(X,SX,Y,SY) + (X)[2*(SX)] * (Y)[2*(SY)])
+#define ARM_MAT_DOT4(X,SX,Y,SY) (ARM_MAT_DOT3(X,SX,Y,SY) + (X)[3*(SX)] * (Y)[3*(SY)])
+#define ARM_MAT_DOT5(X,SX,Y,SY) (ARM_MAT_DOT4(X,SX,Y,SY) + (X)[4*(SX)] * (Y)[4*(SY)])
+#define ARM_MAT_DOT6(X,SX,Y,SY) (ARM_MAT_DOT5(X,SX,Y,SY) + (X)[5*(SX)] * (Y)[5*(SY)])
+
+/* Smallest and biggest dimension for the fixed size kernels */
+#define ARM_MAT_SMALL_MIN_DIM 2U
+#define ARM_MAT_SMALL_MAX_DIM 6U
+
+/*
+
+  Define the multiplication, transposition and matrix vector multiplication
+  of N x N floating-point matrices.
+
+*/
+#define ARM_MAT_SMALL_KERNELS_F32(N)                                            \
+__STATIC_FORCEINLINE void arm_mat_mult_##N##x##N##_f32(                         \
+  const float32_t * pA,                                                         \
+  const float32_t * pB,                                                         \
+        float32_t * pC)                                                         \
+{                                                                               \
+  uint32_t i, j;                                                                \
+                                                                                \
+  for (i = 0U; i < N; i++)                                                      \
+  {                                                                             \
+    for (j = 0U; j < N; j++)                                                    \
+    {                                                                           \
+      pC[i * N + j] = ARM_MAT_DOT##N(&pA[i * N], 1, &pB[j], N);                 \
+    }                                                                           \
+  }                                                                             \
+}                                                                               \
+                                                                                \
+__STATIC_FORCEINLINE void arm_mat_trans_##N##x##N##_f32(                        \
+  const float32_t * pA,                                                         \
+        float32_t * pC)                                                         \
+{                                                                               \
+  uint32_t i, j;                                                                \
+                                                                                \
+  for (i = 0U; i < N; i++)                                                      \
+  {                                                                             \
+    for (j = 0U; j < N; j++)                                                    \
+    {                                                                           \
+      pC[j * N + i] = pA[i * N + j];                                            \
+    }                                                                           \
+  }                                                                             \
+}                                                                               \
+                                                                                \
+__STATIC_FORCEINLINE void arm_mat_vec_mult_##N##x##N##_f32(                     \
+  const float32_t * pA,                                                         \
+  const float32_t * pVec,                                                       \
+        float32_t * pDst)                                                       \
+{                                                                               \
+  uint32_t i;                                                                   \
+                                                                                \
+  for (i = 0U; i < N; i++)                                                      \
+  {                                                                             \
+    pDst[i] = ARM_MAT_DOT##N(&pA[i * N], 1, pVec, 1);                           \
+  }                                                                             \
+}
+
+ARM_MAT_SMALL_KERNELS_F32(2)
+ARM_MAT_SMALL_KERNELS_F32(3)
+ARM_MAT_SMALL_KERNELS_F32(4)
+ARM_MAT_SMALL_KERNELS_F32(5)
+ARM_MAT_SMALL_KERNELS_F32(6)
+
+/**
+  @brief         Floating-point 2x2 matrix inverse (closed form).
+  @param[in]     pA    points to the input matrix data
+  @param[out]    pC    points to the output matrix data
+  @return        ARM_MATH_SINGULAR if the determinant is zero, ARM_MATH_SUCCESS otherwise
+ */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_2x2_f32(
+  const float32_t * pA,
+        float32_t * pC)
+{
+  float32_t det, invDet;
+
+  det = pA[0] * pA[3] - pA[1] * pA[2];
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+  invDet = 1.0f / det;
+
+  pC[0] =  pA[3] * invDet;
+  pC[1] = -pA[1] * invDet;
+  pC[2] = -pA[2] * invDet;
+  pC[3] =  pA[0] * invDet;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Floating-point 3x3 matrix inverse (closed form).
+  @param[in]     pA    points to the input matrix data
+  @param[out]    pC    points to the output matrix data
+  @return        ARM_MATH_SINGULAR if the determinant is zero, ARM_MATH_SUCCESS otherwise
+ */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_3x3_f32(
+  const float32_t * pA,
+        float32_t * pC)
+{
+  float32_t c00, c01, c02, det, invDet;
+
+  /* Cofactors of the first row */
+  c00 = pA[4] * pA[8] - pA[5] * pA[7];
+  c01 = pA[5] * pA[6] - pA[3] * pA[8];
+  c02 = pA[3] * pA[7] - pA[4] * pA[6];
+
+  det = pA[0] * c00 + pA[1] * c01 + pA[2] * c02;
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+  invDet = 1.0f / det;
+
+  /* Transposed matrix of cofactors divided by the determinant */
+  pC[0] = c00 * invDet;
+  pC[1] = (pA[2] * pA[7] - pA[1] * pA[8]) * invDet;
+  pC[2] = (pA[1] * pA[5] - pA[2] * pA[4]) * invDet;
+  pC[3] = c01 * invDet;
+  pC[4] = (pA[0] * pA[8] - pA[2] * pA[6]) * invDet;
+  pC[5] = (pA[2] * pA[3] - pA[0] * pA[5]) * invDet;
+  pC[6] = c02 * invDet;
+  pC[7] = (pA[1] * pA[6] - pA[0] * pA[7]) * invDet;
+  pC[8] = (pA[0] * pA[4] - pA[1] * pA[3]) * invDet;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Floating-point N x N matrix inverse for N up to 6.
+  @param[in]     pA    points to the input matrix data
+  @param[out]    pC    points to the output matrix data
+  @param[in]     n     dimension of the matrix. When it is a constant,
+                       the compiler can unroll the loops.
+  @return        ARM_MATH_SINGULAR if a pivot is zero, ARM_MATH_SUCCESS otherwise
+
+  Gauss-Jordan elimination with partial pivoting on a local copy
+  of the input matrix. The input matrix is not modified.
+ */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_nxn_f32(
+  const float32_t * pA,
+        float32_t * pC,
+  const uint32_t n)
+{
+  float32_t a[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t pivot, invPivot, maxVal, tmp, coef;
+  uint32_t i, j, k, pivotRow;
+
+  for (i = 0U; i < n * n; i++)
+  {
+    a[i] = pA[i];
+    pC[i] = 0.0f;
+  }
+  for (i = 0U; i < n; i++)
+  {
+    pC[i * n + i] = 1.0f;
+  }
+
+  for (k = 0U; k < n; k++)
+  {
+    /* Row with the biggest pivot */
+    pivotRow = k;
+    maxVal = fabsf(a[k * n + k]);
+    for (i = k + 1U; i < n; i++)
+    {
+      if (fabsf(a[i * n + k]) > maxVal)
+      {
+        maxVal = fabsf(a[i * n + k]);
+        pivotRow = i;
+      }
+    }
+
+    if (maxVal == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    if (pivotRow != k)
+    {
+      for (j = 0U; j < n; j++)
+      {
+        tmp = a[k * n + j];
+        a[k * n + j] = a[pivotRow * n + j];
+        a[pivotRow * n + j] = tmp;
+
+        tmp = pC[k * n + j];
+        pC[k * n + j] = pC[pivotRow * n + j];
+        pC[pivotRow * n + j] = tmp;
+      }
+    }
+
+    /* Normalize the pivot row */
+    pivot = a[k * n + k];
+    invPivot = 1.0f / pivot;
+    for (j = 0U; j < n; j++)
+    {
+      a[k * n + j] *= invPivot;
+      pC[k * n + j] *= invPivot;
+    }
+
+    /* Eliminate the pivot column from the other rows */
+    for (i = 0U; i < n; i++)
+    {
+      if (i != k)
+      {
+        coef = a[i * n + k];
+        for (j = 0U; j < n; j++)
+        {
+          a[i * n + j] -= coef * a[k * n + j];
+          pC[i * n + j] -= coef * pC[k * n + j];
+        }
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Floating-point 4x4 matrix inverse (closed form).
+  @param[in]     pA    points to the input matrix data
+  @param[out]    pC    points to the output matrix data
+  @return        ARM_MATH_SINGULAR if the determinant is zero, ARM_MATH_SUCCESS otherwise
+
+  The cofactors are expanded with the 2x2 minors of the two upper rows
+  and of the two lower rows (Laplace expansion) so that each minor is
+  computed only once.
+ */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_4x4_f32(
+  const float32_t * pA,
+        float32_t * pC)
+{
+  float32_t s0, s1, s2, s3, s4, s5;
+  float32_t c0, c1, c2, c3, c4, c5;
+  float32_t det, invDet;
+
+  /* 2x2 minors of the rows 0 and 1 */
+  s0 = pA[0] * pA[5] - pA[4] * pA[1];
+  s1 = pA[0] * pA[6] - pA[4] * pA[2];
+  s2 = pA[0] * pA[7] - pA[4] * pA[3];
+  s3 = pA[1] * pA[6] - pA[5] * pA[2];
+  s4 = pA[1] * pA[7] - pA[5] * pA[3];
+  s5 = pA[2] * pA[7] - pA[6] * pA[3];
+
+  /* 2x2 minors of the rows 2 and 3 */
+  c0 = pA[8]  * pA[13] - pA[12] * pA[9];
+  c1 = pA[8]  * pA[14] - pA[12] * pA[10];
+  c2 = pA[8]  * pA[15] - pA[12] * pA[11];
+  c3 = pA[9]  * pA[14] - pA[13] * pA[10];
+  c4 = pA[9]  * pA[15] - pA[13] * pA[11];
+  c5 = pA[10] * pA[15] - pA[14] * pA[11];
+
+  det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+  invDet = 1.0f / det;
+
+  /* Transposed matrix of cofactors divided by the determinant */
+  pC[0]  = ( pA[5]  * c5 - pA[6]  * c4 + pA[7]  * c3) * invDet;
+  pC[1]  = (-pA[1]  * c5 + pA[2]  * c4 - pA[3]  * c3) * invDet;
+  pC[2]  = ( pA[13] * s5 - pA[14] * s4 + pA[15] * s3) * invDet;
+  pC[3]  = (-pA[9]  * s5 + pA[10] * s4 - pA[11] * s3) * invDet;
+
+  pC[4]  = (-pA[4]  * c5 + pA[6]  * c2 - pA[7]  * c1) * invDet;
+  pC[5]  = ( pA[0]  * c5 - pA[2]  * c2 + pA[3]  * c1) * invDet;
+  pC[6]  = (-pA[12] * s5 + pA[14] * s2 - pA[15] * s1) * invDet;
+  pC[7]  = ( pA[8]  * s5 - pA[10] * s2 + pA[11] * s1) * invDet;
+
+  pC[8]  = ( pA[4]  * c4 - pA[5]  * c2 + pA[7]  * c0) * invDet;
+  pC[9]  = (-pA[0]  * c4 + pA[1]  * c2 - pA[3]  * c0) * invDet;
+  pC[10] = ( pA[12] * s4 - pA[13] * s2 + pA[15] * s0) * invDet;
+  pC[11] = (-pA[8]  * s4 + pA[9]  * s2 - pA[11] * s0) * invDet;
+
+  pC[12] = (-pA[4]  * c3 + pA[5]  * c1 - pA[6]  * c0) * invDet;
+  pC[13] = ( pA[0]  * c3 - pA[1]  * c1 + pA[2]  * c0) * invDet;
+  pC[14] = (-pA[12] * s3 + pA[13] * s1 - pA[14] * s0) * invDet;
+  pC[15] = ( pA[8]  * s3 - pA[9]  * s1 + pA[10] * s0) * invDet;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Floating-point 5x5 matrix inverse.
+  @param[in]     pA    points to the input matrix data
+  @param[out]    pC    points to the output matrix data
+  @return        ARM_MATH_SINGULAR if a pivot is zero, ARM_MATH_SUCCESS otherwise
+ */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_5x5_f32(
+  const float32_t * pA,
+        float32_t * pC)
+{
+  return (arm_mat_inverse_nxn_f32(pA, pC, 5U));
+}
+
+/**
+  @brief         Floating-point 6x6 matrix inverse.
+  @param[in]     pA    points to the input matrix data
+  @param[out]    pC    points to the output matrix data
+  @return        ARM_MATH_SINGULAR if a pivot is zero, ARM_MATH_SUCCESS otherwise
+ */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_6x6_f32(
+  const float32_t * pA,
+        float32_t * pC)
+{
+  return (arm_mat_inverse_nxn_f32(pA, pC, 6U));
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _MATRIX_UTILS_H_ */
@@ -44,6 +44,14 @@ extern "C"
  * @defgroup groupQuaternionMath Quaternion Math Functions
  * Functions to operates on quaternions and convert between a
  * rotation and quaternion representation.
+ *
+ * By default, the quaternions are stored one after the other
+ * (4 floats per quaternion). The functions with a _soa suffix are using a
+ * structure of arrays layout: the nbQuaternions real parts followed by the
+ * nbQuaternions i parts, the j parts and the k parts. Vectors and rotation
+ * matrices are stored in the same way (one array per coordinate or
+ * coefficient). This layout is better suited to vectorization when
+ * a lot of small rotations are processed together.
  */
 
 
@@ -152,6 +160,91 @@ void arm_rotation2quaternion_f32(const float32_t *pInputRotations,
     float32_t *pOutputQuaternions,  
     uint32_t nbQuaternions);
 
+/**
+  @brief         Floating-point quaternion conjugates in SoA layout.
+  @param[in]     pInputQuaternions            points to the input quaternions in SoA layout
+  @param[out]    pConjugateQuaternions        points to the output conjugate quaternions in SoA layout
+  @param[in]     nbQuaternions                number of quaternions in each array
+  @return        none
+ */
+void arm_quaternion_conjugate_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pConjugateQuaternions, 
+    uint32_t nbQuaternions);
+
+/**
+  @brief         Floating-point normalization of quaternions in SoA layout.
+  @param[in]     pInputQuaternions            points to the input quaternions in SoA layout
+  @param[out]    pNormalizedQuaternions       points to the output normalized quaternions in SoA layout
+  @param[in]     nbQuaternions                number of quaternions in each array
+  @return        none
+ */
+void arm_quaternion_normalize_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pNormalizedQuaternions, 
+    uint32_t nbQuaternions);
+
+/**
+  @brief         Floating-point elementwise product of quaternions in SoA layout.
+  @param[in]     qa                  first array of quaternions in SoA layout
+  @param[in]     qb                  second array of quaternions in SoA layout
+  @param[out]    qr                  elementwise product of quaternions in SoA layout
+  @param[in]     nbQuaternions       number of quaternions in the arrays
+  @return        none
+ */
+void arm_quaternion_product_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t *qr,
+    uint32_t nbQuaternions);
+
+/**
+ * @brief Conversion of quaternions to equivalent rotation matrices in SoA layout.
+ * @param[in]       pInputQuaternions points to normalized quaternions in SoA layout
+ * @param[out]      pOutputRotations points to 3x3 rotations in SoA layout (R00 R01 R02 R10 R11 R12 R20 R21 R22 arrays)
+ * @param[in]       nbQuaternions number of quaternions in the array
+ * @return none.
+ */
+void arm_quaternion2rotation_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pOutputRotations, 
+    uint32_t nbQuaternions);
+
+/**
+ * @brief Conversion of rotation matrices to equivalent quaternions in SoA layout.
+ * @param[in]       pInputRotations points to 3x3 rotations in SoA layout (R00 R01 R02 R10 R11 R12 R20 R21 R22 arrays)
+ * @param[out]      pOutputQuaternions points to quaternions in SoA layout
+ * @param[in]       nbQuaternions number of quaternions in the array
+ * @return none.
+ */
+void arm_rotation2quaternion_soa_f32(const float32_t *pInputRotations, 
+    float32_t *pOutputQuaternions,  
+    uint32_t nbQuaternions);
+
+/**
+  @brief         Floating-point rotation of vectors by quaternions in SoA layout.
+  @param[in]     pInputQuaternions            points to the normalized quaternions in SoA layout
+  @param[in]     pInputVectors                points to the vectors in SoA layout (x, y and z arrays)
+  @param[out]    pOutputVectors               points to the rotated vectors in SoA layout
+  @param[in]     nbQuaternions                number of quaternions and vectors
+  @return        none
+ */
+void arm_quaternion_rotate_soa_f32(const float32_t *pInputQuaternions, 
+    const float32_t *pInputVectors, 
+    float32_t *pOutputVectors,
+    uint32_t nbQuaternions);
+
+/**
+  @brief         Floating-point spherical linear interpolation of quaternions in SoA layout.
+  @param[in]     qa                  first array of normalized quaternions in SoA layout
+  @param[in]     qb                  second array of normalized quaternions in SoA layout
+  @param[in]     t                   interpolation factor between 0 (qa) and 1 (qb)
+  @param[out]    qr                  interpolated quaternions in SoA layout
+  @param[in]     nbQuaternions       number of quaternions in the arrays
+  @return        none
+ */
+void arm_quaternion_slerp_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t t,
+    float32_t *qr,
+    uint32_t nbQuaternions);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -577,6 +577,452 @@ float64_t arm_kullback_leibler_f64(const float64_t * pSrcA,
       float32_t *pResult);
 
 
+  /**
+   * @brief Instance structure for the floating-point streaming statistics accumulator.
+   */
+  typedef struct
+  {
+          uint64_t count;       /**< number of accumulated samples. */
+          float32_t mean;       /**< running mean. */
+          float32_t m2;         /**< running sum of the squared deviations from the mean. */
+          float32_t min;        /**< minimum value. */
+          float32_t max;        /**< maximum value. */
+          uint64_t minIndex;    /**< position of the minimum value in the stream. */
+          uint64_t maxIndex;    /**< position of the maximum value in the stream. */
+  } arm_stats_accum_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 streaming statistics accumulator.
+   */
+  typedef struct
+  {
+          uint64_t count;       /**< number of accumulated samples. */
+          q31_t shift;          /**< reference value subtracted from the samples. It is the first sample of the stream. */
+          q63_t sum;            /**< sum of the shifted samples in 33.31 format. */
+          q63_t sumOfSquares;   /**< sum of the squared shifted samples in 33.31 format. */
+          q31_t min;            /**< minimum value. */
+          q31_t max;            /**< maximum value. */
+          uint64_t minIndex;    /**< position of the minimum value in the stream. */
+          uint64_t maxIndex;    /**< position of the maximum value in the stream. */
+  } arm_stats_accum_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 streaming statistics accumulator.
+   */
+  typedef struct
+  {
+          uint64_t count;       /**< number of accumulated samples. */
+          q15_t shift;          /**< reference value subtracted from the samples. It is the first sample of the stream. */
+          q63_t sum;            /**< sum of the shifted samples in 49.15 format. */
+          q63_t sumOfSquares;   /**< sum of the squared shifted samples in 34.30 format. */
+          q15_t min;            /**< minimum value. */
+          q15_t max;            /**< maximum value. */
+          uint64_t minIndex;    /**< position of the minimum value in the stream. */
+          uint64_t maxIndex;    /**< position of the maximum value in the stream. */
+  } arm_stats_accum_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point streaming statistics accumulator.
+   * @param[out] S  points to an instance of the floating-point accumulator structure.
+   */
+  void arm_stats_accum_init_f32(
+        arm_stats_accum_instance_f32 * S);
+
+  /**
+   * @brief  Initialization function for the Q31 streaming statistics accumulator.
+   * @param[out] S  points to an instance of the Q31 accumulator structure.
+   */
+  void arm_stats_accum_init_q31(
+        arm_stats_accum_instance_q31 * S);
+
+  /**
+   * @brief  Initialization function for the Q15 streaming statistics accumulator.
+   * @param[out] S  points to an instance of the Q15 accumulator structure.
+   */
+  void arm_stats_accum_init_q15(
+        arm_stats_accum_instance_q15 * S);
+
+  /**
+   * @brief  Accumulates a block of floating-point samples.
+   * @param[in,out] S          points to an instance of the floating-point accumulator structure.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   */
+  void arm_stats_accum_f32(
+        arm_stats_accum_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Accumulates a block of Q31 samples.
+   * @param[in,out] S          points to an instance of the Q31 accumulator structure.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   */
+  void arm_stats_accum_q31(
+        arm_stats_accum_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Accumulates a block of Q15 samples.
+   * @param[in,out] S          points to an instance of the Q15 accumulator structure.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   */
+  void arm_stats_accum_q15(
+        arm_stats_accum_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Merges two floating-point streaming statistics accumulators.
+   * @param[in,out] S     points to the accumulator receiving the merged statistics.
+   * @param[in]     pOther points to the accumulator to merge into S.
+   */
+  void arm_stats_accum_merge_f32(
+        arm_stats_accum_instance_f32 * S,
+  const arm_stats_accum_instance_f32 * pOther);
+
+  /**
+   * @brief  Merges two Q31 streaming statistics accumulators.
+   * @param[in,out] S     points to the accumulator receiving the merged statistics.
+   * @param[in]     pOther points to the accumulator to merge into S.
+   */
+  void arm_stats_accum_merge_q31(
+        arm_stats_accum_instance_q31 * S,
+  const arm_stats_accum_instance_q31 * pOther);
+
+  /**
+   * @brief  Merges two Q15 streaming statistics accumulators.
+   * @param[in,out] S     points to the accumulator receiving the merged statistics.
+   * @param[in]     pOther points to the accumulator to merge into S.
+   */
+  void arm_stats_accum_merge_q15(
+        arm_stats_accum_instance_q15 * S,
+  const arm_stats_accum_instance_q15 * pOther);
+
+  /**
+   * @brief  Statistics of a floating-point streaming statistics accumulator.
+   * @param[in]  S      points to an instance of the floating-point accumulator structure.
+   * @param[out] pMean  mean value returned here
+   * @param[out] pVar   variance value returned here
+   * @param[out] pStd   standard deviation value returned here
+   * @param[out] pRms   root mean square value returned here
+   */
+  void arm_stats_accum_result_f32(
+  const arm_stats_accum_instance_f32 * S,
+        float32_t * pMean,
+        float32_t * pVar,
+        float32_t * pStd,
+        float32_t * pRms);
+
+  /**
+   * @brief  Statistics of a Q31 streaming statistics accumulator.
+   * @param[in]  S      points to an instance of the Q31 accumulator structure.
+   * @param[out] pMean  mean value returned here
+   * @param[out] pVar   variance value returned here
+   * @param[out] pStd   standard deviation value returned here
+   * @param[out] pRms   root mean square value returned here
+   */
+  void arm_stats_accum_result_q31(
+  const arm_stats_accum_instance_q31 * S,
+        q31_t * pMean,
+        q31_t * pVar,
+        q31_t * pStd,
+        q31_t * pRms);
+
+  /**
+   * @brief  Statistics of a Q15 streaming statistics accumulator.
+   * @param[in]  S      points to an instance of the Q15 accumulator structure.
+   * @param[out] pMean  mean value returned here
+   * @param[out] pVar   variance value returned here
+   * @param[out] pStd   standard deviation value returned here
+   * @param[out] pRms   root mean square value returned here
+   */
+  void arm_stats_accum_result_q15(
+  const arm_stats_accum_instance_q15 * S,
+        q15_t * pMean,
+        q15_t * pVar,
+        q15_t * pStd,
+        q15_t * pRms);
+
+
+  /**
+   * @brief Instance structure for the floating-point moving window statistics.
+   */
+  typedef struct
+  {
+          uint32_t windowSize;  /**< number of samples in the window. */
+          uint32_t count;       /**< number of samples currently in the window. */
+          uint32_t pos;         /**< position of the next sample in the ring buffer. */
+          uint32_t minHead;     /**< position of the front of the minimum queue. */
+          uint32_t minCount;    /**< number of entries in the minimum queue. */
+          uint32_t maxHead;     /**< position of the front of the maximum queue. */
+          uint32_t maxCount;    /**< number of entries in the maximum queue. */
+          float32_t shift;      /**< reference value subtracted from the samples in the running sums. */
+          float32_t sum;        /**< running sum of the shifted samples in the window. */
+          float32_t sumOfSquares; /**< running sum of the squared shifted samples in the window. */
+          float32_t *pBuffer;   /**< points to the ring buffer of length windowSize. */
+          uint32_t *pMinQueue;  /**< points to the monotonic queue of buffer positions for the minimum. The array is of length windowSize. */
+          uint32_t *pMaxQueue;  /**< points to the monotonic queue of buffer positions for the maximum. The array is of length windowSize. */
+  } arm_moving_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 moving window statistics.
+   */
+  typedef struct
+  {
+          uint32_t windowSize;  /**< number of samples in the window. */
+          uint32_t count;       /**< number of samples currently in the window. */
+          uint32_t pos;         /**< position of the next sample in the ring buffer. */
+          uint32_t minHead;     /**< position of the front of the minimum queue. */
+          uint32_t minCount;    /**< number of entries in the minimum queue. */
+          uint32_t maxHead;     /**< position of the front of the maximum queue. */
+          uint32_t maxCount;    /**< number of entries in the maximum queue. */
+          q63_t sum;            /**< running sum of the samples in the window in 49.15 format. */
+          q63_t sumOfSquares;   /**< running sum of the squared samples in the window in 34.30 format. */
+          q15_t *pBuffer;       /**< points to the ring buffer of length windowSize. */
+          uint32_t *pMinQueue;  /**< points to the monotonic queue of buffer positions for the minimum. The array is of length windowSize. */
+          uint32_t *pMaxQueue;  /**< points to the monotonic queue of buffer positions for the maximum. The array is of length windowSize. */
+  } arm_moving_stats_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point moving window statistics.
+   * @param[out] S           points to an instance of the floating-point moving statistics structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pBuffer     points to the ring buffer of length windowSize.
+   * @param[in]  pMinQueue   points to the minimum queue of length windowSize.
+   * @param[in]  pMaxQueue   points to the maximum queue of length windowSize.
+   * @return     execution status
+   *               - \ref ARM_MATH_SUCCESS        : Operation successful
+   *               - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+   */
+  arm_status arm_moving_stats_init_f32(
+        arm_moving_stats_instance_f32 * S,
+        uint32_t windowSize,
+        float32_t * pBuffer,
+        uint32_t * pMinQueue,
+        uint32_t * pMaxQueue);
+
+  /**
+   * @brief  Initialization function for the Q15 moving window statistics.
+   * @param[out] S           points to an instance of the Q15 moving statistics structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pBuffer     points to the ring buffer of length windowSize.
+   * @param[in]  pMinQueue   points to the minimum queue of length windowSize.
+   * @param[in]  pMaxQueue   points to the maximum queue of length windowSize.
+   * @return     execution status
+   *               - \ref ARM_MATH_SUCCESS        : Operation successful
+   *               - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+   */
+  arm_status arm_moving_stats_init_q15(
+        arm_moving_stats_instance_q15 * S,
+        uint32_t windowSize,
+        q15_t * pBuffer,
+        uint32_t * pMinQueue,
+        uint32_t * pMaxQueue);
+
+  /**
+   * @brief  Adds a block of floating-point samples to the moving window.
+   * @param[in,out] S          points to an instance of the floating-point moving statistics structure.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   */
+  void arm_moving_stats_f32(
+        arm_moving_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the moving window.
+   * @param[in,out] S          points to an instance of the Q15 moving statistics structure.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   */
+  void arm_moving_stats_q15(
+        arm_moving_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Statistics of the floating-point moving window.
+   * @param[in]  S      points to an instance of the floating-point moving statistics structure.
+   * @param[out] pMean  mean value returned here
+   * @param[out] pVar   variance value returned here
+   * @param[out] pRms   root mean square value returned here
+   * @param[out] pMin   minimum value returned here
+   * @param[out] pMax   maximum value returned here
+   */
+  void arm_moving_stats_result_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pMean,
+        float32_t * pVar,
+        float32_t * pRms,
+        float32_t * pMin,
+        float32_t * pMax);
+
+  /**
+   * @brief  Statistics of the Q15 moving window.
+   * @param[in]  S      points to an instance of the Q15 moving statistics structure.
+   * @param[out] pMean  mean value returned here
+   * @param[out] pVar   variance value returned here
+   * @param[out] pRms   root mean square value returned here
+   * @param[out] pMin   minimum value returned here
+   * @param[out] pMax   maximum value returned here
+   */
+  void arm_moving_stats_result_q15(
+  const arm_moving_stats_instance_q15 * S,
+        q15_t * pMean,
+        q15_t * pVar,
+        q15_t * pRms,
+        q15_t * pMin,
+        q15_t * pMax);
+
+  /**
+   * @brief  Histogram of a floating-point vector with uniform bins.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   * @param[in]     minVal     lower edge of the first bin
+   * @param[in]     maxVal     upper edge of the last bin
+   * @param[in]     numBins    number of bins
+   * @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : numBins is 0 or maxVal is not greater than minVal
+   */
+  arm_status arm_histogram_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t minVal,
+        float32_t maxVal,
+        uint32_t numBins,
+        uint32_t * pHist);
+
+  /**
+   * @brief  Histogram of a floating-point vector with custom bin edges.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   * @param[in]     pEdges     points to the numBins + 1 increasing bin edges
+   * @param[in]     numBins    number of bins
+   * @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+   */
+  void arm_histogram_edges_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+  const float32_t * pEdges,
+        uint32_t numBins,
+        uint32_t * pHist);
+
+  /**
+   * @brief  Histogram of a Q15 vector with uniform bins.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   * @param[in]     minVal     smallest value of the first bin
+   * @param[in]     maxVal     largest value of the last bin
+   * @param[in]     numBins    number of bins
+   * @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : numBins is 0 or maxVal is smaller than minVal
+   */
+  arm_status arm_histogram_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        q15_t minVal,
+        q15_t maxVal,
+        uint32_t numBins,
+        uint32_t * pHist);
+
+  /**
+   * @brief  Histogram of a Q15 vector with custom bin edges.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   * @param[in]     pEdges     points to the numBins + 1 increasing bin edges
+   * @param[in]     numBins    number of bins
+   * @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+   */
+  void arm_histogram_edges_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+  const q15_t * pEdges,
+        uint32_t numBins,
+        uint32_t * pHist);
+
+  /**
+   * @brief  Percentile of a floating-point vector.
+   * @param[in]     pSrc        points to the input vector
+   * @param[in]     blockSize   number of samples in input vector
+   * @param[in]     percentage  percentage between 0 and 100
+   * @param[in,out] pScratch    points to a buffer of blockSize samples. Can be pSrc.
+   * @param[out]    pResult     percentile value returned here
+   */
+  void arm_percentile_f32(
+        float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t percentage,
+        float32_t * pScratch,
+        float32_t * pResult);
+
+  /**
+   * @brief  Median of a floating-point vector.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   * @param[in,out] pScratch   points to a buffer of blockSize samples. Can be pSrc.
+   * @param[out]    pResult    median value returned here
+   */
+  void arm_median_f32(
+        float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pScratch,
+        float32_t * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point P-square quantile estimator.
+   */
+  typedef struct
+  {
+          float32_t quantile;   /**< estimated quantile between 0 and 1. */
+          uint32_t count;       /**< number of samples received. */
+          float32_t height[5];  /**< marker heights. */
+          uint32_t pos[5];      /**< marker positions. */
+          float32_t delta[5];   /**< desired marker positions minus the actual positions. */
+          float32_t incr[5];    /**< increments of the desired marker positions for each sample. */
+  } arm_p2_quantile_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point P-square quantile estimator.
+   * @param[out] S         points to an instance of the floating-point P-square structure.
+   * @param[in]  quantile  quantile to estimate, between 0 and 1.
+   * @return     execution status
+   *               - \ref ARM_MATH_SUCCESS        : Operation successful
+   *               - \ref ARM_MATH_ARGUMENT_ERROR : quantile is not between 0 and 1
+   */
+  arm_status arm_p2_quantile_init_f32(
+        arm_p2_quantile_instance_f32 * S,
+        float32_t quantile);
+
+  /**
+   * @brief  Adds a block of floating-point samples to the P-square quantile estimator.
+   * @param[in,out] S          points to an instance of the floating-point P-square structure.
+   * @param[in]     pSrc       points to the input vector
+   * @param[in]     blockSize  number of samples in input vector
+   */
+  void arm_p2_quantile_f32(
+        arm_p2_quantile_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Estimated quantile of the floating-point P-square estimator.
+   * @param[in]  S        points to an instance of the floating-point P-square structure.
+   * @param[out] pResult  quantile estimate returned here
+   */
+  void arm_p2_quantile_result_f32(
+  const arm_p2_quantile_instance_f32 * S,
+        float32_t * pResult);
+
+
 
 
 #ifdef   __cplusplus
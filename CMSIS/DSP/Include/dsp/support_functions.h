@@ -186,6 +186,354 @@ extern "C"
         q15_t * pDst,
         uint32_t blockSize);
 
+  /**
+   * @brief  Converts a Q7 vector to a floating-point vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q7_f32(
+  const q7_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q15 vector to a floating-point vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q15_f32(
+  const q15_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q31 vector to a floating-point vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q31_f32(
+  const q31_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a floating-point vector to a Q7 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_f32_q7(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        q7_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a floating-point vector to a Q15 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_f32_q15(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a floating-point vector to a Q31 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scale      scale factor
+   * @param[in]  offset     offset added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_f32_q31(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q7 vector to a Q15 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift      number of bits to shift the result by
+   * @param[in]  offset     offset in Q15 format added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q7_q15(
+  const q7_t * pSrc,
+        q15_t scaleFract,
+        int8_t shift,
+        q15_t offset,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q7 vector to a Q31 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift      number of bits to shift the result by
+   * @param[in]  offset     offset in Q31 format added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q7_q31(
+  const q7_t * pSrc,
+        q15_t scaleFract,
+        int8_t shift,
+        q31_t offset,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q15 vector to a Q7 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift      number of bits to shift the result by
+   * @param[in]  offset     offset in Q7 format added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q15_q7(
+  const q15_t * pSrc,
+        q15_t scaleFract,
+        int8_t shift,
+        q7_t offset,
+        q7_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q15 vector to a Q31 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift      number of bits to shift the result by
+   * @param[in]  offset     offset in Q31 format added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q15_q31(
+  const q15_t * pSrc,
+        q15_t scaleFract,
+        int8_t shift,
+        q31_t offset,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q31 vector to a Q7 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift      number of bits to shift the result by
+   * @param[in]  offset     offset in Q7 format added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q31_q7(
+  const q31_t * pSrc,
+        q31_t scaleFract,
+        int8_t shift,
+        q7_t offset,
+        q7_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Converts a Q31 vector to a Q15 vector with a scale and an offset.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  scaleFract fractional portion of the scale value
+   * @param[in]  shift      number of bits to shift the result by
+   * @param[in]  offset     offset in Q15 format added after the scaling
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_convert_affine_q31_q15(
+  const q31_t * pSrc,
+        q31_t scaleFract,
+        int8_t shift,
+        q15_t offset,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  De-interleaves a floating-point multichannel buffer.
+   * @param[in]  pSrc        points to the interleaved input buffer
+   * @param[in]  numChannels number of channels
+   * @param[out] pDst        points to the planar output buffer
+   * @param[in]  blockSize   number of samples in each channel
+   */
+  void arm_deinterleave_f32(
+  const float32_t * pSrc,
+        uint32_t numChannels,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Interleaves floating-point channels into a multichannel buffer.
+   * @param[in]  pSrc        points to the planar input buffer
+   * @param[in]  numChannels number of channels
+   * @param[out] pDst        points to the interleaved output buffer
+   * @param[in]  blockSize   number of samples in each channel
+   */
+  void arm_interleave_f32(
+  const float32_t * pSrc,
+        uint32_t numChannels,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Splits a floating-point complex vector into its real and imaginary parts.
+   * @param[in]  pSrc       points to the complex input vector
+   * @param[out] pReal      points to the real part output vector
+   * @param[out] pImag      points to the imaginary part output vector
+   * @param[in]  numSamples number of complex samples
+   */
+  void arm_cmplx_split_f32(
+  const float32_t * pSrc,
+        float32_t * pReal,
+        float32_t * pImag,
+        uint32_t numSamples);
+
+  /**
+   * @brief  Merges real and imaginary parts into a floating-point complex vector.
+   * @param[in]  pReal      points to the real part input vector
+   * @param[in]  pImag      points to the imaginary part input vector
+   * @param[out] pDst       points to the complex output vector
+   * @param[in]  numSamples number of complex samples
+   */
+  void arm_cmplx_merge_f32(
+  const float32_t * pReal,
+  const float32_t * pImag,
+        float32_t * pDst,
+        uint32_t numSamples);
+
+  /**
+   * @brief  De-interleaves a Q31 multichannel buffer.
+   * @param[in]  pSrc        points to the interleaved input buffer
+   * @param[in]  numChannels number of channels
+   * @param[out] pDst        points to the planar output buffer
+   * @param[in]  blockSize   number of samples in each channel
+   */
+  void arm_deinterleave_q31(
+  const q31_t * pSrc,
+        uint32_t numChannels,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Interleaves Q31 channels into a multichannel buffer.
+   * @param[in]  pSrc        points to the planar input buffer
+   * @param[in]  numChannels number of channels
+   * @param[out] pDst        points to the interleaved output buffer
+   * @param[in]  blockSize   number of samples in each channel
+   */
+  void arm_interleave_q31(
+  const q31_t * pSrc,
+        uint32_t numChannels,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Splits a Q31 complex vector into its real and imaginary parts.
+   * @param[in]  pSrc       points to the complex input vector
+   * @param[out] pReal      points to the real part output vector
+   * @param[out] pImag      points to the imaginary part output vector
+   * @param[in]  numSamples number of complex samples
+   */
+  void arm_cmplx_split_q31(
+  const q31_t * pSrc,
+        q31_t * pReal,
+        q31_t * pImag,
+        uint32_t numSamples);
+
+  /**
+   * @brief  Merges real and imaginary parts into a Q31 complex vector.
+   * @param[in]  pReal      points to the real part input vector
+   * @param[in]  pImag      points to the imaginary part input vector
+   * @param[out] pDst       points to the complex output vector
+   * @param[in]  numSamples number of complex samples
+   */
+  void arm_cmplx_merge_q31(
+  const q31_t * pReal,
+  const q31_t * pImag,
+        q31_t * pDst,
+        uint32_t numSamples);
+
+  /**
+   * @brief  De-interleaves a Q15 multichannel buffer.
+   * @param[in]  pSrc        points to the interleaved input buffer
+   * @param[in]  numChannels number of channels
+   * @param[out] pDst        points to the planar output buffer
+   * @param[in]  blockSize   number of samples in each channel
+   */
+  void arm_deinterleave_q15(
+  const q15_t * pSrc,
+        uint32_t numChannels,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Interleaves Q15 channels into a multichannel buffer.
+   * @param[in]  pSrc        points to the planar input buffer
+   * @param[in]  numChannels number of channels
+   * @param[out] pDst        points to the interleaved output buffer
+   * @param[in]  blockSize   number of samples in each channel
+   */
+  void arm_interleave_q15(
+  const q15_t * pSrc,
+        uint32_t numChannels,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Splits a Q15 complex vector into its real and imaginary parts.
+   * @param[in]  pSrc       points to the complex input vector
+   * @param[out] pReal      points to the real part output vector
+   * @param[out] pImag      points to the imaginary part output vector
+   * @param[in]  numSamples number of complex samples
+   */
+  void arm_cmplx_split_q15(
+  const q15_t * pSrc,
+        q15_t * pReal,
+        q15_t * pImag,
+        uint32_t numSamples);
+
+  /**
+   * @brief  Merges real and imaginary parts into a Q15 complex vector.
+   * @param[in]  pReal      points to the real part input vector
+   * @param[in]  pImag      points to the imaginary part input vector
+   * @param[out] pDst       points to the complex output vector
+   * @param[in]  numSamples number of complex samples
+   */
+  void arm_cmplx_merge_q15(
+  const q15_t * pReal,
+  const q15_t * pImag,
+        q15_t * pDst,
+        uint32_t numSamples);
+
 
 
 
@@ -205,8 +553,10 @@ extern "C"
              /**< Insertion sort */
     ARM_SORT_QUICK     = 4,
              /**< Quick sort     */
-    ARM_SORT_SELECTION = 5
+    ARM_SORT_SELECTION = 5,
              /**< Selection sort */
+    ARM_SORT_RADIX     = 6
+             /**< Radix sort     */
   } arm_sort_alg;
 
   /**
@@ -282,6 +632,53 @@ extern "C"
     arm_sort_dir dir,
     float32_t * buffer);
 
+  /**
+   * @brief Instance structure for the argsort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+    uint32_t * buffer;       /**< Working buffer of 3 * blockSize words */
+  } arm_argsort_instance_f32;
+
+  /**
+   * @param[in]  S          points to an instance of the argsort structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_argsort_f32(
+    const arm_argsort_instance_f32 * S,
+    const float32_t * pSrc,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @param[in,out]  S            points to an instance of the argsort structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      buffer       Working buffer of 3 * blockSize words.
+   */
+  void arm_argsort_init_f32(
+    arm_argsort_instance_f32 * S,
+    arm_sort_dir dir,
+    uint32_t * buffer);
+
+  /**
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  blockSize  number of samples to process.
+   * @param[in]  k          number of values to select.
+   * @param[in]  dir        ARM_SORT_DESCENDING for the k largest values, ARM_SORT_ASCENDING for the k smallest ones.
+   * @param[out] pDst       points to the k selected values.
+   * @param[out] pIndex     points to the indices of the k selected values.
+   */
+  void arm_topk_f32(
+    const float32_t * pSrc,
+          uint32_t blockSize,
+          uint32_t k,
+          arm_sort_dir dir,
+          float32_t * pDst,
+          uint32_t * pIndex);
+
  
  
   /**
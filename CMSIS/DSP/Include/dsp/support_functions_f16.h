@@ -89,6 +89,126 @@ void arm_float_to_f16(const float32_t * pSrc, float16_t * pDst, uint32_t blockSi
    */
 void arm_f16_to_float(const float16_t * pSrc, float32_t * pDst, uint32_t blockSize);
 
+/**
+ * @brief  Converts a Q15 vector to a f16 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_q15_f16(
+const q15_t * pSrc,
+      float16_t scale,
+      float16_t offset,
+      float16_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a f16 vector to a Q15 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_f16_q15(
+const float16_t * pSrc,
+      float16_t scale,
+      float16_t offset,
+      q15_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a f16 vector to a floating-point vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_f16_f32(
+const float16_t * pSrc,
+      float32_t scale,
+      float32_t offset,
+      float32_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a floating-point vector to a f16 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_f32_f16(
+const float32_t * pSrc,
+      float32_t scale,
+      float32_t offset,
+      float16_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a Q7 vector to a f16 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_q7_f16(
+const q7_t * pSrc,
+      float16_t scale,
+      float16_t offset,
+      float16_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a f16 vector to a Q7 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_f16_q7(
+const float16_t * pSrc,
+      float16_t scale,
+      float16_t offset,
+      q7_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a Q31 vector to a f16 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_q31_f16(
+const q31_t * pSrc,
+      float16_t scale,
+      float16_t offset,
+      float16_t * pDst,
+      uint32_t blockSize);
+
+/**
+ * @brief  Converts a f16 vector to a Q31 vector with a scale and an offset.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  scale      scale factor
+ * @param[in]  offset     offset added after the scaling
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples to process
+ */
+void arm_convert_affine_f16_q31(
+const float16_t * pSrc,
+      float16_t scale,
+      float16_t offset,
+      q31_t * pDst,
+      uint32_t blockSize);
+
 /**
  * @brief Weighted sum
  *
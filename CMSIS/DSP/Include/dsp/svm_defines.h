@@ -43,4 +43,15 @@ typedef enum
              /**< Sigmoid kernel */
 } arm_ml_kernel_type;
 
+/**
+ * @brief Struct for specifying the multi-class SVM strategy
+ */
+typedef enum
+{
+    ARM_SVM_ONE_VS_ONE = 0,
+             /**< One classifier per pair of classes and majority vote */
+    ARM_SVM_ONE_VS_REST = 1
+             /**< One classifier per class and largest decision value */
+} arm_svm_multiclass_type;
+
 #endif
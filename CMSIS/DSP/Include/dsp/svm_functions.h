@@ -48,10 +48,13 @@ extern "C"
  * generated from the scikit-learn object. Some examples are given in
  * DSP/Testing/PatternGeneration/SVM.py
  *
- * If more than 2 classes are needed, the functions in this folder 
- * will have to be used, as building blocks, to do multi-class classification.
+ * Multi-class classification (one-vs-one as scikit-learn SVC or
+ * one-vs-rest) is provided by the multi-class SVM functions which evaluate
+ * the kernel of each support vector only once for all the classifiers.
  *
- * No multi-class classification is provided in this SVM folder.
+ * The q15 and q7 functions use quantized models. The quantization of a
+ * scikit-learn SVC and a bit exact model of the fixed-point functions are
+ * provided by DSP/PythonWrapper/mlquantization.py
  * 
  */
 
@@ -172,6 +175,22 @@ void arm_svm_linear_predict_f32(const arm_svm_linear_instance_f32 *S,
    const float32_t * in, 
    int32_t * pResult);
 
+/**
+ * @brief SVM linear prediction on a batch of vectors
+ * @param[in]    S          Pointer to an instance of the linear SVM structure.
+ * @param[in]    in         Pointer to nbVectors input vectors
+ * @param[in]    nbVectors  Number of input vectors
+ * @param[out]   pScratch   Buffer of vectorDimension + nbVectors samples
+ * @param[out]   pResult    nbVectors predicted classes
+ * @return none.
+ *
+ */
+void arm_svm_linear_predict_batch_f32(const arm_svm_linear_instance_f32 *S,
+   const float32_t * in,
+   uint32_t nbVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
 
 /**
  * @brief        SVM polynomial instance init function
@@ -290,6 +309,423 @@ void arm_svm_sigmoid_predict_f32(const arm_svm_sigmoid_instance_f32 *S,
    int32_t * pResult);
 
 
+/**
+ * @brief Instance structure for multi-class SVM prediction function.
+ */
+typedef struct
+{
+  arm_svm_multiclass_type strategy;       /**< One-vs-one or one-vs-rest */
+  arm_ml_kernel_type kernel;              /**< Kernel of the classifiers */
+  uint32_t        nbOfClasses;            /**< Number of classes */
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  const uint32_t  *nbOfSupportVectorsPerClass; /**< Number of support vectors of each class (one-vs-one) */
+  const float32_t *intercepts;            /**< Intercept of each classifier */
+  const float32_t *dualCoefficients;      /**< Dual coefficients */
+  const float32_t *supportVectors;        /**< Support vectors */
+  const float32_t *supportVectorsNorms;   /**< Squared norms of the support vectors (RBF kernel) */
+  const int32_t   *classes;               /**< The nbOfClasses SVM classes */
+  int32_t         degree;                 /**< Polynomial degree */
+  float32_t       coef0;                  /**< Polynomial or sigmoid constant */
+  float32_t       gamma;                  /**< Gamma factor */
+  float32_t       *pState;                /**< Kernel values, votes and squared norms of the support vectors */
+} arm_svm_multiclass_instance_f32;
+
+/**
+ * @brief        SVM multi-class instance init function
+ * @param[in]    S                      points to an instance of the multi-class SVM structure.
+ * @param[in]    strategy               One-vs-one or one-vs-rest
+ * @param[in]    kernel                 Kernel of the classifiers
+ * @param[in]    nbOfClasses            Number of classes
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    nbOfSupportVectorsPerClass  Number of support vectors of each class (one-vs-one only)
+ * @param[in]    intercepts             Intercept of each classifier
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    classes                Array of nbOfClasses classes ID
+ * @param[in]    degree                 Polynomial degree
+ * @param[in]    coef0                  coeff0 (scikit-learn terminology)
+ * @param[in]    gamma                  gamma (scikit-learn terminology)
+ * @param[in]    pState                 Buffer of nbOfSupportVectors + nbOfClasses samples
+ *                                      and nbOfSupportVectors more samples for the RBF kernel
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR
+ *
+ */
+arm_status arm_svm_multiclass_init_f32(arm_svm_multiclass_instance_f32 *S,
+  arm_svm_multiclass_type strategy,
+  arm_ml_kernel_type kernel,
+  uint32_t nbOfClasses,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const uint32_t *nbOfSupportVectorsPerClass,
+  const float32_t *intercepts,
+  const float32_t *dualCoefficients,
+  const float32_t *supportVectors,
+  const int32_t *classes,
+  int32_t degree,
+  float32_t coef0,
+  float32_t gamma,
+  float32_t *pState);
+
+/**
+ * @brief SVM multi-class prediction
+ * @param[in]    S          Pointer to an instance of the multi-class SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Predicted class
+ * @return none.
+ *
+ */
+void arm_svm_multiclass_predict_f32(const arm_svm_multiclass_instance_f32 *S,
+   const float32_t * in,
+   int32_t * pResult);
+
+/**
+ * @brief Instance structure for q15 linear SVM prediction function.
+ *
+ * The dual coefficients and the intercept are scaled by a common
+ * positive factor so that they are in the q15 range.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  q15_t           intercept;              /**< Intercept */
+  const q15_t     *dualCoefficients;      /**< Dual coefficients */
+  const q15_t     *supportVectors;        /**< Support vectors */
+  const int32_t   *classes;               /**< The two SVM classes */
+} arm_svm_linear_instance_q15;
+
+/**
+ * @brief Instance structure for q15 polynomial SVM prediction function.
+ *
+ * The dual coefficients and the intercept are scaled by a common
+ * positive factor so that they are in the q15 range. gamma and coef0
+ * are scaled by a common positive factor c so that gamma.<x,sv> + coef0
+ * stays in [-1 1). The kernel is then scaled by c^degree which does not
+ * change the predicted class.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  q15_t           intercept;              /**< Intercept */
+  const q15_t     *dualCoefficients;      /**< Dual coefficients */
+  const q15_t     *supportVectors;        /**< Support vectors */
+  const int32_t   *classes;               /**< The two SVM classes */
+  int32_t         degree;                 /**< Polynomial degree */
+  q15_t           coef0;                  /**< Polynomial constant */
+  q15_t           gamma;                  /**< Gamma factor (fractional part) */
+  int32_t         gammaShift;             /**< Gamma factor (exponent) */
+} arm_svm_polynomial_instance_q15;
+
+/**
+ * @brief Instance structure for q15 rbf SVM prediction function.
+ *
+ * The dual coefficients and the intercept are scaled by a common
+ * positive factor so that they are in the q15 range.
+ * The gamma factor is gamma * 2^gammaShift.
+ * The squared norms of the support vectors are computed offline.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  q15_t           intercept;              /**< Intercept */
+  const q15_t     *dualCoefficients;      /**< Dual coefficients */
+  const q15_t     *supportVectors;        /**< Support vectors */
+  const q63_t     *supportVectorsNorms;   /**< Squared norms of the support vectors (34.30 format) */
+  const int32_t   *classes;               /**< The two SVM classes */
+  q15_t           gamma;                  /**< Gamma factor (fractional part) */
+  int32_t         gammaShift;             /**< Gamma factor (exponent) */
+} arm_svm_rbf_instance_q15;
+
+/**
+ * @brief        SVM linear instance init function
+ * @param[in]    S                      Parameters for SVM functions
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @return none.
+ *
+ */
+void arm_svm_linear_init_q15(arm_svm_linear_instance_q15 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q15_t *supportVectors,
+  const int32_t  *classes);
+
+/**
+ * @brief SVM linear prediction
+ * @param[in]    S          Pointer to an instance of the linear SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Decision value
+ * @return none.
+ *
+ */
+void arm_svm_linear_predict_q15(const arm_svm_linear_instance_q15 *S, 
+   const q15_t * in, 
+   int32_t * pResult);
+
+/**
+ * @brief        SVM polynomial instance init function
+ * @param[in]    S                      points to an instance of the polynomial SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    degree                 Polynomial degree
+ * @param[in]    coef0                  coeff0 (scikit-learn terminology)
+ * @param[in]    gamma                  gamma (fractional part)
+ * @param[in]    gammaShift             gamma (exponent)
+ * @return none.
+ *
+ */
+void arm_svm_polynomial_init_q15(arm_svm_polynomial_instance_q15 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q15_t *supportVectors,
+  const int32_t   *classes,
+  int32_t      degree,
+  q15_t coef0,
+  q15_t gamma,
+  int32_t gammaShift
+  );
+
+/**
+ * @brief SVM polynomial prediction
+ * @param[in]    S          Pointer to an instance of the polynomial SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Decision value
+ * @return none.
+ *
+ */
+void arm_svm_polynomial_predict_q15(const arm_svm_polynomial_instance_q15 *S, 
+   const q15_t * in, 
+   int32_t * pResult);
+
+/**
+ * @brief        SVM radial basis function instance init function
+ * @param[in]    S                      points to an instance of the rbf SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    supportVectorsNorms    Array of squared norms of the support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    gamma                  gamma (fractional part)
+ * @param[in]    gammaShift             gamma (exponent)
+ * @return none.
+ *
+ */
+void arm_svm_rbf_init_q15(arm_svm_rbf_instance_q15 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q15_t *supportVectors,
+  const q63_t *supportVectorsNorms,
+  const int32_t   *classes,
+  q15_t gamma,
+  int32_t gammaShift
+  );
+
+/**
+ * @brief SVM rbf prediction
+ * @param[in]    S         Pointer to an instance of the rbf SVM structure.
+ * @param[in]    in        Pointer to input vector
+ * @param[out]   pResult   decision value
+ * @return none.
+ *
+ */
+void arm_svm_rbf_predict_q15(const arm_svm_rbf_instance_q15 *S, 
+   const q15_t * in, 
+   int32_t * pResult);
+
+/**
+ * @brief Instance structure for q7 linear SVM prediction function.
+ *
+ * The dual coefficients and the intercept are scaled by a common
+ * positive factor so that they are in the q15 range.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  q15_t           intercept;              /**< Intercept */
+  const q15_t     *dualCoefficients;      /**< Dual coefficients */
+  const q7_t      *supportVectors;        /**< Support vectors */
+  const int32_t   *classes;               /**< The two SVM classes */
+} arm_svm_linear_instance_q7;
+
+/**
+ * @brief Instance structure for q7 polynomial SVM prediction function.
+ *
+ * The dual coefficients and the intercept are scaled by a common
+ * positive factor so that they are in the q15 range. gamma and coef0
+ * are scaled by a common positive factor c so that gamma.<x,sv> + coef0
+ * stays in [-1 1). The kernel is then scaled by c^degree which does not
+ * change the predicted class.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  q15_t           intercept;              /**< Intercept */
+  const q15_t     *dualCoefficients;      /**< Dual coefficients */
+  const q7_t      *supportVectors;        /**< Support vectors */
+  const int32_t   *classes;               /**< The two SVM classes */
+  int32_t         degree;                 /**< Polynomial degree */
+  q15_t           coef0;                  /**< Polynomial constant */
+  q15_t           gamma;                  /**< Gamma factor (fractional part) */
+  int32_t         gammaShift;             /**< Gamma factor (exponent) */
+} arm_svm_polynomial_instance_q7;
+
+/**
+ * @brief Instance structure for q7 rbf SVM prediction function.
+ *
+ * The dual coefficients and the intercept are scaled by a common
+ * positive factor so that they are in the q15 range.
+ * The gamma factor is gamma * 2^gammaShift.
+ * The squared norms of the support vectors are computed offline.
+ */
+typedef struct
+{
+  uint32_t        nbOfSupportVectors;     /**< Number of support vectors */
+  uint32_t        vectorDimension;        /**< Dimension of vector space */
+  q15_t           intercept;              /**< Intercept */
+  const q15_t     *dualCoefficients;      /**< Dual coefficients */
+  const q7_t      *supportVectors;        /**< Support vectors */
+  const q31_t     *supportVectorsNorms;   /**< Squared norms of the support vectors (18.14 format) */
+  const int32_t   *classes;               /**< The two SVM classes */
+  q15_t           gamma;                  /**< Gamma factor (fractional part) */
+  int32_t         gammaShift;             /**< Gamma factor (exponent) */
+} arm_svm_rbf_instance_q7;
+
+/**
+ * @brief        SVM linear instance init function
+ * @param[in]    S                      Parameters for SVM functions
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @return none.
+ *
+ */
+void arm_svm_linear_init_q7(arm_svm_linear_instance_q7 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q7_t *supportVectors,
+  const int32_t  *classes);
+
+/**
+ * @brief SVM linear prediction
+ * @param[in]    S          Pointer to an instance of the linear SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Decision value
+ * @return none.
+ *
+ */
+void arm_svm_linear_predict_q7(const arm_svm_linear_instance_q7 *S, 
+   const q7_t * in, 
+   int32_t * pResult);
+
+/**
+ * @brief        SVM polynomial instance init function
+ * @param[in]    S                      points to an instance of the polynomial SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    degree                 Polynomial degree
+ * @param[in]    coef0                  coeff0 (scikit-learn terminology)
+ * @param[in]    gamma                  gamma (fractional part)
+ * @param[in]    gammaShift             gamma (exponent)
+ * @return none.
+ *
+ */
+void arm_svm_polynomial_init_q7(arm_svm_polynomial_instance_q7 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q7_t *supportVectors,
+  const int32_t   *classes,
+  int32_t      degree,
+  q15_t coef0,
+  q15_t gamma,
+  int32_t gammaShift
+  );
+
+/**
+ * @brief SVM polynomial prediction
+ * @param[in]    S          Pointer to an instance of the polynomial SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Decision value
+ * @return none.
+ *
+ */
+void arm_svm_polynomial_predict_q7(const arm_svm_polynomial_instance_q7 *S, 
+   const q7_t * in, 
+   int32_t * pResult);
+
+/**
+ * @brief        SVM radial basis function instance init function
+ * @param[in]    S                      points to an instance of the rbf SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    supportVectorsNorms    Array of squared norms of the support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    gamma                  gamma (fractional part)
+ * @param[in]    gammaShift             gamma (exponent)
+ * @return none.
+ *
+ */
+void arm_svm_rbf_init_q7(arm_svm_rbf_instance_q7 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q7_t *supportVectors,
+  const q31_t *supportVectorsNorms,
+  const int32_t   *classes,
+  q15_t gamma,
+  int32_t gammaShift
+  );
+
+/**
+ * @brief SVM rbf prediction
+ * @param[in]    S         Pointer to an instance of the rbf SVM structure.
+ * @param[in]    in        Pointer to input vector
+ * @param[out]   pResult   decision value
+ * @return none.
+ *
+ */
+void arm_svm_rbf_predict_q7(const arm_svm_rbf_instance_q7 *S, 
+   const q7_t * in, 
+   int32_t * pResult);
+
+
+
 
 
 #ifdef   __cplusplus
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * @file     tree_functions.h
+ * @brief    Public header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _TREE_FUNCTIONS_H_
+#define _TREE_FUNCTIONS_H_
+
+#include "arm_math_types.h"
+#include "arm_math_memory.h"
+
+#include "dsp/none.h"
+#include "dsp/utils.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @defgroup groupTree Tree Ensemble Functions
+ * Inference of decision trees, random forests and gradient boosted trees.
+ * The training must be done from scikit-learn. The node arrays are
+ * generated from the scikit-learn object by
+ * DSP/PythonWrapper/treeexport.py
+ *
+ * The nodes of all the trees are in flat arrays (one array per field).
+ * The two children of a node are consecutive in the arrays: the left
+ * child is taken when the feature is lower or equal to the threshold
+ * and the right child otherwise.
+ *
+ * A leaf is its own child and its threshold is never exceeded
+ * (+infinity or 0x7FFF). So each tree is evaluated with a fixed number of
+ * steps (the depth of the tree) and without any branch depending on the data.
+ *
+ * The leaves of a tree are accumulated in the scores starting at
+ * output treeOutputs[t]. With numberOfLeafValues equal to numberOfOutputs
+ * (random forests) each leaf contains a value for each output. With
+ * numberOfLeafValues equal to 1 (gradient boosting) each tree is updating
+ * only one output.
+ *
+ * For a classifier, the predicted class is the index of the maximum score
+ * (or the sign of the score when there is only one output).
+ */
+
+  /**
+   * @brief Instance structure for the floating-point tree ensemble.
+   */
+  typedef struct
+  {
+          uint32_t numberOfTrees;       /**< number of trees. */
+          uint32_t numberOfNodes;       /**< total number of nodes (internal nodes and leaves). */
+          uint32_t vectorDimension;     /**< dimension of the input vectors. */
+          uint32_t numberOfOutputs;     /**< number of scores. */
+          uint32_t numberOfLeafValues;  /**< number of values in each leaf (1 or numberOfOutputs). */
+    const uint32_t *treeRoots;          /**< index of the root node of each tree. The array is of length numberOfTrees. */
+    const uint16_t *treeDepths;         /**< depth of each tree. The array is of length numberOfTrees. */
+    const uint16_t *treeOutputs;        /**< first output updated by each tree. The array is of length numberOfTrees. */
+    const uint16_t *featureIndexes;     /**< feature compared by each node. The array is of length numberOfNodes. */
+    const float32_t *thresholds;        /**< threshold of each node. The array is of length numberOfNodes. */
+    const uint32_t *leftChildren;       /**< index of the left child of each node (the right child is the next one). The array is of length numberOfNodes. */
+    const uint32_t *leafIndexes;        /**< index of the values of each leaf in leafValues. The array is of length numberOfNodes. */
+    const float32_t *leafValues;        /**< values of the leaves. numberOfLeafValues values per leaf. */
+    const float32_t *baseValues;        /**< initial scores. The array is of length numberOfOutputs. */
+  } arm_tree_ensemble_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 tree ensemble.
+   */
+  typedef struct
+  {
+          uint32_t numberOfTrees;       /**< number of trees. */
+          uint32_t numberOfNodes;       /**< total number of nodes (internal nodes and leaves). */
+          uint32_t vectorDimension;     /**< dimension of the input vectors. */
+          uint32_t numberOfOutputs;     /**< number of scores. */
+          uint32_t numberOfLeafValues;  /**< number of values in each leaf (1 or numberOfOutputs). */
+    const uint32_t *treeRoots;          /**< index of the root node of each tree. The array is of length numberOfTrees. */
+    const uint16_t *treeDepths;         /**< depth of each tree. The array is of length numberOfTrees. */
+    const uint16_t *treeOutputs;        /**< first output updated by each tree. The array is of length numberOfTrees. */
+    const uint16_t *featureIndexes;     /**< feature compared by each node. The array is of length numberOfNodes. */
+    const q15_t *thresholds;            /**< threshold of each node. The array is of length numberOfNodes. */
+    const uint32_t *leftChildren;       /**< index of the left child of each node (the right child is the next one). The array is of length numberOfNodes. */
+    const uint32_t *leafIndexes;        /**< index of the values of each leaf in leafValues. The array is of length numberOfNodes. */
+    const q15_t *leafValues;            /**< values of the leaves. numberOfLeafValues values per leaf. */
+    const q31_t *baseValues;            /**< initial scores in Q16.15. The array is of length numberOfOutputs. */
+  } arm_tree_ensemble_instance_q15;
+
+  /**
+   * @brief Floating-point tree ensemble prediction.
+   * @param[in]  S          points to an instance of the floating-point tree ensemble structure.
+   * @param[in]  pSrc       points to the input vectors. One row of vectorDimension samples per vector.
+   * @param[in]  nbVectors  number of input vectors.
+   * @param[out] pScores    points to the scores. One row of numberOfOutputs samples per vector.
+   */
+  void arm_tree_ensemble_predict_f32(
+  const arm_tree_ensemble_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t nbVectors,
+        float32_t * pScores);
+
+  /**
+   * @brief Q15 tree ensemble prediction.
+   * @param[in]  S          points to an instance of the Q15 tree ensemble structure.
+   * @param[in]  pSrc       points to the input vectors. One row of vectorDimension samples per vector.
+   * @param[in]  nbVectors  number of input vectors.
+   * @param[out] pScores    points to the scores in Q16.15. One row of numberOfOutputs samples per vector.
+   */
+  void arm_tree_ensemble_predict_q15(
+  const arm_tree_ensemble_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t nbVectors,
+        q31_t * pScores);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _TREE_FUNCTIONS_H_ */
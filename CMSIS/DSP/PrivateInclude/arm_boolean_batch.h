@@ -0,0 +1,212 @@
+/******************************************************************************
+ * @file     arm_boolean_batch.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_BOOLEAN_BATCH_H_
+#define _ARM_BOOLEAN_BATCH_H_
+
+#include "arm_math_types.h"
+#include "arm_common_tables.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Popcount kernels shared by the one-to-many boolean distances.
+ *
+ * The booleans are packed as in arm_boolean_distance : the full words
+ * are entirely used and the last numberOfBools % 32 booleans are in
+ * the most significant bits of the last word.
+ */
+
+/**
+ * @brief  Number of words of a packed vector of booleans
+ * @param[in]  numberOfBools  Number of booleans
+ * @return number of words
+ */
+__STATIC_FORCEINLINE uint32_t arm_boolean_words(uint32_t numberOfBools)
+{
+  return ((numberOfBools + 31U) >> 5);
+}
+
+/**
+ * @brief  Mask of the valid booleans of the last word
+ * @param[in]  numberOfBools  Number of booleans
+ * @return mask
+ */
+__STATIC_FORCEINLINE uint32_t arm_boolean_last_mask(uint32_t numberOfBools)
+{
+  uint32_t rem = numberOfBools & 31U;
+
+  return ((rem == 0U) ? 0xFFFFFFFFU : (0xFFFFFFFFU << (32U - rem)));
+}
+
+/**
+ * @brief  Number of bits set in a word (SWAR)
+ * @param[in]  x  word
+ * @return number of bits set
+ */
+__STATIC_FORCEINLINE uint32_t arm_popcount_u32(uint32_t x)
+{
+  x = x - ((x >> 1) & 0x55555555U);
+  x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+  x = (x + (x >> 4)) & 0x0F0F0F0FU;
+
+  return ((x * 0x01010101U) >> 24);
+}
+
+/**
+ * @brief  Popcounts of A xor B and A or B
+ * @param[in]  pA        First vector of packed booleans
+ * @param[in]  pB        Second vector of packed booleans
+ * @param[in]  numWords  Number of words of the vectors
+ * @param[in]  lastMask  Mask of the valid booleans of the last word
+ * @param[out] pXor      Number of booleans which are different
+ * @param[out] pOr       Number of booleans which are true in A or B.
+ *                       Not computed when NULL.
+ *
+ * When numWords is 0, no word is read and both counts are 0.
+ */
+__STATIC_FORCEINLINE void arm_boolean_popcount_xor_or(
+  const uint32_t * pA,
+  const uint32_t * pB,
+  uint32_t numWords,
+  uint32_t lastMask,
+  uint32_t * pXor,
+  uint32_t * pOr)
+{
+  uint32_t cXor = 0U, cOr = 0U;
+  uint32_t a, b;
+  uint32_t blkCnt;
+
+  if (numWords == 0U)
+  {
+    *pXor = 0U;
+    if (pOr != NULL)
+    {
+      *pOr = 0U;
+    }
+    return;
+  }
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+  /* 128 booleans per iteration : byte popcounts from hwLUT */
+  blkCnt = (numWords - 1U) >> 2;
+  while (blkCnt > 0U)
+  {
+    uint8x16_t vecA = vld1q((const uint8_t *) pA);
+    uint8x16_t vecB = vld1q((const uint8_t *) pB);
+
+    cXor += vaddvq(vldrbq_gather_offset_u8(hwLUT, veorq(vecA, vecB)));
+    if (pOr != NULL)
+    {
+      cOr += vaddvq(vldrbq_gather_offset_u8(hwLUT, vorrq(vecA, vecB)));
+    }
+
+    pA += 4;
+    pB += 4;
+    blkCnt--;
+  }
+  blkCnt = (numWords - 1U) & 3U;
+#else
+  blkCnt = numWords - 1U;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    a = *pA++;
+    b = *pB++;
+
+    cXor += arm_popcount_u32(a ^ b);
+    cOr += arm_popcount_u32(a | b);
+
+    blkCnt--;
+  }
+
+  /* Last word with the unused booleans removed */
+  a = *pA & lastMask;
+  b = *pB & lastMask;
+
+  cXor += arm_popcount_u32(a ^ b);
+  cOr += arm_popcount_u32(a | b);
+
+  *pXor = cXor;
+  if (pOr != NULL)
+  {
+    *pOr = cOr;
+  }
+}
+
+/**
+ * @brief  Inserts a distance in a sorted list of the k smallest ones
+ * @param[in]     dist    Distance
+ * @param[in]     index   Index of the distance
+ * @param[in,out] pDist   Sorted distances
+ * @param[in,out] pIndex  Indices of the sorted distances
+ * @param[in]     nb      Number of distances in the list
+ * @param[in]     k       Size of the list
+ * @return new number of distances in the list
+ *
+ * Equal distances are ranked by increasing index since the indices are
+ * inserted in increasing order.
+ */
+__STATIC_FORCEINLINE uint32_t arm_boolean_topk_insert(
+  float32_t dist,
+  uint32_t index,
+  float32_t * pDist,
+  uint32_t * pIndex,
+  uint32_t nb,
+  uint32_t k)
+{
+  uint32_t pos;
+
+  if (nb == k)
+  {
+    if (dist >= pDist[k - 1U])
+    {
+      return (nb);
+    }
+    nb--;
+  }
+
+  pos = nb;
+  while ((pos > 0U) && (pDist[pos - 1U] > dist))
+  {
+    pDist[pos] = pDist[pos - 1U];
+    pIndex[pos] = pIndex[pos - 1U];
+    pos--;
+  }
+  pDist[pos] = dist;
+  pIndex[pos] = index;
+
+  return (nb + 1U);
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_BOOLEAN_BATCH_H_ */
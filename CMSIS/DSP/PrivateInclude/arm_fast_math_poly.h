@@ -0,0 +1,553 @@
+/******************************************************************************
+ * @file     arm_fast_math_poly.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_FAST_MATH_POLY_H_
+#define _ARM_FAST_MATH_POLY_H_
+
+#include "arm_math_types.h"
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_math.h"
+#endif
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Polynomial kernels shared by the transcendental functions
+ * (arm_vexp2_f32, arm_vlog2_f32, arm_vtanh_f32, arm_vsigmoid_f32,
+ * arm_vpow_f32, arm_atan2_f32 and their f16 variants).
+ *
+ * The scalar and the Helium versions use the same range reductions
+ * and the same minimax coefficients so that the error bounds given in
+ * the documentation of the functions hold for both paths.
+ */
+
+#define ARM_POLY_LOG2E          1.44269504f
+#define ARM_POLY_LN2_HI         0.693359375f
+#define ARM_POLY_LN2_LO        -2.12194440e-4f
+
+/* exp(x) overflows above and is not normal below */
+#define ARM_POLY_EXP_MAX        88.7228394f
+#define ARM_POLY_EXP_MIN       -87.3365479f
+
+/* exp(r) = 1 + r + r^2.(C0 + C1.r + ... + C4.r^4) for r in [-ln(2)/2, ln(2)/2] */
+#define ARM_POLY_EXP_C0         0.499999996f
+#define ARM_POLY_EXP_C1         0.166665773f
+#define ARM_POLY_EXP_C2         0.0416668534f
+#define ARM_POLY_EXP_C3         0.00836314052f
+#define ARM_POLY_EXP_C4         0.00139012829f
+
+/* 2^f = 1 + f.(C0 + C1.f + ... + C5.f^5) for f in [-0.5, 0.5] */
+#define ARM_POLY_EXP2_C0        0.693147188f
+#define ARM_POLY_EXP2_C1        0.240226498f
+#define ARM_POLY_EXP2_C2        0.0555035743f
+#define ARM_POLY_EXP2_C3        0.0096182375f
+#define ARM_POLY_EXP2_C4        0.00133907357f
+#define ARM_POLY_EXP2_C5        0.000154035104f
+
+/* log2(1+f) = f.(L_HI + L_LO) + f^2.(C0 + C1.f + ... + C8.f^8) for 1+f in [sqrt(2)/2, sqrt(2)] */
+#define ARM_POLY_LOG2_L_HI      1.44269502f
+#define ARM_POLY_LOG2_L_LO      1.92596303e-8f
+#define ARM_POLY_LOG2_C0       -0.72134749f
+#define ARM_POLY_LOG2_C1        0.480898235f
+#define ARM_POLY_LOG2_C2       -0.360684718f
+#define ARM_POLY_LOG2_C3        0.288562274f
+#define ARM_POLY_LOG2_C4       -0.239884261f
+#define ARM_POLY_LOG2_C5        0.20481616f
+#define ARM_POLY_LOG2_C6       -0.18915694f
+#define ARM_POLY_LOG2_C7        0.184270763f
+#define ARM_POLY_LOG2_C8       -0.112224897f
+
+/* tanh(x) = x + x^3.(C0 + C1.x^2 + ... + C4.x^8) for |x| < ARM_POLY_TANH_SMALL */
+#define ARM_POLY_TANH_SMALL     0.625f
+#define ARM_POLY_TANH_SAT       9.01091290f
+#define ARM_POLY_TANH_C0       -0.333332819f
+#define ARM_POLY_TANH_C1        0.133314422f
+#define ARM_POLY_TANH_C2       -0.0537397126f
+#define ARM_POLY_TANH_C3        0.0206390795f
+#define ARM_POLY_TANH_C4       -0.00570497871f
+
+/* atan(a) = a + a^3.(C0 + C1.a^2 + ... + C4.a^8) for |a| <= tan(pi/8) */
+#define ARM_POLY_TAN_PI_8       0.414213562f
+#define ARM_POLY_ATAN_BIG       1.0e37f
+#define ARM_POLY_ATAN_TINY      1.0e-19f
+#define ARM_POLY_PI_HI          3.14159274f
+#define ARM_POLY_PI_LO         -8.74227766e-8f
+#define ARM_POLY_PI_2_HI        1.57079637f
+#define ARM_POLY_PI_2_LO       -4.37113883e-8f
+#define ARM_POLY_PI_4_HI        0.785398185f
+#define ARM_POLY_PI_4_LO       -2.18556941e-8f
+#define ARM_POLY_ATAN_C0       -0.333333152f
+#define ARM_POLY_ATAN_C1        0.199984715f
+#define ARM_POLY_ATAN_C2       -0.142435329f
+#define ARM_POLY_ATAN_C3        0.105938105f
+#define ARM_POLY_ATAN_C4       -0.060782136f
+
+typedef union
+{
+    float32_t f;
+    int32_t   i;
+} arm_poly_any32_t;
+
+/* p.2^n for n in [-126, 128] */
+__STATIC_FORCEINLINE float32_t arm_poly_scale_f32(float32_t p, int32_t n)
+{
+    arm_poly_any32_t s;
+
+    if (n > 127)
+    {
+        p = p * 2.0f;
+        n = n - 1;
+    }
+    s.i = (n + 127) << 23;
+    return (p * s.f);
+}
+
+__STATIC_INLINE float32_t arm_poly_exp_f32(float32_t x)
+{
+    float32_t r, p;
+    int32_t n;
+
+    if (x != x)
+    {
+        return (x);
+    }
+    if (x > ARM_POLY_EXP_MAX)
+    {
+        return (INFINITY);
+    }
+    if (x < ARM_POLY_EXP_MIN)
+    {
+        return (0.0f);
+    }
+
+    /* x = n.ln(2) + r with |r| <= ln(2)/2 */
+    n = (int32_t) (x * ARM_POLY_LOG2E + ((x < 0.0f) ? -0.5f : 0.5f));
+    r = x - (float32_t) n * ARM_POLY_LN2_HI;
+    r = r - (float32_t) n * ARM_POLY_LN2_LO;
+
+    p = ARM_POLY_EXP_C4;
+    p = p * r + ARM_POLY_EXP_C3;
+    p = p * r + ARM_POLY_EXP_C2;
+    p = p * r + ARM_POLY_EXP_C1;
+    p = p * r + ARM_POLY_EXP_C0;
+    p = 1.0f + (r + (r * r) * p);
+
+    return (arm_poly_scale_f32(p, n));
+}
+
+__STATIC_INLINE float32_t arm_poly_exp2_f32(float32_t x)
+{
+    float32_t f, p;
+    int32_t n;
+
+    if (x != x)
+    {
+        return (x);
+    }
+    if (x >= 128.0f)
+    {
+        return (INFINITY);
+    }
+    if (x < -126.0f)
+    {
+        return (0.0f);
+    }
+
+    /* x = n + f with |f| <= 0.5 */
+    n = (int32_t) (x + ((x < 0.0f) ? -0.5f : 0.5f));
+    f = x - (float32_t) n;
+
+    p = ARM_POLY_EXP2_C5;
+    p = p * f + ARM_POLY_EXP2_C4;
+    p = p * f + ARM_POLY_EXP2_C3;
+    p = p * f + ARM_POLY_EXP2_C2;
+    p = p * f + ARM_POLY_EXP2_C1;
+    p = p * f + ARM_POLY_EXP2_C0;
+    p = 1.0f + f * p;
+
+    return (arm_poly_scale_f32(p, n));
+}
+
+__STATIC_INLINE float32_t arm_poly_log2_f32(float32_t x)
+{
+    arm_poly_any32_t m;
+    float32_t f, p;
+    int32_t e;
+
+    if (x < 0.0f)
+    {
+        return (NAN);
+    }
+    if (x == 0.0f)
+    {
+        return (-INFINITY);
+    }
+    if ((x != x) || (x == INFINITY))
+    {
+        return (x);
+    }
+
+    /* x = 2^e.(1+f) with 1+f in [sqrt(2)/2, sqrt(2)] */
+    m.f = x;
+    e = 0;
+    if (m.i < 0x00800000)
+    {
+        /* Subnormal input */
+        m.f = m.f * 8388608.0f;
+        e = -23;
+    }
+    m.i = m.i - 0x3F3504F3;
+    e = e + (m.i >> 23);
+    m.i = (m.i & 0x007FFFFF) + 0x3F3504F3;
+    f = m.f - 1.0f;
+
+    p = ARM_POLY_LOG2_C8;
+    p = p * f + ARM_POLY_LOG2_C7;
+    p = p * f + ARM_POLY_LOG2_C6;
+    p = p * f + ARM_POLY_LOG2_C5;
+    p = p * f + ARM_POLY_LOG2_C4;
+    p = p * f + ARM_POLY_LOG2_C3;
+    p = p * f + ARM_POLY_LOG2_C2;
+    p = p * f + ARM_POLY_LOG2_C1;
+    p = p * f + ARM_POLY_LOG2_C0;
+    p = f * ARM_POLY_LOG2_L_LO + (f * f) * p;
+
+    return ((float32_t) e + (f * ARM_POLY_LOG2_L_HI + p));
+}
+
+__STATIC_INLINE float32_t arm_poly_tanh_f32(float32_t x)
+{
+    float32_t ax, x2, p;
+
+    ax = (x < 0.0f) ? -x : x;
+
+    if (ax < ARM_POLY_TANH_SMALL)
+    {
+        x2 = x * x;
+        p = ARM_POLY_TANH_C4;
+        p = p * x2 + ARM_POLY_TANH_C3;
+        p = p * x2 + ARM_POLY_TANH_C2;
+        p = p * x2 + ARM_POLY_TANH_C1;
+        p = p * x2 + ARM_POLY_TANH_C0;
+        return (x + (x * x2) * p);
+    }
+
+    if (ax > ARM_POLY_TANH_SAT)
+    {
+        p = 1.0f;
+    }
+    else
+    {
+        /* tanh(|x|) = 1 - 2 / (exp(2|x|) + 1) */
+        p = 1.0f - 2.0f / (arm_poly_exp_f32(2.0f * ax) + 1.0f);
+    }
+
+    if (x != x)
+    {
+        return (x);
+    }
+    return ((x < 0.0f) ? -p : p);
+}
+
+__STATIC_INLINE float32_t arm_poly_sigmoid_f32(float32_t x)
+{
+    return (1.0f / (1.0f + arm_poly_exp_f32(-x)));
+}
+
+__STATIC_INLINE float32_t arm_poly_pow_f32(float32_t x, float32_t y)
+{
+    if (y == 0.0f)
+    {
+        return (1.0f);
+    }
+    if (x == 0.0f)
+    {
+        return ((y > 0.0f) ? 0.0f : INFINITY);
+    }
+    return (arm_poly_exp2_f32(y * arm_poly_log2_f32(x)));
+}
+
+__STATIC_INLINE float32_t arm_poly_atan2_f32(float32_t y, float32_t x)
+{
+    float32_t ax, ay, mx, mn, num, den, a, a2, p;
+    int32_t reduced;
+
+    ax = (x < 0.0f) ? -x : x;
+    ay = (y < 0.0f) ? -y : y;
+    mx = (ay > ax) ? ay : ax;
+    mn = (ay > ax) ? ax : ay;
+
+    if (mx == 0.0f)
+    {
+        return (0.0f);
+    }
+    if (mx > ARM_POLY_ATAN_BIG)
+    {
+        /* Avoid the overflow of mn + mx */
+        mx = mx * 0.0625f;
+        mn = mn * 0.0625f;
+    }
+
+    /* atan(mn/mx) = pi/4 + atan((mn-mx)/(mn+mx)) when mn/mx > tan(pi/8) */
+    reduced = (mn > ARM_POLY_TAN_PI_8 * mx);
+    num = reduced ? (mn - mx) : mn;
+    den = reduced ? (mn + mx) : mx;
+    a = num / den;
+
+    a2 = a * a;
+    p = ARM_POLY_ATAN_C4;
+    p = p * a2 + ARM_POLY_ATAN_C3;
+    p = p * a2 + ARM_POLY_ATAN_C2;
+    p = p * a2 + ARM_POLY_ATAN_C1;
+    p = p * a2 + ARM_POLY_ATAN_C0;
+    p = a + (a * a2) * p;
+
+    if (reduced)
+    {
+        p = ARM_POLY_PI_4_HI + (p + ARM_POLY_PI_4_LO);
+    }
+    if (ay > ax)
+    {
+        p = ARM_POLY_PI_2_HI - (p - ARM_POLY_PI_2_LO);
+    }
+    if (x < 0.0f)
+    {
+        p = ARM_POLY_PI_HI - (p - ARM_POLY_PI_LO);
+    }
+    return ((y < 0.0f) ? -p : p);
+}
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/* p.2^n for n in [-126, 128] */
+__STATIC_INLINE f32x4_t vpoly_scaleq_f32(f32x4_t p, int32x4_t n)
+{
+    any32x4_t       s;
+    mve_pred16_t    p0 = vcmpgtq_n_s32(n, 127);
+
+    p = vmulq_m_n_f32(p, p, 2.0f, p0);
+    n = vsubq_m_n_s32(n, n, 1, p0);
+    s.i = vshlq_n_s32(vaddq_n_s32(n, 127), 23);
+    return vmulq(p, s.f);
+}
+
+__STATIC_INLINE f32x4_t vexpq_hiprec_f32(f32x4_t x)
+{
+    f32x4_t         xc, nf, r, p;
+    int32x4_t       n;
+
+    xc = vminnmq(vmaxnmq(x, vdupq_n_f32(ARM_POLY_EXP_MIN)), vdupq_n_f32(ARM_POLY_EXP_MAX));
+
+    /* x = n.ln(2) + r with |r| <= ln(2)/2 */
+    n = vcvtaq_s32_f32(vmulq_n_f32(xc, ARM_POLY_LOG2E));
+    nf = vcvtq_f32_s32(n);
+    r = vfmsq(xc, nf, vdupq_n_f32(ARM_POLY_LN2_HI));
+    r = vfmsq(r, nf, vdupq_n_f32(ARM_POLY_LN2_LO));
+
+    p = vdupq_n_f32(ARM_POLY_EXP_C4);
+    p = vfmasq(p, r, ARM_POLY_EXP_C3);
+    p = vfmasq(p, r, ARM_POLY_EXP_C2);
+    p = vfmasq(p, r, ARM_POLY_EXP_C1);
+    p = vfmasq(p, r, ARM_POLY_EXP_C0);
+    p = vfmaq(r, vmulq(r, r), p);
+    p = vaddq_n_f32(p, 1.0f);
+
+    p = vpoly_scaleq_f32(p, n);
+    p = vdupq_m(p, INFINITY, vcmpgtq(x, ARM_POLY_EXP_MAX));
+    p = vdupq_m(p, 0.0f, vcmpltq(x, ARM_POLY_EXP_MIN));
+    /* propagate NaN */
+    p = vpselq(x, p, vcmpneq(x, x));
+    return p;
+}
+
+__STATIC_INLINE f32x4_t vexp2q_f32(f32x4_t x)
+{
+    f32x4_t         xc, f, p;
+    int32x4_t       n;
+
+    xc = vminnmq(vmaxnmq(x, vdupq_n_f32(-126.0f)), vdupq_n_f32(128.0f));
+
+    /* x = n + f with |f| <= 0.5 */
+    n = vcvtaq_s32_f32(xc);
+    f = vsubq(xc, vcvtq_f32_s32(n));
+
+    p = vdupq_n_f32(ARM_POLY_EXP2_C5);
+    p = vfmasq(p, f, ARM_POLY_EXP2_C4);
+    p = vfmasq(p, f, ARM_POLY_EXP2_C3);
+    p = vfmasq(p, f, ARM_POLY_EXP2_C2);
+    p = vfmasq(p, f, ARM_POLY_EXP2_C1);
+    p = vfmasq(p, f, ARM_POLY_EXP2_C0);
+    p = vfmasq(p, f, 1.0f);
+
+    p = vpoly_scaleq_f32(p, n);
+    p = vdupq_m(p, INFINITY, vcmpgeq(x, 128.0f));
+    p = vdupq_m(p, 0.0f, vcmpltq(x, -126.0f));
+    p = vpselq(x, p, vcmpneq(x, x));
+    return p;
+}
+
+__STATIC_INLINE f32x4_t vlog2q_f32(f32x4_t x)
+{
+    any32x4_t       m;
+    f32x4_t         f, p;
+    int32x4_t       e;
+    mve_pred16_t    p0;
+
+    /* x = 2^e.(1+f) with 1+f in [sqrt(2)/2, sqrt(2)] */
+    m.f = x;
+    p0 = vcmpltq_n_s32(m.i, 0x00800000);
+    m.f = vmulq_m_n_f32(m.f, m.f, 8388608.0f, p0);
+    e = vdupq_m_n_s32(vdupq_n_s32(0), -23, p0);
+
+    m.i = vsubq_n_s32(m.i, 0x3F3504F3);
+    e = vaddq(e, vshrq_n_s32(m.i, 23));
+    m.i = vaddq_n_s32(vandq(m.i, vdupq_n_s32(0x007FFFFF)), 0x3F3504F3);
+    f = vsubq_n_f32(m.f, 1.0f);
+
+    p = vdupq_n_f32(ARM_POLY_LOG2_C8);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C7);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C6);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C5);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C4);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C3);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C2);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C1);
+    p = vfmasq(p, f, ARM_POLY_LOG2_C0);
+    p = vfmaq(vmulq_n_f32(f, ARM_POLY_LOG2_L_LO), vmulq(f, f), p);
+    p = vfmaq(p, f, vdupq_n_f32(ARM_POLY_LOG2_L_HI));
+    p = vaddq(vcvtq_f32_s32(e), p);
+
+    p = vdupq_m(p, INFINITY, vcmpeqq(x, INFINITY));
+    p = vdupq_m(p, -INFINITY, vcmpeqq(x, 0.0f));
+    p = vdupq_m(p, NAN, vcmpltq(x, 0.0f));
+    p = vpselq(x, p, vcmpneq(x, x));
+    return p;
+}
+
+__STATIC_INLINE f32x4_t vtanhq_hiprec_f32(f32x4_t x)
+{
+    f32x4_t         ax, x2, ps, pl;
+
+    ax = vabsq(x);
+
+    /* Small inputs : odd polynomial */
+    x2 = vmulq(x, x);
+    ps = vdupq_n_f32(ARM_POLY_TANH_C4);
+    ps = vfmasq(ps, x2, ARM_POLY_TANH_C3);
+    ps = vfmasq(ps, x2, ARM_POLY_TANH_C2);
+    ps = vfmasq(ps, x2, ARM_POLY_TANH_C1);
+    ps = vfmasq(ps, x2, ARM_POLY_TANH_C0);
+    ps = vfmaq(x, vmulq(x, x2), ps);
+
+    /* Other inputs : tanh(|x|) = 1 - 2 / (exp(2|x|) + 1) */
+    pl = vexpq_hiprec_f32(vmulq_n_f32(vminnmq(ax, vdupq_n_f32(ARM_POLY_TANH_SAT)), 2.0f));
+    pl = vrecip_hiprec_f32(vaddq_n_f32(pl, 1.0f));
+    pl = vfmsq(vdupq_n_f32(1.0f), pl, vdupq_n_f32(2.0f));
+    pl = vdupq_m(pl, 1.0f, vcmpgtq(ax, ARM_POLY_TANH_SAT));
+    pl = vnegq_m(pl, pl, vcmpltq(x, 0.0f));
+
+    pl = vpselq(ps, pl, vcmpltq(ax, ARM_POLY_TANH_SMALL));
+    pl = vpselq(x, pl, vcmpneq(x, x));
+    return pl;
+}
+
+__STATIC_INLINE f32x4_t vsigmoidq_f32(f32x4_t x)
+{
+    f32x4_t         p;
+
+    p = vexpq_hiprec_f32(vnegq(x));
+    p = vrecip_hiprec_f32(vaddq_n_f32(p, 1.0f));
+    /* exp(-x) is infinite */
+    p = vdupq_m(p, 0.0f, vcmpltq(x, -ARM_POLY_EXP_MAX));
+    p = vpselq(x, p, vcmpneq(x, x));
+    return p;
+}
+
+__STATIC_INLINE f32x4_t vpowq_hiprec_f32(f32x4_t x, f32x4_t y)
+{
+    f32x4_t         p;
+
+    p = vexp2q_f32(vmulq(y, vlog2q_f32(x)));
+    p = vdupq_m(p, 1.0f, vcmpeqq(y, 0.0f));
+    return p;
+}
+
+__STATIC_INLINE f32x4_t vatan2q_f32(f32x4_t y, f32x4_t x)
+{
+    f32x4_t         ax, ay, mx, mn, num, den, a, a2, p, t;
+    mve_pred16_t    reduced, swapped, p0;
+
+    ax = vabsq(x);
+    ay = vabsq(y);
+    swapped = vcmpgtq(ay, ax);
+    mx = vmaxnmq(ax, ay);
+    mn = vminnmq(ax, ay);
+
+    /* Avoid the overflow of mn + mx */
+    p0 = vcmpgtq(mx, ARM_POLY_ATAN_BIG);
+    mx = vmulq_m_n_f32(mx, mx, 0.0625f, p0);
+    mn = vmulq_m_n_f32(mn, mn, 0.0625f, p0);
+    /* Keep mn + mx in the range of vrecip_hiprec_f32 */
+    p0 = vcmpltq(mx, ARM_POLY_ATAN_TINY);
+    mx = vmulq_m_n_f32(mx, mx, 1.8446744e19f, p0);
+    mn = vmulq_m_n_f32(mn, mn, 1.8446744e19f, p0);
+
+    /* atan(mn/mx) = pi/4 + atan((mn-mx)/(mn+mx)) when mn/mx > tan(pi/8) */
+    reduced = vcmpgtq(mn, vmulq_n_f32(mx, ARM_POLY_TAN_PI_8));
+    num = vsubq_m(mn, mn, mx, reduced);
+    den = vaddq_m(mx, mn, mx, reduced);
+    a = vdiv_f32(num, den);
+
+    a2 = vmulq(a, a);
+    p = vdupq_n_f32(ARM_POLY_ATAN_C4);
+    p = vfmasq(p, a2, ARM_POLY_ATAN_C3);
+    p = vfmasq(p, a2, ARM_POLY_ATAN_C2);
+    p = vfmasq(p, a2, ARM_POLY_ATAN_C1);
+    p = vfmasq(p, a2, ARM_POLY_ATAN_C0);
+    p = vfmaq(a, vmulq(a, a2), p);
+
+    t = vaddq_n_f32(vaddq_n_f32(p, ARM_POLY_PI_4_LO), ARM_POLY_PI_4_HI);
+    p = vpselq(t, p, reduced);
+    t = vsubq(vdupq_n_f32(ARM_POLY_PI_2_HI), vsubq_n_f32(p, ARM_POLY_PI_2_LO));
+    p = vpselq(t, p, swapped);
+    t = vsubq(vdupq_n_f32(ARM_POLY_PI_HI), vsubq_n_f32(p, ARM_POLY_PI_LO));
+    p = vpselq(t, p, vcmpltq(x, 0.0f));
+    p = vnegq_m(p, p, vcmpltq(y, 0.0f));
+
+    p = vdupq_m(p, 0.0f, vcmpeqq(mx, 0.0f));
+    return p;
+}
+
+#endif /* (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_FAST_MATH_POLY_H_ */
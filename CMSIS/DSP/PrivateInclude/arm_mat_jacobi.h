@@ -0,0 +1,120 @@
+/******************************************************************************
+ * @file     arm_mat_jacobi.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_MAT_JACOBI_H_
+#define _ARM_MAT_JACOBI_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Plane rotations shared by the Jacobi solvers (arm_mat_eig_sym_f32
+ * and arm_mat_svd_f32).
+ */
+
+/* Maximum number of sweeps before ARM_MATH_DECOMPOSITION_FAILURE */
+#define ARM_MAT_JACOBI_MAX_SWEEPS 32
+
+/* x = c x - s y and y = s x + c y on two rows of n elements */
+__STATIC_INLINE void arm_mat_jacobi_rotate_rows_f32(
+  float32_t * pX,
+  float32_t * pY,
+  float32_t c,
+  float32_t s,
+  uint32_t n)
+{
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  int32_t blkCnt = (int32_t)n;
+  f32x4_t vecX, vecY, vecNX, vecNY;
+
+  while (blkCnt > 0)
+  {
+    mve_pred16_t p0 = vctp32q(blkCnt);
+
+    vecX = vldrwq_z_f32(pX, p0);
+    vecY = vldrwq_z_f32(pY, p0);
+
+    vecNX = vmulq(vecX, c);
+    vecNX = vfmaq(vecNX, vecY, -s);
+
+    vecNY = vmulq(vecY, c);
+    vecNY = vfmaq(vecNY, vecX, s);
+
+    vstrwq_p(pX, vecNX, p0);
+    vstrwq_p(pY, vecNY, p0);
+
+    pX += 4;
+    pY += 4;
+    blkCnt -= 4;
+  }
+#else
+  uint32_t blkCnt;
+  float32_t x, y;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  blkCnt = n >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    x = pX[0];
+    y = pY[0];
+    pX[0] = c * x - s * y;
+    pY[0] = s * x + c * y;
+
+    x = pX[1];
+    y = pY[1];
+    pX[1] = c * x - s * y;
+    pY[1] = s * x + c * y;
+
+    pX += 2;
+    pY += 2;
+    blkCnt--;
+  }
+
+  blkCnt = n & 0x1U;
+#else
+  blkCnt = n;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    x = *pX;
+    y = *pY;
+    *pX++ = c * x - s * y;
+    *pY++ = s * x + c * y;
+    blkCnt--;
+  }
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_MAT_JACOBI_H_ */
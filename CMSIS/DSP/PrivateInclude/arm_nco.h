@@ -0,0 +1,171 @@
+/******************************************************************************
+ * @file     arm_nco.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_NCO_H_
+#define _ARM_NCO_H_
+
+#include "arm_math_types.h"
+#include "dsp/complex_math_functions.h"
+#include "arm_common_tables.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Oscillator kernels shared by arm_nco_xxx and arm_mix_down_xxx.
+ */
+
+/* Number of 4-sample iterations of the f32 rotators between two resynchronizations */
+#define ARM_NCO_RESYNC_PERIOD    16U
+
+/* Number of table entries in a quarter of a cycle */
+#define ARM_NCO_QUARTER          (FAST_MATH_TABLE_SIZE / 4)
+
+/* pi in Q2.29 */
+#define ARM_NCO_PI_Q29           0x6487ED51
+
+/**
+ * @brief  Floating-point cosine and sine of a phase.
+ * @param[in]  phase  phase. 2^32 is one cycle.
+ * @param[out] pRe    cosine of the phase
+ * @param[out] pIm    sine of the phase
+ */
+__STATIC_FORCEINLINE void arm_nco_cis_f32(
+  uint32_t phase,
+  float32_t * pRe,
+  float32_t * pIm)
+{
+  /* The phase is read as a signed value to stay in [-pi pi] */
+  float32_t theta = (float32_t) (int32_t) phase * (2.0f * PI / 4294967296.0f);
+
+  *pRe = cosf(theta);
+  *pIm = sinf(theta);
+}
+
+/**
+ * @brief  Recomputes the 4 floating-point rotators from the phase accumulator.
+ * @param[in,out] S     points to an instance of the NCO
+ *
+ * The recursion of the rotators accumulates rounding errors on the
+ * amplitude and on the phase. Restarting it from the phase accumulator
+ * bounds those errors to the ones of ARM_NCO_RESYNC_PERIOD iterations.
+ */
+__STATIC_FORCEINLINE void arm_nco_resync_f32(
+  arm_nco_instance_f32 * S)
+{
+  float32_t re, im;
+  uint32_t k;
+
+  arm_nco_cis_f32(S->phase, &re, &im);
+
+  S->stateRe[0] = re;
+  S->stateIm[0] = im;
+  for (k = 1U; k < 4U; k++)
+  {
+    S->stateRe[k] = re * S->stepRe[k - 1U] - im * S->stepIm[k - 1U];
+    S->stateIm[k] = re * S->stepIm[k - 1U] + im * S->stepRe[k - 1U];
+  }
+}
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_Q31)
+/**
+ * @brief  Q31 sine and cosine of a phase.
+ * @param[in]  phase  phase. 2^32 is one cycle.
+ * @param[out] pSin   sine of the phase
+ * @param[out] pCos   cosine of the phase
+ *
+ * The table gives sin(a) and cos(a) at the nearest lower entry and the
+ * remaining angle d (below 2.pi/512) is added with
+ * sin(a+d) = sin(a).cos(d) + cos(a).sin(d) where sin(d) and 1 - cos(d)
+ * are short Taylor expansions.
+ */
+__STATIC_FORCEINLINE void arm_nco_sincos_q31(
+  uint32_t phase,
+  q31_t * pSin,
+  q31_t * pCos)
+{
+  uint32_t index;
+  q31_t s, c, d, d2, sd, omc;
+  q63_t acc;
+
+  index = phase >> 23;
+  s = sinTable_q31[index];
+  c = sinTable_q31[(index + ARM_NCO_QUARTER) & (FAST_MATH_TABLE_SIZE - 1)];
+
+  /* Remaining angle in radians (Q31) */
+  d = (q31_t) (((q63_t) (phase & 0x7FFFFFU) * ARM_NCO_PI_Q29) >> 29);
+  d2 = (q31_t) (((q63_t) d * d) >> 31);
+
+  /* sin(d) = d - d^3/6 and 1 - cos(d) = d^2/2 - d^4/24 */
+  sd = d - (q31_t) (((q63_t) d2 * d) >> 31) / 6;
+  omc = (d2 >> 1) - (q31_t) (((q63_t) d2 * d2) >> 31) / 24;
+
+  acc = ((q63_t) s << 31) - (q63_t) s * omc + (q63_t) c * sd;
+  *pSin = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+  acc = ((q63_t) c << 31) - (q63_t) c * omc - (q63_t) s * sd;
+  *pCos = clip_q63_to_q31((acc + 0x40000000) >> 31);
+}
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_Q15)
+/**
+ * @brief  Q15 sine and cosine of a phase.
+ * @param[in]  phase  phase. 2^32 is one cycle.
+ * @param[out] pSin   sine of the phase
+ * @param[out] pCos   cosine of the phase
+ *
+ * Linear interpolation in the table. The cosine uses the same
+ * interpolation weight a quarter of a cycle further.
+ */
+__STATIC_FORCEINLINE void arm_nco_sincos_q15(
+  uint32_t phase,
+  q15_t * pSin,
+  q15_t * pCos)
+{
+  uint32_t index;
+  q31_t fract, a, b;
+
+  index = phase >> 23;
+  fract = (q31_t) ((phase >> 8) & 0x7FFFU);
+
+  a = sinTable_q15[index];
+  b = sinTable_q15[index + 1U];
+  *pSin = (q15_t) (a + (((b - a) * fract + 0x4000) >> 15));
+
+  index = (index + ARM_NCO_QUARTER) & (FAST_MATH_TABLE_SIZE - 1);
+  a = sinTable_q15[index];
+  b = sinTable_q15[index + 1U];
+  *pCos = (q15_t) (a + (((b - a) * fract + 0x4000) >> 15));
+}
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_NCO_H_ */
@@ -0,0 +1,165 @@
+/******************************************************************************
+ * @file     arm_svm_fixed.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.10.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _ARM_SVM_FIXED_H_
+#define _ARM_SVM_FIXED_H_
+
+#include "arm_math_types.h"
+#include "dsp/none.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Kernel evaluation shared by the q15 and q7 SVM predictors.
+ *
+ * The dot products and squared distances are given in Q30 in a q63
+ * (Q14 q7 results are shifted by 16). gamma is a q15 value scaled by
+ * 2^gammaShift. The kernel values are in Q31 and are combined with the
+ * q15 dual coefficients in a Q46 accumulator. Only the sign of the
+ * decision value is used, so the dual coefficients and the intercept
+ * can be scaled by any common positive factor.
+ */
+
+/* log2(e) in Q2.30 */
+#define ARM_SVM_LOG2E_Q30      1549082005
+
+/* exp(-z) is 0 in Q31 for z >= 16 (z is in Q4.27) */
+#define ARM_SVM_EXP_LIMIT_Q27  0x7FFFFFFF
+
+/* 2^(-j/64) for j = 0 ... 64 in Q31 */
+static const q31_t arm_svm_exp2_table_q31[65] = {
+  0x7FFFFFFF, 0x7E9F0606, 0x7D41D96E, 0x7BE86FBA, 0x7A92BE8B, 0x7940BB9E,
+  0x77F25CCE, 0x76A7980F, 0x75606374, 0x741CB528, 0x72DC8374, 0x719FC4B9,
+  0x70666F76, 0x6F307A41, 0x6DFDDBCC, 0x6CCE8AE1, 0x6BA27E65, 0x6A79AD56,
+  0x69540EC9, 0x683199ED, 0x6712460B, 0x65F60A7F, 0x64DCDEC3, 0x63C6BA64,
+  0x62B39509, 0x61A3666D, 0x60962665, 0x5F8BCCDB, 0x5E8451D0, 0x5D7FAD59,
+  0x5C7DD7A4, 0x5B7EC8F2, 0x5A82799A, 0x5988E209, 0x5891FAC1, 0x579DBC57,
+  0x56AC1F75, 0x55BD1CDB, 0x54D0AD5A, 0x53E6C9DA, 0x52FF6B55, 0x521A8AD7,
+  0x51382182, 0x50582888, 0x4F7A9930, 0x4E9F6CD4, 0x4DC69CDD, 0x4CF022CA,
+  0x4C1BF829, 0x4B4A169C, 0x4A7A77D4, 0x49AD1598, 0x48E1E9BA, 0x4818EE22,
+  0x47521CC6, 0x468D6FAE, 0x45CAE0F2, 0x450A6ABB, 0x444C0740, 0x438FB0CB,
+  0x42D561B4, 0x421D1462, 0x4166C34C, 0x40B268FA, 0x40000000
+};
+
+/**
+ * @brief  Arithmetic right shift of a q63 value with saturation to q31
+ * @param[in]  x      value
+ * @param[in]  shift  right shift. A negative value is a left shift.
+ * @return saturated result
+ */
+__STATIC_FORCEINLINE q31_t arm_svm_shift_q63_to_q31(q63_t x, int32_t shift)
+{
+  if (shift >= 0)
+  {
+    return (clip_q63_to_q31(x >> shift));
+  }
+
+  /* Left shift : saturate first so that the shift cannot overflow */
+  return (clip_q63_to_q31((q63_t) clip_q63_to_q31(x) << -shift));
+}
+
+/**
+ * @brief  Polynomial kernel (gamma . dot + coef0)^degree
+ * @param[in]  dot         dot product in Q30
+ * @param[in]  gamma       gamma
+ * @param[in]  gammaShift  exponent of gamma
+ * @param[in]  coef0       coef0 in Q15
+ * @param[in]  degree      degree (>= 1)
+ * @return kernel value in Q31
+ */
+__STATIC_FORCEINLINE q31_t arm_svm_poly_kernel_q31(
+  q63_t dot,
+  q15_t gamma,
+  int32_t gammaShift,
+  q15_t coef0,
+  int32_t degree)
+{
+  q31_t t, k;
+
+  /* Q45 -> Q31 */
+  t = arm_svm_shift_q63_to_q31((q63_t) gamma * dot, 14 - gammaShift);
+  t = clip_q63_to_q31((q63_t) t + ((q63_t) coef0 << 16));
+
+  k = t;
+  while (degree > 1)
+  {
+    k = (q31_t) (((q63_t) k * t) >> 31);
+    degree--;
+  }
+
+  return (k);
+}
+
+/**
+ * @brief  RBF kernel exp(-gamma . d2)
+ * @param[in]  d2          squared distance in Q30
+ * @param[in]  gamma       gamma
+ * @param[in]  gammaShift  exponent of gamma
+ * @return kernel value in Q31
+ *
+ * exp(-z) is computed as 2^(-z.log2(e)). The integer part of the
+ * exponent is a shift and the fractional part is interpolated
+ * in a table of 64 intervals (relative error below 2e-5).
+ */
+__STATIC_FORCEINLINE q31_t arm_svm_rbf_kernel_q31(
+  q63_t d2,
+  q15_t gamma,
+  int32_t gammaShift)
+{
+  q31_t z, a, b;
+  q63_t u;
+  uint32_t i, j, r;
+
+  /* Q45 -> Q27 */
+  z = arm_svm_shift_q63_to_q31((q63_t) gamma * d2, 18 - gammaShift);
+  if (z >= ARM_SVM_EXP_LIMIT_Q27)
+  {
+    return (0);
+  }
+
+  /* z.log2(e) in Q27 */
+  u = ((q63_t) z * ARM_SVM_LOG2E_Q30) >> 30;
+
+  i = (uint32_t) (u >> 27);
+  j = (uint32_t) (u >> 21) & 0x3FU;
+  r = (uint32_t) u & 0x1FFFFFU;
+
+  a = arm_svm_exp2_table_q31[j];
+  b = arm_svm_exp2_table_q31[j + 1U];
+  a = a + (q31_t) (((q63_t) (b - a) * r) >> 21);
+
+  /* i is below 24 since z is below 16 */
+  return (a >> i);
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_SVM_FIXED_H_ */
@@ -263,6 +263,9 @@ MATRIXFROMNUMPY(f64,float64_t,double,NPY_DOUBLE);
 MATRIXFROMNUMPY(q31,q31_t,int32_t,NPY_INT32);
 MATRIXFROMNUMPY(q15,q15_t,int16_t,NPY_INT16);
 MATRIXFROMNUMPY(q7,q7_t,int8_t,NPY_BYTE);
+MATRIXFROMNUMPY(f32_ext,float32_t,double,NPY_DOUBLE);
+MATRIXFROMNUMPY(q31_ext,q31_t,int32_t,NPY_INT32);
+MATRIXFROMNUMPY(q15_ext,q15_t,int16_t,NPY_INT16);
 
 #define CREATEMATRIX(EXT,TYP)                                        \
 arm_matrix_instance_##EXT *create##EXT##Matrix(uint32_t r,uint32_t c)\
@@ -281,6 +284,9 @@ CREATEMATRIX(f64,float64_t);
 CREATEMATRIX(q31,q31_t);
 CREATEMATRIX(q15,q15_t);
 CREATEMATRIX(q7,q7_t);
+CREATEMATRIX(f32_ext,float32_t);
+CREATEMATRIX(q31_ext,q31_t);
+CREATEMATRIX(q15_ext,q15_t);
 
 #define NUMPYVECTORFROMBUFFER(EXT,CTYPE,NUMPYTYPE_FROMC)                     \
 PyObject *NumpyVectorFrom##EXT##Buffer(CTYPE *ptr,int nb)                    \
@@ -318,6 +324,9 @@ NUMPYARRAYFROMMATRIX(f64,NPY_DOUBLE);
 NUMPYARRAYFROMMATRIX(q31,NPY_INT32);
 NUMPYARRAYFROMMATRIX(q15,NPY_INT16);
 NUMPYARRAYFROMMATRIX(q7,NPY_BYTE);
+NUMPYARRAYFROMMATRIX(f32_ext,NPY_FLOAT);
+NUMPYARRAYFROMMATRIX(q31_ext,NPY_INT32);
+NUMPYARRAYFROMMATRIX(q15_ext,NPY_INT16);
 
 //#include "specific.h"
 #include "cmsismodule.h"
@@ -0,0 +1,302 @@
+""" Quantization of scikit-learn classifiers for the CMSIS-DSP
+fixed-point SVM and naive Bayes functions.
+
+The quantize functions return a dictionary with the arguments of the
+corresponding init functions (or the fields of the instance for naive
+Bayes) and the shift to apply to the inputs:
+
+     xq = quantizeInputs(x, params["inputShift"], params["format"])
+
+The predict functions are bit exact models of the CMSIS-DSP functions.
+They can be used to check the accuracy of the quantized model before
+moving to a board:
+
+     params = quantizeSVM(clf, X, "q15")
+     accuracyReport(clf, params, X, y)
+
+"""
+import numpy as np
+
+# Kinds of SVM (same values as in the CMSIS-DSP tests)
+LINEAR = 1
+POLY = 2
+RBF = 3
+
+# log2(e) in Q2.30
+LOG2E_Q30 = 1549082005
+
+# 2^(-j/64) in Q31 as in arm_svm_fixed.h
+EXP2_TABLE_Q31 = [min(int(round(2**(-j/64.0) * 2**31)), 0x7FFFFFFF) for j in range(65)]
+
+def _exponent(m):
+     """ Smallest e such that m < 2^e """
+     if m <= 0:
+          return(0)
+     return(int(np.floor(np.log2(m))) + 1)
+
+def _quantize(x, bits):
+     """ Rounding and saturation to a signed fractional format """
+     r = np.round(np.array(x,dtype=np.float64) * 2.0**(bits - 1))
+     return(np.clip(r, -2**(bits - 1), 2**(bits - 1) - 1).astype(np.int64))
+
+def _q15(x):
+     return(_quantize(x, 16))
+
+def _clip32(x):
+     return(max(min(x, 0x7FFFFFFF), -0x80000000))
+
+def _wrap32(x):
+     return(((x + 0x80000000) & 0xFFFFFFFF) - 0x80000000)
+
+def _shiftQ63ToQ31(x, shift):
+     if shift >= 0:
+          return(_clip32(x >> shift))
+     return(_clip32(_clip32(x) << -shift))
+
+def inputShift(X):
+     """ Exponent of the power of 2 which brings the inputs in [-1 1) """
+     return(_exponent(np.max(np.abs(X))))
+
+def quantizeInputs(X, shift, format="q15"):
+     """ Inputs divided by 2^shift and converted to q15 or q7 """
+     x = np.array(X,dtype=np.float64) / 2.0**shift
+     if format == "q7":
+          return(_quantize(x, 8))
+     return(_quantize(x, 16))
+
+def _dots(A, B, format):
+     """ Dot products in Q30 """
+     d = np.array(A,dtype=np.int64).dot(np.array(B,dtype=np.int64).T)
+     if format == "q7":
+          return(d << 16)
+     return(d)
+
+def _splitGamma(g):
+     """ q15 fractional part and exponent """
+     shift = _exponent(g)
+     return(int(_q15(g / 2.0**shift)), shift)
+
+def quantizeSVM(clf, X, format="q15"):
+     """ Quantize a 2-class linear, polynomial or rbf sklearn SVC
+
+     Args:
+       clf : trained sklearn.svm.SVC
+       X : training data (to choose the input and kernel scalings)
+       format : "q15" or "q7"
+     Returns:
+       dictionary of the init function arguments
+
+     The linear SVM is returned with a single support vector : the
+     weight vector of the classifier.
+     """
+     kinds = {"linear":LINEAR, "poly":POLY, "rbf":RBF}
+     if not clf.kernel in kinds:
+          raise ValueError("Unsupported kernel %s" % clf.kernel)
+
+     shift = inputShift(np.concatenate((np.array(X), clf.support_vectors_)))
+     sv = quantizeInputs(clf.support_vectors_, shift, format)
+
+     dual = clf.dual_coef_.reshape(clf.dual_coef_.size)
+     intercept = clf.intercept_[0]
+
+     params = {"format":format,
+               "kind":kinds[clf.kernel],
+               "inputShift":shift,
+               "classes":list(clf.classes_),
+               "supportVectors":sv,
+               "degree":0,
+               "coef0":0,
+               "gamma":0,
+               "gammaShift":0}
+
+     # Kernel factor for the quantized inputs
+     gamma = clf._gamma * 4.0**shift
+
+     if clf.kernel == "linear":
+          # The support vectors are replaced by the weight vector
+          # sum(dual[k] . sv[k]) which is quantized with its own scaling.
+          # It avoids the accumulation of the quantization errors of all
+          # the support vectors and there is only one dot product.
+          weights = clf.coef_[0]
+          e = _exponent(np.max(np.abs(weights)))
+          params["supportVectors"] = quantizeInputs([weights], e, format)
+          dual = np.array([2.0**(shift + e)])
+
+     if clf.kernel == "poly":
+          # Scale c of gamma.<x,sv> + coef0 with one bit of headroom.
+          # The kernel is scaled by c^-degree.
+          xq = quantizeInputs(X, shift, format)
+          t = gamma * _dots(xq, sv, format) / 2.0**30 + clf.coef0
+          c = 2.0**(_exponent(max(np.max(np.abs(t)), abs(clf.coef0))) + 1)
+          dual = dual * c**clf.degree
+          params["degree"] = int(clf.degree)
+          params["coef0"] = int(_q15(clf.coef0 / c))
+          params["gamma"], params["gammaShift"] = _splitGamma(gamma / c)
+
+     if clf.kernel == "rbf":
+          params["gamma"], params["gammaShift"] = _splitGamma(gamma)
+          # Squared norms of the support vectors as computed by arm_dot_prod
+          # (34.30 for q15 and 18.14 for q7) for the supportVectorsNorms argument
+          params["supportVectorsNorms"] = np.sum(np.array(sv,dtype=np.int64)**2, axis=1)
+
+     # Common scaling of the dual coefficients and intercept
+     scale = 2.0**_exponent(max(np.max(np.abs(dual)), abs(intercept)))
+     params["dualCoefficients"] = _q15(dual / scale)
+     params["intercept"] = int(_q15(intercept / scale))
+
+     return(params)
+
+def _polyKernel(dot, params):
+     t = _shiftQ63ToQ31(params["gamma"] * dot, 14 - params["gammaShift"])
+     t = _clip32(t + (params["coef0"] << 16))
+     k = t
+     for i in range(params["degree"] - 1):
+          k = _wrap32((k * t) >> 31)
+     return(k)
+
+def _rbfKernel(d2, params):
+     z = _shiftQ63ToQ31(params["gamma"] * d2, 18 - params["gammaShift"])
+     if z >= 0x7FFFFFFF:
+          return(0)
+     u = (z * LOG2E_Q30) >> 30
+     i = u >> 27
+     j = (u >> 21) & 0x3F
+     r = u & 0x1FFFFF
+     a = EXP2_TABLE_Q31[j]
+     b = EXP2_TABLE_Q31[j + 1]
+     a = a + (((b - a) * r) >> 21)
+     return(a >> i)
+
+def svmPredictFixed(params, Xq):
+     """ Bit exact model of arm_svm_xxx_predict_q15 / q7
+
+     Args:
+       params : result of quantizeSVM
+       Xq : quantized inputs (one vector per row)
+     Returns:
+       predicted classes
+     """
+     sv = params["supportVectors"]
+     dual = [int(x) for x in params["dualCoefficients"]]
+     format = params["format"]
+     kind = params["kind"]
+     Xq = np.array(Xq,dtype=np.int64).reshape(-1, sv.shape[1])
+     raw = np.array(Xq).dot(np.array(sv).T)
+     result = []
+     for n, x in enumerate(Xq):
+          if kind == LINEAR:
+               if format == "q7":
+                    acc = params["intercept"] << 14
+                    for k in range(len(dual)):
+                         acc += dual[k] * int(raw[n,k])
+               else:
+                    acc = params["intercept"] << 15
+                    for k in range(len(dual)):
+                         acc += dual[k] * (int(raw[n,k]) >> 15)
+          else:
+               q = 16 if format == "q7" else 0
+               acc = params["intercept"] << 31
+               xx = int(x.dot(x))
+               for k in range(len(dual)):
+                    if kind == POLY:
+                         kv = _polyKernel(int(raw[n,k]) << q, params)
+                    else:
+                         d2 = xx + int(params["supportVectorsNorms"][k]) - 2 * int(raw[n,k])
+                         kv = _rbfKernel(d2 << q, params)
+                    acc += dual[k] * kv
+          result.append(params["classes"][1 if acc > 0 else 0])
+     return(np.array(result))
+
+def quantizeGaussianNB(clf, X):
+     """ Quantize a sklearn GaussianNB for arm_gaussian_naive_bayes_predict_q15
+
+     Args:
+       clf : trained sklearn.naive_bayes.GaussianNB
+       X : training data (to choose the input scaling)
+     Returns:
+       dictionary of the q15 instance fields
+     """
+     shift = inputShift(np.concatenate((np.array(X), clf.theta_.reshape(-1, clf.theta_.shape[1]))))
+     # sklearn var_ already includes epsilon
+     var = clf.var_
+     # Weights of the squared differences of the quantized inputs
+     w = 0.5 / var * 4.0**shift
+     scale = 2.0**_exponent(np.max(w))
+     constants = np.log(clf.class_prior_) - 0.5 * np.sum(np.log(2.0 * np.pi * var), axis=1)
+     constants = np.array([_clip32(int(np.round(c / scale * 2**15))) for c in constants])
+
+     return({"format":"q15",
+             "inputShift":shift,
+             "vectorDimension":clf.theta_.shape[1],
+             "numberOfClasses":clf.theta_.shape[0],
+             "classes":list(clf.classes_),
+             "theta":quantizeInputs(clf.theta_, shift, "q15"),
+             "invSigma":_q15(w / scale),
+             "classConstants":constants})
+
+def gaussianNBScoresFixed(params, Xq):
+     """ Bit exact model of arm_gaussian_naive_bayes_predict_q15
+
+     Args:
+       params : result of quantizeGaussianNB
+       Xq : quantized inputs (one vector per row)
+     Returns:
+       predicted class indexes and scores (one row per input)
+     """
+     theta = params["theta"]
+     w = params["invSigma"]
+     Xq = np.array(Xq,dtype=np.int64).reshape(-1, params["vectorDimension"])
+     result = []
+     scores = []
+     for x in Xq:
+          best = None
+          index = 0
+          s = []
+          for c in range(params["numberOfClasses"]):
+               acc = int(params["classConstants"][c]) << 29
+               for d in range(params["vectorDimension"]):
+                    diff = int(x[d]) - int(theta[c,d])
+                    acc -= ((diff * diff) >> 1) * int(w[c,d])
+               if best is None or acc > best:
+                    best = acc
+                    index = c
+               s.append(_clip32(acc >> 29))
+          result.append(index)
+          scores.append(s)
+     return(np.array(result), np.array(scores))
+
+def gaussianNBPredictFixed(params, Xq):
+     """ Predicted class indexes of arm_gaussian_naive_bayes_predict_q15 """
+     return(gaussianNBScoresFixed(params, Xq)[0])
+
+def predictFixed(params, X):
+     """ Predicted classes of the quantized model for float inputs """
+     Xq = quantizeInputs(X, params["inputShift"], params["format"])
+     if "kind" in params:
+          return(svmPredictFixed(params, Xq))
+     return(np.array(params["classes"])[gaussianNBPredictFixed(params, Xq)])
+
+def accuracyReport(clf, params, X, y=None, verbose=True):
+     """ Compare the quantized model with the sklearn one
+
+     Args:
+       clf : sklearn classifier
+       params : result of quantizeSVM or quantizeGaussianNB
+       X : test inputs
+       y : test labels (optional)
+     Returns:
+       dictionary with the agreement between the two models and
+       their accuracies when y is given
+     """
+     ref = clf.predict(X)
+     fixed = predictFixed(params, X)
+     r = {"agreement":np.mean(ref == fixed)}
+     if y is not None:
+          r["floatAccuracy"] = np.mean(ref == np.array(y))
+          r["fixedAccuracy"] = np.mean(fixed == np.array(y))
+     if verbose:
+          print("Agreement with the float model : %.2f %%" % (100.0 * r["agreement"]))
+          if y is not None:
+               print("Float accuracy : %.2f %%" % (100.0 * r["floatAccuracy"]))
+               print("%s accuracy : %.2f %%" % (params["format"].upper(), 100.0 * r["fixedAccuracy"]))
+     return(r)
@@ -61,6 +61,9 @@ interpolation.remove(os.path.join(ROOT,"Source","InterpolationFunctions","Interp
 quaternion = glob.glob(os.path.join(ROOT,"Source","QuaternionMathFunctions","*.c"))
 quaternion.remove(os.path.join(ROOT,"Source","QuaternionMathFunctions","QuaternionMathFunctions.c"))
 
+estimation = glob.glob(os.path.join(ROOT,"Source","EstimationFunctions","*.c"))
+estimation.remove(os.path.join(ROOT,"Source","EstimationFunctions","EstimationFunctions.c"))
+
 #distance = glob.glob(os.path.join(ROOT,"Source","DistanceFunctions","*.c"))
 #distance.remove(os.path.join(ROOT,"Source","DistanceFunctions","DistanceFunctions.c"))
 
@@ -71,7 +74,7 @@ modulesrc.append(os.path.join("cmsisdsp_pkg","src","cmsismodule.c"))
 
 allsrcs = support + fastmath + filtering + matrix + statistics + complexf + basic
 allsrcs = allsrcs + controller + transform + modulesrc + common+ interpolation
-allsrcs = allsrcs + quaternion
+allsrcs = allsrcs + quaternion + estimation
 
 def notf16(number):
   if re.search(r'f16',number):
@@ -217,6 +217,25 @@ r=dsp.arm_mat_trans_q7(f.toQ7(a))
 print(f.Q7toF32(r[1]))
 print("")
 
+################# MATRICES WITH 32-BIT DIMENSIONS #################
+
+printTitle("Matrices with 32-bit dimensions")
+a=np.random.randn(3,70000) / 1000.0
+b=np.random.randn(70000) / 1000.0
+
+r=dsp.arm_mat_trans_ext_f32(a)
+print(np.array_equal(r[1],np.transpose(a).astype(np.float32)))
+
+r=dsp.arm_mat_vec_mult_ext_f32(a,b)
+print(np.max(np.abs(r - np.dot(a,b))))
+
+r=dsp.arm_mat_add_ext_q31(f.toQ31(a),f.toQ31(a))
+print(np.max(np.abs(f.Q31toF32(r[1]) - 2*a)))
+
+r=dsp.arm_mat_mult_ext_f32(a,np.transpose(a))
+print(np.max(np.abs(r[1] - np.dot(a,np.transpose(a)))))
+print("")
+
 ################## FILL FUNCTIONS #################
 
 v=0.22 
@@ -0,0 +1,285 @@
+""" Export of scikit-learn tree ensembles for the CMSIS-DSP
+arm_tree_ensemble_predict_f32 and arm_tree_ensemble_predict_q15 functions.
+
+Supported models : DecisionTreeClassifier, DecisionTreeRegressor,
+RandomForestClassifier, RandomForestRegressor, ExtraTreesClassifier,
+ExtraTreesRegressor, GradientBoostingClassifier and
+GradientBoostingRegressor.
+
+     params = exportTreeEnsemble(clf, "q15", X)
+     print(toC(params, "model"))
+     accuracyReport(clf, params, X, y)
+
+The q15 inputs are the float inputs divided by 2^params["inputShift"].
+The q15 scores are the float scores divided by 2^params["outputShift"]
+(in Q16.15).
+
+"""
+import numpy as np
+from mlquantization import _exponent, _quantize, _clip32, inputShift, quantizeInputs
+
+# Kinds of models
+CLASSIFIER = 1
+REGRESSOR = 2
+
+def _trees(model):
+     """ List of (tree, output index, leaf factor) and base values """
+     if hasattr(model, "tree_"):
+          return([(model.tree_, 0, 1.0)], None)
+
+     estimators = model.estimators_
+     if isinstance(estimators, np.ndarray):
+          # Gradient boosting : one regression tree per output and stage
+          trees = []
+          for stage in range(estimators.shape[0]):
+               for k in range(estimators.shape[1]):
+                    trees.append((estimators[stage, k].tree_, k, model.learning_rate))
+          x0 = np.zeros((1, model.n_features_in_))
+          base = np.array(model._raw_predict_init(x0)[0], dtype=np.float64)
+          return(trees, base)
+
+     # Forests : the leaves are averaged
+     n = len(estimators)
+     return([(e.tree_, 0, 1.0 / n) for e in estimators], None)
+
+def _leafValues(tree, leaf, factor, probabilities):
+     v = tree.value[leaf]
+     if probabilities:
+          v = v[0] / np.sum(v[0])
+     else:
+          v = v[:, 0]
+     return(factor * v)
+
+def _floorF32(t):
+     """ Largest float32 lower or equal to t.
+     scikit-learn compares float32 inputs to float64 thresholds so
+     x <= t is equivalent to x <= _floorF32(t)
+     """
+     r = np.float32(t)
+     if np.float64(r) > t:
+          r = np.nextafter(r, np.float32(-np.inf))
+     return(r)
+
+def exportTreeEnsemble(model, format="f32", X=None):
+     """ Node arrays of a sklearn tree ensemble
+
+     Args:
+       model : trained sklearn tree, forest or gradient boosting model
+       format : "f32" or "q15"
+       X : training data (to choose the input scaling in q15)
+     Returns:
+       dictionary of the instance fields
+
+     The two children of a node are consecutive and the leaves are
+     their own children, so the arrays can be evaluated without branches.
+     """
+     if format == "q15" and X is None:
+          raise ValueError("Training data is needed for the q15 format")
+
+     gradientBoosting = hasattr(model, "estimators_") and isinstance(model.estimators_, np.ndarray)
+     classifier = hasattr(model, "classes_")
+     if classifier and getattr(model, "n_outputs_", 1) > 1:
+          raise ValueError("Multi-output classifiers are not supported")
+
+     trees, base = _trees(model)
+
+     if gradientBoosting:
+          nbOutputs = len(base)
+          nbLeafValues = 1
+     elif classifier:
+          nbOutputs = len(model.classes_)
+          nbLeafValues = nbOutputs
+     else:
+          nbOutputs = model.n_outputs_
+          nbLeafValues = nbOutputs
+     if base is None:
+          base = np.zeros(nbOutputs)
+
+     roots = []
+     depths = []
+     outputs = []
+     features = []
+     thresholds = []
+     children = []
+     leafIndexes = []
+     leaves = []
+
+     for (tree, output, factor) in trees:
+          root = len(features)
+          roots.append(root)
+          depths.append(int(tree.max_depth))
+          outputs.append(output)
+
+          # Breadth first numbering with consecutive children
+          order = [0]
+          index = {0:root}
+          for old in order:
+               if tree.children_left[old] >= 0:
+                    index[tree.children_left[old]] = root + len(order)
+                    index[tree.children_right[old]] = root + len(order) + 1
+                    order.append(tree.children_left[old])
+                    order.append(tree.children_right[old])
+
+          for old in order:
+               if tree.children_left[old] >= 0:
+                    features.append(int(tree.feature[old]))
+                    thresholds.append(tree.threshold[old])
+                    children.append(index[tree.children_left[old]])
+                    leafIndexes.append(0)
+               else:
+                    features.append(0)
+                    thresholds.append(np.inf)
+                    children.append(index[old])
+                    leafIndexes.append(len(leaves))
+                    leaves.append(_leafValues(tree, old, factor, classifier and not gradientBoosting))
+
+     leaves = np.array(leaves).reshape(len(leaves), nbLeafValues)
+
+     params = {"format":format,
+               "kind":CLASSIFIER if classifier else REGRESSOR,
+               "classes":list(model.classes_) if classifier else None,
+               "numberOfTrees":len(trees),
+               "numberOfNodes":len(features),
+               "vectorDimension":model.n_features_in_,
+               "numberOfOutputs":nbOutputs,
+               "numberOfLeafValues":nbLeafValues,
+               "treeRoots":np.array(roots, dtype=np.uint32),
+               "treeDepths":np.array(depths, dtype=np.uint16),
+               "treeOutputs":np.array(outputs, dtype=np.uint16),
+               "featureIndexes":np.array(features, dtype=np.uint16),
+               "leftChildren":np.array(children, dtype=np.uint32),
+               "leafIndexes":np.array(leafIndexes, dtype=np.uint32)}
+
+     if format == "q15":
+          shift = inputShift(X)
+          # Largest q15 lower or equal to the scaled threshold
+          t = np.floor(np.array(thresholds) / 2.0**shift * 2**15)
+          t = np.clip(np.nan_to_num(t, posinf=2**15 - 1), -2**15, 2**15 - 1)
+          outShift = _exponent(np.max(np.abs(leaves)))
+          params["inputShift"] = shift
+          params["outputShift"] = outShift
+          params["thresholds"] = t.astype(np.int16)
+          params["leafValues"] = _quantize(leaves.reshape(-1) / 2.0**outShift, 16).astype(np.int16)
+          params["baseValues"] = np.array([_clip32(int(np.round(b / 2.0**outShift * 2**15))) for b in base], dtype=np.int32)
+     else:
+          params["thresholds"] = np.array([_floorF32(t) for t in thresholds], dtype=np.float32)
+          params["leafValues"] = leaves.reshape(-1).astype(np.float32)
+          params["baseValues"] = base.astype(np.float32)
+
+     return(params)
+
+def treeEnsembleScores(params, X):
+     """ Model of arm_tree_ensemble_predict_f32 / q15
+
+     Args:
+       params : result of exportTreeEnsemble
+       X : float inputs for f32 or quantized inputs for q15 (one vector per row)
+     Returns:
+       scores (one row per input). Q16.15 integers in q15.
+     """
+     q15 = params["format"] == "q15"
+     X = np.array(X).reshape(-1, params["vectorDimension"])
+     nbOutputs = params["numberOfOutputs"]
+     nbLeafValues = params["numberOfLeafValues"]
+     if q15:
+          scores = np.tile(np.array(params["baseValues"], dtype=np.int64), (X.shape[0], 1))
+          X = X.astype(np.int64)
+     else:
+          scores = np.tile(np.array(params["baseValues"], dtype=np.float32), (X.shape[0], 1))
+          X = X.astype(np.float32)
+     leaves = np.array(params["leafValues"]).reshape(-1, nbLeafValues)
+     rows = np.arange(X.shape[0])
+     for t in range(params["numberOfTrees"]):
+          n = np.full(X.shape[0], params["treeRoots"][t], dtype=np.int64)
+          for d in range(params["treeDepths"][t]):
+               right = X[rows, params["featureIndexes"][n]] > params["thresholds"][n]
+               n = params["leftChildren"][n].astype(np.int64) + right
+          o = params["treeOutputs"][t]
+          scores[:, o:o + nbLeafValues] += leaves[params["leafIndexes"][n]]
+     return(scores)
+
+def predictTreeEnsemble(params, X):
+     """ Predictions of the exported model for float inputs """
+     if params["format"] == "q15":
+          scores = treeEnsembleScores(params, quantizeInputs(X, params["inputShift"], "q15"))
+          scores = scores * 2.0**(params["outputShift"] - 15)
+     else:
+          scores = treeEnsembleScores(params, X)
+
+     if params["kind"] == REGRESSOR:
+          if params["numberOfOutputs"] == 1:
+               return(scores[:, 0])
+          return(scores)
+
+     classes = np.array(params["classes"])
+     if params["numberOfOutputs"] == 1:
+          return(classes[(scores[:, 0] > 0).astype(int)])
+     return(classes[np.argmax(scores, axis=1)])
+
+def accuracyReport(model, params, X, y=None, verbose=True):
+     """ Compare the exported model with the sklearn one
+
+     Args:
+       model : sklearn model
+       params : result of exportTreeEnsemble
+       X : test inputs
+       y : test labels or targets (optional)
+     Returns:
+       dictionary with the agreement between the two classifiers
+       (or the maximum error for a regressor) and their accuracies
+       when y is given
+     """
+     ref = model.predict(X)
+     exported = predictTreeEnsemble(params, X)
+     if params["kind"] == REGRESSOR:
+          r = {"maxError":np.max(np.abs(ref - exported))}
+          if verbose:
+               print("Maximum error with the float model : %g" % r["maxError"])
+          return(r)
+
+     r = {"agreement":np.mean(ref == exported)}
+     if y is not None:
+          r["floatAccuracy"] = np.mean(ref == np.array(y))
+          r["exportedAccuracy"] = np.mean(exported == np.array(y))
+     if verbose:
+          print("Agreement with the float model : %.2f %%" % (100.0 * r["agreement"]))
+          if y is not None:
+               print("Float accuracy : %.2f %%" % (100.0 * r["floatAccuracy"]))
+               print("%s accuracy : %.2f %%" % (params["format"].upper(), 100.0 * r["exportedAccuracy"]))
+     return(r)
+
+def _cArray(ctype, name, values, fmt):
+     items = [fmt(v) for v in values]
+     lines = []
+     for i in range(0, len(items), 8):
+          lines.append("  " + ",".join(items[i:i + 8]))
+     return("static const %s %s[%d]={\n%s\n};\n" % (ctype, name, len(items), ",\n".join(lines)))
+
+def _f32(v):
+     if np.isinf(v):
+          return("INFINITY")
+     return("%.9gf" % v)
+
+def toC(params, name):
+     """ C declarations of the node arrays and of the instance """
+     q15 = params["format"] == "q15"
+     value = "q15_t" if q15 else "float32_t"
+     fmt = (lambda v: "%d" % v) if q15 else _f32
+     fmtBase = (lambda v: "%d" % v) if q15 else _f32
+     r = ""
+     r += _cArray("uint32_t", name + "_roots", params["treeRoots"], lambda v: "%d" % v)
+     r += _cArray("uint16_t", name + "_depths", params["treeDepths"], lambda v: "%d" % v)
+     r += _cArray("uint16_t", name + "_outputs", params["treeOutputs"], lambda v: "%d" % v)
+     r += _cArray("uint16_t", name + "_features", params["featureIndexes"], lambda v: "%d" % v)
+     r += _cArray(value, name + "_thresholds", params["thresholds"], fmt)
+     r += _cArray("uint32_t", name + "_children", params["leftChildren"], lambda v: "%d" % v)
+     r += _cArray("uint32_t", name + "_leafIndexes", params["leafIndexes"], lambda v: "%d" % v)
+     r += _cArray(value, name + "_leaves", params["leafValues"], fmt)
+     r += _cArray("q31_t" if q15 else "float32_t", name + "_base", params["baseValues"], fmtBase)
+     r += "\nconst arm_tree_ensemble_instance_%s %s={\n" % (params["format"], name)
+     r += "  %d,%d,%d,%d,%d,\n" % (params["numberOfTrees"], params["numberOfNodes"],
+          params["vectorDimension"], params["numberOfOutputs"], params["numberOfLeafValues"])
+     r += "  %s_roots,%s_depths,%s_outputs,\n" % (name, name, name)
+     r += "  %s_features,%s_thresholds,%s_children,%s_leafIndexes,\n" % (name, name, name, name)
+     r += "  %s_leaves,%s_base\n};\n" % (name, name)
+     return(r)
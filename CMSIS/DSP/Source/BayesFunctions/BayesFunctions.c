@@ -27,3 +27,5 @@
  */
 
 #include "arm_gaussian_naive_bayes_predict_f32.c"
+#include "arm_gaussian_naive_bayes_predict_batch_f32.c"
+#include "arm_gaussian_naive_bayes_predict_q15.c"
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_batch_f32.c
+ * Description:  Naive Gaussian Bayesian Estimator on a batch of vectors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include <limits.h>
+#include <math.h>
+
+#define DPI_F (2.0f*3.1415926535897932384626433832795f)
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator on a batch of vectors
+ *
+ * @param[in]  S            points to a naive bayes instance structure
+ * @param[in]  in           points to nbVectors input vectors
+ * @param[in]  nbVectors    number of input vectors
+ * @param[out] pBuffer      points to a temporary buffer of length
+ *                          numberOfClasses * (vectorDimension + 2)
+ * @param[out] pResult      nbVectors predicted classes
+ * @return none
+ *
+ * The terms of the log-likelihoods which do not depend on the input
+ * (the logarithms of the priors and of the variances and the inverses
+ * of the variances) are computed once for the batch in pBuffer.
+ * The log-likelihood of a vector for a class is then a sum of
+ * vectorDimension weighted squared differences without any division
+ * or logarithm.
+ *
+ * On Helium, 4 vectors are processed in parallel: each lane computes
+ * the log-likelihoods of one vector and keeps the best class. The
+ * components of the 4 vectors are read with gather loads.
+ *
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_instance_f32 *S, 
+   const float32_t * in, 
+   uint32_t nbVectors,
+   float32_t *pBuffer,
+   uint32_t *pResult)
+{
+    uint32_t nbClass;
+    uint32_t nbDim;
+    const float32_t *pTheta;
+    const float32_t *pSigma = S->sigma;
+    float32_t *pWeights = pBuffer;
+    float32_t *pConst = pBuffer + S->numberOfClasses * S->vectorDimension;
+    const float32_t *pIn;
+    float32_t sigma, acc;
+    f32x4_t vacc, vdiff, vbest;
+    uint32x4_t vbestIdx, offsets;
+    mve_pred16_t p0, pGreater;
+    int32_t blkCnt;
+
+    /* -0.5 / sigma and the constant part of the log-likelihoods */
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        acc = 0.0f;
+        for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+        {
+           sigma = *pSigma++ + S->epsilon;
+           acc += logf(DPI_F * sigma);
+           *pWeights++ = -0.5f / sigma;
+        }
+        pConst[nbClass] = logf(S->classPriors[nbClass]) - 0.5f * acc;
+    }
+
+    /* Offsets of a component in 4 consecutive vectors */
+    offsets = vmulq_n_u32(vidupq_n_u32(0, 1), S->vectorDimension);
+
+    /* Compute 4 vectors at a time */
+    blkCnt = nbVectors;
+    while (blkCnt > 0)
+    {
+        p0 = vctp32q(blkCnt);
+
+        pTheta = S->theta;
+        pWeights = pBuffer;
+
+        /* Same selection as arm_max_f32 : first class with the biggest score */
+        vbest = vdupq_n_f32(-INFINITY);
+        vbestIdx = vdupq_n_u32(0);
+
+        for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+        {
+            pIn = in;
+            vacc = vdupq_n_f32(pConst[nbClass]);
+            for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+            {
+               vdiff = vsubq(vldrwq_gather_shifted_offset_z_f32(pIn, offsets, p0), *pTheta++);
+               vacc = vfmaq(vacc, vmulq(vdiff, vdiff), *pWeights++);
+               pIn++;
+            }
+
+            pGreater = vcmpgtq(vacc, vbest);
+            vbest = vpselq(vacc, vbest, pGreater);
+            vbestIdx = vpselq(vdupq_n_u32(nbClass), vbestIdx, pGreater);
+        }
+
+        vstrwq_p(pResult, vbestIdx, p0);
+
+        in += 4 * S->vectorDimension;
+        pResult += 4;
+        blkCnt -= 4;
+    }
+}
+
+#else
+
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_instance_f32 *S, 
+   const float32_t * in, 
+   uint32_t nbVectors,
+   float32_t *pBuffer,
+   uint32_t *pResult)
+{
+    uint32_t nbClass;
+    uint32_t nbDim;
+    const float32_t *pTheta;
+    const float32_t *pSigma = S->sigma;
+    float32_t *pWeights = pBuffer;
+    float32_t *pConst = pBuffer + S->numberOfClasses * S->vectorDimension;
+    float32_t *pScores = pConst + S->numberOfClasses;
+    const float32_t *pIn;
+    float32_t sigma, diff, acc, result;
+
+    /* -0.5 / sigma and the constant part of the log-likelihoods */
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        acc = 0.0f;
+        for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+        {
+           sigma = *pSigma++ + S->epsilon;
+           acc += logf(DPI_F * sigma);
+           *pWeights++ = -0.5f / sigma;
+        }
+        pConst[nbClass] = logf(S->classPriors[nbClass]) - 0.5f * acc;
+    }
+
+    while (nbVectors > 0U)
+    {
+        pTheta = S->theta;
+        pWeights = pBuffer;
+
+        for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+        {
+            pIn = in;
+            acc = pConst[nbClass];
+            for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+            {
+               diff = *pIn++ - *pTheta++;
+               acc += diff * diff * *pWeights++;
+            }
+            pScores[nbClass] = acc;
+        }
+
+        arm_max_f32(pScores, S->numberOfClasses, &result, pResult);
+
+        in += S->vectorDimension;
+        pResult++;
+        nbVectors--;
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+ * @} end of groupBayes group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_q15.c
+ * Description:  Naive Gaussian Bayesian Estimator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include <limits.h>
+#include <math.h>
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator
+ *
+ * @param[in]   *S                      points to a naive bayes instance structure
+ * @param[in]   *in                     points to the elements of the input vector.
+ * @param[out]  *pOutputScores          points to a buffer of length numberOfClasses containing the scaled log-likelihoods in Q16.15
+ * @return The predicted class
+ *
+ * The log-likelihood of a class is
+ * classConstants - sum(invSigma . (in - theta)^2).
+ * It does not need any logarithm or division since those terms are
+ * precomputed in the instance.
+ * The squared differences are in Q2.29 and the log-likelihoods are
+ * accumulated in a q63 in 19.44 format. They are saturated to q31
+ * in pOutputScores. The predicted class is computed before the
+ * saturation.
+ *
+ */
+uint32_t arm_gaussian_naive_bayes_predict_q15(const arm_gaussian_naive_bayes_instance_q15 *S, 
+   const q15_t * in, 
+   q31_t *pOutputScores)
+{
+    uint32_t nbClass;
+    uint32_t nbDim;
+    const q15_t *pTheta = S->theta;
+    const q15_t *pInvSigma = S->invSigma;
+    const q15_t *pIn;
+    q63_t acc, maxAcc = 0;
+    uint32_t index = 0U;
+    q31_t diff;
+    uint32_t sq;
+
+    for(nbClass = 0; nbClass < S->numberOfClasses; nbClass++)
+    {
+        pIn = in;
+        acc = (q63_t) S->classConstants[nbClass] << 29;
+
+        for(nbDim = 0; nbDim < S->vectorDimension; nbDim++)
+        {
+            /* |diff| < 2^16 so diff^2 / 2 is a positive q31 */
+            diff = (q31_t) *pIn++ - *pTheta++;
+            sq = ((uint32_t) diff * (uint32_t) diff) >> 1;
+            acc -= (q63_t) (q31_t) sq * *pInvSigma++;
+        }
+
+        if ((nbClass == 0U) || (acc > maxAcc))
+        {
+            maxAcc = acc;
+            index = nbClass;
+        }
+
+        pOutputScores[nbClass] = clip_q63_to_q31(acc >> 29);
+    }
+
+    return (index);
+}
+
+/**
+ * @} end of groupBayes group
+ */
@@ -56,3 +56,21 @@
 #include "arm_cmplx_mult_real_f32.c"
 #include "arm_cmplx_mult_real_q15.c"
 #include "arm_cmplx_mult_real_q31.c"
+#include "arm_nco_init_f32.c"
+#include "arm_nco_set_frequency_f32.c"
+#include "arm_nco_f32.c"
+#include "arm_mix_down_f32.c"
+#include "arm_nco_init_q31.c"
+#include "arm_nco_set_frequency_q31.c"
+#include "arm_nco_init_q15.c"
+#include "arm_nco_set_frequency_q15.c"
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_Q31)
+#include "arm_nco_q31.c"
+#include "arm_mix_down_q31.c"
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_Q15)
+#include "arm_nco_q15.c"
+#include "arm_mix_down_q15.c"
+#endif
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mix_down_f32.c
+ * Description:  Floating-point quadrature down-conversion
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+#include "arm_nco.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Floating-point quadrature down-conversion of a real signal.
+  @param[in,out] S          points to an instance of the floating-point NCO
+  @param[in]     pSrc       points to the real input vector
+  @param[out]    pDst       points to the complex output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The input is multiplied by the conjugate of the oscillator
+                   output. The oscillator is advanced by blockSize samples.
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+void arm_mix_down_f32(
+  arm_nco_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt, resyncCnt, k, phase;
+  f32x4_t vecRe, vecIm, vecStepRe, vecStepIm, vecTmp, vecIn;
+  float32x4x2_t vecOut;
+  float32_t in;
+
+  phase = S->phase;
+
+  vecStepRe = vdupq_n_f32(S->stepRe[3]);
+  vecStepIm = vdupq_n_f32(S->stepIm[3]);
+
+  vecRe = vld1q(S->stateRe);
+  vecIm = vld1q(S->stateIm);
+
+  resyncCnt = ARM_NCO_RESYNC_PERIOD;
+
+  /* Compute 4 complex outputs at a time */
+  blkCnt = blockSize >> 2U;
+  while (blkCnt > 0U)
+  {
+    vecIn = vld1q(pSrc);
+    pSrc += 4;
+
+    vecOut.val[0] = vmulq(vecRe, vecIn);
+    vecOut.val[1] = vmulq(vecIm, vnegq(vecIn));
+    vst2q(pDst, vecOut);
+    pDst += 8;
+
+    /* Advance by 4 samples */
+    vecTmp = vfmsq(vmulq(vecRe, vecStepRe), vecIm, vecStepIm);
+    vecIm = vfmaq(vmulq(vecIm, vecStepRe), vecRe, vecStepIm);
+    vecRe = vecTmp;
+
+    resyncCnt--;
+    if (resyncCnt == 0U)
+    {
+      S->phase += 4U * ARM_NCO_RESYNC_PERIOD * S->phaseInc;
+      arm_nco_resync_f32(S);
+      vecRe = vld1q(S->stateRe);
+      vecIm = vld1q(S->stateIm);
+
+      resyncCnt = ARM_NCO_RESYNC_PERIOD;
+    }
+
+    blkCnt--;
+  }
+
+  vst1q(S->stateRe, vecRe);
+  vst1q(S->stateIm, vecIm);
+
+  /* Tail */
+  blkCnt = blockSize & 3U;
+  for (k = 0U; k < blkCnt; k++)
+  {
+    in = *pSrc++;
+    *pDst++ = in * S->stateRe[k];
+    *pDst++ = -in * S->stateIm[k];
+  }
+
+  /* Restart the rotators from the phase of the sample after the last processed one */
+  S->phase = phase + blockSize * S->phaseInc;
+  arm_nco_resync_f32(S);
+}
+
+#else
+void arm_mix_down_f32(
+  arm_nco_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt, resyncCnt, k, phase;
+  float32_t stepRe, stepIm, re, im, in;
+
+  phase = S->phase;
+
+  stepRe = S->stepRe[3];
+  stepIm = S->stepIm[3];
+
+  resyncCnt = ARM_NCO_RESYNC_PERIOD;
+
+  /* Compute 4 complex outputs at a time */
+  blkCnt = blockSize >> 2U;
+  while (blkCnt > 0U)
+  {
+    for (k = 0U; k < 4U; k++)
+    {
+      re = S->stateRe[k];
+      im = S->stateIm[k];
+      in = *pSrc++;
+
+      *pDst++ = in * re;
+      *pDst++ = -in * im;
+
+      /* Advance by 4 samples */
+      S->stateRe[k] = re * stepRe - im * stepIm;
+      S->stateIm[k] = im * stepRe + re * stepIm;
+    }
+
+    resyncCnt--;
+    if (resyncCnt == 0U)
+    {
+      S->phase += 4U * ARM_NCO_RESYNC_PERIOD * S->phaseInc;
+      arm_nco_resync_f32(S);
+
+      resyncCnt = ARM_NCO_RESYNC_PERIOD;
+    }
+
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 3U;
+  for (k = 0U; k < blkCnt; k++)
+  {
+    in = *pSrc++;
+    *pDst++ = in * S->stateRe[k];
+    *pDst++ = -in * S->stateIm[k];
+  }
+
+  /* Restart the rotators from the phase of the sample after the last processed one */
+  S->phase = phase + blockSize * S->phaseInc;
+  arm_nco_resync_f32(S);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of NCO group
+ */
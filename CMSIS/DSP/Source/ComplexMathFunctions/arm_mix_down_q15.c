@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mix_down_q15.c
+ * Description:  Q15 quadrature down-conversion
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+#include "arm_nco.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Q15 quadrature down-conversion of a real signal.
+  @param[in,out] S          points to an instance of the Q15 NCO
+  @param[in]     pSrc       points to the real input vector
+  @param[out]    pDst       points to the complex output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The products are computed in Q30 and truncated to Q15.
+                   The only saturated value is -1 * -1.
+ */
+
+void arm_mix_down_q15(
+  arm_nco_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt, phase, phaseInc;
+  q15_t s, c, in;
+
+  phase = S->phase;
+  phaseInc = S->phaseInc;
+
+  blkCnt = blockSize;
+  while (blkCnt > 0U)
+  {
+    arm_nco_sincos_q15(phase, &s, &c);
+    in = *pSrc++;
+
+    /* Multiply by the conjugate of the oscillator */
+    *pDst++ = (q15_t) __SSAT(((q31_t) in * c) >> 15, 16);
+    *pDst++ = (q15_t) __SSAT(((q31_t) in * -s) >> 15, 16);
+
+    phase += phaseInc;
+
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+  @} end of NCO group
+ */
@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_f32.c
+ * Description:  Floating-point numerically controlled oscillator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+#include "arm_nco.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup NCO Numerically Controlled Oscillator
+
+  Generates the complex exponential exp(j.(w.n + phi)) one block at a time.
+  The output is stored in an interleaved fashion (real, imag, real, imag, ...)
+  and the phase is kept in the instance between blocks so that consecutive
+  blocks form a continuous signal.
+
+  The frequency is in cycles per sample: 0.25 is a quarter of the sampling
+  rate. The initial phase is in cycles. The frequency can be changed with
+  <code>arm_nco_set_frequency_xxx</code> without phase discontinuity.
+
+  The mix-down functions multiply a real input signal by the conjugate of the
+  oscillator output:
+
+  <pre>
+      pDst[(2*n)+0] =  pSrc[n] * cos(w.n + phi);
+      pDst[(2*n)+1] = -pSrc[n] * sin(w.n + phi);
+  </pre>
+
+  which shifts the component of the input at frequency w to 0 (quadrature
+  down-conversion).
+
+  @par           Floating-point algorithm
+                   4 complex rotators hold the next 4 samples of the
+                   oscillator and are all multiplied by exp(j.4.w) to advance
+                   by 4 samples. Every 64 samples and at the end of each
+                   block, they are recomputed from a 32-bit phase accumulator
+                   so that the rounding errors of the recursion do not
+                   accumulate.
+
+  @par           Fixed-point algorithm
+                   A 32-bit phase accumulator wraps naturally every cycle.
+                   The Q31 version refines the 512 entry sine table with the
+                   angle addition formula. The Q15 version uses a linear
+                   interpolation of the table.
+
+  There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Floating-point NCO.
+  @param[in,out] S          points to an instance of the floating-point NCO
+  @param[out]    pDst       points to the complex output vector
+  @param[in]     blockSize  number of complex samples to generate
+  @return        none
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt, resyncCnt, k, phase;
+  f32x4_t vecRe, vecIm, vecStepRe, vecStepIm, vecTmp;
+  float32x4x2_t vecOut;
+
+  phase = S->phase;
+
+  vecStepRe = vdupq_n_f32(S->stepRe[3]);
+  vecStepIm = vdupq_n_f32(S->stepIm[3]);
+
+  vecRe = vld1q(S->stateRe);
+  vecIm = vld1q(S->stateIm);
+
+  resyncCnt = ARM_NCO_RESYNC_PERIOD;
+
+  /* Compute 4 complex outputs at a time */
+  blkCnt = blockSize >> 2U;
+  while (blkCnt > 0U)
+  {
+    vecOut.val[0] = vecRe;
+    vecOut.val[1] = vecIm;
+    vst2q(pDst, vecOut);
+    pDst += 8;
+
+    /* Advance by 4 samples */
+    vecTmp = vfmsq(vmulq(vecRe, vecStepRe), vecIm, vecStepIm);
+    vecIm = vfmaq(vmulq(vecIm, vecStepRe), vecRe, vecStepIm);
+    vecRe = vecTmp;
+
+    resyncCnt--;
+    if (resyncCnt == 0U)
+    {
+      S->phase += 4U * ARM_NCO_RESYNC_PERIOD * S->phaseInc;
+      arm_nco_resync_f32(S);
+      vecRe = vld1q(S->stateRe);
+      vecIm = vld1q(S->stateIm);
+
+      resyncCnt = ARM_NCO_RESYNC_PERIOD;
+    }
+
+    blkCnt--;
+  }
+
+  vst1q(S->stateRe, vecRe);
+  vst1q(S->stateIm, vecIm);
+
+  /* Tail */
+  blkCnt = blockSize & 3U;
+  for (k = 0U; k < blkCnt; k++)
+  {
+    *pDst++ = S->stateRe[k];
+    *pDst++ = S->stateIm[k];
+  }
+
+  /* Restart the rotators from the phase of the sample after the last generated one */
+  S->phase = phase + blockSize * S->phaseInc;
+  arm_nco_resync_f32(S);
+}
+
+#else
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt, resyncCnt, k, phase;
+  float32_t stepRe, stepIm, re, im;
+
+  phase = S->phase;
+
+  stepRe = S->stepRe[3];
+  stepIm = S->stepIm[3];
+
+  resyncCnt = ARM_NCO_RESYNC_PERIOD;
+
+  /* Compute 4 complex outputs at a time */
+  blkCnt = blockSize >> 2U;
+  while (blkCnt > 0U)
+  {
+    for (k = 0U; k < 4U; k++)
+    {
+      re = S->stateRe[k];
+      im = S->stateIm[k];
+      *pDst++ = re;
+      *pDst++ = im;
+
+      /* Advance by 4 samples */
+      S->stateRe[k] = re * stepRe - im * stepIm;
+      S->stateIm[k] = im * stepRe + re * stepIm;
+    }
+
+    resyncCnt--;
+    if (resyncCnt == 0U)
+    {
+      S->phase += 4U * ARM_NCO_RESYNC_PERIOD * S->phaseInc;
+      arm_nco_resync_f32(S);
+
+      resyncCnt = ARM_NCO_RESYNC_PERIOD;
+    }
+
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 3U;
+  for (k = 0U; k < blkCnt; k++)
+  {
+    *pDst++ = S->stateRe[k];
+    *pDst++ = S->stateIm[k];
+  }
+
+  /* Restart the rotators from the phase of the sample after the last generated one */
+  S->phase = phase + blockSize * S->phaseInc;
+  arm_nco_resync_f32(S);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of NCO group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_f32.c
+ * Description:  Floating-point NCO initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point NCO.
+  @param[out]    S      points to an instance of the floating-point NCO
+  @param[in]     freq   frequency in cycles per sample
+  @param[in]     phase  initial phase in cycles
+  @return        none
+
+  @par           Details
+                   A frequency of 0.25 is a quarter of the sampling rate.
+                   Negative frequencies are allowed.
+                   The frequency and the phase are quantized to 2^-31 cycle.
+ */
+
+void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t freq,
+  float32_t phase)
+{
+  /* Reduce the phase to [-0.5 0.5] cycle. One cycle is 2^32 in the phase accumulator */
+  S->phase = (uint32_t) (int32_t) ((phase - roundf(phase)) * 2147483648.0f) << 1;
+
+  /* Compute the rotation steps and the rotators */
+  arm_nco_set_frequency_f32(S, freq);
+}
+
+/**
+  @} end of NCO group
+ */
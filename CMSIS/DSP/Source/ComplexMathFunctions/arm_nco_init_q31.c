@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_q31.c
+ * Description:  Q31 NCO initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 NCO.
+  @param[out]    S      points to an instance of the Q31 NCO
+  @param[in]     freq   frequency in cycles per sample
+  @param[in]     phase  initial phase in cycles
+  @return        none
+
+  @par           Details
+                   The frequency and the phase are Q31 fractions of a cycle:
+                   0x20000000 is a quarter of the sampling rate and negative
+                   frequencies are allowed.
+ */
+
+void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  q31_t freq,
+  q31_t phase)
+{
+  /* One cycle is 2^32 in the phase accumulator */
+  S->phase = (uint32_t) phase << 1;
+  S->phaseInc = (uint32_t) freq << 1;
+}
+
+/**
+  @} end of NCO group
+ */
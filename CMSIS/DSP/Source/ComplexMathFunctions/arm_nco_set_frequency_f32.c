@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_set_frequency_f32.c
+ * Description:  Floating-point NCO frequency update
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+#include "arm_nco.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Changes the frequency of a floating-point NCO.
+  @param[in,out] S     points to an instance of the floating-point NCO
+  @param[in]     freq  frequency in cycles per sample
+  @return        none
+
+  @par           Details
+                   The phase of the next sample is kept so that there is no
+                   phase discontinuity in the output.
+ */
+
+void arm_nco_set_frequency_f32(
+  arm_nco_instance_f32 * S,
+  float32_t freq)
+{
+  uint32_t k;
+
+  S->phaseInc = (uint32_t) (int32_t) ((freq - roundf(freq)) * 2147483648.0f) << 1;
+
+  /* exp(j.k.w) for k = 1 to 4 computed from the quantized frequency so that
+     the rotators stay in phase with the accumulator */
+  for (k = 1U; k <= 4U; k++)
+  {
+    arm_nco_cis_f32(k * S->phaseInc, &S->stepRe[k - 1U], &S->stepIm[k - 1U]);
+  }
+
+  /* Rebuild the rotators from the phase of the next sample */
+  arm_nco_resync_f32(S);
+}
+
+/**
+  @} end of NCO group
+ */
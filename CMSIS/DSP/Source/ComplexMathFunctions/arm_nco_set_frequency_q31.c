@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_set_frequency_q31.c
+ * Description:  Q31 NCO frequency update
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/complex_math_functions.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Changes the frequency of a Q31 NCO.
+  @param[in,out] S     points to an instance of the Q31 NCO
+  @param[in]     freq  frequency in cycles per sample (Q31)
+  @return        none
+
+  @par           Details
+                   The phase accumulator is kept so that there is no phase
+                   discontinuity in the output.
+ */
+
+void arm_nco_set_frequency_q31(
+  arm_nco_instance_q31 * S,
+  q31_t freq)
+{
+  S->phaseInc = (uint32_t) freq << 1;
+}
+
+/**
+  @} end of NCO group
+ */
@@ -32,15 +32,27 @@
 #include "arm_pid_reset_f32.c"
 #include "arm_pid_reset_q15.c"
 #include "arm_pid_reset_q31.c"
+#include "arm_pid_bank_f32.c"
+#include "arm_pid_bank_q31.c"
+#include "arm_pid_bank_init_f32.c"
+#include "arm_pid_bank_init_q31.c"
+#include "arm_pid_bank_reset_f32.c"
+#include "arm_pid_bank_reset_q31.c"
+#include "arm_svpwm_f32.c"
+#include "arm_svpwm_q31.c"
 
 #if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FAST_ALLOW_TABLES)
 
 #if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_F32)
 #include "arm_sin_cos_f32.c"
+#include "arm_foc_transform_f32.c"
+#include "arm_foc_transform_block_f32.c"
 #endif 
 
 #if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_Q31)
 #include "arm_sin_cos_q31.c"
+#include "arm_foc_transform_q31.c"
+#include "arm_foc_transform_block_q31.c"
 #endif
 
 #endif
\ No newline at end of file
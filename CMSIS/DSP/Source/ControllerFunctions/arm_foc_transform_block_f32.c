@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_transform_block_f32.c
+ * Description:  Floating-point Field Oriented Control transform for several motors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+#include "arm_common_tables.h"
+
+/**
+  @addtogroup FOC
+  @{
+ */
+
+/**
+  @brief         Floating-point Field Oriented Control transform for several motors.
+  @param[in]     pIa        points to the phase a currents
+  @param[in]     pIb        points to the phase b currents
+  @param[in]     pTheta     points to the rotor angles in degrees
+  @param[out]    pId        points to the output d coordinates
+  @param[out]    pIq        points to the output q coordinates
+  @param[out]    pSinVal    points to the sines of the rotor angles
+  @param[out]    pCosVal    points to the cosines of the rotor angles
+  @param[in]     numMotors  number of motors
+  @return        none
+
+  @par           Details
+                   The sine and cosine are computed with the table and the interpolation
+                   of \ref arm_sin_cos_f32. On Helium, 4 motors are processed in parallel
+                   and the table is read with gather loads.
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+/* Interpolation between two table values (same polynomial as arm_sin_cos_f32) */
+__STATIC_INLINE f32x4_t arm_foc_interpolate_f32(
+  f32x4_t f1,
+  f32x4_t f2,
+  f32x4_t d1,
+  f32x4_t d2,
+  f32x4_t fract)
+{
+    /* delta between the two points (fixed), in this case 2*pi/FAST_MATH_TABLE_SIZE */
+    const float32_t Dn = 0.0122718463030f;
+    f32x4_t Df, temp;
+
+    /* delta between the values of the functions */
+    Df = vsubq(f2, f1);
+
+    temp = vsubq(vmulq(vaddq(d1, d2), Dn), vaddq(Df, Df));
+    temp = vfmaq(vsubq(vmulq(Df, 3.0f), vmulq(vaddq(d2, vaddq(d1, d1)), Dn)), fract, temp);
+    temp = vfmaq(vmulq(d1, Dn), fract, temp);
+
+    return (vfmaq(f1, fract, temp));
+}
+
+void arm_foc_transform_block_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+  const float32_t * pTheta,
+        float32_t * pId,
+        float32_t * pIq,
+        float32_t * pSinVal,
+        float32_t * pCosVal,
+        uint32_t numMotors)
+{
+    const uint32x4_t mask = vdupq_n_u32(0x1ff);
+    f32x4_t theta, in, findex, fract, s1, s2, c1, c2, sinVal, cosVal;
+    f32x4_t Ia, Ialpha, Ibeta, Id, Iq;
+    uint32x4_t indexS, indexC;
+    int32_t blkCnt;
+
+    /* Compute 4 motors at a time */
+    blkCnt = numMotors;
+    while (blkCnt > 0)
+    {
+        /* The loads are predicated so that the tail does not read past the arrays */
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        theta = vldrwq_z_f32(pTheta, p0);
+
+        /* Scale input, divide input by 360 and keep the fractional part */
+        in = vmulq(vabsq(theta), 0.00277777777778f);
+        in = vsubq(in, vcvtq_f32_s32(vcvtq_s32_f32(in)));
+
+        /* Calculate the nearest index */
+        findex = vmulq(in, (float32_t)FAST_MATH_TABLE_SIZE);
+        indexS = vandq(vcvtq_u32_f32(findex), mask);
+        indexC = vandq(vaddq(indexS, (uint32_t)(FAST_MATH_TABLE_SIZE / 4)), mask);
+
+        /* Calculation of fractional value */
+        fract = vsubq(findex, vcvtq_f32_u32(indexS));
+
+        /* Read two nearest values of input value from the sin table for sine and cosine */
+        s1 = vldrwq_gather_shifted_offset_f32(sinTable_f32, indexS);
+        s2 = vldrwq_gather_shifted_offset_f32(sinTable_f32, vaddq(indexS, (uint32_t)1));
+        c1 = vldrwq_gather_shifted_offset_f32(sinTable_f32, indexC);
+        c2 = vldrwq_gather_shifted_offset_f32(sinTable_f32, vaddq(indexC, (uint32_t)1));
+
+        cosVal = arm_foc_interpolate_f32(c1, c2, vnegq(s1), vnegq(s2), fract);
+        sinVal = arm_foc_interpolate_f32(s1, s2, c1, c2, fract);
+        sinVal = vnegq_m(sinVal, sinVal, vcmpltq(theta, 0.0f));
+
+        /* Clarke transform */
+        Ia = vldrwq_z_f32(pIa, p0);
+        Ialpha = Ia;
+        Ibeta = vfmaq(vmulq(Ia, 0.57735026919f), vldrwq_z_f32(pIb, p0), 1.15470053838f);
+
+        /* Park transform */
+        Id = vfmaq(vmulq(Ialpha, cosVal), Ibeta, sinVal);
+        Iq = vfmsq(vmulq(Ibeta, cosVal), Ialpha, sinVal);
+
+        vstrwq_p(pId, Id, p0);
+        vstrwq_p(pIq, Iq, p0);
+        vstrwq_p(pSinVal, sinVal, p0);
+        vstrwq_p(pCosVal, cosVal, p0);
+
+        pIa += 4; pIb += 4; pTheta += 4;
+        pId += 4; pIq += 4; pSinVal += 4; pCosVal += 4;
+
+        blkCnt -= 4;
+    }
+}
+
+#else
+
+void arm_foc_transform_block_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+  const float32_t * pTheta,
+        float32_t * pId,
+        float32_t * pIq,
+        float32_t * pSinVal,
+        float32_t * pCosVal,
+        uint32_t numMotors)
+{
+  for(uint32_t i=0; i < numMotors; i++)
+  {
+     arm_foc_transform_f32(pIa[i], pIb[i], pTheta[i], &pId[i], &pIq[i], &pSinVal[i], &pCosVal[i]);
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of FOC group
+ */
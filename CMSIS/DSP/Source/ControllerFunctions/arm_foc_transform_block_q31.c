@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_transform_block_q31.c
+ * Description:  Q31 Field Oriented Control transform for several motors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup FOC
+  @{
+ */
+
+/**
+  @brief         Q31 Field Oriented Control transform for several motors.
+  @param[in]     pIa        points to the phase a currents
+  @param[in]     pIb        points to the phase b currents
+  @param[in]     pTheta     points to the scaled rotor angles
+  @param[out]    pId        points to the output d coordinates
+  @param[out]    pIq        points to the output q coordinates
+  @param[out]    pSinVal    points to the sines of the rotor angles
+  @param[out]    pCosVal    points to the cosines of the rotor angles
+  @param[in]     numMotors  number of motors
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The results are the same as the ones of \ref arm_foc_transform_q31.
+ */
+
+void arm_foc_transform_block_q31(
+  const q31_t * pIa,
+  const q31_t * pIb,
+  const q31_t * pTheta,
+        q31_t * pId,
+        q31_t * pIq,
+        q31_t * pSinVal,
+        q31_t * pCosVal,
+        uint32_t numMotors)
+{
+  for(uint32_t i=0; i < numMotors; i++)
+  {
+     arm_foc_transform_q31(pIa[i], pIb[i], pTheta[i], &pId[i], &pIq[i], &pSinVal[i], &pCosVal[i]);
+  }
+}
+
+/**
+  @} end of FOC group
+ */
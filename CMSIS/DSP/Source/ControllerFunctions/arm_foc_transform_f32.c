@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_foc_transform_f32.c
+ * Description:  Floating-point Field Oriented Control transform
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup FOC
+  @{
+ */
+
+/**
+  @brief         Floating-point Field Oriented Control transform.
+  @param[in]     Ia       input three-phase coordinate <code>a</code>
+  @param[in]     Ib       input three-phase coordinate <code>b</code>
+  @param[in]     theta    rotor angle in degrees
+  @param[out]    pId      points to output rotor reference frame d
+  @param[out]    pIq      points to output rotor reference frame q
+  @param[out]    pSinVal  points to the sine of the rotor angle
+  @param[out]    pCosVal  points to the cosine of the rotor angle
+  @return        none
+ */
+
+void arm_foc_transform_f32(
+  float32_t Ia,
+  float32_t Ib,
+  float32_t theta,
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t * pSinVal,
+  float32_t * pCosVal)
+{
+  float32_t Ialpha, Ibeta;
+  float32_t sinVal, cosVal;
+
+  arm_sin_cos_f32(theta, &sinVal, &cosVal);
+
+  arm_clarke_f32(Ia, Ib, &Ialpha, &Ibeta);
+
+  arm_park_f32(Ialpha, Ibeta, pId, pIq, sinVal, cosVal);
+
+  *pSinVal = sinVal;
+  *pCosVal = cosVal;
+}
+
+/**
+  @} end of FOC group
+ */
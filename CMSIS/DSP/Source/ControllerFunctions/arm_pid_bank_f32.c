@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_f32.c
+ * Description:  Floating-point PID controller bank
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PIDBank
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point PID controller bank.
+  @param[in]     S     points to an instance of the PID bank structure
+  @param[in]     pSrc  points to the errors. One error per controller.
+  @param[out]    pDst  points to the outputs. One output per controller.
+  @return        none
+
+  @par           Details
+                   All the controllers of the bank are updated with one new error.
+                   The output of controller i is pDst[i].
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_pid_bank_f32(
+  const arm_pid_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+    const uint32_t n = S->numControllers;
+    const float32_t *pKp = S->pCoeffs, *pKi = pKp + n, *pKd = pKi + n;
+    const float32_t *pKf = pKd + n, *pMin = pKf + n, *pMax = pMin + n;
+    float32_t *pI = S->pState, *pE = pI + n, *pD = pE + n;
+    f32x4_t e, inc, iPrev, iNew, d, u, vMin, vMax;
+    mve_pred16_t pSat;
+    int32_t blkCnt;
+
+    /* Compute 4 controllers at a time */
+    blkCnt = n;
+    while (blkCnt > 0)
+    {
+        /* The loads are predicated so that the tail does not read past the arrays */
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        e = vldrwq_z_f32(pSrc, p0);
+        vMin = vldrwq_z_f32(pMin, p0);
+        vMax = vldrwq_z_f32(pMax, p0);
+
+        /* D[n] = Kf * D[n-1] + Kd * (e[n] - e[n-1]) */
+        d = vmulq(vldrwq_z_f32(pKf, p0), vldrwq_z_f32(pD, p0));
+        d = vfmaq(d, vldrwq_z_f32(pKd, p0), vsubq(e, vldrwq_z_f32(pE, p0)));
+
+        /* I[n] = I[n-1] + Ki * e[n] */
+        inc = vmulq(vldrwq_z_f32(pKi, p0), e);
+        iPrev = vldrwq_z_f32(pI, p0);
+        iNew = vaddq(iPrev, inc);
+
+        /* P[n] + I[n] + D[n] */
+        u = vfmaq(vaddq(iNew, d), vldrwq_z_f32(pKp, p0), e);
+
+        /* Anti-windup : the integrator is not updated when it increases the saturation */
+        pSat = (vcmpgtq(u, vMax) & vcmpgtq(inc, 0.0f)) | (vcmpltq(u, vMin) & vcmpltq(inc, 0.0f));
+        iNew = vpselq(iPrev, iNew, pSat);
+
+        u = vminnmq(vmaxnmq(u, vMin), vMax);
+
+        vstrwq_p(pDst, u, p0);
+        vstrwq_p(pI, iNew, p0);
+        vstrwq_p(pE, e, p0);
+        vstrwq_p(pD, d, p0);
+
+        pSrc += 4; pDst += 4;
+        pKp += 4; pKi += 4; pKd += 4; pKf += 4;
+        pMin += 4; pMax += 4;
+        pI += 4; pE += 4; pD += 4;
+
+        blkCnt -= 4;
+    }
+}
+
+#else
+
+void arm_pid_bank_f32(
+  const arm_pid_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+    const uint32_t n = S->numControllers;
+    const float32_t *pKp = S->pCoeffs, *pKi = pKp + n, *pKd = pKi + n;
+    const float32_t *pKf = pKd + n, *pMin = pKf + n, *pMax = pMin + n;
+    float32_t *pI = S->pState, *pE = pI + n, *pD = pE + n;
+    float32_t e, inc, iNew, d, u;
+
+    for(uint32_t i=0; i < n; i++)
+    {
+        e = pSrc[i];
+
+        /* D[n] = Kf * D[n-1] + Kd * (e[n] - e[n-1]) */
+        d = pKf[i] * pD[i] + pKd[i] * (e - pE[i]);
+
+        /* I[n] = I[n-1] + Ki * e[n] */
+        inc = pKi[i] * e;
+        iNew = pI[i] + inc;
+
+        /* P[n] + I[n] + D[n] */
+        u = pKp[i] * e + iNew + d;
+
+        /* Anti-windup : the integrator is not updated when it increases the saturation */
+        if (u > pMax[i])
+        {
+            u = pMax[i];
+            if (inc > 0.0f)
+            {
+                iNew = pI[i];
+            }
+        }
+        else if (u < pMin[i])
+        {
+            u = pMin[i];
+            if (inc < 0.0f)
+            {
+                iNew = pI[i];
+            }
+        }
+
+        pDst[i] = u;
+        pI[i] = iNew;
+        pE[i] = e;
+        pD[i] = d;
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of PIDBank group
+ */
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_init_q31.c
+ * Description:  Q31 PID controller bank initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PIDBank
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 PID controller bank.
+  @param[in,out] S               points to an instance of the PID bank structure
+  @param[in]     numControllers  number of controllers in the bank
+  @param[in]     pCoeffs         points to the coefficient array of length 6*numControllers
+  @param[in]     pState          points to the state array of length 3*numControllers
+  @param[in]     postShift       shift to be applied to the products with the gains Kp, Ki and Kd
+  @return        none
+
+  @par           Details
+                   The coefficients are stored as {Kp, Ki, Kd, Kf, outMin, outMax}
+                   with numControllers values for each coefficient. \n
+                   Kp, Ki and Kd are in Q(1+postShift).(31-postShift) format.
+                   Kf, outMin and outMax are in 1.31 format. \n
+                   The state of all the controllers is set to zero.
+ */
+
+void arm_pid_bank_init_q31(
+        arm_pid_bank_instance_q31 * S,
+        uint16_t numControllers,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint8_t postShift)
+{
+  S->numControllers = numControllers;
+  S->postShift = postShift;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Integrators, previous errors and filtered derivatives */
+  memset(pState, 0, 3U * numControllers * sizeof(q31_t));
+}
+
+/**
+  @} end of PIDBank group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pid_bank_q31.c
+ * Description:  Q31 PID controller bank
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup PIDBank
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 PID controller bank.
+  @param[in]     S     points to an instance of the PID bank structure
+  @param[in]     pSrc  points to the errors. One error per controller.
+  @param[out]    pDst  points to the outputs. One output per controller.
+  @return        none
+
+  @par           Details
+                   All the controllers of the bank are updated with one new error.
+                   The output of controller i is pDst[i].
+
+  @par           Scaling and Overflow Behavior
+                   The products with the gains are computed with 64-bit accumulators,
+                   shifted by 31-postShift bits and saturated to 1.31 format.
+                   The integrator, the filtered derivative and the output are saturated
+                   to 1.31 format. The difference of two successive errors is computed
+                   without overflow.
+ */
+
+void arm_pid_bank_q31(
+  const arm_pid_bank_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst)
+{
+    const uint32_t n = S->numControllers;
+    const int32_t shift = 31 - (int32_t) S->postShift;
+    const q31_t *pKp = S->pCoeffs, *pKi = pKp + n, *pKd = pKi + n;
+    const q31_t *pKf = pKd + n, *pMin = pKf + n, *pMax = pMin + n;
+    q31_t *pI = S->pState, *pE = pI + n, *pD = pE + n;
+    q31_t e, p, inc, iNew, d;
+    q63_t u;
+
+    for(uint32_t i=0; i < n; i++)
+    {
+        e = pSrc[i];
+
+        /* D[n] = Kf * D[n-1] + Kd * (e[n] - e[n-1]) */
+        d = clip_q63_to_q31((((q63_t) pKf[i] * pD[i]) >> 31) +
+                            (((q63_t) pKd[i] * ((q63_t) e - pE[i])) >> shift));
+
+        /* I[n] = I[n-1] + Ki * e[n] */
+        inc = clip_q63_to_q31(((q63_t) pKi[i] * e) >> shift);
+        iNew = clip_q63_to_q31((q63_t) pI[i] + inc);
+
+        /* P[n] + I[n] + D[n] */
+        p = clip_q63_to_q31(((q63_t) pKp[i] * e) >> shift);
+        u = (q63_t) p + iNew + d;
+
+        /* Anti-windup : the integrator is not updated when it increases the saturation */
+        if (u > pMax[i])
+        {
+            u = pMax[i];
+            if (inc > 0)
+            {
+                iNew = pI[i];
+            }
+        }
+        else if (u < pMin[i])
+        {
+            u = pMin[i];
+            if (inc < 0)
+            {
+                iNew = pI[i];
+            }
+        }
+
+        pDst[i] = (q31_t) u;
+        pI[i] = iNew;
+        pE[i] = e;
+        pD[i] = d;
+    }
+}
+
+/**
+  @} end of PIDBank group
+ */
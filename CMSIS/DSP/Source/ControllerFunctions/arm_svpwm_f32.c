@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svpwm_f32.c
+ * Description:  Floating-point space vector PWM
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup SVPWM
+  @{
+ */
+
+/**
+  @brief         Floating-point space vector PWM.
+  @param[in]     pValpha    points to the alpha coordinates of the voltage vectors
+  @param[in]     pVbeta     points to the beta coordinates of the voltage vectors
+  @param[out]    pDa        points to the duty cycles of phase a
+  @param[out]    pDb        points to the duty cycles of phase b
+  @param[out]    pDc        points to the duty cycles of phase c
+  @param[in]     numMotors  number of motors
+  @return        none
+
+  @par           Details
+                   The voltages are normalized by the DC bus voltage and
+                   the duty cycles are in [0 1].
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_svpwm_f32(
+  const float32_t * pValpha,
+  const float32_t * pVbeta,
+        float32_t * pDa,
+        float32_t * pDb,
+        float32_t * pDc,
+        uint32_t numMotors)
+{
+    const f32x4_t zero = vdupq_n_f32(0.0f);
+    const f32x4_t one = vdupq_n_f32(1.0f);
+    f32x4_t va, vb, vc, half, s, vmax, vmin, off;
+    int32_t blkCnt;
+
+    /* Compute 4 motors at a time */
+    blkCnt = numMotors;
+    while (blkCnt > 0)
+    {
+        /* The loads are predicated so that the tail does not read past the arrays */
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        /* Inverse Clarke transform */
+        va = vldrwq_z_f32(pValpha, p0);
+        half = vmulq(va, 0.5f);
+        s = vmulq(vldrwq_z_f32(pVbeta, p0), 0.86602540378f);
+        vb = vsubq(s, half);
+        vc = vnegq(vaddq(s, half));
+
+        /* Min-max injection */
+        vmax = vmaxnmq(vmaxnmq(va, vb), vc);
+        vmin = vminnmq(vminnmq(va, vb), vc);
+        off = vfmsq(vdupq_n_f32(0.5f), vaddq(vmax, vmin), vdupq_n_f32(0.5f));
+
+        vstrwq_p(pDa, vminnmq(vmaxnmq(vaddq(va, off), zero), one), p0);
+        vstrwq_p(pDb, vminnmq(vmaxnmq(vaddq(vb, off), zero), one), p0);
+        vstrwq_p(pDc, vminnmq(vmaxnmq(vaddq(vc, off), zero), one), p0);
+
+        pValpha += 4; pVbeta += 4;
+        pDa += 4; pDb += 4; pDc += 4;
+
+        blkCnt -= 4;
+    }
+}
+
+#else
+
+/* Clamp of the duty cycles for overmodulation */
+__STATIC_FORCEINLINE float32_t arm_svpwm_clamp_f32(float32_t x)
+{
+    return (x < 0.0f ? 0.0f : (x > 1.0f ? 1.0f : x));
+}
+
+void arm_svpwm_f32(
+  const float32_t * pValpha,
+  const float32_t * pVbeta,
+        float32_t * pDa,
+        float32_t * pDb,
+        float32_t * pDc,
+        uint32_t numMotors)
+{
+    float32_t va, vb, vc, half, s, vmax, vmin, off;
+
+    for(uint32_t i=0; i < numMotors; i++)
+    {
+        /* Inverse Clarke transform */
+        va = pValpha[i];
+        half = 0.5f * va;
+        s = 0.86602540378f * pVbeta[i];
+        vb = s - half;
+        vc = -s - half;
+
+        /* Min-max injection */
+        vmax = va > vb ? va : vb;
+        vmax = vmax > vc ? vmax : vc;
+        vmin = va < vb ? va : vb;
+        vmin = vmin < vc ? vmin : vc;
+        off = 0.5f - 0.5f * (vmax + vmin);
+
+        pDa[i] = arm_svpwm_clamp_f32(va + off);
+        pDb[i] = arm_svpwm_clamp_f32(vb + off);
+        pDc[i] = arm_svpwm_clamp_f32(vc + off);
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of SVPWM group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svpwm_q31.c
+ * Description:  Q31 space vector PWM
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/controller_functions.h"
+
+/**
+  @addtogroup SVPWM
+  @{
+ */
+
+/* Clamp of the duty cycles to [0 1) for overmodulation */
+__STATIC_FORCEINLINE q31_t arm_svpwm_clamp_q31(q63_t x)
+{
+    return ((q31_t) (x < 0 ? 0 : (x > INT32_MAX ? INT32_MAX : x)));
+}
+
+/**
+  @brief         Q31 space vector PWM.
+  @param[in]     pValpha    points to the alpha coordinates of the voltage vectors
+  @param[in]     pVbeta     points to the beta coordinates of the voltage vectors
+  @param[out]    pDa        points to the duty cycles of phase a
+  @param[out]    pDb        points to the duty cycles of phase b
+  @param[out]    pDc        points to the duty cycles of phase c
+  @param[in]     numMotors  number of motors
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The voltages are normalized by the DC bus voltage and
+                   the duty cycles are in 1.31 format in the range [0 1).
+                   The phase voltages are computed with saturation and the
+                   duty cycles with a 64-bit accumulator, hence there is no risk of overflow.
+ */
+
+void arm_svpwm_q31(
+  const q31_t * pValpha,
+  const q31_t * pVbeta,
+        q31_t * pDa,
+        q31_t * pDb,
+        q31_t * pDc,
+        uint32_t numMotors)
+{
+    q31_t va, vb, vc, half, s, vmax, vmin;
+    q63_t off;
+
+    for(uint32_t i=0; i < numMotors; i++)
+    {
+        /* Inverse Clarke transform */
+        va = pValpha[i];
+        half = va >> 1;
+        /* sqrt(3)/2 * Vbeta */
+        s = (q31_t) (((q63_t) pVbeta[i] * 0x6ED9EBA1) >> 31);
+        vb = __QSUB(s, half);
+        vc = __QSUB(-half, s);
+
+        /* Min-max injection */
+        vmax = va > vb ? va : vb;
+        vmax = vmax > vc ? vmax : vc;
+        vmin = va < vb ? va : vb;
+        vmin = vmin < vc ? vmin : vc;
+        off = 0x40000000LL - (((q63_t) vmax + vmin) >> 1);
+
+        pDa[i] = arm_svpwm_clamp_q31(va + off);
+        pDb[i] = arm_svpwm_clamp_q31(vb + off);
+        pDc[i] = arm_svpwm_clamp_q31(vc + off);
+    }
+}
+
+/**
+  @} end of SVPWM group
+ */
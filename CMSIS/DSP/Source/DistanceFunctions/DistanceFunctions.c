@@ -29,15 +29,24 @@
 #include "arm_boolean_distance.c"
 #include "arm_braycurtis_distance_f32.c"
 #include "arm_canberra_distance_f32.c"
+#include "arm_cdist_f32.c"
+#include "arm_cdist_init_f32.c"
 #include "arm_chebyshev_distance_f32.c"
 #include "arm_cityblock_distance_f32.c"
 #include "arm_correlation_distance_f32.c"
 #include "arm_cosine_distance_f32.c"
 #include "arm_dice_distance.c"
+#include "arm_dtw_distance_f32.c"
+#include "arm_dtw_distance_q7.c"
 #include "arm_euclidean_distance_f32.c"
 #include "arm_hamming_distance.c"
+#include "arm_hamming_distance_batch.c"
+#include "arm_hamming_topk.c"
 #include "arm_jaccard_distance.c"
+#include "arm_jaccard_distance_batch.c"
+#include "arm_jaccard_topk.c"
 #include "arm_jensenshannon_distance_f32.c"
+#include "arm_knn_f32.c"
 #include "arm_kulsinski_distance.c"
 #include "arm_minkowski_distance_f32.c"
 #include "arm_rogerstanimoto_distance.c"
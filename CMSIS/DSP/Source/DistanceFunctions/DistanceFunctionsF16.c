@@ -26,6 +26,8 @@
 
 #include "arm_braycurtis_distance_f16.c"
 #include "arm_canberra_distance_f16.c"
+#include "arm_cdist_f16.c"
+#include "arm_cdist_init_f16.c"
 #include "arm_chebyshev_distance_f16.c"
 #include "arm_cityblock_distance_f16.c"
 #include "arm_correlation_distance_f16.c"
@@ -0,0 +1,397 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cdist_f16.c
+ * Description:  Half-precision distance matrix
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/* Dot products of a vector with 4 consecutive rows of vecDim samples */
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+static void arm_cdist_dot4_f16(const float16_t *pQ,
+  const float16_t *pB,
+  uint32_t vecDim,
+  float16_t *pDots)
+{
+    const float16_t *pB0 = pB;
+    const float16_t *pB1 = pB0 + vecDim;
+    const float16_t *pB2 = pB1 + vecDim;
+    const float16_t *pB3 = pB2 + vecDim;
+    uint32_t blkCnt;
+    f16x8_t vecQ, acc0, acc1, acc2, acc3;
+
+    acc0 = vdupq_n_f16(0.0f);
+    acc1 = vdupq_n_f16(0.0f);
+    acc2 = vdupq_n_f16(0.0f);
+    acc3 = vdupq_n_f16(0.0f);
+
+    blkCnt = vecDim >> 3;
+    while (blkCnt > 0U)
+    {
+        vecQ = vld1q(pQ);
+        pQ += 8;
+
+        acc0 = vfmaq(acc0, vecQ, vld1q(pB0));
+        pB0 += 8;
+        acc1 = vfmaq(acc1, vecQ, vld1q(pB1));
+        pB1 += 8;
+        acc2 = vfmaq(acc2, vecQ, vld1q(pB2));
+        pB2 += 8;
+        acc3 = vfmaq(acc3, vecQ, vld1q(pB3));
+        pB3 += 8;
+
+        blkCnt--;
+    }
+
+    /*
+     * tail
+     * (will be merged thru tail predication)
+     */
+    blkCnt = vecDim & 7;
+    if (blkCnt > 0U)
+    {
+        mve_pred16_t p0 = vctp16q(blkCnt);
+
+        vecQ = vldrhq_z_f16(pQ, p0);
+        acc0 = vfmaq_m(acc0, vecQ, vldrhq_z_f16(pB0, p0), p0);
+        acc1 = vfmaq_m(acc1, vecQ, vldrhq_z_f16(pB1, p0), p0);
+        acc2 = vfmaq_m(acc2, vecQ, vldrhq_z_f16(pB2, p0), p0);
+        acc3 = vfmaq_m(acc3, vecQ, vldrhq_z_f16(pB3, p0), p0);
+    }
+
+    pDots[0] = vecAddAcrossF16Mve(acc0);
+    pDots[1] = vecAddAcrossF16Mve(acc1);
+    pDots[2] = vecAddAcrossF16Mve(acc2);
+    pDots[3] = vecAddAcrossF16Mve(acc3);
+}
+
+/*
+
+Dot products of 2 vectors with 4 consecutive rows of vecDim samples.
+The 8 accumulators would not fit in the 8 vector registers so the rows
+are processed 2 at a time (2 x 2 register block).
+
+*/
+static void arm_cdist_dot2x4_f16(const float16_t *pQ,
+  const float16_t *pB,
+  uint32_t vecDim,
+  float16_t *pDots)
+{
+    const float16_t *pQ0, *pQ1, *pB0, *pB1;
+    uint32_t blkCnt, j;
+    f16x8_t vecQ0, vecQ1, vecB, acc00, acc01, acc10, acc11;
+
+    for(j = 0; j < 4; j += 2)
+    {
+        pQ0 = pQ;
+        pQ1 = pQ0 + vecDim;
+        pB0 = pB + j * vecDim;
+        pB1 = pB0 + vecDim;
+
+        acc00 = vdupq_n_f16(0.0f);
+        acc01 = vdupq_n_f16(0.0f);
+        acc10 = vdupq_n_f16(0.0f);
+        acc11 = vdupq_n_f16(0.0f);
+
+        blkCnt = vecDim >> 3;
+        while (blkCnt > 0U)
+        {
+            vecQ0 = vld1q(pQ0);
+            pQ0 += 8;
+            vecQ1 = vld1q(pQ1);
+            pQ1 += 8;
+
+            vecB = vld1q(pB0);
+            pB0 += 8;
+            acc00 = vfmaq(acc00, vecQ0, vecB);
+            acc10 = vfmaq(acc10, vecQ1, vecB);
+
+            vecB = vld1q(pB1);
+            pB1 += 8;
+            acc01 = vfmaq(acc01, vecQ0, vecB);
+            acc11 = vfmaq(acc11, vecQ1, vecB);
+
+            blkCnt--;
+        }
+
+        /*
+         * tail
+         * (will be merged thru tail predication)
+         */
+        blkCnt = vecDim & 7;
+        if (blkCnt > 0U)
+        {
+            mve_pred16_t p0 = vctp16q(blkCnt);
+
+            vecQ0 = vldrhq_z_f16(pQ0, p0);
+            vecQ1 = vldrhq_z_f16(pQ1, p0);
+
+            vecB = vldrhq_z_f16(pB0, p0);
+            acc00 = vfmaq_m(acc00, vecQ0, vecB, p0);
+            acc10 = vfmaq_m(acc10, vecQ1, vecB, p0);
+
+            vecB = vldrhq_z_f16(pB1, p0);
+            acc01 = vfmaq_m(acc01, vecQ0, vecB, p0);
+            acc11 = vfmaq_m(acc11, vecQ1, vecB, p0);
+        }
+
+        pDots[j]     = vecAddAcrossF16Mve(acc00);
+        pDots[j + 1] = vecAddAcrossF16Mve(acc01);
+        pDots[j + 4] = vecAddAcrossF16Mve(acc10);
+        pDots[j + 5] = vecAddAcrossF16Mve(acc11);
+    }
+}
+
+#else
+static void arm_cdist_dot4_f16(const float16_t *pQ,
+  const float16_t *pB,
+  uint32_t vecDim,
+  float16_t *pDots)
+{
+    const float16_t *pB0 = pB;
+    const float16_t *pB1 = pB0 + vecDim;
+    const float16_t *pB2 = pB1 + vecDim;
+    const float16_t *pB3 = pB2 + vecDim;
+    _Float16 acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    _Float16 q;
+
+    while (vecDim > 0U)
+    {
+        q = (_Float16)*pQ++;
+
+        acc0 += q * (_Float16)*pB0++;
+        acc1 += q * (_Float16)*pB1++;
+        acc2 += q * (_Float16)*pB2++;
+        acc3 += q * (_Float16)*pB3++;
+
+        vecDim--;
+    }
+
+    pDots[0] = acc0;
+    pDots[1] = acc1;
+    pDots[2] = acc2;
+    pDots[3] = acc3;
+}
+
+/*
+
+Dot products of 2 vectors with 4 consecutive rows of vecDim samples.
+Each sample of the rows is loaded once for the 2 vectors.
+
+*/
+static void arm_cdist_dot2x4_f16(const float16_t *pQ,
+  const float16_t *pB,
+  uint32_t vecDim,
+  float16_t *pDots)
+{
+    const float16_t *pQ0 = pQ;
+    const float16_t *pQ1 = pQ0 + vecDim;
+    const float16_t *pB0 = pB;
+    const float16_t *pB1 = pB0 + vecDim;
+    const float16_t *pB2 = pB1 + vecDim;
+    const float16_t *pB3 = pB2 + vecDim;
+    _Float16 acc00 = 0.0f, acc01 = 0.0f, acc02 = 0.0f, acc03 = 0.0f;
+    _Float16 acc10 = 0.0f, acc11 = 0.0f, acc12 = 0.0f, acc13 = 0.0f;
+    _Float16 q0, q1, b;
+
+    while (vecDim > 0U)
+    {
+        q0 = (_Float16)*pQ0++;
+        q1 = (_Float16)*pQ1++;
+
+        b = (_Float16)*pB0++;
+        acc00 += q0 * b;
+        acc10 += q1 * b;
+        b = (_Float16)*pB1++;
+        acc01 += q0 * b;
+        acc11 += q1 * b;
+        b = (_Float16)*pB2++;
+        acc02 += q0 * b;
+        acc12 += q1 * b;
+        b = (_Float16)*pB3++;
+        acc03 += q0 * b;
+        acc13 += q1 * b;
+
+        vecDim--;
+    }
+
+    pDots[0] = acc00;
+    pDots[1] = acc01;
+    pDots[2] = acc02;
+    pDots[3] = acc03;
+    pDots[4] = acc10;
+    pDots[5] = acc11;
+    pDots[6] = acc12;
+    pDots[7] = acc13;
+}
+#endif /* defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/* Distance from the dot product and the squared norms */
+__STATIC_FORCEINLINE float16_t arm_cdist_from_dot_f16(arm_cdist_metric metric,
+  float16_t normQ,
+  float16_t normB,
+  float16_t dot)
+{
+    float16_t tmp;
+
+    if (metric == ARM_CDIST_COSINE)
+    {
+        arm_sqrt_f16((_Float16)normQ * (_Float16)normB, &tmp);
+        return((_Float16)1.0f - (_Float16)dot / (_Float16)tmp);
+    }
+
+    tmp = (_Float16)normQ + (_Float16)normB - (_Float16)2.0f * (_Float16)dot;
+    if ((_Float16)tmp < (_Float16)0.0f)
+    {
+        tmp = 0.0f;
+    }
+
+    if (metric == ARM_CDIST_EUCLIDEAN)
+    {
+        arm_sqrt_f16(tmp, &tmp);
+    }
+
+    return(tmp);
+}
+
+/**
+ * @brief        Distances between query vectors and the reference vectors
+ * @param[in]    S           Instance
+ * @param[in]    pQueries    Query vectors (numQueries rows of vecDim samples)
+ * @param[in]    numQueries  Number of query vectors
+ * @param[out]   pDst        Distances (numQueries rows of numVectors samples)
+ *
+ * pDst[i * numVectors + j] is the distance between the query i and the
+ * reference vector j.
+ *
+ */
+void arm_cdist_f16(const arm_cdist_instance_f16 *S,
+  const float16_t *pQueries,
+  uint32_t numQueries,
+  float16_t *pDst)
+{
+    const float16_t *pB;
+    const float16_t *pNorms;
+    float16_t normQ[2], dots[8];
+    uint32_t blkCnt, j;
+    uint32_t numVectors = S->numVectors;
+    uint32_t vecDim = S->vecDim;
+
+    /* 2 queries at a time */
+    while (numQueries > 1U)
+    {
+        arm_power_f16(pQueries, vecDim, &normQ[0]);
+        arm_power_f16(pQueries + vecDim, vecDim, &normQ[1]);
+
+        pB = S->pVectors;
+        pNorms = S->pNorms;
+
+        /* 4 reference vectors at a time */
+        blkCnt = numVectors >> 2;
+        while (blkCnt > 0U)
+        {
+            arm_cdist_dot2x4_f16(pQueries, pB, vecDim, dots);
+
+            for(j = 0; j < 4; j++)
+            {
+                pDst[j] = arm_cdist_from_dot_f16(S->metric, normQ[0], pNorms[j], dots[j]);
+                pDst[numVectors + j] = arm_cdist_from_dot_f16(S->metric, normQ[1], pNorms[j], dots[4 + j]);
+            }
+
+            pDst += 4;
+            pNorms += 4;
+            pB += 4 * vecDim;
+            blkCnt--;
+        }
+
+        blkCnt = numVectors & 3;
+        while (blkCnt > 0U)
+        {
+            arm_dot_prod_f16(pQueries, pB, vecDim, &dots[0]);
+            arm_dot_prod_f16(pQueries + vecDim, pB, vecDim, &dots[4]);
+            pDst[0] = arm_cdist_from_dot_f16(S->metric, normQ[0], *pNorms, dots[0]);
+            pDst[numVectors] = arm_cdist_from_dot_f16(S->metric, normQ[1], *pNorms, dots[4]);
+
+            pDst++;
+            pNorms++;
+            pB += vecDim;
+            blkCnt--;
+        }
+
+        /* Skip the row of the second query */
+        pDst += numVectors;
+        pQueries += 2 * vecDim;
+        numQueries -= 2;
+    }
+
+    /* Last query */
+    if (numQueries > 0U)
+    {
+        arm_power_f16(pQueries, vecDim, &normQ[0]);
+
+        pB = S->pVectors;
+        pNorms = S->pNorms;
+
+        blkCnt = numVectors >> 2;
+        while (blkCnt > 0U)
+        {
+            arm_cdist_dot4_f16(pQueries, pB, vecDim, dots);
+
+            for(j = 0; j < 4; j++)
+            {
+                *pDst++ = arm_cdist_from_dot_f16(S->metric, normQ[0], *pNorms++, dots[j]);
+            }
+
+            pB += 4 * vecDim;
+            blkCnt--;
+        }
+
+        blkCnt = numVectors & 3;
+        while (blkCnt > 0U)
+        {
+            arm_dot_prod_f16(pQueries, pB, vecDim, &dots[0]);
+            *pDst++ = arm_cdist_from_dot_f16(S->metric, normQ[0], *pNorms++, dots[0]);
+
+            pB += vecDim;
+            blkCnt--;
+        }
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
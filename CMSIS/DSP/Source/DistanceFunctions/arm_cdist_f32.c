@@ -0,0 +1,427 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cdist_f32.c
+ * Description:  Floating-point distance matrix
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @ingroup FloatDist
+ */
+
+/**
+  @defgroup DistanceMatrix Distance matrix
+
+  Distances between a set of query vectors and a set of reference vectors
+  (one-to-many when there is only one query).
+
+  The Euclidean and cosine distances are computed from the dot products
+  of the vectors and from their squared norms:
+
+  <pre>
+      |a - b|^2 = |a|^2 + |b|^2 - 2 a.b
+      1 - cos(a,b) = 1 - a.b / sqrt(|a|^2 |b|^2)
+  </pre>
+
+  The squared norms of the reference vectors are computed once by the
+  initialization function and the squared norm of each query once per call.
+  In the many-to-many mode, the dot products are computed for 2 queries
+  and 4 reference vectors at a time, as in a blocked matrix product: each
+  sample of a query is loaded once for 4 reference vectors and each sample
+  of a reference vector once for 2 queries. With Helium, the 2 x 4 block
+  is processed as two 2 x 2 register blocks because of the number of vector
+  registers. A single query is computed against 4 reference vectors at a time.
+
+  The Euclidean distance computed like this loses accuracy for vectors
+  which are very close compared to their norms. Negative squared distances
+  generated by rounding errors are replaced by 0.
+
+  arm_knn_f32 returns the k reference vectors nearest to a query.
+ */
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/* Dot products of a vector with 4 consecutive rows of vecDim samples */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+static void arm_cdist_dot4_f32(const float32_t *pQ,
+  const float32_t *pB,
+  uint32_t vecDim,
+  float32_t *pDots)
+{
+    const float32_t *pB0 = pB;
+    const float32_t *pB1 = pB0 + vecDim;
+    const float32_t *pB2 = pB1 + vecDim;
+    const float32_t *pB3 = pB2 + vecDim;
+    uint32_t blkCnt;
+    f32x4_t vecQ, acc0, acc1, acc2, acc3;
+
+    acc0 = vdupq_n_f32(0.0f);
+    acc1 = vdupq_n_f32(0.0f);
+    acc2 = vdupq_n_f32(0.0f);
+    acc3 = vdupq_n_f32(0.0f);
+
+    blkCnt = vecDim >> 2;
+    while (blkCnt > 0U)
+    {
+        vecQ = vld1q(pQ);
+        pQ += 4;
+
+        acc0 = vfmaq(acc0, vecQ, vld1q(pB0));
+        pB0 += 4;
+        acc1 = vfmaq(acc1, vecQ, vld1q(pB1));
+        pB1 += 4;
+        acc2 = vfmaq(acc2, vecQ, vld1q(pB2));
+        pB2 += 4;
+        acc3 = vfmaq(acc3, vecQ, vld1q(pB3));
+        pB3 += 4;
+
+        blkCnt--;
+    }
+
+    /*
+     * tail
+     * (will be merged thru tail predication)
+     */
+    blkCnt = vecDim & 3;
+    if (blkCnt > 0U)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        vecQ = vldrwq_z_f32(pQ, p0);
+        acc0 = vfmaq_m(acc0, vecQ, vldrwq_z_f32(pB0, p0), p0);
+        acc1 = vfmaq_m(acc1, vecQ, vldrwq_z_f32(pB1, p0), p0);
+        acc2 = vfmaq_m(acc2, vecQ, vldrwq_z_f32(pB2, p0), p0);
+        acc3 = vfmaq_m(acc3, vecQ, vldrwq_z_f32(pB3, p0), p0);
+    }
+
+    pDots[0] = vecAddAcrossF32Mve(acc0);
+    pDots[1] = vecAddAcrossF32Mve(acc1);
+    pDots[2] = vecAddAcrossF32Mve(acc2);
+    pDots[3] = vecAddAcrossF32Mve(acc3);
+}
+
+/*
+
+Dot products of 2 vectors with 4 consecutive rows of vecDim samples.
+The 8 accumulators would not fit in the 8 vector registers so the rows
+are processed 2 at a time (2 x 2 register block).
+
+*/
+static void arm_cdist_dot2x4_f32(const float32_t *pQ,
+  const float32_t *pB,
+  uint32_t vecDim,
+  float32_t *pDots)
+{
+    const float32_t *pQ0, *pQ1, *pB0, *pB1;
+    uint32_t blkCnt, j;
+    f32x4_t vecQ0, vecQ1, vecB, acc00, acc01, acc10, acc11;
+
+    for(j = 0; j < 4; j += 2)
+    {
+        pQ0 = pQ;
+        pQ1 = pQ0 + vecDim;
+        pB0 = pB + j * vecDim;
+        pB1 = pB0 + vecDim;
+
+        acc00 = vdupq_n_f32(0.0f);
+        acc01 = vdupq_n_f32(0.0f);
+        acc10 = vdupq_n_f32(0.0f);
+        acc11 = vdupq_n_f32(0.0f);
+
+        blkCnt = vecDim >> 2;
+        while (blkCnt > 0U)
+        {
+            vecQ0 = vld1q(pQ0);
+            pQ0 += 4;
+            vecQ1 = vld1q(pQ1);
+            pQ1 += 4;
+
+            vecB = vld1q(pB0);
+            pB0 += 4;
+            acc00 = vfmaq(acc00, vecQ0, vecB);
+            acc10 = vfmaq(acc10, vecQ1, vecB);
+
+            vecB = vld1q(pB1);
+            pB1 += 4;
+            acc01 = vfmaq(acc01, vecQ0, vecB);
+            acc11 = vfmaq(acc11, vecQ1, vecB);
+
+            blkCnt--;
+        }
+
+        /*
+         * tail
+         * (will be merged thru tail predication)
+         */
+        blkCnt = vecDim & 3;
+        if (blkCnt > 0U)
+        {
+            mve_pred16_t p0 = vctp32q(blkCnt);
+
+            vecQ0 = vldrwq_z_f32(pQ0, p0);
+            vecQ1 = vldrwq_z_f32(pQ1, p0);
+
+            vecB = vldrwq_z_f32(pB0, p0);
+            acc00 = vfmaq_m(acc00, vecQ0, vecB, p0);
+            acc10 = vfmaq_m(acc10, vecQ1, vecB, p0);
+
+            vecB = vldrwq_z_f32(pB1, p0);
+            acc01 = vfmaq_m(acc01, vecQ0, vecB, p0);
+            acc11 = vfmaq_m(acc11, vecQ1, vecB, p0);
+        }
+
+        pDots[j]     = vecAddAcrossF32Mve(acc00);
+        pDots[j + 1] = vecAddAcrossF32Mve(acc01);
+        pDots[j + 4] = vecAddAcrossF32Mve(acc10);
+        pDots[j + 5] = vecAddAcrossF32Mve(acc11);
+    }
+}
+
+#else
+static void arm_cdist_dot4_f32(const float32_t *pQ,
+  const float32_t *pB,
+  uint32_t vecDim,
+  float32_t *pDots)
+{
+    const float32_t *pB0 = pB;
+    const float32_t *pB1 = pB0 + vecDim;
+    const float32_t *pB2 = pB1 + vecDim;
+    const float32_t *pB3 = pB2 + vecDim;
+    float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    float32_t q;
+
+    while (vecDim > 0U)
+    {
+        q = *pQ++;
+
+        acc0 += q * *pB0++;
+        acc1 += q * *pB1++;
+        acc2 += q * *pB2++;
+        acc3 += q * *pB3++;
+
+        vecDim--;
+    }
+
+    pDots[0] = acc0;
+    pDots[1] = acc1;
+    pDots[2] = acc2;
+    pDots[3] = acc3;
+}
+
+/*
+
+Dot products of 2 vectors with 4 consecutive rows of vecDim samples.
+Each sample of the rows is loaded once for the 2 vectors.
+
+*/
+static void arm_cdist_dot2x4_f32(const float32_t *pQ,
+  const float32_t *pB,
+  uint32_t vecDim,
+  float32_t *pDots)
+{
+    const float32_t *pQ0 = pQ;
+    const float32_t *pQ1 = pQ0 + vecDim;
+    const float32_t *pB0 = pB;
+    const float32_t *pB1 = pB0 + vecDim;
+    const float32_t *pB2 = pB1 + vecDim;
+    const float32_t *pB3 = pB2 + vecDim;
+    float32_t acc00 = 0.0f, acc01 = 0.0f, acc02 = 0.0f, acc03 = 0.0f;
+    float32_t acc10 = 0.0f, acc11 = 0.0f, acc12 = 0.0f, acc13 = 0.0f;
+    float32_t q0, q1, b;
+
+    while (vecDim > 0U)
+    {
+        q0 = *pQ0++;
+        q1 = *pQ1++;
+
+        b = *pB0++;
+        acc00 += q0 * b;
+        acc10 += q1 * b;
+        b = *pB1++;
+        acc01 += q0 * b;
+        acc11 += q1 * b;
+        b = *pB2++;
+        acc02 += q0 * b;
+        acc12 += q1 * b;
+        b = *pB3++;
+        acc03 += q0 * b;
+        acc13 += q1 * b;
+
+        vecDim--;
+    }
+
+    pDots[0] = acc00;
+    pDots[1] = acc01;
+    pDots[2] = acc02;
+    pDots[3] = acc03;
+    pDots[4] = acc10;
+    pDots[5] = acc11;
+    pDots[6] = acc12;
+    pDots[7] = acc13;
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/* Distance from the dot product and the squared norms */
+__STATIC_FORCEINLINE float32_t arm_cdist_from_dot_f32(arm_cdist_metric metric,
+  float32_t normQ,
+  float32_t normB,
+  float32_t dot)
+{
+    float32_t tmp;
+
+    if (metric == ARM_CDIST_COSINE)
+    {
+        arm_sqrt_f32(normQ * normB, &tmp);
+        return(1.0f - dot / tmp);
+    }
+
+    tmp = normQ + normB - 2.0f * dot;
+    if (tmp < 0.0f)
+    {
+        tmp = 0.0f;
+    }
+
+    if (metric == ARM_CDIST_EUCLIDEAN)
+    {
+        arm_sqrt_f32(tmp, &tmp);
+    }
+
+    return(tmp);
+}
+
+/**
+ * @brief        Distances between query vectors and the reference vectors
+ * @param[in]    S           Instance
+ * @param[in]    pQueries    Query vectors (numQueries rows of vecDim samples)
+ * @param[in]    numQueries  Number of query vectors
+ * @param[out]   pDst        Distances (numQueries rows of numVectors samples)
+ *
+ * pDst[i * numVectors + j] is the distance between the query i and the
+ * reference vector j.
+ *
+ */
+void arm_cdist_f32(const arm_cdist_instance_f32 *S,
+  const float32_t *pQueries,
+  uint32_t numQueries,
+  float32_t *pDst)
+{
+    const float32_t *pB;
+    const float32_t *pNorms;
+    float32_t normQ[2], dots[8];
+    uint32_t blkCnt, j;
+    uint32_t numVectors = S->numVectors;
+    uint32_t vecDim = S->vecDim;
+
+    /* 2 queries at a time */
+    while (numQueries > 1U)
+    {
+        arm_power_f32(pQueries, vecDim, &normQ[0]);
+        arm_power_f32(pQueries + vecDim, vecDim, &normQ[1]);
+
+        pB = S->pVectors;
+        pNorms = S->pNorms;
+
+        /* 4 reference vectors at a time */
+        blkCnt = numVectors >> 2;
+        while (blkCnt > 0U)
+        {
+            arm_cdist_dot2x4_f32(pQueries, pB, vecDim, dots);
+
+            for(j = 0; j < 4; j++)
+            {
+                pDst[j] = arm_cdist_from_dot_f32(S->metric, normQ[0], pNorms[j], dots[j]);
+                pDst[numVectors + j] = arm_cdist_from_dot_f32(S->metric, normQ[1], pNorms[j], dots[4 + j]);
+            }
+
+            pDst += 4;
+            pNorms += 4;
+            pB += 4 * vecDim;
+            blkCnt--;
+        }
+
+        blkCnt = numVectors & 3;
+        while (blkCnt > 0U)
+        {
+            arm_dot_prod_f32(pQueries, pB, vecDim, &dots[0]);
+            arm_dot_prod_f32(pQueries + vecDim, pB, vecDim, &dots[4]);
+            pDst[0] = arm_cdist_from_dot_f32(S->metric, normQ[0], *pNorms, dots[0]);
+            pDst[numVectors] = arm_cdist_from_dot_f32(S->metric, normQ[1], *pNorms, dots[4]);
+
+            pDst++;
+            pNorms++;
+            pB += vecDim;
+            blkCnt--;
+        }
+
+        /* Skip the row of the second query */
+        pDst += numVectors;
+        pQueries += 2 * vecDim;
+        numQueries -= 2;
+    }
+
+    /* Last query */
+    if (numQueries > 0U)
+    {
+        arm_power_f32(pQueries, vecDim, &normQ[0]);
+
+        pB = S->pVectors;
+        pNorms = S->pNorms;
+
+        blkCnt = numVectors >> 2;
+        while (blkCnt > 0U)
+        {
+            arm_cdist_dot4_f32(pQueries, pB, vecDim, dots);
+
+            for(j = 0; j < 4; j++)
+            {
+                *pDst++ = arm_cdist_from_dot_f32(S->metric, normQ[0], *pNorms++, dots[j]);
+            }
+
+            pB += 4 * vecDim;
+            blkCnt--;
+        }
+
+        blkCnt = numVectors & 3;
+        while (blkCnt > 0U)
+        {
+            arm_dot_prod_f32(pQueries, pB, vecDim, &dots[0]);
+            *pDst++ = arm_cdist_from_dot_f32(S->metric, normQ[0], *pNorms++, dots[0]);
+
+            pB += vecDim;
+            blkCnt--;
+        }
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
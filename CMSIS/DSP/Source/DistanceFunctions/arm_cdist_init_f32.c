@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cdist_init_f32.c
+ * Description:  Floating-point distance matrix initialization
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        Initialization function for the floating-point distance matrix
+ * @param[out]   S           Instance
+ * @param[in]    metric      Metric of the distances
+ * @param[in]    pVectors    Reference vectors (numVectors rows of vecDim samples)
+ * @param[in]    numVectors  Number of reference vectors
+ * @param[in]    vecDim      Dimension of the vectors
+ * @param[out]   pNorms      Buffer of numVectors samples for the squared norms
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unknown metric
+ *
+ * The squared norms of the reference vectors are computed once here
+ * and reused by all the following distance computations. The reference
+ * vectors are not copied and must not be modified while the instance
+ * is used.
+ *
+ */
+arm_status arm_cdist_init_f32(arm_cdist_instance_f32 *S,
+  arm_cdist_metric metric,
+  const float32_t *pVectors,
+  uint32_t numVectors,
+  uint32_t vecDim,
+  float32_t *pNorms)
+{
+    uint32_t i;
+
+    if ((metric != ARM_CDIST_EUCLIDEAN) &&
+        (metric != ARM_CDIST_SQEUCLIDEAN) &&
+        (metric != ARM_CDIST_COSINE))
+    {
+        return(ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->metric = metric;
+    S->numVectors = numVectors;
+    S->vecDim = vecDim;
+    S->pVectors = pVectors;
+    S->pNorms = pNorms;
+
+    for(i = 0; i < numVectors; i++)
+    {
+        arm_power_f32(pVectors, vecDim, &pNorms[i]);
+        pVectors += vecDim;
+    }
+
+    return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_distance_f32.c
+ * Description:  Dynamic time warping distance between two vectors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include <math.h>
+
+/**
+  @ingroup FloatDist
+ */
+
+/**
+  @defgroup DTW Dynamic time warping distance
+
+  Distance between two sequences of possibly different lengths which can
+  be locally stretched or compressed in time. It is the smallest sum of
+  the costs |a[i] - b[j]| along a path of cells (i,j) going from (0,0)
+  to (lenA-1,lenB-1) by steps of (1,0), (0,1) or (1,1).
+
+  The path is constrained to a Sakoe-Chiba band : |i - j| <= window when
+  i is the index in the longer sequence and j the index in the shorter one.
+  The window is increased to the difference of the lengths when it is
+  smaller since the last cell could not be reached otherwise. A window
+  greater or equal to the length of the longer sequence is no constraint.
+
+  The cost matrix is never stored : only two rows of the length of the
+  shorter sequence are kept. Since every path crosses each row, the
+  computation is abandoned as soon as the smallest cost of a row is
+  greater than a threshold. It is useful for a nearest neighbour search
+  where the threshold is the best distance found so far.
+ */
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+/**
+ * @brief        Dynamic time warping distance between two vectors
+ * @param[in]    pSrcA       First sequence
+ * @param[in]    lenA        Length of the first sequence
+ * @param[in]    pSrcB       Second sequence
+ * @param[in]    lenB        Length of the second sequence
+ * @param[in]    window      Half-width of the Sakoe-Chiba band
+ * @param[in]    threshold   Early abandon threshold
+ * @param[out]   pScratch    Buffer of 2 * (min(lenA,lenB) + 1) samples
+ * @return distance or F32_MAX when the computation has been abandoned
+ *
+ * Use F32_MAX as threshold to always compute the distance.
+ *
+ */
+float32_t arm_dtw_distance_f32(const float32_t *pSrcA,
+  uint32_t lenA,
+  const float32_t *pSrcB,
+  uint32_t lenB,
+  uint32_t window,
+  float32_t threshold,
+  float32_t *pScratch)
+{
+    const float32_t *pRow, *pCol;
+    uint32_t nbRows, nbCols;
+    float32_t *pPrev, *pCur, *pTmp;
+    uint32_t i, j, jStart, jEnd;
+    float32_t rowMin, m, r;
+
+    /* The rows are the longer sequence and the buffers the shorter one */
+    if (lenA >= lenB)
+    {
+        pRow = pSrcA; nbRows = lenA;
+        pCol = pSrcB; nbCols = lenB;
+    }
+    else
+    {
+        pRow = pSrcB; nbRows = lenB;
+        pCol = pSrcA; nbCols = lenA;
+    }
+
+    if (window < nbRows - nbCols)
+    {
+        window = nbRows - nbCols;
+    }
+
+    pPrev = pScratch;
+    pCur = pScratch + nbCols + 1;
+
+    /* Row before the first one : only the origin is reachable */
+    pPrev[0] = 0.0f;
+    for(j = 1; j <= nbCols; j++)
+    {
+        pPrev[j] = F32_MAX;
+    }
+    pCur[0] = F32_MAX;
+
+    for(i = 1; i <= nbRows; i++)
+    {
+        jStart = (i > window) ? i - window : 1U;
+        jEnd = ((window < nbCols) && (i < nbCols - window)) ? i + window : nbCols;
+
+        /* Left border of the band */
+        pCur[jStart - 1U] = F32_MAX;
+
+        r = pRow[i - 1U];
+        rowMin = F32_MAX;
+        for(j = jStart; j <= jEnd; j++)
+        {
+            m = pPrev[j - 1U];
+            if (pPrev[j] < m)
+            {
+                m = pPrev[j];
+            }
+            if (pCur[j - 1U] < m)
+            {
+                m = pCur[j - 1U];
+            }
+
+            m += fabsf(r - pCol[j - 1U]);
+            pCur[j] = m;
+
+            if (m < rowMin)
+            {
+                rowMin = m;
+            }
+        }
+
+        /* Right border of the band */
+        if (jEnd < nbCols)
+        {
+            pCur[jEnd + 1U] = F32_MAX;
+        }
+
+        if (rowMin > threshold)
+        {
+            return (F32_MAX);
+        }
+
+        pTmp = pPrev;
+        pPrev = pCur;
+        pCur = pTmp;
+    }
+
+    return (pPrev[nbCols]);
+}
+
+/**
+ * @} end of DTW group
+ */
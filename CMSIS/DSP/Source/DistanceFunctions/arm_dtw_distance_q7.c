@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_distance_q7.c
+ * Description:  Dynamic time warping distance between two q7 vectors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+/**
+ * @brief        Dynamic time warping distance between two q7 vectors
+ * @param[in]    pSrcA       First sequence
+ * @param[in]    lenA        Length of the first sequence
+ * @param[in]    pSrcB       Second sequence
+ * @param[in]    lenB        Length of the second sequence
+ * @param[in]    window      Half-width of the Sakoe-Chiba band
+ * @param[in]    threshold   Early abandon threshold
+ * @param[out]   pScratch    Buffer of 2 * (min(lenA,lenB) + 1) samples
+ * @return distance or Q31_MAX when the computation has been abandoned
+ *
+ * @par          Scaling and Overflow Behavior
+ *                   The costs |a[i] - b[j]| are integers in [0 255] and are
+ *                   accumulated exactly in 32 bits. The result is in the q7
+ *                   format of the inputs : it is 128 times the distance
+ *                   between the sequences converted to floating-point.
+ *                   There is no overflow for sequences shorter than 2^22.
+ *
+ * Use Q31_MAX as threshold to always compute the distance.
+ *
+ */
+q31_t arm_dtw_distance_q7(const q7_t *pSrcA,
+  uint32_t lenA,
+  const q7_t *pSrcB,
+  uint32_t lenB,
+  uint32_t window,
+  q31_t threshold,
+  q31_t *pScratch)
+{
+    const q7_t *pRow, *pCol;
+    uint32_t nbRows, nbCols;
+    q31_t *pPrev, *pCur, *pTmp;
+    uint32_t i, j, jStart, jEnd;
+    q31_t rowMin, m, d, r;
+
+    /* The rows are the longer sequence and the buffers the shorter one */
+    if (lenA >= lenB)
+    {
+        pRow = pSrcA; nbRows = lenA;
+        pCol = pSrcB; nbCols = lenB;
+    }
+    else
+    {
+        pRow = pSrcB; nbRows = lenB;
+        pCol = pSrcA; nbCols = lenA;
+    }
+
+    if (window < nbRows - nbCols)
+    {
+        window = nbRows - nbCols;
+    }
+
+    pPrev = pScratch;
+    pCur = pScratch + nbCols + 1;
+
+    /* Row before the first one : only the origin is reachable */
+    pPrev[0] = 0;
+    for(j = 1; j <= nbCols; j++)
+    {
+        pPrev[j] = Q31_MAX;
+    }
+    pCur[0] = Q31_MAX;
+
+    for(i = 1; i <= nbRows; i++)
+    {
+        jStart = (i > window) ? i - window : 1U;
+        jEnd = ((window < nbCols) && (i < nbCols - window)) ? i + window : nbCols;
+
+        /* Left border of the band */
+        pCur[jStart - 1U] = Q31_MAX;
+
+        r = pRow[i - 1U];
+        rowMin = Q31_MAX;
+        for(j = jStart; j <= jEnd; j++)
+        {
+            /* At least one of the 3 cells is inside the band
+               so the sum never uses Q31_MAX */
+            m = pPrev[j - 1U];
+            if (pPrev[j] < m)
+            {
+                m = pPrev[j];
+            }
+            if (pCur[j - 1U] < m)
+            {
+                m = pCur[j - 1U];
+            }
+
+            d = r - (q31_t) pCol[j - 1U];
+            m += (d > 0) ? d : -d;
+            pCur[j] = m;
+
+            if (m < rowMin)
+            {
+                rowMin = m;
+            }
+        }
+
+        /* Right border of the band */
+        if (jEnd < nbCols)
+        {
+            pCur[jEnd + 1U] = Q31_MAX;
+        }
+
+        if (rowMin > threshold)
+        {
+            return (Q31_MAX);
+        }
+
+        pTmp = pPrev;
+        pPrev = pCur;
+        pCur = pTmp;
+    }
+
+    return (pPrev[nbCols]);
+}
+
+/**
+ * @} end of DTW group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hamming_distance_batch.c
+ * Description:  Hamming distance between a vector and a batch of vectors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_boolean_batch.h"
+
+/**
+  @addtogroup BoolDist
+  @{
+ */
+
+
+/**
+ * @brief        Hamming distances between a vector and a batch of vectors
+ *
+ * @param[in]    pA              Vector of packed booleans
+ * @param[in]    pB              numVectors vectors of packed booleans
+ * @param[in]    numVectors      Number of vectors in pB
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[out]   pDst            numVectors distances
+ *
+ * Each vector of pB uses (numberOfBools + 31) / 32 words and the vectors
+ * are contiguous. The differences are counted with a popcount of A xor B
+ * on full words instead of the bit per bit loop of arm_hamming_distance.
+ * The distance between two empty vectors is 0.
+ *
+ */
+
+void arm_hamming_distance_batch(const uint32_t *pA,
+  const uint32_t *pB,
+  uint32_t numVectors,
+  uint32_t numberOfBools,
+  float32_t *pDst)
+{
+    uint32_t numWords = arm_boolean_words(numberOfBools);
+    uint32_t lastMask = arm_boolean_last_mask(numberOfBools);
+    uint32_t cXor;
+
+    while (numVectors > 0U)
+    {
+        arm_boolean_popcount_xor_or(pA, pB, numWords, lastMask, &cXor, NULL);
+
+        *pDst++ = (numberOfBools == 0U) ? 0.0f : (float32_t)cXor / (float32_t)numberOfBools;
+
+        pB += numWords;
+        numVectors--;
+    }
+}
+
+
+/**
+ * @} end of BoolDist group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hamming_topk.c
+ * Description:  k nearest vectors of a batch for the Hamming distance
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_boolean_batch.h"
+
+/**
+  @addtogroup BoolDist
+  @{
+ */
+
+
+/**
+ * @brief        k nearest vectors of a batch for the Hamming distance
+ *
+ * @param[in]    pA              Vector of packed booleans
+ * @param[in]    pB              numVectors vectors of packed booleans
+ * @param[in]    numVectors      Number of vectors in pB
+ * @param[in]    numberOfBools   Number of booleans in each vector
+ * @param[in]    k               Number of neighbours
+ * @param[out]   pDist           Distances of the k nearest vectors in increasing order
+ * @param[out]   pIndex          Indices of the k nearest vectors
+ *
+ * The k best matches are kept sorted while the batch is scanned so no
+ * buffer of numVectors distances is needed. Equal distances are ranked
+ * by increasing index. When k is greater than numVectors, only
+ * numVectors neighbours are returned. The distance between two empty
+ * vectors is 0.
+ *
+ */
+
+void arm_hamming_topk(const uint32_t *pA,
+  const uint32_t *pB,
+  uint32_t numVectors,
+  uint32_t numberOfBools,
+  uint32_t k,
+  float32_t *pDist,
+  uint32_t *pIndex)
+{
+    uint32_t numWords = arm_boolean_words(numberOfBools);
+    uint32_t lastMask = arm_boolean_last_mask(numberOfBools);
+    uint32_t cXor;
+    uint32_t nb = 0U;
+    uint32_t i;
+
+    if (k == 0U)
+    {
+        return;
+    }
+
+    for(i = 0; i < numVectors; i++)
+    {
+        arm_boolean_popcount_xor_or(pA, pB, numWords, lastMask, &cXor, NULL);
+
+        nb = arm_boolean_topk_insert((numberOfBools == 0U) ? 0.0f : (float32_t)cXor / (float32_t)numberOfBools,
+                                     i, pDist, pIndex, nb, k);
+
+        pB += numWords;
+    }
+}
+
+
+/**
+ * @} end of BoolDist group
+ */
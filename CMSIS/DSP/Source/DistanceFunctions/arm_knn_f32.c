@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_f32.c
+ * Description:  Floating-point k nearest neighbours
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @addtogroup DistanceMatrix
+  @{
+ */
+
+/**
+ * @brief        k nearest reference vectors of a query vector
+ * @param[in]    S           Instance
+ * @param[in]    pQuery      Query vector
+ * @param[in]    k           Number of neighbours
+ * @param[out]   pScratch    Buffer of numVectors samples
+ * @param[out]   pDist       Distances of the k nearest vectors in increasing order
+ * @param[out]   pIndex      Indices of the k nearest vectors
+ *
+ * The distances to all the reference vectors are computed in pScratch
+ * and the k smallest ones are selected with arm_topk_f32. Equal distances
+ * are ranked by increasing index. When k is greater than the number of
+ * reference vectors, only numVectors neighbours are returned.
+ *
+ * For the Euclidean distance, the selection is done on the squared
+ * distances and the square root is only computed for the k results.
+ *
+ */
+void arm_knn_f32(const arm_cdist_instance_f32 *S,
+  const float32_t *pQuery,
+  uint32_t k,
+  float32_t *pScratch,
+  float32_t *pDist,
+  uint32_t *pIndex)
+{
+    arm_cdist_instance_f32 sq;
+    uint32_t i;
+
+    if (S->metric == ARM_CDIST_EUCLIDEAN)
+    {
+        /* Same ranking without the square roots */
+        sq = *S;
+        sq.metric = ARM_CDIST_SQEUCLIDEAN;
+        arm_cdist_f32(&sq, pQuery, 1, pScratch);
+    }
+    else
+    {
+        arm_cdist_f32(S, pQuery, 1, pScratch);
+    }
+
+    arm_topk_f32(pScratch, S->numVectors, k, ARM_SORT_ASCENDING, pDist, pIndex);
+
+    if (S->metric == ARM_CDIST_EUCLIDEAN)
+    {
+        if (k > S->numVectors)
+        {
+            k = S->numVectors;
+        }
+
+        for(i = 0; i < k; i++)
+        {
+            arm_sqrt_f32(pDist[i], &pDist[i]);
+        }
+    }
+}
+
+/**
+ * @} end of DistanceMatrix group
+ */
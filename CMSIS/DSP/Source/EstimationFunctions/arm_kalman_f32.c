@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_f32.c
+ * Description:  Floating-point Kalman filter
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/estimation_functions.h"
+
+/**
+  @ingroup groupEstimation
+ */
+
+/**
+  @defgroup Kalman Kalman Filter
+
+  Linear Kalman filter in square-root covariance form.
+
+  The model is:
+  <pre>
+      x[k] = F x[k-1] + w      w : noise of covariance Q = G G^t
+      z[k] = H x[k]   + v      v : noise of covariance R = Lr Lr^t
+  </pre>
+  F is the state transition matrix, H the observation matrix,
+  x the state vector of dimension numStates and z the measurement
+  vector of dimension numMeas.
+
+  The filter does not store the state covariance P but its lower
+  triangular Cholesky factor L with P = L L^t, and the noise covariances
+  are also given by square roots. The covariance is never formed:
+  the prediction triangularizes [F L | G] with Householder reflections
+  and the update applies a Carlson rank-one update to L for each
+  whitened measurement. This doubles the dynamic range of the covariance
+  compared to a filter propagating P, and P stays symmetric positive
+  semi-definite even when it is badly conditioned. No matrix inverse
+  and no Cholesky decomposition are needed after the initialization.
+
+  All the temporary matrices are in a workspace given at initialization.
+  Its size is ARM_KALMAN_WORKSPACE_SIZE_F32(numStates,numMeas) samples.
+
+  @par           Usage
+  <pre>
+      arm_kalman_init_f32(&S, ...);
+      while (...)
+      {
+         arm_kalman_f32(&S, measurement);
+      }
+  </pre>
+  \ref arm_kalman_predict_f32 and \ref arm_kalman_update_f32 can also be used
+  separately, for instance when there are several predictions between two
+  measurements.
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief         Prediction and update steps of the floating-point Kalman filter.
+  @param[in,out] S             points to an instance of the floating-point Kalman filter structure.
+  @param[in]     pMeasurement  points to the measurement vector.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+ */
+arm_status arm_kalman_f32(
+        arm_kalman_instance_f32 * S,
+  const float32_t * pMeasurement)
+{
+  arm_kalman_predict_f32(S);
+
+  return (arm_kalman_update_f32(S, pMeasurement));
+}
+
+/**
+  @} end of Kalman group
+ */
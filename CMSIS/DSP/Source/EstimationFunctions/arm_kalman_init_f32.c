@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_init_f32.c
+ * Description:  Floating-point Kalman filter initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/estimation_functions.h"
+
+/**
+  @ingroup groupEstimation
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Kalman filter.
+  @param[in,out] S                  points to an instance of the floating-point Kalman filter structure.
+  @param[in]     numStates          dimension of the state vector.
+  @param[in]     numMeas            dimension of the measurement vector.
+  @param[in]     pState             points to the state buffer. It contains the initial state estimate.
+  @param[out]    pSqrtCov           points to the buffer for the Cholesky factor of the state covariance.
+  @param[in]     pInitCov           points to the initial state covariance.
+  @param[in]     pTrans             points to the state transition matrix.
+  @param[in]     pObs               points to the observation matrix.
+  @param[in]     pSqrtProcessNoise  points to a square root of the process noise covariance.
+  @param[in]     pSqrtMeasNoise     points to the Cholesky factor of the measurement noise covariance.
+  @param[in]     pWork              points to the workspace.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SINGULAR               : Measurement noise covariance is singular
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Initial covariance is not positive definite
+
+  @par           Sizes
+                   The workspace must contain
+                   ARM_KALMAN_WORKSPACE_SIZE_F32(numStates,numMeas) samples.
+  @par
+                   The matrices are stored in row major order like the matrix
+                   functions. The model matrices are not copied and must
+                   remain valid while the filter is used. They can be
+                   modified between two steps.
+  @par           Noise matrices
+                   The noise covariances are given by square roots.
+                   pSqrtProcessNoise is any numStates x numStates matrix G
+                   with Q = G G^t. It can be singular, for instance zero
+                   when there is no process noise.
+                   pSqrtMeasNoise is the lower triangular Cholesky factor
+                   Lr of the measurement noise covariance R = Lr Lr^t.
+                   R must be positive definite. They can be computed once
+                   with \ref arm_mat_cholesky_f32.
+ */
+arm_status arm_kalman_init_f32(
+        arm_kalman_instance_f32 * S,
+        uint16_t numStates,
+        uint16_t numMeas,
+        float32_t * pState,
+        float32_t * pSqrtCov,
+  const float32_t * pInitCov,
+  const float32_t * pTrans,
+  const float32_t * pObs,
+  const float32_t * pSqrtProcessNoise,
+  const float32_t * pSqrtMeasNoise,
+        float32_t * pWork)
+{
+  arm_matrix_instance_f32 P, L;
+  uint32_t i;
+
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+  S->pState = pState;
+  S->pSqrtCov = pSqrtCov;
+  S->pTrans = pTrans;
+  S->pObs = pObs;
+  S->pSqrtProcessNoise = pSqrtProcessNoise;
+  S->pSqrtMeasNoise = pSqrtMeasNoise;
+  S->pWork = pWork;
+
+  /* The update step divides by the diagonal of the measurement noise factor */
+  for (i = 0; i < numMeas; i++)
+  {
+    if (pSqrtMeasNoise[i * numMeas + i] == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+  }
+
+  /* The Cholesky decomposition only writes the lower triangular part */
+  memset(pSqrtCov, 0, numStates * numStates * sizeof(float32_t));
+
+  arm_mat_init_f32(&P, numStates, numStates, (float32_t *)pInitCov);
+  arm_mat_init_f32(&L, numStates, numStates, pSqrtCov);
+
+  return (arm_mat_cholesky_f32(&P, &L));
+}
+
+/**
+  @} end of Kalman group
+ */
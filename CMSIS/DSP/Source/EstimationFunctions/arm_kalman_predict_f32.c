@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_predict_f32.c
+ * Description:  Floating-point Kalman filter prediction step
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/estimation_functions.h"
+
+/**
+  @ingroup groupEstimation
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief         Prediction step of the floating-point Kalman filter.
+  @param[in,out] S  points to an instance of the floating-point Kalman filter structure.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+
+  @par
+                   x = F x
+  @par
+                   The predicted covariance is P = (F L) (F L)^t + G G^t = A A^t
+                   with the n x 2n matrix A = [F L | G]. A is reduced to a
+                   lower triangular matrix [L' | 0] = A T with n Householder
+                   reflections T applied from the right. T is orthogonal so
+                   L' L'^t = A A^t and L' is the new Cholesky factor.
+                   The covariance itself is never formed and P is positive
+                   semi-definite by construction.
+ */
+arm_status arm_kalman_predict_f32(
+        arm_kalman_instance_f32 * S)
+{
+  const uint16_t n = S->numStates;
+  const uint32_t nbCols = 2 * n;
+  const float32_t *pF = S->pTrans;
+  const float32_t *pG = S->pSqrtProcessNoise;
+  float32_t *pL = S->pSqrtCov;
+  float32_t *pA = S->pWork;                      /* [F L | G] */
+  float32_t *pV = pA + n * nbCols;               /* Householder vector */
+  float32_t *pX = pV + nbCols;                   /* predicted state */
+  arm_matrix_instance_f32 F;
+  float32_t sigma, alpha, vv, d, x0;
+  uint32_t i, j, k, len;
+
+  arm_mat_init_f32(&F, n, n, (float32_t *)pF);
+
+  /* State prediction */
+  arm_mat_vec_mult_f32(&F, S->pState, pX);
+  memcpy(S->pState, pX, n * sizeof(float32_t));
+
+  /* A = [F L | G]. L is lower triangular. */
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      float32_t acc = 0.0f;
+
+      for (k = j; k < n; k++)
+      {
+        acc += pF[i * n + k] * pL[k * n + j];
+      }
+      pA[i * nbCols + j] = acc;
+    }
+    memcpy(&pA[i * nbCols + n], &pG[i * n], n * sizeof(float32_t));
+  }
+
+  /* LQ factorization : row k is reflected onto its first element */
+  for (k = 0; k < n; k++)
+  {
+    float32_t *pRow = &pA[k * nbCols + k];
+
+    len = nbCols - k;
+    arm_dot_prod_f32(pRow, pRow, len, &vv);
+    if (vv == 0.0f)
+    {
+      continue;
+    }
+    sigma = sqrtf(vv);
+
+    /* The sign of alpha avoids a cancellation in v0 */
+    x0 = pRow[0];
+    alpha = (x0 >= 0.0f) ? -sigma : sigma;
+    memcpy(pV, pRow, len * sizeof(float32_t));
+    pV[0] = x0 - alpha;
+    vv = 2.0f * sigma * (sigma + fabsf(x0));
+
+    /* Row k becomes (alpha, 0, ..., 0) */
+    pRow[0] = alpha;
+    memset(&pRow[1], 0, (len - 1) * sizeof(float32_t));
+
+    for (i = k + 1; i < n; i++)
+    {
+      float32_t *pR = &pA[i * nbCols + k];
+
+      arm_dot_prod_f32(pR, pV, len, &d);
+      d = 2.0f * d / vv;
+      for (j = 0; j < len; j++)
+      {
+        pR[j] -= d * pV[j];
+      }
+    }
+
+    /* A positive diagonal is obtained by changing the sign of the column */
+    if (alpha < 0.0f)
+    {
+      for (i = k; i < n; i++)
+      {
+        pA[i * nbCols + k] = -pA[i * nbCols + k];
+      }
+    }
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      pL[i * n + j] = (j <= i) ? pA[i * nbCols + j] : 0.0f;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Kalman group
+ */
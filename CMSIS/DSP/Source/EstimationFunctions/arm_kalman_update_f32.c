@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_update_f32.c
+ * Description:  Floating-point Kalman filter update step
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/estimation_functions.h"
+
+/**
+  @ingroup groupEstimation
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief         Update step of the floating-point Kalman filter.
+  @param[in,out] S             points to an instance of the floating-point Kalman filter structure.
+  @param[in]     pMeasurement  points to the measurement vector.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+
+  @par
+                   The measurements are first whitened with the Cholesky
+                   factor Lr of the measurement noise covariance:
+                   H' = Lr^-1 H and z' = Lr^-1 z. The components of z'
+                   have independent noises of variance 1 and are
+                   processed one after the other.
+  @par
+                   For each row h of H', the Cholesky factor L of the
+                   covariance is updated with the Carlson rank-one
+                   update. With f = L^t h and a = 1 + f^t f, the gain
+                   K = L f / a and the new factor verifies
+                   L' L'^t = L (I - f f^t / a) L^t.
+                   L' is computed column by column and stays lower
+                   triangular. Only square roots of positive numbers
+                   are computed so the covariance cannot lose its
+                   positive definiteness.
+  @par
+                   x = x + K (z'_i - h x)
+ */
+arm_status arm_kalman_update_f32(
+        arm_kalman_instance_f32 * S,
+  const float32_t * pMeasurement)
+{
+  const uint16_t n = S->numStates;
+  const uint16_t m = S->numMeas;
+  const float32_t *pH = S->pObs;
+  const float32_t *pLr = S->pSqrtMeasNoise;
+  float32_t *pL = S->pSqrtCov;
+  float32_t *pHw = S->pWork;                     /* whitened observation matrix */
+  float32_t *pZw = pHw + m * n;                  /* whitened measurement */
+  float32_t *pK = pZw + m;                       /* unnormalized gain */
+  float32_t *pFv = pK + n;                       /* L^t h */
+  float32_t alpha, prev, beta, gamma, y, t;
+  uint32_t i, j, k;
+
+  /* Forward substitution with the measurement noise factor */
+  for (i = 0; i < m; i++)
+  {
+    float32_t *pRow = &pHw[i * n];
+    float32_t invDiag = 1.0f / pLr[i * m + i];
+    float32_t z = pMeasurement[i];
+
+    memcpy(pRow, &pH[i * n], n * sizeof(float32_t));
+    for (k = 0; k < i; k++)
+    {
+      t = pLr[i * m + k];
+      z -= t * pZw[k];
+      for (j = 0; j < n; j++)
+      {
+        pRow[j] -= t * pHw[k * n + j];
+      }
+    }
+    pZw[i] = z * invDiag;
+    arm_scale_f32(pRow, invDiag, pRow, n);
+  }
+
+  /* Sequential scalar updates */
+  for (i = 0; i < m; i++)
+  {
+    const float32_t *pRow = &pHw[i * n];
+
+    /* f = L^t h */
+    for (j = 0; j < n; j++)
+    {
+      float32_t acc = 0.0f;
+
+      for (k = j; k < n; k++)
+      {
+        acc += pL[k * n + j] * pRow[k];
+      }
+      pFv[j] = acc;
+    }
+
+    /* Carlson update of the lower triangular factor, last column first */
+    memset(pK, 0, n * sizeof(float32_t));
+    alpha = 1.0f;
+    for (j = n; j > 0; j--)
+    {
+      float32_t f = pFv[j - 1];
+
+      prev = alpha;
+      alpha += f * f;
+      beta = sqrtf(prev / alpha);
+      gamma = f / sqrtf(prev * alpha);
+
+      for (k = j - 1; k < n; k++)
+      {
+        t = pL[k * n + j - 1];
+        pL[k * n + j - 1] = beta * t - gamma * pK[k];
+        pK[k] += f * t;
+      }
+    }
+
+    /* State update with the innovation of the whitened measurement */
+    arm_dot_prod_f32(pRow, S->pState, n, &y);
+    y = (pZw[i] - y) / alpha;
+    for (k = 0; k < n; k++)
+    {
+      S->pState[k] += pK[k] * y;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Kalman group
+ */
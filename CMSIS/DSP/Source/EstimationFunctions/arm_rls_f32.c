@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_f32.c
+ * Description:  Floating-point recursive least squares estimator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/estimation_functions.h"
+
+/**
+  @ingroup groupEstimation
+ */
+
+/**
+  @defgroup RLS Recursive Least Squares
+
+  Exponentially weighted recursive least squares estimation of the
+  parameters w of the linear model
+  <pre>
+      d[k] = u[k]^t w + e[k]
+  </pre>
+  where u[k] is the regressor vector of step k and d[k] the desired output.
+  For an adaptive FIR filter, u[k] contains the last numParams input samples.
+
+  For each step:
+  <pre>
+      p = P u
+      e = d - w^t u
+      w = w + e / (lambda + u^t p) p
+      P = (P - p p^t / (lambda + u^t p)) / lambda
+  </pre>
+  P is the inverse of the weighted correlation matrix of the regressors and
+  lambda the forgetting factor. Only the upper triangular part of P is
+  computed and it is copied to the lower part so that P remains symmetric.
+
+  The function works on a block of steps. The regressors of the block are
+  the rows of a blockSize x numParams matrix.
+ */
+
+/**
+  @addtogroup RLS
+  @{
+ */
+
+/* pDst = a pDst + b pX on n samples */
+static void arm_rls_scale_add_f32(
+        float32_t * pDst,
+  const float32_t * pX,
+        float32_t a,
+        float32_t b,
+        uint32_t n)
+{
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  int32_t blkCnt = (int32_t)n;
+  f32x4_t vecDst, vecX;
+
+  while (blkCnt > 0)
+  {
+    mve_pred16_t p0 = vctp32q(blkCnt);
+
+    vecDst = vldrwq_z_f32(pDst, p0);
+    vecX = vldrwq_z_f32(pX, p0);
+
+    vecDst = vmulq(vecDst, a);
+    vecDst = vfmaq(vecDst, vecX, b);
+
+    vstrwq_p(pDst, vecDst, p0);
+
+    pDst += 4;
+    pX += 4;
+    blkCnt -= 4;
+  }
+#else
+  uint32_t blkCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  blkCnt = n >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    pDst[0] = a * pDst[0] + b * pX[0];
+    pDst[1] = a * pDst[1] + b * pX[1];
+    pDst[2] = a * pDst[2] + b * pX[2];
+    pDst[3] = a * pDst[3] + b * pX[3];
+
+    pDst += 4;
+    pX += 4;
+    blkCnt--;
+  }
+
+  blkCnt = n & 0x3U;
+#else
+  blkCnt = n;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst = a * *pDst + b * *pX++;
+    pDst++;
+    blkCnt--;
+  }
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+}
+
+/**
+  @brief         Processing function for the floating-point recursive least squares estimator.
+  @param[in,out] S            points to an instance of the floating-point RLS structure.
+  @param[in]     pRegressors  points to the regressor vectors. One row of numParams samples per step.
+  @param[in]     pDesired     points to the desired outputs. One sample per step.
+  @param[out]    pErr         points to the a priori errors. One sample per step.
+  @param[in]     blockSize    number of steps to process.
+ */
+void arm_rls_f32(
+  const arm_rls_instance_f32 * S,
+  const float32_t * pRegressors,
+  const float32_t * pDesired,
+        float32_t * pErr,
+        uint32_t blockSize)
+{
+  const uint16_t n = S->numParams;
+  float32_t *pW = S->pParams;                    /* parameter estimate */
+  float32_t *pP = S->pInvCorr;                   /* inverse correlation matrix */
+  float32_t *pPu = S->pWork;                     /* P u */
+  const float32_t invLambda = 1.0f / S->lambda;
+  arm_matrix_instance_f32 P;
+  float32_t y, uPu, invDenom, coef;
+  uint32_t i, j;
+
+  arm_mat_init_f32(&P, n, n, pP);
+
+  while (blockSize > 0U)
+  {
+    arm_mat_vec_mult_f32(&P, pRegressors, pPu);
+    arm_dot_prod_f32(pRegressors, pPu, n, &uPu);
+    arm_dot_prod_f32(pRegressors, pW, n, &y);
+
+    invDenom = 1.0f / (S->lambda + uPu);
+
+    /* A priori error and parameter update */
+    *pErr = *pDesired - y;
+    arm_rls_scale_add_f32(pW, pPu, 1.0f, *pErr * invDenom, n);
+
+    /* Upper triangular part of the inverse correlation update */
+    for (i = 0; i < n; i++)
+    {
+      coef = -invLambda * invDenom * pPu[i];
+      arm_rls_scale_add_f32(&pP[i * n + i], &pPu[i], invLambda, coef, n - i);
+    }
+
+    /* Copied to the lower triangular part */
+    for (i = 0; i < n; i++)
+    {
+      for (j = i + 1; j < n; j++)
+      {
+        pP[j * n + i] = pP[i * n + j];
+      }
+    }
+
+    pRegressors += n;
+    pDesired++;
+    pErr++;
+    blockSize--;
+  }
+}
+
+/**
+  @} end of RLS group
+ */
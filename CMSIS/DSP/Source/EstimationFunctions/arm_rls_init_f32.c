@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_init_f32.c
+ * Description:  Floating-point RLS estimator initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/estimation_functions.h"
+
+/**
+  @ingroup groupEstimation
+ */
+
+/**
+  @addtogroup RLS
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point recursive least squares estimator.
+  @param[in,out] S          points to an instance of the floating-point RLS structure.
+  @param[in]     numParams  number of estimated parameters.
+  @param[in]     lambda     forgetting factor (0 < lambda <= 1).
+  @param[in]     delta      initial value of the diagonal of the inverse correlation matrix.
+  @param[in]     pParams    points to the parameter buffer. It contains the initial estimate.
+  @param[out]    pInvCorr   points to the inverse correlation matrix buffer.
+  @param[in]     pWork      points to the workspace.
+
+  @par           Details
+                   The inverse correlation matrix is initialized to delta I.
+                   A big delta is used when there is no prior knowledge
+                   of the parameters.
+  @par
+                   pInvCorr has numParams*numParams samples and
+                   pWork has numParams samples.
+ */
+void arm_rls_init_f32(
+        arm_rls_instance_f32 * S,
+        uint16_t numParams,
+        float32_t lambda,
+        float32_t delta,
+        float32_t * pParams,
+        float32_t * pInvCorr,
+        float32_t * pWork)
+{
+  uint32_t i;
+
+  S->numParams = numParams;
+  S->lambda = lambda;
+  S->pParams = pParams;
+  S->pInvCorr = pInvCorr;
+  S->pWork = pWork;
+
+  memset(pInvCorr, 0, numParams * numParams * sizeof(float32_t));
+  for (i = 0; i < numParams; i++)
+  {
+    pInvCorr[i * numParams + i] = delta;
+  }
+}
+
+/**
+  @} end of RLS group
+ */
@@ -52,11 +52,28 @@
 #include "arm_sin_q31.c"
 #endif 
 
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_SIN_F32)
+#include "arm_vsin_f32.c"
+#include "arm_vcos_f32.c"
+#include "arm_vsincos_f32.c"
+#endif 
+
 #endif
 
 #include "arm_sqrt_q15.c"
 #include "arm_sqrt_q31.c"
+#include "arm_vsqrt_f32.c"
+#include "arm_vsqrt_q15.c"
+#include "arm_vsqrt_q31.c"
 #include "arm_vexp_f32.c"
+#include "arm_vexp2_f32.c"
 #include "arm_vlog_f32.c"
+#include "arm_vlog2_f32.c"
 #include "arm_divide_q15.c"
+#include "arm_atan2_f32.c"
+#include "arm_atan2_q31.c"
+#include "arm_atan2_q15.c"
+#include "arm_vpow_f32.c"
+#include "arm_vsigmoid_f32.c"
+#include "arm_vtanh_f32.c"
 
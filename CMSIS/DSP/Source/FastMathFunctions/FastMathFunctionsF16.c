@@ -29,3 +29,7 @@
 #include "arm_vexp_f16.c"
 #include "arm_vlog_f16.c"
 #include "arm_vinverse_f16.c"
+#include "arm_atan2_f16.c"
+#include "arm_vpow_f16.c"
+#include "arm_vsigmoid_f16.c"
+#include "arm_vtanh_f16.c"
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_f16.c
+ * Description:  Fast vectorized two-argument arctangent
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+#include "arm_fast_math_poly.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_atan2_f16(
+  const float16_t * pSrcY,
+  const float16_t * pSrcX,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f16x8_t srcA, srcB;
+   f16x8_t dst;
+
+   blkCnt = blockSize >> 3;
+
+   while (blkCnt > 0U)
+   {
+      srcA = vld1q(pSrcY);
+      srcB = vld1q(pSrcX);
+      /* Compute in single precision */
+      dst = vcvtbq_f16_f32(vuninitializedq_f16(),
+                           vatan2q_f32(vcvtbq_f32_f16(srcA), vcvtbq_f32_f16(srcB)));
+      dst = vcvttq_f16_f32(dst,
+                           vatan2q_f32(vcvttq_f32_f16(srcA), vcvttq_f32_f16(srcB)));
+      vst1q(pDst, dst);
+
+      pSrcY += 8;
+      pSrcX += 8;
+      pDst += 8;
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 7;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      /* C = atan2(Y, X) */
+      *pDst++ = (float16_t) arm_poly_atan2_f32((float32_t) *pSrcY++, (float32_t) *pSrcX++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of atan2 group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
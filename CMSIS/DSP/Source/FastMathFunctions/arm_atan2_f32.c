@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_f32.c
+ * Description:  Fast vectorized two-argument arctangent
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_poly.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup atan2 Two-argument Arctangent
+
+  Computes the angle of each point <code>(pSrcX[n], pSrcY[n])</code>
+  in the range [-pi, pi].
+
+  The ratio of the smallest to the largest coordinate magnitude is
+  reduced to [-tan(pi/8), tan(pi/8)] where atan is approximated with
+  an odd minimax polynomial. The octant is then restored from the signs and the
+  magnitudes of the inputs. atan2(0, 0) is 0.
+
+  The floating-point versions take the angle in radians.
+  The maximum error of the f32 version against a double precision reference
+  is 2.1 ULP (2.8 ULP for the Helium implementation).
+  The f16 version is computed in single precision and is within 1 ULP
+  (half precision) of the exact result.
+
+  The Q31 and Q15 versions accept inputs of any scale and return the angle
+  in radians in Q2.29 and Q2.13 format respectively. Their maximum error is
+  1.1 LSB.
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4_t srcA, srcB;
+   f32x4_t dst;
+
+   blkCnt = blockSize >> 2;
+
+   while (blkCnt > 0U)
+   {
+      srcA = vld1q(pSrcY);
+      srcB = vld1q(pSrcX);
+      dst = vatan2q_f32(srcA, srcB);
+      vst1q(pDst, dst);
+
+      pSrcY += 4;
+      pSrcX += 4;
+      pDst += 4;
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 3;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      /* C = atan2(Y, X) */
+      *pDst++ = arm_poly_atan2_f32(*pSrcY++, *pSrcX++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of atan2 group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q15.c
+ * Description:  Q15 two-argument arctangent
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+
+/* tan(pi/8) in Q15 */
+#define TAN_PI_8_Q15  13573
+
+/* pi, pi/2 and pi/4 in Q15 */
+#define PI_Q15        102944
+#define PI_2_Q15      51472
+#define PI_4_Q15      25736
+
+/* atan(a) = a + a^3.(C0 + C1.a^2 + C2.a^4) for |a| <= tan(pi/8) in Q15 */
+#define ATAN_Q15_C0   (-10920)
+#define ATAN_Q15_C1   6460
+#define ATAN_Q15_C2   (-3678)
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+/**
+  @brief         Q15 vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The ratio of the coordinates is computed with a 32-bit division
+                   so that inputs of any scale are supported.
+                   The output is in the range [-pi, pi] in Q2.13 format.
+ */
+void arm_atan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;                                    /* Loop counter */
+   q31_t x, y;                                         /* Input coordinates */
+   q31_t ax, ay, mx, mn;                               /* Magnitudes of the coordinates */
+   q31_t a, a2, p, t;                                  /* Reduced ratio and polynomial */
+   q31_t res;                                          /* Angle in Q15 */
+   int32_t reduced;                                    /* Octant reduction flag */
+
+   blkCnt = blockSize;
+
+   while (blkCnt > 0U)
+   {
+      /* C = atan2(Y, X) */
+      y = *pSrcY++;
+      x = *pSrcX++;
+
+      ax = (x < 0) ? -x : x;
+      ay = (y < 0) ? -y : y;
+      mx = (ay > ax) ? ay : ax;
+      mn = (ay > ax) ? ax : ay;
+
+      if (mx == 0)
+      {
+         res = 0;
+      }
+      else
+      {
+         /* atan(mn/mx) = pi/4 + atan((mn-mx)/(mn+mx)) when mn/mx > tan(pi/8) */
+         reduced = ((mn << 15) > (TAN_PI_8_Q15 * mx));
+         if (reduced)
+         {
+            a = -(((mx - mn) << 15) / (mn + mx));
+         }
+         else
+         {
+            a = (mn << 15) / mx;
+         }
+
+         a2 = (a * a) >> 15;
+         p = ((ATAN_Q15_C2 * a2) >> 15) + ATAN_Q15_C1;
+         p = ((p * a2) >> 15) + ATAN_Q15_C0;
+         t = (a * a2) >> 15;
+         p = a + ((t * p) >> 15);
+
+         res = p;
+         if (reduced)
+         {
+            res = res + PI_4_Q15;
+         }
+         if (ay > ax)
+         {
+            res = PI_2_Q15 - res;
+         }
+         if (x < 0)
+         {
+            res = PI_Q15 - res;
+         }
+         if (y < 0)
+         {
+            res = -res;
+         }
+      }
+
+      /* Q15 to Q2.13 with rounding */
+      *pDst++ = (q15_t) ((res + 2) >> 2);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of atan2 group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Q31 two-argument arctangent
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+
+/* tan(pi/8) in Q32 */
+#define TAN_PI_8_Q32  0x6A09E668U
+
+/* pi, pi/2 and pi/4 in Q31 */
+#define PI_Q31        0x1921FB544LL
+#define PI_2_Q31      0x0C90FDAA2LL
+#define PI_4_Q31      0x06487ED51LL
+
+/* atan(a) = a + a^3.(C0 + C1.a^2 + ... + C4.a^8) for |a| <= tan(pi/8) in Q31 */
+#define ATAN_Q31_C0   ((q31_t)0xD55556DB)
+#define ATAN_Q31_C1   ((q31_t)0x19991961)
+#define ATAN_Q31_C2   ((q31_t)0xEDC4ADDC)
+#define ATAN_Q31_C3   ((q31_t)0x0D8F613C)
+#define ATAN_Q31_C4   ((q31_t)0xF8384A7D)
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+/**
+  @brief         Q31 vector of two-argument arctangent values.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissae
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The ratio of the coordinates is computed with a 64-bit division
+                   so that inputs of any scale are supported.
+                   The output is in the range [-pi, pi] in Q2.29 format.
+ */
+void arm_atan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;                                    /* Loop counter */
+   q31_t x, y;                                         /* Input coordinates */
+   uint32_t ax, ay, mx, mn;                            /* Magnitudes of the coordinates */
+   q31_t a, a2, p, t;                                  /* Reduced ratio and polynomial */
+   q63_t res;                                          /* Angle in Q31 */
+   int32_t reduced;                                    /* Octant reduction flag */
+
+   blkCnt = blockSize;
+
+   while (blkCnt > 0U)
+   {
+      /* C = atan2(Y, X) */
+      y = *pSrcY++;
+      x = *pSrcX++;
+
+      ax = (x < 0) ? (0U - (uint32_t) x) : (uint32_t) x;
+      ay = (y < 0) ? (0U - (uint32_t) y) : (uint32_t) y;
+      mx = (ay > ax) ? ay : ax;
+      mn = (ay > ax) ? ax : ay;
+
+      if (mx == 0U)
+      {
+         res = 0;
+      }
+      else
+      {
+         /* atan(mn/mx) = pi/4 + atan((mn-mx)/(mn+mx)) when mn/mx > tan(pi/8) */
+         reduced = (((uint64_t) mn << 32) > ((uint64_t) TAN_PI_8_Q32 * mx));
+         if (reduced)
+         {
+            a = -(q31_t) ((((uint64_t) (mx - mn)) << 31) / ((uint64_t) mn + mx));
+         }
+         else
+         {
+            a = (q31_t) ((((uint64_t) mn) << 31) / mx);
+         }
+
+         a2 = (q31_t) (((q63_t) a * a) >> 31);
+         p = (q31_t) (((q63_t) ATAN_Q31_C4 * a2) >> 31) + ATAN_Q31_C3;
+         p = (q31_t) (((q63_t) p * a2) >> 31) + ATAN_Q31_C2;
+         p = (q31_t) (((q63_t) p * a2) >> 31) + ATAN_Q31_C1;
+         p = (q31_t) (((q63_t) p * a2) >> 31) + ATAN_Q31_C0;
+         t = (q31_t) (((q63_t) a * a2) >> 31);
+         p = a + (q31_t) (((q63_t) t * p) >> 31);
+
+         res = p;
+         if (reduced)
+         {
+            res = res + PI_4_Q31;
+         }
+         if (ay > ax)
+         {
+            res = PI_2_Q31 - res;
+         }
+         if (x < 0)
+         {
+            res = PI_Q31 - res;
+         }
+         if (y < 0)
+         {
+            res = -res;
+         }
+      }
+
+      /* Q31 to Q2.29 with rounding */
+      *pDst++ = (q31_t) ((res + 2) >> 2);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of atan2 group
+ */
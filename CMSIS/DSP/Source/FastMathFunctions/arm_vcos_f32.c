@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_f32.c
+ * Description:  Fast vectorized cosine function for floating-point data
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_common_tables.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup cos
+  @{
+ */
+
+/**
+  @brief         Fast approximation to the trigonometric cosine function for a floating-point vector.
+  @param[in]     pSrc       points to the input vector of angles in radians
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par
+                   The same table lookup and linear interpolation as \ref arm_cos_f32
+                   is used. On Helium, the range reduction and the interpolation are
+                   done on 4 samples at a time and the table is read with gather loads.
+                   Elsewhere, the results are identical to \ref arm_cos_f32.
+ */
+
+void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+  float32_t fract, in;                           /* Temporary input, output variables */
+  uint16_t index;                                /* Index variable */
+  float32_t a, b;                                /* Two nearest output values */
+  int32_t n;
+  float32_t findex;
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  f32x4_t vecIn, vecFindex, vecFract, vecA, vecB;
+  uint32x4_t vecIdx;
+
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Scale input to [0 1] range from [0 2*PI], add 0.25 (pi/2) and keep the fractional part */
+    vecIn = vfmaq(vdupq_n_f32(0.25f), vld1q(pSrc), 0.159154943092f);
+    vecIn = vsubq(vecIn, vrndmq(vecIn));
+
+    /* Table index and fractional value */
+    vecFindex = vmulq(vecIn, (float32_t)FAST_MATH_TABLE_SIZE);
+    vecIdx = vcvtq_u32_f32(vecFindex);
+    vecFract = vsubq(vecFindex, vcvtq_f32_u32(vecIdx));
+
+    /* when "in" is exactly 1, the index wraps around to 0 */
+    vecIdx = vandq(vecIdx, vdupq_n_u32(FAST_MATH_TABLE_SIZE - 1));
+
+    /* Read two nearest values of input value from the cos table */
+    vecA = vldrwq_gather_shifted_offset_f32(sinTable_f32, vecIdx);
+    vecB = vldrwq_gather_shifted_offset_f32(&sinTable_f32[1], vecIdx);
+
+    /* Linear interpolation process */
+    vecA = vmulq(vsubq(vdupq_n_f32(1.0f), vecFract), vecA);
+    vst1q(pDst, vfmaq(vecA, vecFract, vecB));
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+#else
+  blkCnt = blockSize;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    /* input x is in radians */
+    /* Scale input to [0 1] range from [0 2*PI] , divide input by 2*pi, add 0.25 (pi/2) to read sine table */
+    in = *pSrc++ * 0.159154943092f + 0.25f;
+
+    /* Calculation of floor value of input */
+    n = (int32_t) in;
+
+    /* Make negative values towards -infinity */
+    if (in < 0.0f)
+    {
+      n--;
+    }
+
+    /* Map input value to [0 1] */
+    in = in - (float32_t) n;
+
+    /* Calculation of index of the table */
+    findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+    index = (uint16_t)findex;
+
+    /* when "in" is exactly 1, we need to rotate the index down to 0 */
+    if (index >= FAST_MATH_TABLE_SIZE) {
+      index = 0;
+      findex -= (float32_t)FAST_MATH_TABLE_SIZE;
+    }
+
+    /* fractional value calculation */
+    fract = findex - (float32_t) index;
+
+    /* Read two nearest values of input value from the cos table */
+    a = sinTable_f32[index];
+    b = sinTable_f32[index+1];
+
+    /* Linear interpolation process */
+    *pDst++ = (1.0f - fract) * a + fract * b;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of cos group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp2_f32.c
+ * Description:  Fast vectorized base 2 exponential
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_poly.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vexp2 Vector Base 2 Exponential
+
+  Computes 2 raised to the power of each element of a vector.
+
+  The input is split into an integer part n and a fractional part f in [-0.5, 0.5].
+  2^f is approximated with a degree 6 minimax polynomial and the
+  result is scaled by 2^n.
+  Results below the smallest normal floating-point value are flushed to 0
+  and inputs greater than or equal to 128 give +infinity.
+
+  The maximum error against a double precision reference is 1.1 ULP.
+ */
+
+/**
+  @addtogroup vexp2
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of base 2 exponential values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_vexp2_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4_t src;
+   f32x4_t dst;
+
+   blkCnt = blockSize >> 2;
+
+   while (blkCnt > 0U)
+   {
+      src = vld1q(pSrc);
+      dst = vexp2q_f32(src);
+      vst1q(pDst, dst);
+
+      pSrc += 4;
+      pDst += 4;
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 3;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      /* C = 2^A */
+      *pDst++ = arm_poly_exp2_f32(*pSrc++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vexp2 group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vpow_f16.c
+ * Description:  Fast vectorized power
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+#include "arm_fast_math_poly.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vpow
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of power values.
+  @param[in]     pSrcA      points to the vector of bases
+  @param[in]     pSrcB      points to the vector of exponents
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_vpow_f16(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f16x8_t srcA, srcB;
+   f16x8_t dst;
+
+   blkCnt = blockSize >> 3;
+
+   while (blkCnt > 0U)
+   {
+      srcA = vld1q(pSrcA);
+      srcB = vld1q(pSrcB);
+      /* Compute in single precision */
+      dst = vcvtbq_f16_f32(vuninitializedq_f16(),
+                           vpowq_hiprec_f32(vcvtbq_f32_f16(srcA), vcvtbq_f32_f16(srcB)));
+      dst = vcvttq_f16_f32(dst,
+                           vpowq_hiprec_f32(vcvttq_f32_f16(srcA), vcvttq_f32_f16(srcB)));
+      vst1q(pDst, dst);
+
+      pSrcA += 8;
+      pSrcB += 8;
+      pDst += 8;
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 7;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      /* C = A^B */
+      *pDst++ = (float16_t) arm_poly_pow_f32((float32_t) *pSrcA++, (float32_t) *pSrcB++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vpow group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
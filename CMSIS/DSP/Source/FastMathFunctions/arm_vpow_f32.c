@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vpow_f32.c
+ * Description:  Fast vectorized power
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_poly.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vpow Vector Power
+
+  Raises each element of a vector to the power given by the
+  corresponding element of a second vector:
+  <pre>
+      pDst[n] = pSrcA[n] ^ pSrcB[n]
+  </pre>
+
+  The result is computed as <code>2^(B.log2(A))</code> with the polynomials of
+  \ref arm_vlog2_f32 and \ref arm_vexp2_f32. The bases must not be negative
+  (a negative base gives NaN). A zero exponent gives 1.
+
+  The error grows with the magnitude of <code>B.log2(A)</code>: it is at most 1.6 ULP
+  when <code>|B.log2(A)| <= 1</code> and stays below <code>2.(1 + |B.log2(A)|)</code> ULP
+  otherwise.
+  The f16 version is computed in single precision and is within 1 ULP
+  (half precision) of the exact result.
+ */
+
+/**
+  @addtogroup vpow
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of power values.
+  @param[in]     pSrcA      points to the vector of bases
+  @param[in]     pSrcB      points to the vector of exponents
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_vpow_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4_t srcA, srcB;
+   f32x4_t dst;
+
+   blkCnt = blockSize >> 2;
+
+   while (blkCnt > 0U)
+   {
+      srcA = vld1q(pSrcA);
+      srcB = vld1q(pSrcB);
+      dst = vpowq_hiprec_f32(srcA, srcB);
+      vst1q(pDst, dst);
+
+      pSrcA += 4;
+      pSrcB += 4;
+      pDst += 4;
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 3;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      /* C = A^B */
+      *pDst++ = arm_poly_pow_f32(*pSrcA++, *pSrcB++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vpow group
+ */
@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsigmoid_f32.c
+ * Description:  Fast vectorized sigmoid
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_fast_math_poly.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vsigmoid Vector Sigmoid
+
+  Computes the logistic sigmoid of each element of a vector:
+  <pre>
+      pDst[n] = 1 / (1 + exp(-pSrc[n]))
+  </pre>
+
+  The exponential uses a Cody-Waite range reduction to [-ln(2)/2, ln(2)/2]
+  and a degree 6 minimax polynomial.
+  Results below the smallest normal floating-point value are flushed to 0.
+
+  The maximum error against a double precision reference is 2.5 ULP
+  (3.2 ULP for the Helium implementation which uses a Newton-Raphson
+  reciprocal instead of a division).
+  The f16 version is computed in single precision and is within 1 ULP
+  (half precision) of the exact result.
+ */
+
+/**
+  @addtogroup vsigmoid
+  @{
+ */
+
+/**
+  @brief         Floating-point vector of sigmoid values.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+void arm_vsigmoid_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   uint32_t blkCnt;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)
+   f32x4_t src;
+   f32x4_t dst;
+
+   blkCnt = blockSize >> 2;
+
+   while (blkCnt > 0U)
+   {
+      src = vld1q(pSrc);
+      dst = vsigmoidq_f32(src);
+      vst1q(pDst, dst);
+
+      pSrc += 4;
+      pDst += 4;
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+
+   blkCnt = blockSize & 3;
+#else
+   blkCnt = blockSize;
+#endif
+
+   while (blkCnt > 0U)
+   {
+      /* C = 1 / (1 + exp(-A)) */
+      *pDst++ = arm_poly_sigmoid_f32(*pSrc++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+   }
+}
+
+/**
+  @} end of vsigmoid group
+ */
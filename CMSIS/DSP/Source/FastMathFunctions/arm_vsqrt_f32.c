@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_f32.c
+ * Description:  Floating-point vector square root
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_math.h"
+#endif
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+
+/**
+  @brief         Floating-point vector square root function.
+  @param[in]     pIn   points to the input vector
+  @param[out]    pOut  points to the output vector of square roots
+  @param[in]     len   number of samples in each vector
+  @return        none
+
+  @par
+                   Negative inputs give a zero output as for \ref arm_sqrt_f32.
+  @par
+                   The Helium and Neon versions compute <code>x * 1/sqrt(x)</code>
+                   with a Newton-Raphson refinement of the inverse square root and are
+                   within a few ULP of the exact result for normal finite inputs.
+ */
+
+void arm_vsqrt_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint16_t len)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  f32x4_t vecIn, vecHalf, invSqrt;
+  q31x4_t newtonStartVec;
+
+  blkCnt = len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    vecIn = vld1q(pIn);
+
+    /* compute initial value */
+    newtonStartVec = vdupq_n_s32(INVSQRT_MAGIC_F32) - vshrq((q31x4_t) vecIn, 1);
+    vecHalf = vmulq(vecIn, 0.5f);
+
+    /* 3 iterations of the inverse square root */
+    INVSQRT_NEWTON_MVE_F32(invSqrt, vecHalf, (f32x4_t) newtonStartVec);
+    INVSQRT_NEWTON_MVE_F32(invSqrt, vecHalf, invSqrt);
+    INVSQRT_NEWTON_MVE_F32(invSqrt, vecHalf, invSqrt);
+
+    /* sqrt(x) = x * invSqrt(x) and set negative values to 0 */
+    vecIn = vdupq_m(vmulq(vecIn, invSqrt), 0.0f, vcmpleq(vecIn, 0.0f));
+    vst1q(pOut, vecIn);
+
+    pIn += 4;
+    pOut += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = len & 3U;
+#elif defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  float32x4_t vecIn;
+
+  blkCnt = len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    vecIn = vld1q_f32(pIn);
+
+    /* Negative values give a negative product and are set to 0 */
+    vecIn = vmaxq_f32(__arm_vec_sqrt_f32_neon(vecIn), vdupq_n_f32(0.0f));
+    vst1q_f32(pOut, vecIn);
+
+    pIn += 4;
+    pOut += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = len & 3U;
+#else
+  blkCnt = len;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    /* C = sqrt(A) */
+    arm_sqrt_f32(*pIn++, pOut++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of SQRT group
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_q31.c
+ * Description:  Q31 vector square root
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_math_functions.h"
+#include "arm_common_tables.h"
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_vec_math.h"
+#endif
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+
+/**
+  @brief         Q31 vector square root function.
+  @param[in]     pIn   points to the input vector.  The range of the input values is [0 +1) or 0x00000000 to 0x7FFFFFFF
+  @param[out]    pOut  points to the output vector of square roots
+  @param[in]     len   number of samples in each vector
+  @return        none
+
+  @par
+                   Negative inputs give a zero output as for \ref arm_sqrt_q31.
+  @par
+                   The Helium version uses a table based initial estimate refined by
+                   a Newton-Raphson iteration. The results may differ from
+                   \ref arm_sqrt_q31 by a few LSB.
+  @par
+                   The Neon version is computed in single precision. The 24-bit
+                   mantissa and the reciprocal square root estimate limit the
+                   accuracy and the results may differ from \ref arm_sqrt_q31 by
+                   up to 400 LSB (about 2^-22 of the full scale).
+ */
+
+void arm_vsqrt_q31(
+  const q31_t * pIn,
+        q31_t * pOut,
+        uint16_t len)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE) && \
+    (!defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES) || defined(ARM_TABLE_FAST_SQRT_Q31_MVE))
+  q31x4_t vecIn;
+
+  blkCnt = len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    vecIn = vld1q(pIn);
+    vst1q(pOut, FAST_VSQRT_Q31(vecIn));
+
+    pIn += 4;
+    pOut += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = len & 3U;
+#elif defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  int32x4_t vecIn;
+
+  blkCnt = len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    vecIn = vld1q_s32(pIn);
+
+    /* Negative values give a negative result and are set to 0 */
+    vecIn = vmaxq_s32(__arm_vec_sqrt_q31_neon(vecIn), vdupq_n_s32(0));
+    vst1q_s32(pOut, vecIn);
+
+    pIn += 4;
+    pOut += 4;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = len & 3U;
+#else
+  blkCnt = len;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    /* C = sqrt(A) */
+    arm_sqrt_q31(*pIn++, pOut++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of SQRT group
+ */
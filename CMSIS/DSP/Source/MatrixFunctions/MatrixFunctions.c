@@ -71,3 +71,30 @@
 #include "arm_mat_solve_lower_triangular_f64.c"
 #include "arm_mat_ldlt_f32.c"
 #include "arm_mat_ldlt_f64.c"
+#include "arm_mat_eig_sym_f32.c"
+#include "arm_mat_svd_f32.c"
+#include "arm_spmat_from_mat_f32.c"
+#include "arm_spmat_from_mat_q15.c"
+#include "arm_spmat_from_mat_q7.c"
+#include "arm_spmat_vec_mult_f32.c"
+#include "arm_spmat_vec_mult_q15.c"
+#include "arm_spmat_vec_mult_q7.c"
+#include "arm_spmat_mult_dense_f32.c"
+#include "arm_mat_mult_batch_f32.c"
+#include "arm_mat_inverse_batch_f32.c"
+#include "arm_mat_cholesky_batch_f32.c"
+#include "arm_mat_init_ext_f32.c"
+#include "arm_mat_init_ext_q31.c"
+#include "arm_mat_init_ext_q15.c"
+#include "arm_mat_add_ext_f32.c"
+#include "arm_mat_add_ext_q31.c"
+#include "arm_mat_add_ext_q15.c"
+#include "arm_mat_trans_ext_f32.c"
+#include "arm_mat_trans_ext_q31.c"
+#include "arm_mat_trans_ext_q15.c"
+#include "arm_mat_vec_mult_ext_f32.c"
+#include "arm_mat_vec_mult_ext_q31.c"
+#include "arm_mat_vec_mult_ext_q15.c"
+#include "arm_mat_mult_ext_f32.c"
+#include "arm_mat_mult_ext_q31.c"
+#include "arm_mat_mult_ext_q15.c"
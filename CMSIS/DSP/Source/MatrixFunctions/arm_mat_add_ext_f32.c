@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_add_ext_f32.c
+ * Description:  Floating-point matrix addition with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixAdd
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix addition with 32-bit dimensions.
+  @param[in]     pSrcA      points to first input matrix structure
+  @param[in]     pSrcB      points to second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The matrices are added as vectors of numRows * numCols
+                   samples with \ref arm_add_f32, by blocks of at most
+                   ARM_MAT_ADD_EXT_BLOCK samples.
+ */
+arm_status arm_mat_add_ext_f32(
+  const arm_matrix_instance_f32_ext * pSrcA,
+  const arm_matrix_instance_f32_ext * pSrcB,
+        arm_matrix_instance_f32_ext * pDst)
+{
+  arm_status status;                             /* status of matrix addition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcB->numRows) ||
+      (pSrcA->numCols != pSrcB->numCols) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcA->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const float32_t *pInA = pSrcA->pData;        /* input data matrix pointer A */
+    const float32_t *pInB = pSrcB->pData;        /* input data matrix pointer B */
+    float32_t *pOut = pDst->pData;               /* output data matrix pointer */
+    size_t numSamples;                           /* samples left to add */
+    uint32_t blkSize;                            /* samples of one block */
+
+    /* Total number of samples in input matrix */
+    numSamples = (size_t) pSrcA->numRows * pSrcA->numCols;
+
+    /* The basic math functions have a 32-bit length */
+    while (numSamples > 0U)
+    {
+      blkSize = (numSamples > ARM_MAT_ADD_EXT_BLOCK) ? ARM_MAT_ADD_EXT_BLOCK : (uint32_t) numSamples;
+
+      arm_add_f32(pInA, pInB, pOut, blkSize);
+
+      pInA += blkSize;
+      pInB += blkSize;
+      pOut += blkSize;
+      numSamples -= blkSize;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixAdd group
+ */
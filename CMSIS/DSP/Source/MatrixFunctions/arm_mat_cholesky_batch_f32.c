@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_batch_f32.c
+ * Description:  Floating-point batched Cholesky decomposition
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/**
+  @brief         Floating-point batched Cholesky decomposition of positive-definite matrices.
+  @param[in]     pSrc       points to the input matrix structure
+  @param[out]    pDst       points to the output matrix structure
+  @param[in]     count      number of matrices in the batch
+  @param[in]     stride     distance in samples between two elements of a matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : At least one input matrix cannot be decomposed
+
+  @par
+                 Each matrix A of the batch is decomposed as A = L L^t where
+                 L is lower triangular. The upper triangular part of the
+                 output is set to zero.
+  @par
+                 When a matrix of the batch cannot be decomposed, the other
+                 matrices are still decomposed. The content of the output for
+                 this matrix is undefined.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+arm_status arm_mat_cholesky_batch_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride)
+{
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows) ||
+      (stride < count)                   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t n = pSrc->numRows;            /* dimension of the matrices */
+    const float32_t *pA;
+    float32_t *pG;
+    f32x4_t vecAcc, vecHalf, vecInvSqrt;
+    q31x4_t newtonStartVec;
+    mve_pred16_t p0;
+    int32_t blkCnt;                              /* matrices remaining in the batch */
+    uint32_t i, j, k;
+
+    status = ARM_MATH_SUCCESS;
+
+    /* Vectorized across the batch : 4 matrices per iteration */
+    pA = pSrc->pData;
+    pG = pDst->pData;
+    blkCnt = (int32_t)count;
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q(blkCnt);
+
+      for (i = 0U; i < n; i++)
+      {
+        /* Column i of L before normalization */
+        for (j = i; j < n; j++)
+        {
+          vecAcc = vldrwq_z_f32(&pA[(j * n + i) * stride], p0);
+          for (k = 0U; k < i; k++)
+          {
+            vecAcc = vfmsq(vecAcc,
+                           vldrwq_z_f32(&pG[(i * n + k) * stride], p0),
+                           vldrwq_z_f32(&pG[(j * n + k) * stride], p0));
+          }
+          vstrwq_p(&pG[(j * n + i) * stride], vecAcc, p0);
+        }
+
+        vecAcc = vldrwq_z_f32(&pG[(i * n + i) * stride], p0);
+        if (vcmpleq_m(vecAcc, 0.0f, p0) != 0U)
+        {
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+
+        /* Inverse square root with newton-raphson iterations */
+        newtonStartVec = vdupq_n_s32(INVSQRT_MAGIC_F32) - vshrq((q31x4_t) vecAcc, 1);
+        vecHalf = vmulq(vecAcc, 0.5f);
+        INVSQRT_NEWTON_MVE_F32(vecInvSqrt, vecHalf, (f32x4_t) newtonStartVec);
+        INVSQRT_NEWTON_MVE_F32(vecInvSqrt, vecHalf, vecInvSqrt);
+        INVSQRT_NEWTON_MVE_F32(vecInvSqrt, vecHalf, vecInvSqrt);
+
+        vstrwq_p(&pG[(i * n + i) * stride], vmulq(vecAcc, vecInvSqrt), p0);
+        for (j = i + 1U; j < n; j++)
+        {
+          vecAcc = vldrwq_z_f32(&pG[(j * n + i) * stride], p0);
+          vstrwq_p(&pG[(j * n + i) * stride], vmulq(vecAcc, vecInvSqrt), p0);
+
+          /* Upper triangular part */
+          vstrwq_p(&pG[(i * n + j) * stride], vdupq_n_f32(0.0f), p0);
+        }
+      }
+
+      pA += 4;
+      pG += 4;
+      blkCnt -= 4;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+#else
+arm_status arm_mat_cholesky_batch_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride)
+{
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows) ||
+      (stride < count)                   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t n = pSrc->numRows;            /* dimension of the matrices */
+    const float32_t *pA = pSrc->pData;
+    float32_t *pG = pDst->pData;
+    float32_t *pOut, *pDiag;
+    const float32_t *pGi, *pGj;
+    uint32_t i, j, k, l;
+
+    status = ARM_MATH_SUCCESS;
+
+    /*
+     * The innermost loops run along the batch on contiguous
+     * samples so that they can be vectorized by the compiler.
+     */
+    for (i = 0U; i < n; i++)
+    {
+      /* Column i of L before normalization */
+      for (j = i; j < n; j++)
+      {
+        pOut = &pG[(j * n + i) * stride];
+        for (k = 0U; k < count; k++)
+        {
+          pOut[k] = pA[(j * n + i) * stride + k];
+        }
+
+        for (l = 0U; l < i; l++)
+        {
+          pGi = &pG[(i * n + l) * stride];
+          pGj = &pG[(j * n + l) * stride];
+          for (k = 0U; k < count; k++)
+          {
+            pOut[k] -= pGi[k] * pGj[k];
+          }
+        }
+      }
+
+      pDiag = &pG[(i * n + i) * stride];
+      for (k = 0U; k < count; k++)
+      {
+        if (pDiag[k] <= 0.0f)
+        {
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+        pDiag[k] = sqrtf(pDiag[k]);
+      }
+
+      for (j = i + 1U; j < n; j++)
+      {
+        pOut = &pG[(j * n + i) * stride];
+        for (k = 0U; k < count; k++)
+        {
+          pOut[k] = pOut[k] / pDiag[k];
+        }
+
+        /* Upper triangular part */
+        pOut = &pG[(i * n + j) * stride];
+        for (k = 0U; k < count; k++)
+        {
+          pOut[k] = 0.0f;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of MatrixBatch group
+ */
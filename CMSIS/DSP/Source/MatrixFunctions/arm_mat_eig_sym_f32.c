@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_eig_sym_f32.c
+ * Description:  Floating-point eigen decomposition of a symmetric matrix
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_jacobi.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixEig Symmetric Eigen Decomposition
+
+  Computes the eigenvalues and eigenvectors of a real symmetric matrix
+  with the cyclic Jacobi method.
+
+  The matrix A is diagonalized by a sequence of plane rotations:
+  <pre>
+      A = V D V^t
+  </pre>
+  where D is diagonal and V is orthogonal.
+
+  Each rotation only modifies two rows of the working matrix and two
+  rows of the transposed eigenvector matrix. Those rows are contiguous in
+  memory so the update is vectorized. The columns of the working matrix
+  are restored from the rows since the working matrix remains symmetric.
+
+  The algorithm stops when all off-diagonal elements are negligible compared
+  to the Frobenius norm of the input matrix. If this is not reached after
+  ARM_MAT_JACOBI_MAX_SWEEPS sweeps, the function returns
+  ARM_MATH_DECOMPOSITION_FAILURE.
+
+  The eigenvalues are sorted by decreasing value and the eigenvectors
+  are stored in the columns of the output matrix in the same order, which
+  is the order expected by a principal component analysis.
+ */
+
+/**
+  @addtogroup MatrixEig
+  @{
+ */
+
+/**
+   * @brief Floating-point eigen decomposition of a symmetric matrix.
+   * @param[in]  pSrc       points to the instance of the input symmetric matrix structure.
+   * @param[out] pEigVec    points to the instance of the output eigenvector matrix structure.
+   *                        Column i is the eigenvector of the i-th eigenvalue.
+   * @param[out] pEigVal    points to the output eigenvalues (numRows values, sorted by decreasing value).
+   * @param[in]  pScratch   points to a working buffer of numRows * numRows samples.
+   * @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : Jacobi iterations did not converge
+   * @par
+   * Only the symmetry of the input is assumed and it is not checked.
+   * The input matrix is not modified.
+   */
+arm_status arm_mat_eig_sym_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pEigVec,
+        float32_t * pEigVal,
+        float32_t * pScratch)
+{
+  arm_status status;                             /* status of matrix eigen decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pEigVec->numRows != pEigVec->numCols) ||
+      (pSrc->numRows != pEigVec->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t n = pSrc->numRows;
+    float32_t *pA = pScratch;                    /* working copy of the matrix */
+    float32_t *pVt = pEigVec->pData;             /* transposed eigenvectors : one per row */
+    float32_t norm, tol;
+    float32_t app, aqq, apq, theta, t, c, s, tmp;
+    uint32_t p, q, r, sweep, nbRot;
+
+    memcpy(pA, pSrc->pData, n * n * sizeof(float32_t));
+
+    /* Vt = I */
+    memset(pVt, 0, n * n * sizeof(float32_t));
+    for (p = 0; p < n; p++)
+    {
+      pVt[p * n + p] = 1.0f;
+    }
+
+    /* Off-diagonal elements smaller than tol are considered zero */
+    arm_dot_prod_f32(pA, pA, n * n, &norm);
+    tol = FLT_EPSILON * sqrtf(norm);
+
+    status = ARM_MATH_DECOMPOSITION_FAILURE;
+
+    for (sweep = 0; sweep < ARM_MAT_JACOBI_MAX_SWEEPS; sweep++)
+    {
+      nbRot = 0;
+
+      for (p = 0; p + 1 < n; p++)
+      {
+        for (q = p + 1; q < n; q++)
+        {
+          apq = pA[p * n + q];
+
+          if (fabsf(apq) <= tol)
+          {
+            continue;
+          }
+
+          app = pA[p * n + p];
+          aqq = pA[q * n + q];
+
+          /* Rotation angle cancelling A[p][q] */
+          theta = (aqq - app) / (2.0f * apq);
+          if (fabsf(theta) > 1.0e15f)
+          {
+            t = 0.5f / theta;
+          }
+          else
+          {
+            t = 1.0f / (fabsf(theta) + sqrtf(theta * theta + 1.0f));
+            if (theta < 0.0f)
+            {
+              t = -t;
+            }
+          }
+          c = 1.0f / sqrtf(t * t + 1.0f);
+          s = t * c;
+
+          /* Rows p and q of Rt A and of Rt Vt */
+          arm_mat_jacobi_rotate_rows_f32(&pA[p * n], &pA[q * n], c, s, n);
+          arm_mat_jacobi_rotate_rows_f32(&pVt[p * n], &pVt[q * n], c, s, n);
+
+          /* Rt A R is symmetric : columns p and q are copies of the rows */
+          for (r = 0; r < n; r++)
+          {
+            pA[r * n + p] = pA[p * n + r];
+            pA[r * n + q] = pA[q * n + r];
+          }
+
+          pA[p * n + p] = app - t * apq;
+          pA[q * n + q] = aqq + t * apq;
+          pA[p * n + q] = 0.0f;
+          pA[q * n + p] = 0.0f;
+
+          nbRot++;
+        }
+      }
+
+      if (nbRot == 0)
+      {
+        status = ARM_MATH_SUCCESS;
+        break;
+      }
+    }
+
+    /* Sort the eigenvalues by decreasing value */
+    for (p = 0; p < n; p++)
+    {
+      pEigVal[p] = pA[p * n + p];
+    }
+
+    for (p = 0; p < n; p++)
+    {
+      q = p;
+      for (r = p + 1; r < n; r++)
+      {
+        if (pEigVal[r] > pEigVal[q])
+        {
+          q = r;
+        }
+      }
+
+      if (q != p)
+      {
+        tmp = pEigVal[p];
+        pEigVal[p] = pEigVal[q];
+        pEigVal[q] = tmp;
+
+        for (r = 0; r < n; r++)
+        {
+          tmp = pVt[p * n + r];
+          pVt[p * n + r] = pVt[q * n + r];
+          pVt[q * n + r] = tmp;
+        }
+      }
+    }
+
+    /* Eigenvectors as columns */
+    for (p = 0; p < n; p++)
+    {
+      for (q = p + 1; q < n; q++)
+      {
+        tmp = pVt[p * n + q];
+        pVt[p * n + q] = pVt[q * n + p];
+        pVt[q * n + p] = tmp;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixEig group
+ */
@@ -0,0 +1,342 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_batch_f32.c
+ * Description:  Floating-point batched matrix inverse
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/**
+  @brief         Floating-point batched matrix inverse.
+  @param[in]     pSrc       points to the input matrix structure. The source
+                            batch is used as working buffer and is modified.
+  @param[out]    pDst       points to the output matrix structure
+  @param[in]     count      number of matrices in the batch
+  @param[in]     stride     distance in samples between two elements of a matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : At least one input matrix is found to be singular (non-invertible)
+
+  @par
+                 Gauss-Jordan elimination with partial pivoting. The pivot
+                 row is selected independently for each matrix of the batch.
+  @par
+                 When a matrix of the batch is singular, the other matrices
+                 are still inverted. The content of the output for the singular
+                 matrix is undefined.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_vec_math.h"
+
+arm_status arm_mat_inverse_batch_f32(
+        arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride)
+{
+  arm_status status;                             /* status of matrix inverse */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows) ||
+      (stride < count)                   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t n = pSrc->numRows;            /* dimension of the matrices */
+    float32_t *pA, *pI;
+    f32x4_t vecA, vecB, vecX, vecY, vecCoef;
+    mve_pred16_t p0, pSwap;
+    int32_t blkCnt;                              /* matrices remaining in the batch */
+    uint32_t c, r, i, j;
+
+    status = ARM_MATH_SUCCESS;
+
+    /* Vectorized across the batch : 4 matrices per iteration */
+    pA = pSrc->pData;
+    pI = pDst->pData;
+    blkCnt = (int32_t)count;
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q(blkCnt);
+
+      /* Output initialized to identity */
+      for (i = 0U; i < n; i++)
+      {
+        for (j = 0U; j < n; j++)
+        {
+          vstrwq_p(&pI[(i * n + j) * stride], vdupq_n_f32((i == j) ? 1.0f : 0.0f), p0);
+        }
+      }
+
+      for (c = 0U; c < n; c++)
+      {
+        /* Bring the biggest pivot to row c in each matrix */
+        for (r = c + 1U; r < n; r++)
+        {
+          vecA = vldrwq_z_f32(&pA[(c * n + c) * stride], p0);
+          vecB = vldrwq_z_f32(&pA[(r * n + c) * stride], p0);
+          pSwap = vcmpgtq_m(vabsq(vecB), vabsq(vecA), p0);
+
+          if (pSwap != 0U)
+          {
+            for (j = c; j < n; j++)
+            {
+              vecX = vldrwq_z_f32(&pA[(c * n + j) * stride], p0);
+              vecY = vldrwq_z_f32(&pA[(r * n + j) * stride], p0);
+              vstrwq_p(&pA[(c * n + j) * stride], vecY, pSwap);
+              vstrwq_p(&pA[(r * n + j) * stride], vecX, pSwap);
+            }
+
+            for (j = 0U; j < n; j++)
+            {
+              vecX = vldrwq_z_f32(&pI[(c * n + j) * stride], p0);
+              vecY = vldrwq_z_f32(&pI[(r * n + j) * stride], p0);
+              vstrwq_p(&pI[(c * n + j) * stride], vecY, pSwap);
+              vstrwq_p(&pI[(r * n + j) * stride], vecX, pSwap);
+            }
+          }
+        }
+
+        /* Normalize the pivot row */
+        vecA = vldrwq_z_f32(&pA[(c * n + c) * stride], p0);
+        if (vcmpeqq_m(vecA, 0.0f, p0) != 0U)
+        {
+          status = ARM_MATH_SINGULAR;
+        }
+        vecCoef = vrecip_hiprec_f32(vecA);
+
+        for (j = c + 1U; j < n; j++)
+        {
+          vecX = vldrwq_z_f32(&pA[(c * n + j) * stride], p0);
+          vstrwq_p(&pA[(c * n + j) * stride], vmulq(vecX, vecCoef), p0);
+        }
+        for (j = 0U; j < n; j++)
+        {
+          vecX = vldrwq_z_f32(&pI[(c * n + j) * stride], p0);
+          vstrwq_p(&pI[(c * n + j) * stride], vmulq(vecX, vecCoef), p0);
+        }
+
+        /* Eliminate the pivot column from the other rows */
+        for (i = 0U; i < n; i++)
+        {
+          if (i == c)
+          {
+            continue;
+          }
+
+          vecCoef = vldrwq_z_f32(&pA[(i * n + c) * stride], p0);
+
+          for (j = c + 1U; j < n; j++)
+          {
+            vecX = vldrwq_z_f32(&pA[(i * n + j) * stride], p0);
+            vecY = vldrwq_z_f32(&pA[(c * n + j) * stride], p0);
+            vstrwq_p(&pA[(i * n + j) * stride], vfmsq(vecX, vecCoef, vecY), p0);
+          }
+          for (j = 0U; j < n; j++)
+          {
+            vecX = vldrwq_z_f32(&pI[(i * n + j) * stride], p0);
+            vecY = vldrwq_z_f32(&pI[(c * n + j) * stride], p0);
+            vstrwq_p(&pI[(i * n + j) * stride], vfmsq(vecX, vecCoef, vecY), p0);
+          }
+        }
+      }
+
+      pA += 4;
+      pI += 4;
+      blkCnt -= 4;
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+#else
+arm_status arm_mat_inverse_batch_f32(
+        arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride)
+{
+  arm_status status;                             /* status of matrix inverse */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows) ||
+      (stride < count)                   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t n = pSrc->numRows;            /* dimension of the matrices */
+    float32_t *pA = pSrc->pData;
+    float32_t *pI = pDst->pData;
+    float32_t *pRowC, *pRowR, *pRowCI, *pRowRI, *pCoef;
+    float32_t tmp;
+    uint32_t c, r, i, j, k;
+
+    status = ARM_MATH_SUCCESS;
+
+    /*
+     * The innermost loops run along the batch on contiguous
+     * samples so that they can be vectorized by the compiler.
+     */
+
+    /* Output initialized to identity */
+    for (i = 0U; i < n; i++)
+    {
+      for (j = 0U; j < n; j++)
+      {
+        tmp = (i == j) ? 1.0f : 0.0f;
+        for (k = 0U; k < count; k++)
+        {
+          pI[(i * n + j) * stride + k] = tmp;
+        }
+      }
+    }
+
+    for (c = 0U; c < n; c++)
+    {
+      /* Bring the biggest pivot to row c in each matrix */
+      pRowC = &pA[(c * n) * stride];
+      pRowCI = &pI[(c * n) * stride];
+      for (r = c + 1U; r < n; r++)
+      {
+        pRowR = &pA[(r * n) * stride];
+        pRowRI = &pI[(r * n) * stride];
+        for (k = 0U; k < count; k++)
+        {
+          if (fabsf(pRowR[c * stride + k]) > fabsf(pRowC[c * stride + k]))
+          {
+            for (j = c; j < n; j++)
+            {
+              tmp = pRowC[j * stride + k];
+              pRowC[j * stride + k] = pRowR[j * stride + k];
+              pRowR[j * stride + k] = tmp;
+            }
+
+            for (j = 0U; j < n; j++)
+            {
+              tmp = pRowCI[j * stride + k];
+              pRowCI[j * stride + k] = pRowRI[j * stride + k];
+              pRowRI[j * stride + k] = tmp;
+            }
+          }
+        }
+      }
+
+      /* The pivot is replaced by its inverse */
+      pCoef = &pRowC[c * stride];
+      for (k = 0U; k < count; k++)
+      {
+        if (pCoef[k] == 0.0f)
+        {
+          status = ARM_MATH_SINGULAR;
+        }
+        pCoef[k] = 1.0f / pCoef[k];
+      }
+
+      /* Normalize the pivot row */
+      for (j = c + 1U; j < n; j++)
+      {
+        for (k = 0U; k < count; k++)
+        {
+          pRowC[j * stride + k] *= pCoef[k];
+        }
+      }
+      for (j = 0U; j < n; j++)
+      {
+        for (k = 0U; k < count; k++)
+        {
+          pRowCI[j * stride + k] *= pCoef[k];
+        }
+      }
+
+      /* Eliminate the pivot column from the other rows */
+      for (i = 0U; i < n; i++)
+      {
+        if (i == c)
+        {
+          continue;
+        }
+
+        pRowR = &pA[(i * n) * stride];
+        pRowRI = &pI[(i * n) * stride];
+        pCoef = &pRowR[c * stride];
+
+        for (j = c + 1U; j < n; j++)
+        {
+          for (k = 0U; k < count; k++)
+          {
+            pRowR[j * stride + k] -= pCoef[k] * pRowC[j * stride + k];
+          }
+        }
+        for (j = 0U; j < n; j++)
+        {
+          for (k = 0U; k < count; k++)
+          {
+            pRowRI[j * stride + k] -= pCoef[k] * pRowCI[j * stride + k];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -27,6 +27,7 @@
  */
 
 #include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
 
 
 /**
@@ -1005,6 +1006,27 @@ arm_status arm_mat_inverse_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+    /* small squared matrix specialized routines */
+    if (numRows == 2U)
+    {
+      return (arm_mat_inverse_2x2_f32(pIn, pOut));
+    }
+    else if (numRows == 3U)
+    {
+      return (arm_mat_inverse_3x3_f32(pIn, pOut));
+    }
+    else if (numRows == 4U)
+    {
+      return (arm_mat_inverse_4x4_f32(pIn, pOut));
+    }
+    else if (numRows == 5U)
+    {
+      return (arm_mat_inverse_5x5_f32(pIn, pOut));
+    }
+    else if (numRows == 6U)
+    {
+      return (arm_mat_inverse_6x6_f32(pIn, pOut));
+    }
 
     /*--------------------------------------------------------------------------------------------------------------
      * Matrix Inverse can be solved using elementary row operations.
@@ -1310,6 +1332,27 @@ arm_status arm_mat_inverse_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+    /* small squared matrix specialized routines */
+    if (numRows == 2U)
+    {
+      return (arm_mat_inverse_2x2_f32(pIn, pOut));
+    }
+    else if (numRows == 3U)
+    {
+      return (arm_mat_inverse_3x3_f32(pIn, pOut));
+    }
+    else if (numRows == 4U)
+    {
+      return (arm_mat_inverse_4x4_f32(pIn, pOut));
+    }
+    else if (numRows == 5U)
+    {
+      return (arm_mat_inverse_5x5_f32(pIn, pOut));
+    }
+    else if (numRows == 6U)
+    {
+      return (arm_mat_inverse_6x6_f32(pIn, pOut));
+    }
 
     /*--------------------------------------------------------------------------------------------------------------
      * Matrix Inverse can be solved using elementary row operations.
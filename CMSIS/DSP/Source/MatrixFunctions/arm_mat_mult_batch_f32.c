@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_batch_f32.c
+ * Description:  Floating-point batched matrix multiplication
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixBatch Batched Matrix Functions
+
+  Apply the same operation to a batch of small matrices with
+  identical dimensions.
+
+  The batch is stored in structure of arrays layout: element (i,j)
+  of the k-th matrix is at address
+  <pre>
+      pData[(i * numCols + j) * stride + k]
+  </pre>
+  The matrix instances give the dimensions of one matrix of the batch
+  and the address of the batch. The stride is the distance, in samples,
+  between two consecutive elements of the same matrix. It must be
+  greater or equal to the number of matrices.
+
+  With this layout, the same element of consecutive matrices is
+  contiguous in memory. The functions are vectorized across the batch so
+  that all the vector lanes are used even when a single matrix is too small
+  to fill them (for instance, the 4x4 matrices of a Kalman filter
+  updated for many tracks).
+ */
+
+/**
+  @addtogroup MatrixBatch
+  @{
+ */
+
+/**
+  @brief         Floating-point batched matrix multiplication.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @param[in]     count      number of matrices in the batch
+  @param[in]     stride     distance in samples between two elements of a matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+arm_status arm_mat_mult_batch_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)  ||
+      (stride < count)                     )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint16_t numRowsA = pSrcA->numRows;    /* number of rows of input matrix A */
+    const uint16_t numColsA = pSrcA->numCols;    /* number of columns of input matrix A */
+    const uint16_t numColsB = pSrcB->numCols;    /* number of columns of input matrix B */
+    const float32_t *pInA, *pInB;
+    float32_t *pOut;
+    f32x4_t acc;
+    int32_t blkCnt;                              /* matrices remaining in the batch */
+    uint32_t k, i, j, l;
+
+    /* Vectorized across the batch : 4 matrices per iteration */
+    k = 0U;
+    blkCnt = (int32_t)count;
+    while (blkCnt > 0)
+    {
+      mve_pred16_t p0 = vctp32q(blkCnt);
+
+      pOut = pDst->pData + k;
+      for (i = 0U; i < numRowsA; i++)
+      {
+        for (j = 0U; j < numColsB; j++)
+        {
+          pInA = pSrcA->pData + (i * numColsA) * stride + k;
+          pInB = pSrcB->pData + j * stride + k;
+
+          acc = vdupq_n_f32(0.0f);
+          for (l = 0U; l < numColsA; l++)
+          {
+            acc = vfmaq(acc, vldrwq_z_f32(pInA, p0), vldrwq_z_f32(pInB, p0));
+            pInA += stride;
+            pInB += numColsB * stride;
+          }
+
+          vstrwq_p(pOut, acc, p0);
+          pOut += stride;
+        }
+      }
+
+      k += 4U;
+      blkCnt -= 4;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+#else
+arm_status arm_mat_mult_batch_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        uint32_t count,
+        uint32_t stride)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)  ||
+      (stride < count)                     )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint16_t numRowsA = pSrcA->numRows;    /* number of rows of input matrix A */
+    const uint16_t numColsA = pSrcA->numCols;    /* number of columns of input matrix A */
+    const uint16_t numColsB = pSrcB->numCols;    /* number of columns of input matrix B */
+    const float32_t *pInA, *pInB;
+    float32_t *pOut;
+    uint32_t i, j, l, k;
+
+    /*
+     * The innermost loops run along the batch on contiguous
+     * samples so that they can be vectorized by the compiler.
+     */
+    for (i = 0U; i < numRowsA; i++)
+    {
+      for (j = 0U; j < numColsB; j++)
+      {
+        pOut = pDst->pData + (i * numColsB + j) * stride;
+
+        pInA = pSrcA->pData + (i * numColsA) * stride;
+        pInB = pSrcB->pData + j * stride;
+        for (k = 0U; k < count; k++)
+        {
+          pOut[k] = pInA[k] * pInB[k];
+        }
+
+        for (l = 1U; l < numColsA; l++)
+        {
+          pInA += stride;
+          pInB += numColsB * stride;
+          for (k = 0U; k < count; k++)
+          {
+            pOut[k] += pInA[k] * pInB[k];
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of MatrixBatch group
+ */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_ext_f32.c
+ * Description:  Floating-point matrix multiplication with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/* pDst = pDst + coef * pSrc on blockSize samples */
+static void arm_mat_mult_ext_row_f32(
+        float32_t * pDst,
+  const float32_t * pSrc,
+        float32_t coef,
+        uint32_t blockSize)
+{
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  int32_t blkCnt = (int32_t)blockSize;
+  f32x4_t vecDst;
+
+  while (blkCnt > 0)
+  {
+    mve_pred16_t p0 = vctp32q(blkCnt);
+
+    vecDst = vldrwq_z_f32(pDst, p0);
+    vecDst = vfmaq(vecDst, vldrwq_z_f32(pSrc, p0), coef);
+    vstrwq_p(pDst, vecDst, p0);
+
+    pDst += 4;
+    pSrc += 4;
+    blkCnt -= 4;
+  }
+#else
+  uint32_t blkCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    pDst[0] += coef * pSrc[0];
+    pDst[1] += coef * pSrc[1];
+    pDst[2] += coef * pSrc[2];
+    pDst[3] += coef * pSrc[3];
+
+    pDst += 4;
+    pSrc += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 0x3U;
+#else
+  blkCnt = blockSize;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ += coef * *pSrc++;
+    blkCnt--;
+  }
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+}
+
+/**
+ * @brief Floating-point matrix multiplication with 32-bit dimensions.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return          execution status
+ *                   - \ref ARM_MATH_SUCCESS       : Operation successful
+ *                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ *
+ * @par Details
+ *      A row of the output is computed as a linear combination of the
+ *      rows of pSrcB. pSrcA, pSrcB and pDst are read and written
+ *      row by row so the access pattern is cache friendly for big matrices.
+ *      The output must not overlap the inputs.
+ */
+arm_status arm_mat_mult_ext_f32(
+  const arm_matrix_instance_f32_ext * pSrcA,
+  const arm_matrix_instance_f32_ext * pSrcB,
+        arm_matrix_instance_f32_ext * pDst)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t numRowsA = pSrcA->numRows;    /* number of rows of input matrix A */
+    const uint32_t numColsA = pSrcA->numCols;    /* number of columns of input matrix A */
+    const uint32_t numColsB = pSrcB->numCols;    /* number of columns of input matrix B */
+    const float32_t *pInA = pSrcA->pData;        /* input data matrix pointer A */
+    const float32_t *pInB;                       /* input data matrix pointer B */
+    float32_t *pOut = pDst->pData;               /* output data matrix pointer */
+    uint32_t i, k;                               /* loop counters */
+
+    for (i = 0U; i < numRowsA; i++)
+    {
+      /* Row i of C = sum over k of a(i,k) * row k of B */
+      memset(pOut, 0, numColsB * sizeof(float32_t));
+
+      pInB = pSrcB->pData;
+      for (k = 0U; k < numColsA; k++)
+      {
+        arm_mat_mult_ext_row_f32(pOut, pInB, *pInA++, numColsB);
+        pInB += numColsB;
+      }
+
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_ext_q15.c
+ * Description:  Q15 matrix multiplication with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Q15 matrix multiplication with 32-bit dimensions.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @param[in]     pState     points to the array for storing intermediate results
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator. The inputs to the
+                   multiplications are in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   This approach provides 33 guard bits and there is no risk of overflow.
+                   The 34.30 result is then truncated to 34.15 format by discarding the low 15 bits
+                   and then saturated to 1.15 format.
+                   The result is the same as with \ref arm_mat_mult_q15.
+
+  @par           Details
+                   pSrcB is transposed in pState with \ref arm_mat_trans_ext_q15 so that
+                   each output sample is the dot product of two contiguous vectors computed with
+                   \ref arm_dot_prod_q15. pState must contain numRows * numCols samples of pSrcB.
+ */
+arm_status arm_mat_mult_ext_q15(
+  const arm_matrix_instance_q15_ext * pSrcA,
+  const arm_matrix_instance_q15_ext * pSrcB,
+        arm_matrix_instance_q15_ext * pDst,
+        q15_t                       * pState)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t numRowsA = pSrcA->numRows;    /* number of rows of input matrix A */
+    const uint32_t numColsA = pSrcA->numCols;    /* number of columns of input matrix A */
+    const uint32_t numColsB = pSrcB->numCols;    /* number of columns of input matrix B */
+    arm_matrix_instance_q15_ext BT;              /* transpose of pSrcB */
+    const q15_t *pInA = pSrcA->pData;            /* input data matrix pointer A */
+    const q15_t *pInB;                           /* input data matrix pointer B */
+    q15_t *pOut = pDst->pData;                   /* output data matrix pointer */
+    q63_t sum;                                   /* accumulator */
+    uint32_t i, j;                               /* loop counters */
+
+    arm_mat_init_ext_q15(&BT, numColsB, pSrcB->numRows, pState);
+    arm_mat_trans_ext_q15(pSrcB, &BT);
+
+    for (i = 0U; i < numRowsA; i++)
+    {
+      pInB = pState;
+      for (j = 0U; j < numColsB; j++)
+      {
+        arm_dot_prod_q15(pInA, pInB, numColsA, &sum);
+
+        /* Saturate and store result in destination buffer */
+        *pOut++ = (q15_t) (__SSAT((sum >> 15), 16));
+
+        pInB += numColsA;
+      }
+
+      pInA += numColsA;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
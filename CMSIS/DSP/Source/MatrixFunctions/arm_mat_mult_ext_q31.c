@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_ext_q31.c
+ * Description:  Q31 matrix multiplication with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/* pAcc = pAcc + coef * pSrc on blockSize samples with 2.62 accumulators */
+static void arm_mat_mult_ext_row_q31(
+        q63_t * pAcc,
+  const q31_t * pSrc,
+        q31_t coef,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    pAcc[0] += (q63_t) coef * pSrc[0];
+    pAcc[1] += (q63_t) coef * pSrc[1];
+    pAcc[2] += (q63_t) coef * pSrc[2];
+    pAcc[3] += (q63_t) coef * pSrc[3];
+
+    pAcc += 4;
+    pSrc += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 0x3U;
+#else
+  blkCnt = blockSize;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    *pAcc++ += (q63_t) coef * *pSrc++;
+    blkCnt--;
+  }
+}
+
+/**
+  @brief         Q31 matrix multiplication with 32-bit dimensions.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate
+                   multiplication results but provides only a single guard bit. There is no saturation
+                   on intermediate additions. Thus, if the accumulator overflows it wraps around and
+                   distorts the result. The input signals should be scaled down to avoid intermediate
+                   overflows. The input is thus scaled down by log2(numColsA) bits
+                   to avoid overflows, as a total of numColsA additions are performed internally.
+                   The 2.62 accumulator is right shifted by 31 bits and saturated to 1.31 format to yield the final result.
+                   The result is the same as with \ref arm_mat_mult_q31.
+
+  @par           Details
+                   As in \ref arm_mat_mult_ext_f32, the rows of the output are computed
+                   as linear combinations of the rows of pSrcB so that pSrcB is read
+                   contiguously. The output row is computed by blocks of ARM_MAT_MULT_EXT_BLOCK
+                   columns whose 2.62 accumulators are kept on the stack.
+                   The output must not overlap the inputs.
+ */
+arm_status arm_mat_mult_ext_q31(
+  const arm_matrix_instance_q31_ext * pSrcA,
+  const arm_matrix_instance_q31_ext * pSrcB,
+        arm_matrix_instance_q31_ext * pDst)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t numRowsA = pSrcA->numRows;    /* number of rows of input matrix A */
+    const uint32_t numColsA = pSrcA->numCols;    /* number of columns of input matrix A */
+    const size_t numColsB = pSrcB->numCols;      /* number of columns of input matrix B */
+    const q31_t *pInA = pSrcA->pData;            /* input data matrix pointer A */
+    const q31_t *pInB;                           /* input data matrix pointer B */
+    q31_t *pOut = pDst->pData;                   /* output data matrix pointer */
+    q63_t acc[ARM_MAT_MULT_EXT_BLOCK];           /* accumulators of a block of the output row */
+    size_t j0;                                   /* first column of the block */
+    uint32_t i, j, k, blkSize;                   /* loop counters and block size */
+
+    for (i = 0U; i < numRowsA; i++)
+    {
+      for (j0 = 0U; j0 < numColsB; j0 += ARM_MAT_MULT_EXT_BLOCK)
+      {
+        blkSize = ((numColsB - j0) > ARM_MAT_MULT_EXT_BLOCK) ? ARM_MAT_MULT_EXT_BLOCK : (uint32_t) (numColsB - j0);
+
+        for (j = 0U; j < blkSize; j++)
+        {
+          acc[j] = 0;
+        }
+
+        /* Block of row i of C = sum over k of a(i,k) * block of row k of B */
+        pInB = &pSrcB->pData[j0];
+        for (k = 0U; k < numColsA; k++)
+        {
+          arm_mat_mult_ext_row_q31(acc, pInB, pInA[k], blkSize);
+          pInB += numColsB;
+        }
+
+        /* Convert result from 2.62 to 1.31 format and store result in destination buffer */
+        for (j = 0U; j < blkSize; j++)
+        {
+          *pOut++ = (q31_t) (acc[j] >> 31);
+        }
+      }
+
+      pInA += numColsA;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
@@ -27,6 +27,7 @@
  */
 
 #include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
 
 /**
  * @ingroup groupMatrix
@@ -876,6 +877,36 @@ arm_status arm_mat_mult_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+    /* small squared matrix specialized routines */
+    if ((numRowsA == numColsB) && (numColsB == numColsA))
+    {
+      if (numRowsA == 2U)
+      {
+        arm_mat_mult_2x2_f32(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (numRowsA == 3U)
+      {
+        arm_mat_mult_3x3_f32(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (numRowsA == 4U)
+      {
+        arm_mat_mult_4x4_f32(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (numRowsA == 5U)
+      {
+        arm_mat_mult_5x5_f32(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (numRowsA == 6U)
+      {
+        arm_mat_mult_6x6_f32(pInA, pInB, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+    }
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -0,0 +1,241 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_svd_f32.c
+ * Description:  Floating-point singular value decomposition
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_jacobi.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixSVD Singular Value Decomposition
+
+  Computes the thin singular value decomposition of a real matrix A
+  of dimension M x N with M >= N:
+  <pre>
+      A = U S V^t
+  </pre>
+  U is M x N with orthonormal columns, S is diagonal with N non negative
+  values and V is N x N orthogonal.
+
+  The one-sided Jacobi (Hestenes) method is used. It orthogonalizes the
+  columns of A with plane rotations. The columns of A are kept as rows of the
+  transposed matrix in the scratch buffer, so that dot products and rotations
+  work on contiguous memory and are vectorized.
+
+  The singular values are sorted by decreasing value. When a singular
+  value is zero, the corresponding column of U is set to zero.
+ */
+
+/**
+  @addtogroup MatrixSVD
+  @{
+ */
+
+/**
+   * @brief Floating-point singular value decomposition.
+   * @param[in]  pSrc       points to the instance of the input M x N matrix structure (M >= N).
+   * @param[out] pU         points to the instance of the output M x N matrix structure.
+   * @param[out] pS         points to the output singular values (N values, sorted by decreasing value).
+   * @param[out] pV         points to the instance of the output N x N matrix structure.
+   * @param[in]  pScratch   points to a working buffer of M * N samples.
+   * @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : Jacobi iterations did not converge
+   * @par
+   * For a matrix with more columns than rows, the decomposition of the
+   * transposed matrix must be computed.
+   * The input matrix is not modified.
+   */
+arm_status arm_mat_svd_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pU,
+        float32_t * pS,
+        arm_matrix_instance_f32 * pV,
+        float32_t * pScratch)
+{
+  arm_status status;                             /* status of singular value decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows < pSrc->numCols) ||
+      (pU->numRows != pSrc->numRows) ||
+      (pU->numCols != pSrc->numCols) ||
+      (pV->numRows != pSrc->numCols) ||
+      (pV->numCols != pSrc->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t m = pSrc->numRows;
+    const uint32_t n = pSrc->numCols;
+    float32_t *pW = pScratch;                    /* columns of A as rows */
+    float32_t *pVt = pV->pData;                  /* transposed right singular vectors */
+    arm_matrix_instance_f32 W;
+    float32_t alpha, beta, gamma, zeta, t, c, s, tmp;
+    uint32_t p, q, r, sweep, nbRot;
+
+    W.numRows = (uint16_t)n;
+    W.numCols = (uint16_t)m;
+    W.pData = pW;
+    arm_mat_trans_f32(pSrc, &W);
+
+    /* Vt = I */
+    memset(pVt, 0, n * n * sizeof(float32_t));
+    for (p = 0; p < n; p++)
+    {
+      pVt[p * n + p] = 1.0f;
+    }
+
+    status = ARM_MATH_DECOMPOSITION_FAILURE;
+
+    for (sweep = 0; sweep < ARM_MAT_JACOBI_MAX_SWEEPS; sweep++)
+    {
+      nbRot = 0;
+
+      for (p = 0; p + 1 < n; p++)
+      {
+        for (q = p + 1; q < n; q++)
+        {
+          arm_dot_prod_f32(&pW[p * m], &pW[q * m], m, &gamma);
+          arm_dot_prod_f32(&pW[p * m], &pW[p * m], m, &alpha);
+          arm_dot_prod_f32(&pW[q * m], &pW[q * m], m, &beta);
+
+          /* Columns p and q are already orthogonal */
+          if (fabsf(gamma) <= FLT_EPSILON * sqrtf(alpha * beta))
+          {
+            continue;
+          }
+
+          /* Rotation angle making columns p and q orthogonal */
+          zeta = (beta - alpha) / (2.0f * gamma);
+          if (fabsf(zeta) > 1.0e15f)
+          {
+            t = 0.5f / zeta;
+          }
+          else
+          {
+            t = 1.0f / (fabsf(zeta) + sqrtf(zeta * zeta + 1.0f));
+            if (zeta < 0.0f)
+            {
+              t = -t;
+            }
+          }
+          c = 1.0f / sqrtf(t * t + 1.0f);
+          s = t * c;
+
+          arm_mat_jacobi_rotate_rows_f32(&pW[p * m], &pW[q * m], c, s, m);
+          arm_mat_jacobi_rotate_rows_f32(&pVt[p * n], &pVt[q * n], c, s, n);
+
+          nbRot++;
+        }
+      }
+
+      if (nbRot == 0)
+      {
+        status = ARM_MATH_SUCCESS;
+        break;
+      }
+    }
+
+    /* Singular values are the norms of the orthogonalized columns */
+    for (p = 0; p < n; p++)
+    {
+      arm_dot_prod_f32(&pW[p * m], &pW[p * m], m, &alpha);
+      pS[p] = sqrtf(alpha);
+    }
+
+    /* Sort by decreasing singular value */
+    for (p = 0; p < n; p++)
+    {
+      q = p;
+      for (r = p + 1; r < n; r++)
+      {
+        if (pS[r] > pS[q])
+        {
+          q = r;
+        }
+      }
+
+      if (q != p)
+      {
+        tmp = pS[p];
+        pS[p] = pS[q];
+        pS[q] = tmp;
+
+        for (r = 0; r < m; r++)
+        {
+          tmp = pW[p * m + r];
+          pW[p * m + r] = pW[q * m + r];
+          pW[q * m + r] = tmp;
+        }
+
+        for (r = 0; r < n; r++)
+        {
+          tmp = pVt[p * n + r];
+          pVt[p * n + r] = pVt[q * n + r];
+          pVt[q * n + r] = tmp;
+        }
+      }
+    }
+
+    /* U = A V S^-1 */
+    for (p = 0; p < n; p++)
+    {
+      tmp = (pS[p] > 0.0f) ? 1.0f / pS[p] : 0.0f;
+      arm_scale_f32(&pW[p * m], tmp, &pW[p * m], m);
+    }
+    arm_mat_trans_f32(&W, pU);
+
+    /* Right singular vectors as columns */
+    for (p = 0; p < n; p++)
+    {
+      for (q = p + 1; q < n; q++)
+      {
+        tmp = pVt[p * n + q];
+        pVt[p * n + q] = pVt[q * n + p];
+        pVt[q * n + p] = tmp;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixSVD group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_ext_q15.c
+ * Description:  Q15 matrix transpose with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixTrans
+  @{
+ */
+
+/**
+  @brief         Q15 matrix transpose with 32-bit dimensions.
+  @param[in]     pSrc      points to input matrix
+  @param[out]    pDst      points to output matrix
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   The matrix is transposed by tiles of ARM_MAT_TRANS_EXT_TILE x ARM_MAT_TRANS_EXT_TILE
+                   samples so that the reads and the writes stay in a small
+                   part of the memory even when the matrix is big.
+ */
+arm_status arm_mat_trans_ext_q15(
+  const arm_matrix_instance_q15_ext * pSrc,
+        arm_matrix_instance_q15_ext * pDst)
+{
+  arm_status status;                             /* status of matrix transpose */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pDst->numCols) ||
+      (pSrc->numCols != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const size_t nRows = pSrc->numRows;          /* number of rows */
+    const size_t nCols = pSrc->numCols;          /* number of columns */
+    const q15_t *pIn;                          /* input data matrix pointer */
+    q15_t *pOut;                               /* output data matrix pointer */
+    size_t i0, j0, i, j, iEnd, jEnd;             /* tile bounds and loop counters */
+
+    for (i0 = 0U; i0 < nRows; i0 += ARM_MAT_TRANS_EXT_TILE)
+    {
+      iEnd = ((nRows - i0) > ARM_MAT_TRANS_EXT_TILE) ? (i0 + ARM_MAT_TRANS_EXT_TILE) : nRows;
+
+      for (j0 = 0U; j0 < nCols; j0 += ARM_MAT_TRANS_EXT_TILE)
+      {
+        jEnd = ((nCols - j0) > ARM_MAT_TRANS_EXT_TILE) ? (j0 + ARM_MAT_TRANS_EXT_TILE) : nCols;
+
+        /* Rows of the tile are written as columns of the output */
+        for (i = i0; i < iEnd; i++)
+        {
+          pIn = &pSrc->pData[i * nCols + j0];
+          pOut = &pDst->pData[j0 * nRows + i];
+
+          for (j = j0; j < jEnd; j++)
+          {
+            *pOut = *pIn++;
+            pOut += nRows;
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixTrans group
+ */
@@ -27,6 +27,7 @@
  */
 
 #include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
 
 /**
   @ingroup groupMatrix
@@ -249,6 +250,36 @@ arm_status arm_mat_trans_f32(
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
   {
+    /* small squared matrix specialized routines */
+    if (nRows == nCols)
+    {
+      if (nRows == 2U)
+      {
+        arm_mat_trans_2x2_f32(pIn, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (nRows == 3U)
+      {
+        arm_mat_trans_3x3_f32(pIn, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (nRows == 4U)
+      {
+        arm_mat_trans_4x4_f32(pIn, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (nRows == 5U)
+      {
+        arm_mat_trans_5x5_f32(pIn, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+      else if (nRows == 6U)
+      {
+        arm_mat_trans_6x6_f32(pIn, pOut);
+        return (ARM_MATH_SUCCESS);
+      }
+    }
+
     /* Matrix transpose by exchanging the rows with columns */
     /* row loop */
     do
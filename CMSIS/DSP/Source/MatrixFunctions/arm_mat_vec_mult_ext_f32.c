@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_ext_f32.c
+ * Description:  Floating-point matrix and vector multiplication with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+ * @brief Floating-point matrix and vector multiplication with 32-bit dimensions.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to input vector
+ * @param[out]      *pDst points to output vector
+ *
+ * @par Details
+ *      Each output sample is the dot product of a row of the matrix
+ *      with the vector computed with \ref arm_dot_prod_f32.
+ */
+void arm_mat_vec_mult_ext_f32(
+  const arm_matrix_instance_f32_ext *pSrcMat,
+  const float32_t *pVec,
+  float32_t *pDst)
+{
+    const uint32_t numRows = pSrcMat->numRows;
+    const uint32_t numCols = pSrcMat->numCols;
+    const float32_t *pInA = pSrcMat->pData;
+    uint32_t row;
+
+    for (row = 0U; row < numRows; row++)
+    {
+        arm_dot_prod_f32(pInA, pVec, numCols, pDst);
+
+        pInA += numCols;
+        pDst++;
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
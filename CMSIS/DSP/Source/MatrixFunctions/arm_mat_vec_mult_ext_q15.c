@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_ext_q15.c
+ * Description:  Q15 matrix and vector multiplication with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+ * @brief Q15 matrix and vector multiplication with 32-bit dimensions.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to input vector
+ * @param[out]      *pDst points to output vector
+ *
+ * @par Scaling and Overflow Behavior
+ *      The function is implemented using a 64-bit internal accumulator.
+ *      The inputs to the multiplications are in 1.15 format and multiplications yield a 2.30 result.
+ *      The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ *      This approach provides 33 guard bits and there is no risk of overflow.
+ *      The 34.30 result is then truncated to 34.15 format by discarding the low 15 bits
+ *      and then saturated to 1.15 format. The result is the same as with \ref arm_mat_vec_mult_q15.
+ */
+void arm_mat_vec_mult_ext_q15(
+  const arm_matrix_instance_q15_ext *pSrcMat,
+  const q15_t *pVec,
+  q15_t *pDst)
+{
+    const uint32_t numRows = pSrcMat->numRows;
+    const uint32_t numCols = pSrcMat->numCols;
+    const q15_t *pInA = pSrcMat->pData;
+    q63_t sum;
+    uint32_t row;
+
+    for (row = 0U; row < numRows; row++)
+    {
+        arm_dot_prod_q15(pInA, pVec, numCols, &sum);
+        *pDst++ = (q15_t)(__SSAT((sum >> 15), 16));
+
+        pInA += numCols;
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_ext_q31.c
+ * Description:  Q31 matrix and vector multiplication with 32-bit dimensions
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+ * @brief Q31 matrix and vector multiplication with 32-bit dimensions.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ *
+ * @par Scaling and Overflow Behavior
+ *      The function is implemented using an internal 64-bit accumulator.
+ *      The accumulator has a 2.62 format and maintains full precision of the intermediate
+ *      multiplication results but provides only a single guard bit. There is no saturation
+ *      on intermediate additions. The result is the same as with \ref arm_mat_vec_mult_q31.
+ */
+void arm_mat_vec_mult_ext_q31(
+  const arm_matrix_instance_q31_ext *pSrcMat,
+  const q31_t *pVec,
+  q31_t *pDst)
+{
+    const uint32_t numRows = pSrcMat->numRows;
+    const uint32_t numCols = pSrcMat->numCols;
+    const q31_t *pInA = pSrcMat->pData;
+    const q31_t *pInVec;
+    q63_t sum;
+    uint32_t row, colCnt;
+
+    for (row = 0U; row < numRows; row++)
+    {
+        sum = 0;
+        pInVec = pVec;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: process 4 columns per iteration */
+        colCnt = numCols >> 2U;
+
+        while (colCnt > 0U)
+        {
+            sum += (q63_t)*pInA++ * *pInVec++;
+            sum += (q63_t)*pInA++ * *pInVec++;
+            sum += (q63_t)*pInA++ * *pInVec++;
+            sum += (q63_t)*pInA++ * *pInVec++;
+
+            colCnt--;
+        }
+
+        /* Loop unrolling: compute remaining columns */
+        colCnt = numCols & 0x3U;
+#else
+        colCnt = numCols;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        while (colCnt > 0U)
+        {
+            sum += (q63_t)*pInA++ * *pInVec++;
+
+            colCnt--;
+        }
+
+        /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
+        *pDst++ = (q31_t)(sum >> 31);
+    }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
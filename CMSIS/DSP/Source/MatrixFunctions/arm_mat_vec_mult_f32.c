@@ -28,6 +28,7 @@
  */
 
 #include "dsp/matrix_functions.h"
+#include "dsp/matrix_utils.h"
 
 
 /**
@@ -301,6 +302,35 @@ void arm_mat_vec_mult_f32(const arm_matrix_instance_f32 *pSrcMat, const float32_
     uint16_t i, row, colCnt; /* loop counters */
     float32_t matData, matData2, vecData, vecData2;
 
+    /* small squared matrix specialized routines */
+    if (numRows == numCols)
+    {
+        if (numRows == 2U)
+        {
+            arm_mat_vec_mult_2x2_f32(pSrcA, pVec, pDst);
+            return;
+        }
+        else if (numRows == 3U)
+        {
+            arm_mat_vec_mult_3x3_f32(pSrcA, pVec, pDst);
+            return;
+        }
+        else if (numRows == 4U)
+        {
+            arm_mat_vec_mult_4x4_f32(pSrcA, pVec, pDst);
+            return;
+        }
+        else if (numRows == 5U)
+        {
+            arm_mat_vec_mult_5x5_f32(pSrcA, pVec, pDst);
+            return;
+        }
+        else if (numRows == 6U)
+        {
+            arm_mat_vec_mult_6x6_f32(pSrcA, pVec, pDst);
+            return;
+        }
+    }
 
     /* Process 4 rows at a time */
     row = numRows >> 2;
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spmat_from_mat_q15.c
+ * Description:  Q15 conversion of a dense matrix to a sparse matrix
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SparseMatrixConvert
+  @{
+ */
+
+/**
+  @brief         Q15 conversion of a dense matrix to a sparse matrix.
+  @param[in]     pSrc         points to the instance of the input dense matrix structure
+  @param[in,out] pDst         points to the instance of the output sparse matrix structure
+  @param[in]     maxNonZeros  size of the column indexes and values buffers
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR  : More than maxNonZeros non zero values
+ */
+arm_status arm_spmat_from_mat_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  arm_spmat_instance_q15 * pDst,
+  uint32_t maxNonZeros)
+{
+  const q15_t *pIn = pSrc->pData;                /* input data matrix pointer */
+  uint32_t *pRowPtr = pDst->pRowPtr;             /* row offsets of the sparse matrix */
+  uint16_t *pColIdx = pDst->pColIdx;             /* column indexes of the sparse matrix */
+  q15_t *pOut = pDst->pData;                     /* non zero values of the sparse matrix */
+  uint16_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t nbNonZeros = 0U;                      /* number of non zero values */
+  uint16_t row, col;                             /* loop counters */
+  q15_t in;
+
+  pDst->numRows = numRows;
+  pDst->numCols = numCols;
+
+  for (row = 0U; row < numRows; row++)
+  {
+    pRowPtr[row] = nbNonZeros;
+
+    for (col = 0U; col < numCols; col++)
+    {
+      in = *pIn++;
+
+      if (in != 0)
+      {
+        if (nbNonZeros == maxNonZeros)
+        {
+          /* Set status as ARM_MATH_LENGTH_ERROR */
+          return (ARM_MATH_LENGTH_ERROR);
+        }
+
+        pColIdx[nbNonZeros] = col;
+        pOut[nbNonZeros] = in;
+        nbNonZeros++;
+      }
+    }
+  }
+
+  pRowPtr[numRows] = nbNonZeros;
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of SparseMatrixConvert group
+ */
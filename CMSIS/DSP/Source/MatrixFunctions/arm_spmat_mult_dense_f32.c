@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spmat_mult_dense_f32.c
+ * Description:  Floating-point sparse matrix and dense matrix multiplication
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup SparseMatrixMult Sparse Matrix Multiplication
+ *
+ * Multiplies a sparse matrix with a dense matrix.
+ *
+ * The sparse matrix A is stored in compressed sparse row (CSR) format.
+ * Row i of the result is the sum of the rows of B selected by the
+ * column indexes of the non zero values of row i of A, weighted by those
+ * values. The rows of B and of the result are contiguous in memory so the
+ * accumulation is vectorized.
+ */
+
+/**
+ * @addtogroup SparseMatrixMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse matrix and dense matrix multiplication.
+ * @param[in]       *pSrcA points to the first input sparse matrix structure
+ * @param[in]       *pSrcB points to the second input dense matrix structure
+ * @param[out]      *pDst points to output dense matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+arm_status arm_spmat_mult_dense_f32(
+  const arm_spmat_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;    /* row offsets of A */
+    const float32_t *pInB = pSrcB->pData;        /* input data matrix pointer B */
+    float32_t *pOut = pDst->pData;               /* output data matrix pointer */
+    uint16_t numRowsA = pSrcA->numRows;          /* number of rows of input matrix A */
+    uint16_t numColsB = pSrcB->numCols;          /* number of columns of input matrix B */
+    uint16_t row;                                /* loop counter */
+    uint32_t col, k;                             /* loop counters */
+
+    for (row = 0U; row < numRowsA; row++)
+    {
+      /*
+       * compute 4 columns of the output row at a time
+       * and keep them in a register for all the non zero values of the row
+       */
+      for (col = 0U; col < numColsB; col += 4U)
+      {
+        mve_pred16_t p0 = vctp32q(numColsB - col);
+        f32x4_t vecSum = vdupq_n_f32(0.0f);
+
+        for (k = pRowPtr[row]; k < pRowPtr[row + 1]; k++)
+        {
+          f32x4_t vecB = vldrwq_z_f32(&pInB[pSrcA->pColIdx[k] * numColsB + col], p0);
+
+          vecSum = vfmaq(vecSum, vecB, pSrcA->pData[k]);
+        }
+
+        vstrwq_p(&pOut[col], vecSum, p0);
+      }
+
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+#else
+arm_status arm_spmat_mult_dense_f32(
+  const arm_spmat_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;    /* row offsets of A */
+    const float32_t *pInB;                       /* row of input matrix B */
+    float32_t *pOut = pDst->pData;               /* output data matrix pointer */
+    float32_t *px;                               /* temporary output data matrix pointer */
+    float32_t a;                                 /* non zero value of A */
+    uint16_t numRowsA = pSrcA->numRows;          /* number of rows of input matrix A */
+    uint16_t numColsB = pSrcB->numCols;          /* number of columns of input matrix B */
+    uint16_t row;                                /* loop counter */
+    uint32_t k, blkCnt;                          /* loop counters */
+
+    for (row = 0U; row < numRowsA; row++)
+    {
+      memset(pOut, 0, numColsB * sizeof(float32_t));
+
+      /* Output row += a * row of B for each non zero value a of the row of A */
+      for (k = pRowPtr[row]; k < pRowPtr[row + 1]; k++)
+      {
+        a = pSrcA->pData[k];
+        pInB = &pSrcB->pData[pSrcA->pColIdx[k] * numColsB];
+        px = pOut;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: Compute 4 outputs at a time */
+        blkCnt = numColsB >> 2U;
+
+        while (blkCnt > 0U)
+        {
+          px[0] += a * pInB[0];
+          px[1] += a * pInB[1];
+          px[2] += a * pInB[2];
+          px[3] += a * pInB[3];
+
+          px += 4;
+          pInB += 4;
+          blkCnt--;
+        }
+
+        /* Loop unrolling: Compute remaining outputs */
+        blkCnt = numColsB & 0x3U;
+#else
+        blkCnt = numColsB;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        while (blkCnt > 0U)
+        {
+          *px++ += a * *pInB++;
+          blkCnt--;
+        }
+      }
+
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+ * @} end of SparseMatrixMult group
+ */
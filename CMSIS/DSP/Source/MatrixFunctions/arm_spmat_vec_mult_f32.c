@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spmat_vec_mult_f32.c
+ * Description:  Floating-point sparse matrix and vector multiplication
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup SparseMatrixVectMult Sparse Matrix Vector Multiplication
+ *
+ * Multiplies a sparse matrix and a vector.
+ *
+ * The matrix is stored in compressed sparse row (CSR) format. Only the non
+ * zero values of each row are multiplied with the elements of the vector
+ * selected by their column indexes, so the cost is proportional to the number
+ * of non zero values and not to the size of the matrix.
+ *
+ * A sparse matrix can be created from a dense one with \ref arm_spmat_from_mat_f32,
+ * \ref arm_spmat_from_mat_q15 or \ref arm_spmat_from_mat_q7.
+ */
+
+/**
+ * @addtogroup SparseMatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input sparse matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_spmat_vec_mult_f32(const arm_spmat_instance_f32 *pSrcMat, const float32_t *pVec, float32_t *pDst)
+{
+    const uint32_t *pRowPtr = pSrcMat->pRowPtr;      /* row offsets */
+    uint16_t numRows = pSrcMat->numRows;             /* number of rows of input matrix */
+    uint16_t row;                                    /* loop counter */
+
+    for (row = 0U; row < numRows; row++)
+    {
+        const float32_t *pInA = &pSrcMat->pData[pRowPtr[row]];
+        const uint16_t *pIdx = &pSrcMat->pColIdx[pRowPtr[row]];
+        int32_t blkCnt = (int32_t)(pRowPtr[row + 1] - pRowPtr[row]);
+        f32x4_t vecSum = vdupq_n_f32(0.0f);
+
+        while (blkCnt > 0)
+        {
+            mve_pred16_t p0 = vctp32q(blkCnt);
+            uint32x4_t vecIdx;
+            f32x4_t vecA, vecIn;
+
+            /*
+             * gather the vector elements selected by the column indexes
+             */
+            vecIdx = vldrhq_z_u32(pIdx, p0);
+            vecIn = vldrwq_gather_shifted_offset_z_f32(pVec, vecIdx, p0);
+            vecA = vldrwq_z_f32(pInA, p0);
+
+            vecSum = vfmaq(vecSum, vecA, vecIn);
+
+            pIdx += 4;
+            pInA += 4;
+            blkCnt -= 4;
+        }
+
+        *pDst++ = vecAddAcrossF32Mve(vecSum);
+    }
+}
+#else
+void arm_spmat_vec_mult_f32(const arm_spmat_instance_f32 *pSrcMat, const float32_t *pVec, float32_t *pDst)
+{
+    const uint32_t *pRowPtr = pSrcMat->pRowPtr;      /* row offsets */
+    const float32_t *pInA;                           /* non zero values of the current row */
+    const uint16_t *pIdx;                            /* column indexes of the current row */
+    uint16_t numRows = pSrcMat->numRows;             /* number of rows of input matrix */
+    uint16_t row;                                    /* loop counter */
+    uint32_t blkCnt;                                 /* loop counter */
+    float32_t sum;
+
+    for (row = 0U; row < numRows; row++)
+    {
+        pInA = &pSrcMat->pData[pRowPtr[row]];
+        pIdx = &pSrcMat->pColIdx[pRowPtr[row]];
+        sum = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: Compute 4 products at a time */
+        blkCnt = (pRowPtr[row + 1] - pRowPtr[row]) >> 2U;
+
+        while (blkCnt > 0U)
+        {
+            sum += pInA[0] * pVec[pIdx[0]];
+            sum += pInA[1] * pVec[pIdx[1]];
+            sum += pInA[2] * pVec[pIdx[2]];
+            sum += pInA[3] * pVec[pIdx[3]];
+
+            pInA += 4;
+            pIdx += 4;
+            blkCnt--;
+        }
+
+        /* Loop unrolling: Compute remaining products */
+        blkCnt = (pRowPtr[row + 1] - pRowPtr[row]) & 0x3U;
+#else
+        blkCnt = pRowPtr[row + 1] - pRowPtr[row];
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        while (blkCnt > 0U)
+        {
+            sum += *pInA++ * pVec[*pIdx++];
+            blkCnt--;
+        }
+
+        *pDst++ = sum;
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+ * @} end of SparseMatrixVectMult group
+ */
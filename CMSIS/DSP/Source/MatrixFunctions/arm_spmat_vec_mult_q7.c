@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spmat_vec_mult_q7.c
+ * Description:  Q7 sparse matrix and vector multiplication
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q7 sparse matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input sparse matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ *
+ * @par Scaling and Overflow Behavior
+ *             The function is implemented using a 32-bit internal accumulator.
+ *             The inputs are in 1.7 format and the products are accumulated
+ *             in 18.14 format. The result is truncated to 1.7 format by
+ *             discarding the low 7 bits and then saturated.
+ */
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+void arm_spmat_vec_mult_q7(const arm_spmat_instance_q7 *pSrcMat, const q7_t *pVec, q7_t *pDst)
+{
+    const uint32_t *pRowPtr = pSrcMat->pRowPtr;      /* row offsets */
+    uint16_t numRows = pSrcMat->numRows;             /* number of rows of input matrix */
+    uint16_t row;                                    /* loop counter */
+
+    for (row = 0U; row < numRows; row++)
+    {
+        const q7_t *pInA = &pSrcMat->pData[pRowPtr[row]];
+        const uint16_t *pIdx = &pSrcMat->pColIdx[pRowPtr[row]];
+        int32_t blkCnt = (int32_t)(pRowPtr[row + 1] - pRowPtr[row]);
+        q31_t acc = 0;
+
+        while (blkCnt > 0)
+        {
+            mve_pred16_t p0 = vctp16q(blkCnt);
+            uint16x8_t vecIdx;
+            q15x8_t vecA, vecIn;
+
+            /*
+             * gather the vector elements selected by the column indexes
+             */
+            vecIdx = vldrhq_z_u16(pIdx, p0);
+            vecIn = vldrbq_gather_offset_z_s16(pVec, vecIdx, p0);
+            vecA = vldrbq_z_s16(pInA, p0);
+
+            acc = vmladavaq(acc, vecA, vecIn);
+
+            pIdx += 8;
+            pInA += 8;
+            blkCnt -= 8;
+        }
+
+        *pDst++ = (q7_t) __SSAT(acc >> 7, 8);
+    }
+}
+#else
+void arm_spmat_vec_mult_q7(const arm_spmat_instance_q7 *pSrcMat, const q7_t *pVec, q7_t *pDst)
+{
+    const uint32_t *pRowPtr = pSrcMat->pRowPtr;      /* row offsets */
+    const q7_t *pInA;                            /* non zero values of the current row */
+    const uint16_t *pIdx;                            /* column indexes of the current row */
+    uint16_t numRows = pSrcMat->numRows;             /* number of rows of input matrix */
+    uint16_t row;                                    /* loop counter */
+    uint32_t blkCnt;                                 /* loop counter */
+    q31_t sum;
+
+    for (row = 0U; row < numRows; row++)
+    {
+        pInA = &pSrcMat->pData[pRowPtr[row]];
+        pIdx = &pSrcMat->pColIdx[pRowPtr[row]];
+        sum = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: Compute 4 products at a time */
+        blkCnt = (pRowPtr[row + 1] - pRowPtr[row]) >> 2U;
+
+        while (blkCnt > 0U)
+        {
+            sum += (q15_t) pInA[0] * pVec[pIdx[0]];
+            sum += (q15_t) pInA[1] * pVec[pIdx[1]];
+            sum += (q15_t) pInA[2] * pVec[pIdx[2]];
+            sum += (q15_t) pInA[3] * pVec[pIdx[3]];
+
+            pInA += 4;
+            pIdx += 4;
+            blkCnt--;
+        }
+
+        /* Loop unrolling: Compute remaining products */
+        blkCnt = (pRowPtr[row + 1] - pRowPtr[row]) & 0x3U;
+#else
+        blkCnt = pRowPtr[row + 1] - pRowPtr[row];
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        while (blkCnt > 0U)
+        {
+            sum += (q15_t) *pInA++ * pVec[*pIdx++];
+            blkCnt--;
+        }
+
+        /* Store the result in the destination buffer */
+        *pDst++ = (q7_t) __SSAT(sum >> 7, 8);
+    }
+}
+#endif /* defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+ * @} end of SparseMatrixVectMult group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion2rotation_soa_f32.c
+ * Description:  Floating-point quaternion to rotation conversion in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @addtogroup QuatRot
+  @{
+ */
+
+/**
+   @brief Conversion of quaternions to equivalent rotation matrices in SoA layout.
+   @param[in]       pInputQuaternions points to normalized quaternions in SoA layout
+   @param[out]      pOutputRotations points to 3x3 rotations in SoA layout
+   @param[in]       nbQuaternions number of quaternions in the array
+   @return none.
+
+   @par
+   The output contains 9 arrays of nbQuaternions coefficients in the
+   order R00 R01 R02 R10 R11 R12 R20 R21 R22.
+ */
+void arm_quaternion2rotation_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pOutputRotations, 
+    uint32_t nbQuaternions)
+{
+    const float32_t *pw = pInputQuaternions, *px = pInputQuaternions + nbQuaternions;
+    const float32_t *py = pInputQuaternions + 2*nbQuaternions, *pz = pInputQuaternions + 3*nbQuaternions;
+    float32_t *pr = pOutputRotations;
+
+    for(uint32_t nb=0; nb < nbQuaternions; nb++)
+    {
+        float32_t q00 = SQ(pw[nb]);
+        float32_t q11 = SQ(px[nb]);
+        float32_t q22 = SQ(py[nb]);
+        float32_t q33 = SQ(pz[nb]);
+        float32_t q01 = pw[nb] * px[nb];
+        float32_t q02 = pw[nb] * py[nb];
+        float32_t q03 = pw[nb] * pz[nb];
+        float32_t q12 = px[nb] * py[nb];
+        float32_t q13 = px[nb] * pz[nb];
+        float32_t q23 = py[nb] * pz[nb];
+
+        pr[nb]                   = q00 + q11 - q22 - q33;
+        pr[nb + nbQuaternions]   = 2*(q12 - q03);
+        pr[nb + 2*nbQuaternions] = 2*(q13 + q02);
+        pr[nb + 3*nbQuaternions] = 2*(q12 + q03);
+        pr[nb + 4*nbQuaternions] = q00 - q11 + q22 - q33;
+        pr[nb + 5*nbQuaternions] = 2*(q23 - q01);
+        pr[nb + 6*nbQuaternions] = 2*(q13 - q02);
+        pr[nb + 7*nbQuaternions] = 2*(q23 + q01);
+        pr[nb + 8*nbQuaternions] = q00 - q11 - q22 + q33;
+    }
+}
+
+/**
+  @} end of QuatRot group
+ */
@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_conjugate_soa_f32.c
+ * Description:  Floating-point quaternion conjugate in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @addtogroup QuatConjugate
+  @{
+ */
+
+/**
+  @brief         Floating-point quaternion conjugates in SoA layout.
+  @param[in]     pInputQuaternions            points to the input quaternions in SoA layout
+  @param[out]    pConjugateQuaternions        points to the output conjugate quaternions in SoA layout
+  @param[in]     nbQuaternions                number of quaternions in each array
+  @return        none
+
+  @par
+  The real parts are copied and the three imaginary planes are
+  negated with a single vector operation of 3*nbQuaternions samples.
+  The function can be used in-place.
+ */
+void arm_quaternion_conjugate_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pConjugateQuaternions, 
+    uint32_t nbQuaternions)
+{
+    if (pInputQuaternions != pConjugateQuaternions)
+    {
+        arm_copy_f32(pInputQuaternions, pConjugateQuaternions, nbQuaternions);
+    }
+    arm_negate_f32(pInputQuaternions + nbQuaternions,
+                   pConjugateQuaternions + nbQuaternions,
+                   3*nbQuaternions);
+}
+
+/**
+  @} end of QuatConjugate group
+ */
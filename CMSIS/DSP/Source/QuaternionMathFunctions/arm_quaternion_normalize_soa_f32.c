@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_normalize_soa_f32.c
+ * Description:  Floating-point quaternion normalization in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @addtogroup QuatNormalized
+  @{
+ */
+
+/**
+  @brief         Floating-point normalization of quaternions in SoA layout.
+  @param[in]     pInputQuaternions            points to the input quaternions in SoA layout
+  @param[out]    pNormalizedQuaternions       points to the output normalized quaternions in SoA layout
+  @param[in]     nbQuaternions                number of quaternions in each array
+  @return        none
+ */
+void arm_quaternion_normalize_soa_f32(const float32_t *pInputQuaternions, 
+    float32_t *pNormalizedQuaternions, 
+    uint32_t nbQuaternions)
+{
+    const float32_t *pw = pInputQuaternions, *px = pInputQuaternions + nbQuaternions;
+    const float32_t *py = pInputQuaternions + 2*nbQuaternions, *pz = pInputQuaternions + 3*nbQuaternions;
+    float32_t *prw = pNormalizedQuaternions, *prx = pNormalizedQuaternions + nbQuaternions;
+    float32_t *pry = pNormalizedQuaternions + 2*nbQuaternions, *prz = pNormalizedQuaternions + 3*nbQuaternions;
+    float32_t w, x, y, z, inv;
+
+    for(uint32_t i=0; i < nbQuaternions; i++)
+    {
+        w = pw[i]; x = px[i]; y = py[i]; z = pz[i];
+
+        inv = 1.0f / sqrtf(w * w + x * x + y * y + z * z);
+
+        prw[i] = w * inv;
+        prx[i] = x * inv;
+        pry[i] = y * inv;
+        prz[i] = z * inv;
+    }
+}
+
+/**
+  @} end of QuatNormalized group
+ */
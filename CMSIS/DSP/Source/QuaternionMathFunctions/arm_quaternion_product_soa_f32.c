@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_product_soa_f32.c
+ * Description:  Floating-point quaternion product in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @ingroup QuatProd
+ */
+
+/**
+  @defgroup QuatProdSoA Elementwise Quaternion Product in SoA layout
+
+  Compute the elementwise product of quaternions stored in
+  structure of arrays layout.
+ */
+
+/**
+  @addtogroup QuatProdSoA
+  @{
+ */
+
+/**
+  @brief         Floating-point elementwise product of quaternions in SoA layout.
+  @param[in]     qa                  first array of quaternions in SoA layout
+  @param[in]     qb                  second array of quaternions in SoA layout
+  @param[out]    qr                  elementwise product of quaternions in SoA layout
+  @param[in]     nbQuaternions       number of quaternions in the arrays
+  @return        none
+
+  @par
+  The arrays contain the nbQuaternions real parts followed by the
+  nbQuaternions i, j and k parts.
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_quaternion_product_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t *qr,
+    uint32_t nbQuaternions)
+{
+    const float32_t *paw = qa, *pax = qa + nbQuaternions;
+    const float32_t *pay = qa + 2*nbQuaternions, *paz = qa + 3*nbQuaternions;
+    const float32_t *pbw = qb, *pbx = qb + nbQuaternions;
+    const float32_t *pby = qb + 2*nbQuaternions, *pbz = qb + 3*nbQuaternions;
+    float32_t *prw = qr, *prx = qr + nbQuaternions;
+    float32_t *pry = qr + 2*nbQuaternions, *prz = qr + 3*nbQuaternions;
+    f32x4_t aw, ax, ay, az, bw, bx, by, bz;
+    f32x4_t rw, rx, ry, rz;
+    int32_t blkCnt;
+
+    /* Compute 4 quaternions at a time */
+    blkCnt = nbQuaternions;
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        aw = vld1q(paw); ax = vld1q(pax); ay = vld1q(pay); az = vld1q(paz);
+        bw = vld1q(pbw); bx = vld1q(pbx); by = vld1q(pby); bz = vld1q(pbz);
+
+        rw = vmulq(aw, bw);
+        rw = vfmsq(rw, ax, bx);
+        rw = vfmsq(rw, ay, by);
+        rw = vfmsq(rw, az, bz);
+
+        rx = vmulq(aw, bx);
+        rx = vfmaq(rx, ax, bw);
+        rx = vfmaq(rx, ay, bz);
+        rx = vfmsq(rx, az, by);
+
+        ry = vmulq(aw, by);
+        ry = vfmaq(ry, ay, bw);
+        ry = vfmaq(ry, az, bx);
+        ry = vfmsq(ry, ax, bz);
+
+        rz = vmulq(aw, bz);
+        rz = vfmaq(rz, az, bw);
+        rz = vfmaq(rz, ax, by);
+        rz = vfmsq(rz, ay, bx);
+
+        vstrwq_p(prw, rw, p0);
+        vstrwq_p(prx, rx, p0);
+        vstrwq_p(pry, ry, p0);
+        vstrwq_p(prz, rz, p0);
+
+        paw += 4; pax += 4; pay += 4; paz += 4;
+        pbw += 4; pbx += 4; pby += 4; pbz += 4;
+        prw += 4; prx += 4; pry += 4; prz += 4;
+
+        blkCnt -= 4;
+    }
+}
+
+#else
+
+void arm_quaternion_product_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t *qr,
+    uint32_t nbQuaternions)
+{
+    const float32_t *paw = qa, *pax = qa + nbQuaternions;
+    const float32_t *pay = qa + 2*nbQuaternions, *paz = qa + 3*nbQuaternions;
+    const float32_t *pbw = qb, *pbx = qb + nbQuaternions;
+    const float32_t *pby = qb + 2*nbQuaternions, *pbz = qb + 3*nbQuaternions;
+    float32_t *prw = qr, *prx = qr + nbQuaternions;
+    float32_t *pry = qr + 2*nbQuaternions, *prz = qr + 3*nbQuaternions;
+    float32_t aw, ax, ay, az, bw, bx, by, bz;
+
+    for(uint32_t i=0; i < nbQuaternions; i++)
+    {
+        aw = paw[i]; ax = pax[i]; ay = pay[i]; az = paz[i];
+        bw = pbw[i]; bx = pbx[i]; by = pby[i]; bz = pbz[i];
+
+        prw[i] = aw * bw - ax * bx - ay * by - az * bz;
+        prx[i] = aw * bx + ax * bw + ay * bz - az * by;
+        pry[i] = aw * by + ay * bw + az * bx - ax * bz;
+        prz[i] = aw * bz + az * bw + ax * by - ay * bx;
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of QuatProdSoA group
+ */
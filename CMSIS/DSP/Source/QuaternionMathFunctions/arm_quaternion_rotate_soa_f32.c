@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_rotate_soa_f32.c
+ * Description:  Floating-point rotation of vectors by quaternions in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @defgroup QuatRotate Vector rotation
+
+  Rotation of 3D vectors by normalized quaternions:
+  <pre>
+      v' = q v q*
+  </pre>
+  It is computed without any quaternion product with:
+  <pre>
+      t  = 2 u x v
+      v' = v + w t + u x t
+  </pre>
+  where w is the real part of q and u its imaginary part.
+ */
+
+/**
+  @addtogroup QuatRotate
+  @{
+ */
+
+/**
+  @brief         Floating-point rotation of vectors by quaternions in SoA layout.
+  @param[in]     pInputQuaternions            points to the normalized quaternions in SoA layout
+  @param[in]     pInputVectors                points to the vectors in SoA layout
+  @param[out]    pOutputVectors               points to the rotated vectors in SoA layout
+  @param[in]     nbQuaternions                number of quaternions and vectors
+  @return        none
+
+  @par
+  The vectors are 3 arrays of nbQuaternions x, y and z coordinates.
+  The vector i is rotated by the quaternion i.
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_quaternion_rotate_soa_f32(const float32_t *pInputQuaternions, 
+    const float32_t *pInputVectors, 
+    float32_t *pOutputVectors,
+    uint32_t nbQuaternions)
+{
+    const float32_t *pw = pInputQuaternions, *px = pInputQuaternions + nbQuaternions;
+    const float32_t *py = pInputQuaternions + 2*nbQuaternions, *pz = pInputQuaternions + 3*nbQuaternions;
+    const float32_t *pvx = pInputVectors, *pvy = pInputVectors + nbQuaternions;
+    const float32_t *pvz = pInputVectors + 2*nbQuaternions;
+    float32_t *prx = pOutputVectors, *pry = pOutputVectors + nbQuaternions;
+    float32_t *prz = pOutputVectors + 2*nbQuaternions;
+    f32x4_t w, x, y, z, vx, vy, vz, tx, ty, tz, rx, ry, rz;
+    int32_t blkCnt;
+
+    /* Compute 4 vectors at a time */
+    blkCnt = nbQuaternions;
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp32q(blkCnt);
+
+        w = vld1q(pw); x = vld1q(px); y = vld1q(py); z = vld1q(pz);
+        vx = vld1q(pvx); vy = vld1q(pvy); vz = vld1q(pvz);
+
+        /* t = 2 u x v */
+        tx = vmulq(y, vz);
+        tx = vfmsq(tx, z, vy);
+        tx = vaddq(tx, tx);
+
+        ty = vmulq(z, vx);
+        ty = vfmsq(ty, x, vz);
+        ty = vaddq(ty, ty);
+
+        tz = vmulq(x, vy);
+        tz = vfmsq(tz, y, vx);
+        tz = vaddq(tz, tz);
+
+        /* v' = v + w t + u x t */
+        rx = vfmaq(vx, w, tx);
+        rx = vfmaq(rx, y, tz);
+        rx = vfmsq(rx, z, ty);
+
+        ry = vfmaq(vy, w, ty);
+        ry = vfmaq(ry, z, tx);
+        ry = vfmsq(ry, x, tz);
+
+        rz = vfmaq(vz, w, tz);
+        rz = vfmaq(rz, x, ty);
+        rz = vfmsq(rz, y, tx);
+
+        vstrwq_p(prx, rx, p0);
+        vstrwq_p(pry, ry, p0);
+        vstrwq_p(prz, rz, p0);
+
+        pw += 4; px += 4; py += 4; pz += 4;
+        pvx += 4; pvy += 4; pvz += 4;
+        prx += 4; pry += 4; prz += 4;
+
+        blkCnt -= 4;
+    }
+}
+
+#else
+
+void arm_quaternion_rotate_soa_f32(const float32_t *pInputQuaternions, 
+    const float32_t *pInputVectors, 
+    float32_t *pOutputVectors,
+    uint32_t nbQuaternions)
+{
+    const float32_t *pw = pInputQuaternions, *px = pInputQuaternions + nbQuaternions;
+    const float32_t *py = pInputQuaternions + 2*nbQuaternions, *pz = pInputQuaternions + 3*nbQuaternions;
+    const float32_t *pvx = pInputVectors, *pvy = pInputVectors + nbQuaternions;
+    const float32_t *pvz = pInputVectors + 2*nbQuaternions;
+    float32_t *prx = pOutputVectors, *pry = pOutputVectors + nbQuaternions;
+    float32_t *prz = pOutputVectors + 2*nbQuaternions;
+    float32_t w, x, y, z, vx, vy, vz, tx, ty, tz;
+
+    for(uint32_t i=0; i < nbQuaternions; i++)
+    {
+        w = pw[i]; x = px[i]; y = py[i]; z = pz[i];
+        vx = pvx[i]; vy = pvy[i]; vz = pvz[i];
+
+        /* t = 2 u x v */
+        tx = 2.0f * (y * vz - z * vy);
+        ty = 2.0f * (z * vx - x * vz);
+        tz = 2.0f * (x * vy - y * vx);
+
+        /* v' = v + w t + u x t */
+        prx[i] = vx + w * tx + y * tz - z * ty;
+        pry[i] = vy + w * ty + z * tx - x * tz;
+        prz[i] = vz + w * tz + x * ty - y * tx;
+    }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of QuatRotate group
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_quaternion_slerp_soa_f32.c
+ * Description:  Floating-point quaternion spherical linear interpolation in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/* Above this cosine the interpolation is linear
+   since sin(theta) is too small */
+#define SLERP_LINEAR_THRESHOLD 0.9995f
+
+/**
+  @ingroup groupQuaternionMath
+ */
+
+/**
+  @defgroup QuatSlerp Quaternion interpolation
+
+  Spherical linear interpolation of normalized quaternions:
+  <pre>
+      slerp(qa, qb, t) = (sin((1-t) theta) qa + sin(t theta) qb) / sin(theta)
+  </pre>
+  where cos(theta) is the dot product of qa and qb.
+
+  qb is replaced by -qb when the dot product is negative so that
+  the interpolation follows the shortest path.
+  When the quaternions are very close, a normalized linear
+  interpolation is used instead.
+ */
+
+/**
+  @addtogroup QuatSlerp
+  @{
+ */
+
+/**
+  @brief         Floating-point spherical linear interpolation of quaternions in SoA layout.
+  @param[in]     qa                  first array of normalized quaternions in SoA layout
+  @param[in]     qb                  second array of normalized quaternions in SoA layout
+  @param[in]     t                   interpolation factor between 0 (qa) and 1 (qb)
+  @param[out]    qr                  interpolated quaternions in SoA layout
+  @param[in]     nbQuaternions       number of quaternions in the arrays
+  @return        none
+ */
+void arm_quaternion_slerp_soa_f32(const float32_t *qa, 
+    const float32_t *qb, 
+    float32_t t,
+    float32_t *qr,
+    uint32_t nbQuaternions)
+{
+    const float32_t *paw = qa, *pax = qa + nbQuaternions;
+    const float32_t *pay = qa + 2*nbQuaternions, *paz = qa + 3*nbQuaternions;
+    const float32_t *pbw = qb, *pbx = qb + nbQuaternions;
+    const float32_t *pby = qb + 2*nbQuaternions, *pbz = qb + 3*nbQuaternions;
+    float32_t *prw = qr, *prx = qr + nbQuaternions;
+    float32_t *pry = qr + 2*nbQuaternions, *prz = qr + 3*nbQuaternions;
+    float32_t d, ka, kb, theta, s;
+    float32_t rw, rx, ry, rz;
+
+    for(uint32_t i=0; i < nbQuaternions; i++)
+    {
+        d = paw[i] * pbw[i] + pax[i] * pbx[i] + pay[i] * pby[i] + paz[i] * pbz[i];
+
+        /* Shortest path */
+        kb = 1.0f;
+        if (d < 0.0f)
+        {
+            d = -d;
+            kb = -1.0f;
+        }
+
+        if (d > SLERP_LINEAR_THRESHOLD)
+        {
+            ka = 1.0f - t;
+            kb = kb * t;
+        }
+        else
+        {
+            theta = acosf(d);
+            s = 1.0f / sinf(theta);
+            ka = sinf((1.0f - t) * theta) * s;
+            kb = kb * sinf(t * theta) * s;
+        }
+
+        rw = ka * paw[i] + kb * pbw[i];
+        rx = ka * pax[i] + kb * pbx[i];
+        ry = ka * pay[i] + kb * pby[i];
+        rz = ka * paz[i] + kb * pbz[i];
+
+        if (d > SLERP_LINEAR_THRESHOLD)
+        {
+            s = 1.0f / sqrtf(rw * rw + rx * rx + ry * ry + rz * rz);
+            rw *= s;
+            rx *= s;
+            ry *= s;
+            rz *= s;
+        }
+
+        prw[i] = rw;
+        prx[i] = rx;
+        pry[i] = ry;
+        prz[i] = rz;
+    }
+}
+
+/**
+  @} end of QuatSlerp group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rotation2quaternion_soa_f32.c
+ * Description:  Floating-point rotation to quaternion conversion in SoA layout
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/quaternion_math_functions.h"
+#include <math.h>
+
+/**
+  @addtogroup RotQuat
+  @{
+ */
+
+/**
+ * @brief Conversion of rotation matrices to equivalent quaternions in SoA layout.
+ * @param[in]       pInputRotations points to 3x3 rotations in SoA layout
+ * @param[out]      pOutputQuaternions points to quaternions in SoA layout
+ * @param[in]       nbQuaternions number of quaternions in the array
+ * @return none.
+ *
+ * The input contains 9 arrays of nbQuaternions coefficients in the
+ * order R00 R01 R02 R10 R11 R12 R20 R21 R22.
+ *
+ * q and -q are representing the same rotation. This ambiguity must be taken into
+ * account when using the output of this function.
+ *
+ * The loop has no branch: the 4 possible values of the diagonal term
+ * (trace, or the biggest diagonal coefficient) are computed and the
+ * right one is selected with the predicates of the 4 cases, as are the
+ * outputs. Only one square root and one division are computed per
+ * quaternion. With -ffast-math, the selections are converted to
+ * conditional selects and the loop can be vectorized by the compiler.
+ * The output must not overlap the input.
+ * 
+ */
+void arm_rotation2quaternion_soa_f32(const float32_t * __restrict pInputRotations, 
+    float32_t * __restrict pOutputQuaternions,  
+    uint32_t nbQuaternions)
+{
+    const float32_t *p00 = pInputRotations;
+    const float32_t *p01 = p00 + nbQuaternions, *p02 = p01 + nbQuaternions;
+    const float32_t *p10 = p02 + nbQuaternions, *p11 = p10 + nbQuaternions;
+    const float32_t *p12 = p11 + nbQuaternions, *p20 = p12 + nbQuaternions;
+    const float32_t *p21 = p20 + nbQuaternions, *p22 = p21 + nbQuaternions;
+    float32_t *pw = pOutputQuaternions, *px = pOutputQuaternions + nbQuaternions;
+    float32_t *py = pOutputQuaternions + 2*nbQuaternions, *pz = pOutputQuaternions + 3*nbQuaternions;
+
+    for(uint32_t nb=0; nb < nbQuaternions; nb++)
+    {
+       float32_t r00 = p00[nb], r01 = p01[nb], r02 = p02[nb];
+       float32_t r10 = p10[nb], r11 = p11[nb], r12 = p12[nb];
+       float32_t r20 = p20[nb], r21 = p21[nb], r22 = p22[nb];
+       float32_t trace = r00 + r11 + r22;
+       float32_t t0, t1, t2, t3, t;
+       float32_t doubler, s, big;
+       float32_t dx, dy, dz, sxy, sxz, syz, q;
+       uint32_t c0, c1, c2;
+
+       /* Candidates for the diagonal term (4*qw, 4*qx, 4*qy or 4*qz) */
+       t0 = trace + 1.0f;
+       t1 = 1.0f + r00 - r11 - r22;
+       t2 = 1.0f + r11 - r00 - r22;
+       t3 = 1.0f + r22 - r00 - r11;
+
+       /*
+        * Predicates of the cases. They are tested in the reverse order of
+        * priority so that each selection overrides the previous one.
+        */
+       c0 = (trace > 0);
+       c1 = (r00 > r11) & (r00 > r22);
+       c2 = (r11 > r22);
+
+       t = c2 ? t2 : t3;
+       t = c1 ? t1 : t;
+       t = c0 ? t0 : t;
+
+       doubler = sqrtf(t) * 2;
+       s = 1.0f / doubler;
+       big = 0.25f * doubler;
+
+       dx  = (r21 - r12) * s;
+       dy  = (r02 - r20) * s;
+       dz  = (r10 - r01) * s;
+       sxy = (r01 + r10) * s;
+       sxz = (r02 + r20) * s;
+       syz = (r12 + r21) * s;
+
+       q = c2 ? dy : dz;
+       q = c1 ? dx : q;
+       pw[nb] = c0 ? big : q;
+
+       q = c2 ? sxy : sxz;
+       q = c1 ? big : q;
+       px[nb] = c0 ? dx : q;
+
+       q = c2 ? big : syz;
+       q = c1 ? sxy : q;
+       py[nb] = c0 ? dy : q;
+
+       q = c2 ? syz : big;
+       q = c1 ? sxz : q;
+       pz[nb] = c0 ? dz : q;
+    }
+}
+
+/**
+  @} end of RotQuat group
+ */
@@ -28,9 +28,24 @@
 
 #include "arm_svm_linear_init_f32.c"
 #include "arm_svm_linear_predict_f32.c"
+#include "arm_svm_linear_predict_batch_f32.c"
+#include "arm_svm_multiclass_init_f32.c"
+#include "arm_svm_multiclass_predict_f32.c"
 #include "arm_svm_polynomial_init_f32.c"
 #include "arm_svm_polynomial_predict_f32.c"
 #include "arm_svm_rbf_init_f32.c"
 #include "arm_svm_rbf_predict_f32.c"
 #include "arm_svm_sigmoid_init_f32.c"
 #include "arm_svm_sigmoid_predict_f32.c"
+#include "arm_svm_linear_init_q15.c"
+#include "arm_svm_linear_predict_q15.c"
+#include "arm_svm_polynomial_init_q15.c"
+#include "arm_svm_polynomial_predict_q15.c"
+#include "arm_svm_rbf_init_q15.c"
+#include "arm_svm_rbf_predict_q15.c"
+#include "arm_svm_linear_init_q7.c"
+#include "arm_svm_linear_predict_q7.c"
+#include "arm_svm_polynomial_init_q7.c"
+#include "arm_svm_polynomial_predict_q7.c"
+#include "arm_svm_rbf_init_q7.c"
+#include "arm_svm_rbf_predict_q7.c"
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_linear_predict_batch_f32.c
+ * Description:  SVM Linear Classifier on a batch of vectors
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/matrix_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+ * @addtogroup linearsvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM linear prediction on a batch of vectors
+ * @param[in]    S          Pointer to an instance of the linear SVM structure.
+ * @param[in]    in         Pointer to nbVectors input vectors
+ * @param[in]    nbVectors  Number of input vectors
+ * @param[out]   pScratch   Buffer of vectorDimension + nbVectors samples
+ * @param[out]   pResult    nbVectors predicted classes
+ * @return none.
+ *
+ * The decision function of a linear SVM is a dot product with the weight
+ * vector w = sum(dualCoefficients[k] * supportVectors[k]). It is computed
+ * once for the batch in pScratch so the cost per vector is one dot
+ * product of dimension vectorDimension instead of nbOfSupportVectors.
+ * The decision values of all the vectors are then computed with
+ * arm_mat_vec_mult_f32, by blocks of at most 65535 vectors since the
+ * number of rows of a matrix is a uint16_t. vectorDimension must not be
+ * bigger than 65535.
+ *
+ * The decision values are rounded differently from
+ * arm_svm_linear_predict_f32 so vectors very close to the separating
+ * hyperplane may be classified differently.
+ *
+ */
+void arm_svm_linear_predict_batch_f32(
+    const arm_svm_linear_instance_f32 *S,
+    const float32_t * in,
+    uint32_t nbVectors,
+    float32_t * pScratch,
+    int32_t * pResult)
+{
+    float32_t *pWeights = pScratch;
+    float32_t *pDecision = pScratch + S->vectorDimension;
+    const float32_t *pSupport = S->supportVectors;
+    arm_matrix_instance_f32 inputs;
+    float32_t coef;
+    uint32_t i, j, blkSize;
+
+    for(j = 0; j < S->vectorDimension; j++)
+    {
+        pWeights[j] = 0.0f;
+    }
+
+    for(i = 0; i < S->nbOfSupportVectors; i++)
+    {
+        coef = S->dualCoefficients[i];
+        for(j = 0; j < S->vectorDimension; j++)
+        {
+            pWeights[j] += coef * *pSupport++;
+        }
+    }
+
+    /* The number of rows of a matrix instance is limited to 65535
+       so big batches are processed in several blocks */
+    while (nbVectors > 0U)
+    {
+        blkSize = (nbVectors > UINT16_MAX) ? UINT16_MAX : nbVectors;
+
+        arm_mat_init_f32(&inputs, (uint16_t)blkSize, S->vectorDimension, (float32_t *)in);
+        arm_mat_vec_mult_f32(&inputs, pWeights, pDecision);
+
+        for(i = 0; i < blkSize; i++)
+        {
+            pResult[i] = S->classes[STEP(S->intercept + pDecision[i])];
+        }
+
+        in += blkSize * S->vectorDimension;
+        pDecision += blkSize;
+        pResult += blkSize;
+        nbVectors -= blkSize;
+    }
+}
+
+
+/**
+ * @} end of linearsvm group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_linear_predict_q15.c
+ * Description:  SVM Linear Classifier
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+ * @addtogroup linearsvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM linear prediction
+ * @param[in]    S          Pointer to an instance of the linear SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Decision value
+ * @return none.
+ *
+ * The dot products are computed in 34.30 format and truncated to
+ * 49.15 before the multiplication by the dual coefficients.
+ * The decision value is accumulated in a q63.
+ *
+ */
+void arm_svm_linear_predict_q15(
+    const arm_svm_linear_instance_q15 *S,
+    const q15_t * in,
+    int32_t * pResult)
+{
+    const q15_t *pSupport = S->supportVectors;
+    const q15_t *pDualCoef = S->dualCoefficients;
+    q63_t sum = (q63_t) S->intercept << 15;
+    q63_t dot;
+    uint32_t i;
+
+    for(i = 0; i < S->nbOfSupportVectors; i++)
+    {
+        arm_dot_prod_q15(pSupport, in, S->vectorDimension, &dot);
+        sum += (q63_t) *pDualCoef++ * (dot >> 15);
+        pSupport += S->vectorDimension;
+    }
+
+    *pResult = S->classes[STEP(sum)];
+}
+
+
+/**
+ * @} end of linearsvm group
+ */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_multiclass_init_f32.c
+ * Description:  SVM Multi-class Instance Initialization
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/statistics_functions.h"
+#include <limits.h>
+#include <math.h>
+
+/**
+  @ingroup groupSVM
+ */
+
+/**
+  @defgroup multiclasssvm Multi-class SVM
+
+  Multi-class SVM classifier
+
+  The classifiers of all the pairs of classes (one-vs-one) or of each class
+  against the others (one-vs-rest) share a single array of support vectors.
+  The kernel between the input and each support vector is computed once
+  per prediction and reused by all the classifiers.
+
+  One-vs-one uses the layout of scikit-learn SVC (libsvm) :
+  - the support vectors are sorted by class and nbOfSupportVectorsPerClass
+    gives the number of support vectors of each class
+  - dualCoefficients is a (nbOfClasses - 1) x nbOfSupportVectors matrix
+    (dual_coef_ attribute)
+  - intercepts has one value per pair (i,j) with i < j in the order
+    (0,1), (0,2) ... (1,2) ... (intercept_ attribute)
+
+  The classifier of the pair (i,j) uses the coefficients of row j-1 for the
+  support vectors of class i and of row i for the support vectors of
+  class j. A positive decision value is a vote for i. The predicted class
+  is the one with the most votes and ties are won by the lowest class index.
+
+  One-vs-rest uses a nbOfClasses x nbOfSupportVectors matrix of dual
+  coefficients (0 for the support vectors not used by a classifier) and
+  one intercept per class. The predicted class is the one with the largest
+  decision value. nbOfSupportVectorsPerClass is not used.
+
+  For the RBF kernel, the squared norms of the support vectors are computed
+  by the init function and kept at the end of the state buffer. The squared
+  distances are then computed as |x|^2 + |sv|^2 - 2 <x,sv> from the same
+  matrix-vector product as the other kernels.
+ */
+
+/**
+ * @addtogroup multiclasssvm
+ * @{
+ */
+
+
+/**
+ * @brief        SVM multi-class instance init function
+ *
+ * Classes are integer used as output of the function.
+ *
+ * @param[in]    S                      points to an instance of the multi-class SVM structure.
+ * @param[in]    strategy               One-vs-one or one-vs-rest
+ * @param[in]    kernel                 Kernel of the classifiers
+ * @param[in]    nbOfClasses            Number of classes
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    nbOfSupportVectorsPerClass  Number of support vectors of each class (one-vs-one only)
+ * @param[in]    intercepts             Intercept of each classifier
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    classes                Array of nbOfClasses classes ID
+ * @param[in]    degree                 Polynomial degree
+ * @param[in]    coef0                  coeff0 (scikit-learn terminology)
+ * @param[in]    gamma                  gamma (scikit-learn terminology)
+ * @param[in]    pState                 Buffer of nbOfSupportVectors + nbOfClasses samples
+ *                                      and nbOfSupportVectors more samples for the RBF kernel
+ * @return       ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR when there are
+ *               less than 2 classes or when the numbers of support vectors
+ *               per class are not consistent with nbOfSupportVectors
+ *
+ * degree is only used by the polynomial kernel. coef0 is only used by the
+ * polynomial and sigmoid kernels and gamma is not used by the linear kernel.
+ *
+ */
+
+arm_status arm_svm_multiclass_init_f32(arm_svm_multiclass_instance_f32 *S,
+  arm_svm_multiclass_type strategy,
+  arm_ml_kernel_type kernel,
+  uint32_t nbOfClasses,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const uint32_t *nbOfSupportVectorsPerClass,
+  const float32_t *intercepts,
+  const float32_t *dualCoefficients,
+  const float32_t *supportVectors,
+  const int32_t *classes,
+  int32_t degree,
+  float32_t coef0,
+  float32_t gamma,
+  float32_t *pState)
+{
+   uint32_t i, nb;
+   float32_t *pNorms;
+
+   if (nbOfClasses < 2U)
+   {
+      return (ARM_MATH_ARGUMENT_ERROR);
+   }
+
+   if (strategy == ARM_SVM_ONE_VS_ONE)
+   {
+      nb = 0;
+      for(i = 0; i < nbOfClasses; i++)
+      {
+         nb += nbOfSupportVectorsPerClass[i];
+      }
+
+      if (nb != nbOfSupportVectors)
+      {
+         return (ARM_MATH_ARGUMENT_ERROR);
+      }
+   }
+
+   S->strategy = strategy;
+   S->kernel = kernel;
+   S->nbOfClasses = nbOfClasses;
+   S->nbOfSupportVectors = nbOfSupportVectors;
+   S->vectorDimension = vectorDimension;
+   S->nbOfSupportVectorsPerClass = nbOfSupportVectorsPerClass;
+   S->intercepts = intercepts;
+   S->dualCoefficients = dualCoefficients;
+   S->supportVectors = supportVectors;
+   S->classes = classes;
+   S->degree = degree;
+   S->coef0 = coef0;
+   S->gamma = gamma;
+   S->pState = pState;
+   S->supportVectorsNorms = NULL;
+
+   if (kernel == ARM_ML_KERNEL_RBF)
+   {
+      pNorms = pState + nbOfSupportVectors + nbOfClasses;
+      for(i = 0; i < nbOfSupportVectors; i++)
+      {
+         arm_power_f32(supportVectors + i * vectorDimension, vectorDimension, &pNorms[i]);
+      }
+      S->supportVectorsNorms = pNorms;
+   }
+
+   return (ARM_MATH_SUCCESS);
+}
+
+
+
+/**
+ * @} end of multiclasssvm group
+ */
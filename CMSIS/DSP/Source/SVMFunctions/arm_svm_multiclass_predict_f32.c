@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_multiclass_predict_f32.c
+ * Description:  SVM Multi-class Classifier
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+#include "dsp/statistics_functions.h"
+#include "dsp/support_functions.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+ * @addtogroup multiclasssvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM multi-class prediction
+ * @param[in]    S          Pointer to an instance of the multi-class SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Predicted class
+ * @return none.
+ *
+ * The kernels of the nbOfSupportVectors support vectors are computed once
+ * in the state buffer. The dot products with the support vectors are
+ * computed with arm_mat_vec_mult_f32 for all the kernels. The RBF kernel
+ * gets the squared distances from these dot products and from the squared
+ * norms computed by the init function, and the exponentials with
+ * arm_vexp_f32. Each classifier is then a dot product between its dual
+ * coefficients and a slice of the kernel values.
+ *
+ */
+void arm_svm_multiclass_predict_f32(
+    const arm_svm_multiclass_instance_f32 *S,
+    const float32_t * in,
+    int32_t * pResult)
+{
+    float32_t *pKernel = S->pState;
+    float32_t *pVotes = S->pState + S->nbOfSupportVectors;
+    const float32_t *pSupport = S->supportVectors;
+    uint32_t nbSV = S->nbOfSupportVectors;
+    arm_matrix_instance_f32 support;
+    uint32_t i, j, p;
+    uint32_t startI, startJ;
+    uint32_t best;
+    float32_t sum, dot, norm, dist;
+
+    /* Kernels between the input and all the support vectors */
+    arm_mat_init_f32(&support, nbSV, S->vectorDimension, (float32_t *)pSupport);
+    arm_mat_vec_mult_f32(&support, in, pKernel);
+
+    if (S->kernel == ARM_ML_KERNEL_RBF)
+    {
+        arm_power_f32(in, S->vectorDimension, &norm);
+        for(i = 0; i < nbSV; i++)
+        {
+            dist = norm + S->supportVectorsNorms[i] - 2.0f * pKernel[i];
+            /* The rounding errors can give a small negative distance */
+            dist = (dist < 0.0f) ? 0.0f : dist;
+            pKernel[i] = -S->gamma * dist;
+        }
+        arm_vexp_f32(pKernel, pKernel, nbSV);
+    }
+    else if (S->kernel == ARM_ML_KERNEL_POLYNOMIAL)
+    {
+        for(i = 0; i < nbSV; i++)
+        {
+            pKernel[i] = arm_exponent_f32(S->gamma * pKernel[i] + S->coef0, S->degree);
+        }
+    }
+    else if (S->kernel == ARM_ML_KERNEL_SIGMOID)
+    {
+        for(i = 0; i < nbSV; i++)
+        {
+            pKernel[i] = tanhf(S->gamma * pKernel[i] + S->coef0);
+        }
+    }
+
+    if (S->strategy == ARM_SVM_ONE_VS_ONE)
+    {
+        arm_fill_f32(0.0f, pVotes, S->nbOfClasses);
+
+        p = 0;
+        startI = 0;
+        for(i = 0; i < S->nbOfClasses; i++)
+        {
+            startJ = startI + S->nbOfSupportVectorsPerClass[i];
+            for(j = i + 1; j < S->nbOfClasses; j++)
+            {
+                /* Coefficients of row j-1 for the support vectors of i
+                   and of row i for the support vectors of j */
+                arm_dot_prod_f32(S->dualCoefficients + (j - 1) * nbSV + startI,
+                    pKernel + startI, S->nbOfSupportVectorsPerClass[i], &dot);
+                sum = S->intercepts[p] + dot;
+                arm_dot_prod_f32(S->dualCoefficients + i * nbSV + startJ,
+                    pKernel + startJ, S->nbOfSupportVectorsPerClass[j], &dot);
+                sum += dot;
+
+                pVotes[(sum > 0.0f) ? i : j] += 1.0f;
+
+                startJ += S->nbOfSupportVectorsPerClass[j];
+                p++;
+            }
+            startI += S->nbOfSupportVectorsPerClass[i];
+        }
+    }
+    else
+    {
+        for(i = 0; i < S->nbOfClasses; i++)
+        {
+            arm_dot_prod_f32(S->dualCoefficients + i * nbSV, pKernel, nbSV, &dot);
+            pVotes[i] = S->intercepts[i] + dot;
+        }
+    }
+
+    /* First largest vote or decision value */
+    best = 0;
+    for(i = 1; i < S->nbOfClasses; i++)
+    {
+        if (pVotes[i] > pVotes[best])
+        {
+            best = i;
+        }
+    }
+
+    *pResult = S->classes[best];
+}
+
+
+/**
+ * @} end of multiclasssvm group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_polynomial_predict_q15.c
+ * Description:  SVM Polynomial Classifier
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "arm_svm_fixed.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+ * @addtogroup polysvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM polynomial prediction
+ * @param[in]    S          Pointer to an instance of the polynomial SVM structure.
+ * @param[in]    in         Pointer to input vector
+ * @param[out]   pResult    Decision value
+ * @return none.
+ *
+ * The kernel values are computed in Q31 and saturated. They are
+ * accumulated with the dual coefficients in a q63 in 17.46 format.
+ *
+ */
+void arm_svm_polynomial_predict_q15(
+    const arm_svm_polynomial_instance_q15 *S,
+    const q15_t * in,
+    int32_t * pResult)
+{
+    const q15_t *pSupport = S->supportVectors;
+    const q15_t *pDualCoef = S->dualCoefficients;
+    q63_t sum = (q63_t) S->intercept << 31;
+    q63_t dot;
+    q31_t k;
+    uint32_t i;
+
+    for(i = 0; i < S->nbOfSupportVectors; i++)
+    {
+        arm_dot_prod_q15(pSupport, in, S->vectorDimension, &dot);
+        k = arm_svm_poly_kernel_q31(dot, S->gamma, S->gammaShift, S->coef0, S->degree);
+        sum += (q63_t) *pDualCoef++ * k;
+        pSupport += S->vectorDimension;
+    }
+
+    *pResult = S->classes[STEP(sum)];
+}
+
+
+/**
+ * @} end of polysvm group
+ */
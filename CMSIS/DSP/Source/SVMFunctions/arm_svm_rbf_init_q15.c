@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_rbf_init_q15.c
+ * Description:  SVM Radial Basis Function Instance Initialization
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include <limits.h>
+#include <math.h>
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief        SVM radial basis function instance init function
+ *
+ * Classes are integer used as output of the function (instead of having -1,1
+ * as class values).
+ *
+ * The dual coefficients and the intercept can be scaled by any common
+ * positive factor to bring them in the q15 range.
+ * The gamma factor is gamma * 2^gammaShift.
+ *
+ * supportVectorsNorms contains the squared norm of each support vector
+ * as computed by arm_dot_prod_q15 (34.30 format). They are computed offline
+ * (the Python quantization helper provides them) so that they are not
+ * recomputed for each prediction.
+ *
+ * @param[in]    S                      points to an instance of the rbf SVM structure.
+ * @param[in]    nbOfSupportVectors     Number of support vectors
+ * @param[in]    vectorDimension        Dimension of vector space
+ * @param[in]    intercept              Intercept
+ * @param[in]    dualCoefficients       Array of dual coefficients
+ * @param[in]    supportVectors         Array of support vectors
+ * @param[in]    supportVectorsNorms    Array of squared norms of the support vectors
+ * @param[in]    classes                Array of 2 classes ID
+ * @param[in]    gamma                  gamma (fractional part)
+ * @param[in]    gammaShift             gamma (exponent)
+ * @return none.
+ *
+ */
+
+void arm_svm_rbf_init_q15(arm_svm_rbf_instance_q15 *S, 
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  q15_t intercept,
+  const q15_t *dualCoefficients,
+  const q15_t *supportVectors,
+  const q63_t *supportVectorsNorms,
+  const int32_t *classes,
+  q15_t gamma,
+  int32_t gammaShift
+  )
+{
+   S->nbOfSupportVectors = nbOfSupportVectors;
+   S->vectorDimension = vectorDimension;
+   S->intercept = intercept;
+   S->dualCoefficients = dualCoefficients;
+   S->supportVectors = supportVectors;
+   S->supportVectorsNorms = supportVectorsNorms;
+   S->classes = classes;
+   S->gamma = gamma;
+   S->gammaShift = gammaShift;
+}
+
+
+/**
+ * @} end of rbfsvm group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_rbf_predict_q7.c
+ * Description:  SVM Radial Basis Function Classifier
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "arm_svm_fixed.h"
+#include <limits.h>
+#include <math.h>
+
+
+/**
+ * @addtogroup rbfsvm
+ * @{
+ */
+
+
+/**
+ * @brief SVM rbf prediction
+ * @param[in]    S         Pointer to an instance of the rbf SVM structure.
+ * @param[in]    in        Pointer to input vector
+ * @param[out]   pResult   decision value
+ * @return none.
+ *
+ * The squared distances are computed exactly as
+ * <x,x> + <sv,sv> - 2.<x,sv> with the vectorized dot products.
+ * The norms <sv,sv> are read from the instance.
+ * exp is computed from a table of 2^x. The kernel values are in Q31
+ * and are accumulated with the dual coefficients in a q63 in
+ * 17.46 format.
+ *
+ */
+void arm_svm_rbf_predict_q7(
+    const arm_svm_rbf_instance_q7 *S,
+    const q7_t * in,
+    int32_t * pResult)
+{
+    const q7_t *pSupport = S->supportVectors;
+    const q31_t *pNorms = S->supportVectorsNorms;
+    const q15_t *pDualCoef = S->dualCoefficients;
+    q63_t sum = (q63_t) S->intercept << 31;
+    q31_t dotIn, dot;
+    q63_t d2;
+    q31_t k;
+    uint32_t i;
+
+    arm_dot_prod_q7(in, in, S->vectorDimension, &dotIn);
+
+    for(i = 0; i < S->nbOfSupportVectors; i++)
+    {
+        arm_dot_prod_q7(pSupport, in, S->vectorDimension, &dot);
+        d2 = (q63_t) dotIn + *pNorms++ - 2 * (q63_t) dot;
+
+        /* Q14 -> Q30 */
+        k = arm_svm_rbf_kernel_q31(d2 << 16, S->gamma, S->gammaShift);
+        sum += (q63_t) *pDualCoef++ * k;
+        pSupport += S->vectorDimension;
+    }
+
+    *pResult = S->classes[STEP(sum)];
+}
+
+
+/**
+ * @} end of rbfsvm group
+ */
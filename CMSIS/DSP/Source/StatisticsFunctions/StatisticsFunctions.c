@@ -65,4 +65,31 @@
 #include "arm_absmin_f32.c"
 #include "arm_absmin_q15.c"
 #include "arm_absmin_q31.c"
-#include "arm_absmin_q7.c"
\ No newline at end of file
+#include "arm_absmin_q7.c"
+#include "arm_stats_accum_f32.c"
+#include "arm_stats_accum_init_f32.c"
+#include "arm_stats_accum_merge_f32.c"
+#include "arm_stats_accum_result_f32.c"
+#include "arm_stats_accum_q31.c"
+#include "arm_stats_accum_init_q31.c"
+#include "arm_stats_accum_merge_q31.c"
+#include "arm_stats_accum_result_q31.c"
+#include "arm_stats_accum_q15.c"
+#include "arm_stats_accum_init_q15.c"
+#include "arm_stats_accum_merge_q15.c"
+#include "arm_stats_accum_result_q15.c"
+#include "arm_moving_stats_f32.c"
+#include "arm_moving_stats_init_f32.c"
+#include "arm_moving_stats_result_f32.c"
+#include "arm_moving_stats_q15.c"
+#include "arm_moving_stats_init_q15.c"
+#include "arm_moving_stats_result_q15.c"
+#include "arm_histogram_f32.c"
+#include "arm_histogram_edges_f32.c"
+#include "arm_histogram_q15.c"
+#include "arm_histogram_edges_q15.c"
+#include "arm_percentile_f32.c"
+#include "arm_median_f32.c"
+#include "arm_p2_quantile_f32.c"
+#include "arm_p2_quantile_init_f32.c"
+#include "arm_p2_quantile_result_f32.c"
\ No newline at end of file
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_edges_f32.c
+ * Description:  Histogram of a floating-point vector with custom bin edges
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Histogram
+  @{
+ */
+
+/**
+  @brief         Histogram of a floating-point vector with custom bin edges.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[in]     pEdges     points to the numBins + 1 increasing bin edges
+  @param[in]     numBins    number of bins
+  @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+  @return        none
+
+  @par           Details
+                   The bin of a sample is found by a binary search in the edges
+                   so the cost is O(log(numBins)) per sample.
+ */
+void arm_histogram_edges_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+  const float32_t * pEdges,
+        uint32_t numBins,
+        uint32_t * pHist)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t in;                                  /* Temporary variable to store input value */
+        uint32_t lo, hi, mid;                          /* Binary search bounds */
+
+  if (numBins == 0U)
+  {
+    return;
+  }
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if ((in >= pEdges[0]) && (in <= pEdges[numBins]))
+    {
+      /* Largest k such that pEdges[k] <= in, limited to the last bin */
+      lo = 0U;
+      hi = numBins;
+      while (hi - lo > 1U)
+      {
+        mid = (lo + hi) >> 1U;
+        if (pEdges[mid] <= in)
+        {
+          lo = mid;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+
+      pHist[lo]++;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of Histogram group
+ */
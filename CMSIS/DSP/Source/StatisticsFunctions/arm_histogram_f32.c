@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_f32.c
+ * Description:  Histogram of a floating-point vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Histogram Histogram
+
+  Counts the number of samples of a vector falling in each bin.
+
+  The bins are either uniform between a minimum and a maximum value or
+  defined by an array of increasing edges. For n bins with edges
+  e[0] ... e[n], the bin k contains the samples x such that
+  <pre>
+      e[k] <= x < e[k+1]
+  </pre>
+  The last bin also contains the samples equal to e[n]. Samples outside
+  of [e[0], e[n]] are not counted.
+
+  The counts are added to the content of the histogram array so that a
+  histogram can be computed block by block. The array must be cleared
+  before the first block.
+
+  There are separate functions for floating point and Q15 data types.
+ */
+
+/**
+  @addtogroup Histogram
+  @{
+ */
+
+/**
+  @brief         Histogram of a floating-point vector with uniform bins.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[in]     minVal     lower edge of the first bin
+  @param[in]     maxVal     upper edge of the last bin
+  @param[in]     numBins    number of bins
+  @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : numBins is 0 or maxVal is not greater than minVal
+
+  @par           Details
+                   The bin of a sample is computed with one multiplication so the
+                   cost does not depend on the number of bins.
+ */
+arm_status arm_histogram_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t minVal,
+        float32_t maxVal,
+        uint32_t numBins,
+        uint32_t * pHist)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t scale;                               /* Number of bins per unit */
+        float32_t in;                                  /* Temporary variable to store input value */
+        uint32_t bin;                                  /* Bin index */
+
+  if ((numBins == 0U) || !(maxVal > minVal))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  scale = (float32_t) numBins / (maxVal - minVal);
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if ((in >= minVal) && (in <= maxVal))
+    {
+      bin = (uint32_t) ((in - minVal) * scale);
+
+      /* maxVal and rounding errors near maxVal */
+      if (bin >= numBins)
+      {
+        bin = numBins - 1U;
+      }
+
+      pHist[bin]++;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Histogram group
+ */
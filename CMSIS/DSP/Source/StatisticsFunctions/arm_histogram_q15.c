@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_q15.c
+ * Description:  Histogram of a Q15 vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Histogram
+  @{
+ */
+
+/**
+  @brief         Histogram of a Q15 vector with uniform bins.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[in]     minVal     smallest value of the first bin
+  @param[in]     maxVal     largest value of the last bin
+  @param[in]     numBins    number of bins
+  @param[in,out] pHist      points to the numBins counts. The counts are incremented.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : numBins is 0 or maxVal is smaller than minVal
+
+  @par           Details
+                   The maxVal - minVal + 1 possible values of the range are split into
+                   numBins uniform bins. The bin of a sample x is
+                   <pre>
+                       ((x - minVal) * numBins) / (maxVal - minVal + 1)
+                   </pre>
+                   It is computed in integer arithmetic so there is no rounding issue
+                   at the bin edges.
+  @par
+                   The division by the range is replaced by a multiplication with a
+                   reciprocal computed once per call. With numBins = q * range + r,
+                   the bin is d * q + ((d * recip) >> shift) where d = x - minVal,
+                   shift is twice the number of bits of the range and
+                   recip = ceil(r * 2^shift / range).
+                   Since the rounding error of the reciprocal is smaller than
+                   1 / (range * range), the result is exactly the one of the division.
+ */
+arm_status arm_histogram_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        q15_t minVal,
+        q15_t maxVal,
+        uint32_t numBins,
+        uint32_t * pHist)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t range;                                /* Number of values in the range */
+        uint32_t quotient;                             /* Integer part of numBins / range */
+        uint32_t recip;                                /* Reciprocal for the fractional part */
+        uint32_t shift;                                /* Fractional bits of the reciprocal */
+        uint32_t diff;                                 /* Offset of the sample in the range */
+        q15_t in;                                      /* Temporary variable to store input value */
+
+  if ((numBins == 0U) || (maxVal < minVal))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  range = (uint32_t) ((q31_t) maxVal - (q31_t) minVal) + 1U;
+
+  /* range is at most 2^16 so shift is at most 32 and recip fits on 32 bits */
+  shift = 0U;
+  while ((1UL << shift) < range)
+  {
+    shift++;
+  }
+  shift = 2U * shift;
+
+  quotient = numBins / range;
+  recip = (uint32_t) ((((uint64_t) (numBins - quotient * range) << shift) + range - 1U) / range);
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if ((in >= minVal) && (in <= maxVal))
+    {
+      diff = (uint32_t) ((q31_t) in - (q31_t) minVal);
+      pHist[diff * quotient + (uint32_t) (((uint64_t) diff * recip) >> shift)]++;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Histogram group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_f32.c
+ * Description:  Median of a floating-point vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Percentile
+  @{
+ */
+
+/**
+  @brief         Median of a floating-point vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[in,out] pScratch   points to a buffer of blockSize samples. Can be pSrc.
+  @param[out]    pResult    median value returned here
+  @return        none
+
+  @par           Details
+                   For an even number of samples, the median is the mean of the
+                   two middle samples. The result is 0 when blockSize is 0.
+ */
+void arm_median_f32(
+        float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pScratch,
+        float32_t * pResult)
+{
+  arm_percentile_f32(pSrc, blockSize, 50.0f, pScratch, pResult);
+}
+
+/**
+  @} end of Percentile group
+ */
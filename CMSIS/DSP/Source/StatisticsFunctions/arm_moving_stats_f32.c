@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_f32.c
+ * Description:  Moving window statistics of a floating-point signal
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup MovingStats Moving Window Statistics
+
+  Computes the mean, variance, root mean square, minimum and maximum
+  of the last windowSize samples of a signal.
+
+  The samples of the window are kept in a ring buffer. Adding a sample
+  removes the oldest one from the window. The cost of each new sample is
+  O(1) amortized whatever the window size:
+  - the mean, variance and root mean square are computed from running
+    sums of the samples and of their squares,
+  - the minimum and maximum are the fronts of two monotonic queues of
+    buffer positions. A queue only contains the samples which can still
+    become the extremum of a future window, so each sample is pushed and
+    popped at most once.
+
+  The statistics can be read with the result function after any number
+  of samples, for instance once per hop.
+
+  The variance is computed with a (n - 1) normalization as in \ref arm_var_f32,
+  where n is the number of samples in the window. Before windowSize samples
+  have been received, the window contains all the received samples.
+
+  There are separate functions for floating point and Q15 data types.
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of floating-point samples to the moving window.
+  @param[in,out] S          points to an instance of the floating-point moving statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+
+  @par           Details
+                   The running sums are computed on the samples minus a reference value.
+                   Each time the ring buffer wraps, the reference value is set to the mean
+                   of the window and the sums are recomputed from the buffer. It removes the
+                   rounding errors accumulated by the additions and subtractions, and avoids
+                   cancellation in the variance when the mean is large compared to the
+                   standard deviation.
+ */
+void arm_moving_stats_f32(
+        arm_moving_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        float32_t *pBuffer = S->pBuffer;               /* Ring buffer */
+        uint32_t *pMinQueue = S->pMinQueue;            /* Monotonic queue for the minimum */
+        uint32_t *pMaxQueue = S->pMaxQueue;            /* Monotonic queue for the maximum */
+        uint32_t windowSize = S->windowSize;
+        uint32_t count = S->count;
+        uint32_t pos = S->pos;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        float32_t shift = S->shift;
+        float32_t sum = S->sum, sumOfSquares = S->sumOfSquares;
+        float32_t in, dev;
+        uint32_t back, i;                              /* Queue position, loop counter */
+        uint32_t blkCnt;                               /* Loop counter */
+
+  if ((count == 0U) && (blockSize > 0U))
+  {
+    shift = pSrc[0];
+  }
+
+  blkCnt = blockSize;
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (count == windowSize)
+    {
+      /* Remove the oldest sample of the window which is at the write position */
+      dev = pBuffer[pos] - shift;
+      sum -= dev;
+      sumOfSquares -= dev * dev;
+
+      /* The oldest sample can only be at the front of the queues */
+      if ((minCount > 0U) && (pMinQueue[minHead] == pos))
+      {
+        minHead = (minHead == windowSize - 1U) ? 0U : minHead + 1U;
+        minCount--;
+      }
+
+      if ((maxCount > 0U) && (pMaxQueue[maxHead] == pos))
+      {
+        maxHead = (maxHead == windowSize - 1U) ? 0U : maxHead + 1U;
+        maxCount--;
+      }
+    }
+    else
+    {
+      count++;
+    }
+
+    pBuffer[pos] = in;
+
+    dev = in - shift;
+    sum += dev;
+    sumOfSquares += dev * dev;
+
+    /* Remove the samples which can no longer be the minimum */
+    while (minCount > 0U)
+    {
+      back = minHead + minCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pBuffer[pMinQueue[back]] < in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    back = minHead + minCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMinQueue[back] = pos;
+    minCount++;
+
+    /* Remove the samples which can no longer be the maximum */
+    while (maxCount > 0U)
+    {
+      back = maxHead + maxCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pBuffer[pMaxQueue[back]] > in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    back = maxHead + maxCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMaxQueue[back] = pos;
+    maxCount++;
+
+    pos++;
+    if (pos == windowSize)
+    {
+      pos = 0U;
+
+      /*
+       * The window is full. The reference value is moved to the mean
+       * and the sums are recomputed once per window so the cost
+       * remains O(1) per sample.
+       */
+      shift += sum / (float32_t) count;
+      sum = 0.0f;
+      sumOfSquares = 0.0f;
+      for (i = 0U; i < count; i++)
+      {
+        dev = pBuffer[i] - shift;
+        sum += dev;
+        sumOfSquares += dev * dev;
+      }
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->count = count;
+  S->pos = pos;
+  S->minHead = minHead;
+  S->minCount = minCount;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->shift = shift;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @} end of MovingStats group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_init_f32.c
+ * Description:  Initialization function for the floating-point moving window statistics
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point moving window statistics.
+  @param[out]    S          points to an instance of the floating-point moving statistics structure
+  @param[in]     windowSize number of samples in the window
+  @param[in]     pBuffer    points to the ring buffer of length windowSize
+  @param[in]     pMinQueue  points to the minimum queue of length windowSize
+  @param[in]     pMaxQueue  points to the maximum queue of length windowSize
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : windowSize is 0
+ */
+arm_status arm_moving_stats_init_f32(
+        arm_moving_stats_instance_f32 * S,
+        uint32_t windowSize,
+        float32_t * pBuffer,
+        uint32_t * pMinQueue,
+        uint32_t * pMaxQueue)
+{
+  if (windowSize == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowSize = windowSize;
+  S->count = 0U;
+  S->pos = 0U;
+  S->minHead = 0U;
+  S->minCount = 0U;
+  S->maxHead = 0U;
+  S->maxCount = 0U;
+  S->shift = 0.0f;
+  S->sum = 0.0f;
+  S->sumOfSquares = 0.0f;
+  S->pBuffer = pBuffer;
+  S->pMinQueue = pMinQueue;
+  S->pMaxQueue = pMaxQueue;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MovingStats group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_q15.c
+ * Description:  Moving window statistics of a Q15 signal
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of Q15 samples to the moving window.
+  @param[in,out] S          points to an instance of the Q15 moving statistics structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The running sums are exact: the samples are accumulated in 49.15 format
+                   and their squares in 34.30 format, so removing a sample from the window
+                   does not introduce any error. The sums can not overflow for windows
+                   smaller than 2^33 samples.
+ */
+void arm_moving_stats_q15(
+        arm_moving_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+        q15_t *pBuffer = S->pBuffer;                   /* Ring buffer */
+        uint32_t *pMinQueue = S->pMinQueue;            /* Monotonic queue for the minimum */
+        uint32_t *pMaxQueue = S->pMaxQueue;            /* Monotonic queue for the maximum */
+        uint32_t windowSize = S->windowSize;
+        uint32_t count = S->count;
+        uint32_t pos = S->pos;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        q63_t sum = S->sum, sumOfSquares = S->sumOfSquares;
+        q15_t in, old;
+        uint32_t back;                                 /* Queue position */
+        uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (count == windowSize)
+    {
+      /* Remove the oldest sample of the window which is at the write position */
+      old = pBuffer[pos];
+      sum -= old;
+      sumOfSquares -= (q31_t) old * old;
+
+      /* The oldest sample can only be at the front of the queues */
+      if ((minCount > 0U) && (pMinQueue[minHead] == pos))
+      {
+        minHead = (minHead == windowSize - 1U) ? 0U : minHead + 1U;
+        minCount--;
+      }
+
+      if ((maxCount > 0U) && (pMaxQueue[maxHead] == pos))
+      {
+        maxHead = (maxHead == windowSize - 1U) ? 0U : maxHead + 1U;
+        maxCount--;
+      }
+    }
+    else
+    {
+      count++;
+    }
+
+    pBuffer[pos] = in;
+
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+
+    /* Remove the samples which can no longer be the minimum */
+    while (minCount > 0U)
+    {
+      back = minHead + minCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pBuffer[pMinQueue[back]] < in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    back = minHead + minCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMinQueue[back] = pos;
+    minCount++;
+
+    /* Remove the samples which can no longer be the maximum */
+    while (maxCount > 0U)
+    {
+      back = maxHead + maxCount - 1U;
+      back = (back >= windowSize) ? back - windowSize : back;
+      if (pBuffer[pMaxQueue[back]] > in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    back = maxHead + maxCount;
+    back = (back >= windowSize) ? back - windowSize : back;
+    pMaxQueue[back] = pos;
+    maxCount++;
+
+    pos = (pos == windowSize - 1U) ? 0U : pos + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->count = count;
+  S->pos = pos;
+  S->minHead = minHead;
+  S->minCount = minCount;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @} end of MovingStats group
+ */
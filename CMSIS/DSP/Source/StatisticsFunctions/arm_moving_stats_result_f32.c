@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_result_f32.c
+ * Description:  Statistics of the floating-point moving window
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Statistics of the floating-point moving window.
+  @param[in]     S          points to an instance of the floating-point moving statistics structure
+  @param[out]    pMean      mean value returned here
+  @param[out]    pVar       variance value returned here
+  @param[out]    pRms       root mean square value returned here
+  @param[out]    pMin       minimum value returned here
+  @param[out]    pMax       maximum value returned here
+  @return        none
+ */
+void arm_moving_stats_result_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pMean,
+        float32_t * pVar,
+        float32_t * pRms,
+        float32_t * pMin,
+        float32_t * pMax)
+{
+  float32_t n;                                   /* Number of samples as float */
+  float32_t meanDev;                             /* Mean of the shifted samples */
+  float32_t m2;                                  /* Sum of the squared deviations from the mean */
+  float32_t mean;                                /* Mean */
+
+  if (S->count == 0U)
+  {
+    *pMean = 0.0f;
+    *pVar = 0.0f;
+    *pRms = 0.0f;
+    *pMin = 0.0f;
+    *pMax = 0.0f;
+    return;
+  }
+
+  n = (float32_t) S->count;
+
+  meanDev = S->sum / n;
+  mean = S->shift + meanDev;
+
+  m2 = S->sumOfSquares - meanDev * S->sum;
+  if (m2 < 0.0f)
+  {
+    m2 = 0.0f;
+  }
+
+  *pMean = mean;
+  *pVar = (S->count > 1U) ? m2 / (n - 1.0f) : 0.0f;
+  arm_sqrt_f32(m2 / n + mean * mean, pRms);
+  *pMin = S->pBuffer[S->pMinQueue[S->minHead]];
+  *pMax = S->pBuffer[S->pMaxQueue[S->maxHead]];
+}
+
+/**
+  @} end of MovingStats group
+ */
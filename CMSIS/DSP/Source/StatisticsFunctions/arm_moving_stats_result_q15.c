@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_result_q15.c
+ * Description:  Statistics of the Q15 moving window
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Statistics of the Q15 moving window.
+  @param[in]     S          points to an instance of the Q15 moving statistics structure
+  @param[out]    pMean      mean value returned here
+  @param[out]    pVar       variance value returned here
+  @param[out]    pRms       root mean square value returned here
+  @param[out]    pMin       minimum value returned here
+  @param[out]    pMax       maximum value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The mean is computed in 2.30 format. The variance and mean of squares
+                   are computed in 3.30 format and truncated to 1.15 format with saturation.
+ */
+void arm_moving_stats_result_q15(
+  const arm_moving_stats_instance_q15 * S,
+        q15_t * pMean,
+        q15_t * pVar,
+        q15_t * pRms,
+        q15_t * pMin,
+        q15_t * pMax)
+{
+  q63_t n;                                       /* Number of samples */
+  q63_t mean;                                    /* Mean in 2.30 format */
+  q63_t meanOfSquares;                           /* Mean of squares in 3.30 format */
+  q63_t varPop;                                  /* Variance with a n normalization */
+  q63_t var;                                     /* Variance with a (n - 1) normalization */
+
+  if (S->count == 0U)
+  {
+    *pMean = 0;
+    *pVar = 0;
+    *pRms = 0;
+    *pMin = 0;
+    *pMax = 0;
+    return;
+  }
+
+  n = (q63_t) S->count;
+
+  mean = (S->sum << 15) / n;
+  meanOfSquares = S->sumOfSquares / n;
+
+  varPop = meanOfSquares - ((mean * mean) >> 30);
+  if (varPop < 0)
+  {
+    varPop = 0;
+  }
+
+  var = (n > 1) ? varPop + varPop / (n - 1) : 0;
+
+  *pMean = (q15_t) __SSAT((q31_t) (mean >> 15), 16);
+  *pVar = (q15_t) __SSAT((q31_t) (var >> 15), 16);
+  arm_sqrt_q15((q15_t) __SSAT((q31_t) (meanOfSquares >> 15), 16), pRms);
+  *pMin = S->pBuffer[S->pMinQueue[S->minHead]];
+  *pMax = S->pBuffer[S->pMaxQueue[S->maxHead]];
+}
+
+/**
+  @} end of MovingStats group
+ */
@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_p2_quantile_f32.c
+ * Description:  P-square quantile estimation of a floating-point stream
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup P2Quantile P-square Quantile Estimator
+
+  Estimates a quantile of an unbounded stream of samples with the P-square
+  algorithm of Jain and Chlamtac, without storing the samples.
+
+  The estimator keeps 5 markers: the minimum, the maximum, the estimated
+  quantile and two intermediate quantiles. Each marker has a height, which
+  is a sample value, and a position, which is its rank in the samples
+  received so far. For each new sample, the positions of the markers above
+  the sample are incremented. The desired positions of the markers for the
+  quantile p and n samples are
+  <pre>
+      0, (n - 1) * p / 2, (n - 1) * p, (n - 1) * (1 + p) / 2, n - 1
+  </pre>
+  When a marker is more than one position away from its desired position,
+  it is moved by one position and its height is adjusted with a piecewise
+  parabolic prediction.
+
+  The memory and the cost per sample are constant. The estimate is exact
+  for the first 5 samples.
+
+  The instance stores the difference between the desired and actual
+  positions of the markers instead of the desired positions. This
+  difference remains small so there is no loss of accuracy for long
+  streams.
+ */
+
+/**
+  @addtogroup P2Quantile
+  @{
+ */
+
+/**
+  @brief         Adds a block of floating-point samples to the P-square quantile estimator.
+  @param[in,out] S          points to an instance of the floating-point P-square structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+ */
+void arm_p2_quantile_f32(
+        arm_p2_quantile_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        float32_t *height = S->height;                 /* Marker heights */
+        uint32_t *pos = S->pos;                        /* Marker positions */
+        float32_t *delta = S->delta;                   /* Desired minus actual positions */
+        const float32_t *incr = S->incr;               /* Desired position increments */
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t in, d, s, np, nm, qp;
+        uint32_t i, k;
+
+  blkCnt = blockSize;
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (S->count < 5U)
+    {
+      /* Initialization: the first samples are kept sorted */
+      i = S->count;
+      while ((i > 0U) && (height[i - 1U] > in))
+      {
+        height[i] = height[i - 1U];
+        i--;
+      }
+      height[i] = in;
+      S->count++;
+
+      if (S->count == 5U)
+      {
+        for (i = 0U; i < 5U; i++)
+        {
+          pos[i] = i;
+        }
+        delta[0] = 0.0f;
+        delta[1] = 2.0f * S->quantile - 1.0f;
+        delta[2] = 4.0f * S->quantile - 2.0f;
+        delta[3] = 2.0f * S->quantile - 1.0f;
+        delta[4] = 0.0f;
+      }
+    }
+    else
+    {
+      /* Cell containing the sample. The extreme markers are updated. */
+      if (in < height[0])
+      {
+        height[0] = in;
+        k = 0U;
+      }
+      else if (in >= height[4])
+      {
+        height[4] = in;
+        k = 3U;
+      }
+      else
+      {
+        k = 0U;
+        while (in >= height[k + 1U])
+        {
+          k++;
+        }
+      }
+
+      /* Markers above the sample move up */
+      for (i = k + 1U; i < 5U; i++)
+      {
+        pos[i]++;
+        delta[i] -= 1.0f;
+      }
+
+      for (i = 0U; i < 5U; i++)
+      {
+        delta[i] += incr[i];
+      }
+
+      S->count++;
+
+      /* Adjust the heights of the middle markers */
+      for (i = 1U; i < 4U; i++)
+      {
+        d = delta[i];
+
+        if (((d >= 1.0f) && (pos[i + 1U] - pos[i] > 1U)) ||
+            ((d <= -1.0f) && (pos[i] - pos[i - 1U] > 1U)))
+        {
+          s = (d >= 1.0f) ? 1.0f : -1.0f;
+          np = (float32_t) (pos[i + 1U] - pos[i]);
+          nm = (float32_t) (pos[i] - pos[i - 1U]);
+
+          /* Piecewise parabolic prediction */
+          qp = height[i] + s / (np + nm) *
+               ((nm + s) * (height[i + 1U] - height[i]) / np +
+                (np - s) * (height[i] - height[i - 1U]) / nm);
+
+          if ((height[i - 1U] < qp) && (qp < height[i + 1U]))
+          {
+            height[i] = qp;
+          }
+          else if (s > 0.0f)
+          {
+            /* Linear prediction */
+            height[i] += (height[i + 1U] - height[i]) / np;
+          }
+          else
+          {
+            height[i] += (height[i - 1U] - height[i]) / nm;
+          }
+
+          if (s > 0.0f)
+          {
+            pos[i]++;
+          }
+          else
+          {
+            pos[i]--;
+          }
+          delta[i] -= s;
+        }
+      }
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of P2Quantile group
+ */
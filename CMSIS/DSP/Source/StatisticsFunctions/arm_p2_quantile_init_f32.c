@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_p2_quantile_init_f32.c
+ * Description:  Initialization function for the P-square quantile estimator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup P2Quantile
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point P-square quantile estimator.
+  @param[out]    S          points to an instance of the floating-point P-square structure
+  @param[in]     quantile   quantile to estimate, between 0 and 1. 0.5 is the median.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : quantile is not between 0 and 1
+ */
+arm_status arm_p2_quantile_init_f32(
+        arm_p2_quantile_instance_f32 * S,
+        float32_t quantile)
+{
+  uint32_t i;
+
+  if (!((quantile >= 0.0f) && (quantile <= 1.0f)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->quantile = quantile;
+  S->count = 0U;
+
+  for (i = 0U; i < 5U; i++)
+  {
+    S->height[i] = 0.0f;
+    S->pos[i] = i;
+    S->delta[i] = 0.0f;
+  }
+
+  S->incr[0] = 0.0f;
+  S->incr[1] = 0.5f * quantile;
+  S->incr[2] = quantile;
+  S->incr[3] = 0.5f * (1.0f + quantile);
+  S->incr[4] = 1.0f;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of P2Quantile group
+ */
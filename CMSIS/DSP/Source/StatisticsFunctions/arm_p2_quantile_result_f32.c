@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_p2_quantile_result_f32.c
+ * Description:  Estimated quantile of the P-square quantile estimator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup P2Quantile
+  @{
+ */
+
+/**
+  @brief         Estimated quantile of the floating-point P-square estimator.
+  @param[in]     S          points to an instance of the floating-point P-square structure
+  @param[out]    pResult    quantile estimate returned here
+  @return        none
+
+  @par           Details
+                   Before 5 samples have been received, the exact quantile of the
+                   samples is returned, interpolated as in \ref arm_percentile_f32.
+                   The result is 0 when no sample has been received.
+ */
+void arm_p2_quantile_result_f32(
+  const arm_p2_quantile_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t pos, frac;
+  uint32_t k;
+
+  if (S->count == 0U)
+  {
+    *pResult = 0.0f;
+  }
+  else if (S->count < 5U)
+  {
+    /* The first samples are sorted in the heights */
+    pos = S->quantile * (float32_t) (S->count - 1U);
+    k = (uint32_t) pos;
+    k = (k > S->count - 1U) ? S->count - 1U : k;
+    frac = pos - (float32_t) k;
+
+    if (k < S->count - 1U)
+    {
+      *pResult = S->height[k] + frac * (S->height[k + 1U] - S->height[k]);
+    }
+    else
+    {
+      *pResult = S->height[k];
+    }
+  }
+  else
+  {
+    *pResult = S->height[2];
+  }
+}
+
+/**
+  @} end of P2Quantile group
+ */
@@ -0,0 +1,285 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_f32.c
+ * Description:  Percentile of a floating-point vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Percentile Median and Percentile
+
+  Computes the median or a percentile of a vector without sorting it.
+
+  The order statistics are found with an introselect algorithm: a quickselect
+  with a median of three pivot and a three way partition, which is O(n) on
+  average. When the partitions do not shrink fast enough, the pivot is chosen
+  with the median of medians algorithm so the worst case is also O(n).
+
+  The percentile is interpolated linearly between the two nearest samples as
+  in the default method of numpy.percentile. For a vector of n samples, the
+  position of the percentage p is
+  <pre>
+      pos = p / 100 * (n - 1)
+  </pre>
+  The median is the percentile 50. For an even number of samples, it is the
+  mean of the two middle samples.
+
+  The selection reorders the samples. The functions use a scratch buffer of
+  blockSize samples so that the input is preserved. When the scratch buffer
+  is the input vector, the selection is done in place and the input vector
+  is modified.
+ */
+
+/**
+  @addtogroup Percentile
+  @{
+ */
+
+/* Below this size, the partition is sorted with an insertion sort */
+#define ARM_SELECT_SMALL_SIZE 16U
+
+static void arm_select_f32(
+  float32_t * pData,
+  uint32_t lo,
+  uint32_t hi,
+  uint32_t k);
+
+static void arm_insertion_sort_f32(
+  float32_t * pData,
+  uint32_t lo,
+  uint32_t hi)
+{
+  uint32_t i, j;
+  float32_t in;
+
+  for (i = lo + 1U; i <= hi; i++)
+  {
+    in = pData[i];
+    j = i;
+    while ((j > lo) && (pData[j - 1U] > in))
+    {
+      pData[j] = pData[j - 1U];
+      j--;
+    }
+    pData[j] = in;
+  }
+}
+
+/*
+ * Median of medians of groups of 5 samples of pData[lo..hi].
+ * The medians are moved to the beginning of the range.
+ */
+static float32_t arm_median_of_medians_f32(
+  float32_t * pData,
+  uint32_t lo,
+  uint32_t hi)
+{
+  uint32_t i, end, nbGroups = 0U;
+  float32_t tmp;
+
+  for (i = lo; i <= hi; i += 5U)
+  {
+    end = (hi - i < 4U) ? hi : i + 4U;
+    arm_insertion_sort_f32(pData, i, end);
+
+    /* Move the median of the group to the beginning */
+    tmp = pData[lo + nbGroups];
+    pData[lo + nbGroups] = pData[i + ((end - i) >> 1U)];
+    pData[i + ((end - i) >> 1U)] = tmp;
+    nbGroups++;
+  }
+
+  arm_select_f32(pData, lo, lo + nbGroups - 1U, lo + (nbGroups >> 1U));
+
+  return (pData[lo + (nbGroups >> 1U)]);
+}
+
+/*
+ * Reorders pData[lo..hi] so that pData[k] is the value it would have
+ * if the range was sorted, with smaller or equal values before it and
+ * greater or equal values after it.
+ */
+static void arm_select_f32(
+  float32_t * pData,
+  uint32_t lo,
+  uint32_t hi,
+  uint32_t k)
+{
+  uint32_t depth;                                /* Remaining quickselect iterations */
+  uint32_t lt, gt, i;                            /* Partition bounds */
+  float32_t pivot, a, b, c, tmp;
+
+  /* 2 * log2(size) quickselect iterations before the median of medians */
+  depth = 0U;
+  for (i = hi - lo + 1U; i > 1U; i >>= 1U)
+  {
+    depth += 2U;
+  }
+
+  while (hi - lo >= ARM_SELECT_SMALL_SIZE)
+  {
+    if (depth > 0U)
+    {
+      /* Median of three */
+      a = pData[lo];
+      b = pData[lo + ((hi - lo) >> 1U)];
+      c = pData[hi];
+      if (a > b)
+      {
+        tmp = a; a = b; b = tmp;
+      }
+      if (b > c)
+      {
+        b = c;
+      }
+      pivot = (a > b) ? a : b;
+      depth--;
+    }
+    else
+    {
+      pivot = arm_median_of_medians_f32(pData, lo, hi);
+    }
+
+    /*
+     * Three way partition:
+     * pData[lo..lt-1] < pivot, pData[lt..gt] == pivot, pData[gt+1..hi] > pivot
+     */
+    lt = lo;
+    gt = hi;
+    i = lo;
+    while (i <= gt)
+    {
+      if (pData[i] < pivot)
+      {
+        tmp = pData[lt]; pData[lt] = pData[i]; pData[i] = tmp;
+        lt++;
+        i++;
+      }
+      else if (pData[i] > pivot)
+      {
+        tmp = pData[gt]; pData[gt] = pData[i]; pData[i] = tmp;
+        gt--;
+      }
+      else
+      {
+        i++;
+      }
+    }
+
+    if (k < lt)
+    {
+      hi = lt - 1U;
+    }
+    else if (k > gt)
+    {
+      lo = gt + 1U;
+    }
+    else
+    {
+      return;
+    }
+  }
+
+  arm_insertion_sort_f32(pData, lo, hi);
+}
+
+/**
+  @brief         Percentile of a floating-point vector.
+  @param[in]     pSrc        points to the input vector
+  @param[in]     blockSize   number of samples in input vector
+  @param[in]     percentage  percentage between 0 and 100
+  @param[in,out] pScratch    points to a buffer of blockSize samples. Can be pSrc.
+  @param[out]    pResult     percentile value returned here
+  @return        none
+
+  @par           Details
+                   The percentage is limited to [0, 100].
+                   The result is 0 when blockSize is 0.
+ */
+void arm_percentile_f32(
+        float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t percentage,
+        float32_t * pScratch,
+        float32_t * pResult)
+{
+        float32_t pos;                                 /* Position of the percentile */
+        float32_t frac;                                /* Interpolation factor */
+        float32_t lower, upper;                        /* Nearest samples */
+        uint32_t k, i;
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  if (pScratch != pSrc)
+  {
+    for (i = 0U; i < blockSize; i++)
+    {
+      pScratch[i] = pSrc[i];
+    }
+  }
+
+  percentage = (percentage < 0.0f) ? 0.0f : percentage;
+  percentage = (percentage > 100.0f) ? 100.0f : percentage;
+
+  pos = percentage * 0.01f * (float32_t) (blockSize - 1U);
+  k = (uint32_t) pos;
+  if (k > blockSize - 1U)
+  {
+    k = blockSize - 1U;
+  }
+  frac = pos - (float32_t) k;
+
+  arm_select_f32(pScratch, 0U, blockSize - 1U, k);
+  lower = pScratch[k];
+
+  if ((frac > 0.0f) && (k < blockSize - 1U))
+  {
+    /* The next order statistic is the minimum of the upper part */
+    upper = pScratch[k + 1U];
+    for (i = k + 2U; i < blockSize; i++)
+    {
+      upper = (pScratch[i] < upper) ? pScratch[i] : upper;
+    }
+
+    *pResult = lower + frac * (upper - lower);
+  }
+  else
+  {
+    *pResult = lower;
+  }
+}
+
+/**
+  @} end of Percentile group
+ */
@@ -0,0 +1,366 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_f32.c
+ * Description:  Streaming statistics of a floating-point vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup StatsAccum Streaming Statistics
+
+  Computes the mean, variance, standard deviation, root mean square,
+  minimum and maximum of an unbounded stream of samples.
+
+  The samples are given block by block to an accumulator. All the statistics
+  are updated in a single pass over each block, so that several statistics of
+  the same data do not require one pass per statistic.
+
+  The floating-point accumulator keeps the mean and the sum of the squared
+  deviations from the mean. They are updated with Welford's method generalized
+  to blocks (Chan et al.):
+  <pre>
+      n     = nA + nB
+      delta = meanB - meanA
+      mean  = meanA + delta * nB / n
+      M2    = M2A + M2B + delta^2 * nA * nB / n
+  </pre>
+  The same formula is used to merge two accumulators, for instance when
+  different parts of a stream have been processed separately.
+
+  The fixed-point accumulators keep exact sums of the samples and of their
+  squares, after subtraction of the first sample of the stream. Fixed-point
+  sums have no cancellation issue so this is the fixed-point equivalent of
+  the Welford update. Merging two accumulators is done by moving the sums of
+  the second one to the reference value of the first one.
+
+  The variance is computed with a (n - 1) normalization as in \ref arm_var_f32.
+  The positions of the minimum and maximum are positions in the whole stream.
+  When a value occurs several times, the first position is returned.
+
+  There are separate functions for floating point, Q31, and Q15 data types.
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/**
+  @brief         Accumulates a block of floating-point samples.
+  @param[in,out] S          points to an instance of the floating-point accumulator structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+
+  @par           Details
+                   The deviations of the block are computed relative to the
+                   current mean of the accumulator. The statistics of the block
+                   are then merged into the accumulator with \ref arm_stats_accum_merge_f32.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+void arm_stats_accum_f32(
+        arm_stats_accum_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+    arm_stats_accum_instance_f32 block;            /* Statistics of the block */
+    uint32_t        blkCnt;                        /* Loop counter */
+    uint32_t        i;                             /* Position in the block */
+    f32x4_t         vecSrc;
+    f32x4_t         sumVec = vdupq_n_f32(0.0f);
+    f32x4_t         sumSqVec = vdupq_n_f32(0.0f);
+    f32x4_t         minVec, maxVec;
+    uint32x4_t      indexVec, minIdxVec, maxIdxVec;
+    uint32_t        curIdx = 0;
+    mve_pred16_t    p0;
+    float32_t       shift, in;
+    float32_t       sum = 0.0f, sumOfSquares = 0.0f;
+    float32_t       minVal, maxVal;
+    uint32_t        minIdx = 0U, maxIdx = 0U;
+
+    if (blockSize == 0U)
+    {
+      return;
+    }
+
+    shift = (S->count > 0U) ? S->mean : pSrc[0];
+    minVal = pSrc[0];
+    maxVal = pSrc[0];
+
+    /* Compute 4 samples at a time */
+    blkCnt = blockSize >> 2U;
+    if (blkCnt > 0U)
+    {
+        minVec = vdupq_n_f32(minVal);
+        maxVec = minVec;
+        minIdxVec = vdupq_n_u32(0);
+        maxIdxVec = vdupq_n_u32(0);
+        indexVec = vidupq_wb_u32(&curIdx, 1);
+
+        while (blkCnt > 0U)
+        {
+            vecSrc = vldrwq_f32(pSrc);
+
+            /* Strict comparisons keep the first position in each lane */
+            p0 = vcmpltq(vecSrc, minVec);
+            minVec = vpselq(vecSrc, minVec, p0);
+            minIdxVec = vpselq(indexVec, minIdxVec, p0);
+
+            p0 = vcmpgtq(vecSrc, maxVec);
+            maxVec = vpselq(vecSrc, maxVec, p0);
+            maxIdxVec = vpselq(indexVec, maxIdxVec, p0);
+
+            vecSrc = vsubq(vecSrc, shift);
+            sumVec = vaddq(sumVec, vecSrc);
+            sumSqVec = vfmaq(sumSqVec, vecSrc, vecSrc);
+
+            indexVec = vidupq_wb_u32(&curIdx, 1);
+
+            pSrc += 4;
+            blkCnt--;
+        }
+
+        sum = vecAddAcrossF32Mve(sumVec);
+        sumOfSquares = vecAddAcrossF32Mve(sumSqVec);
+
+        /* Smallest position among the lanes holding the extremum */
+        minVal = vminnmvq(minVal, minVec);
+        p0 = vcmpeqq(minVec, minVal);
+        minIdx = vminvq(blockSize, vpselq(minIdxVec, vdupq_n_u32(blockSize), p0));
+
+        maxVal = vmaxnmvq(maxVal, maxVec);
+        p0 = vcmpeqq(maxVec, maxVal);
+        maxIdx = vminvq(blockSize, vpselq(maxIdxVec, vdupq_n_u32(blockSize), p0));
+    }
+
+    /* Tail */
+    for (i = blockSize & ~3U; i < blockSize; i++)
+    {
+      in = *pSrc++;
+
+      if (in < minVal)
+      {
+        minVal = in;
+        minIdx = i;
+      }
+
+      if (in > maxVal)
+      {
+        maxVal = in;
+        maxIdx = i;
+      }
+
+      in -= shift;
+      sum += in;
+      sumOfSquares += in * in;
+    }
+
+    block.count = blockSize;
+    block.mean = shift + sum / (float32_t) blockSize;
+    block.m2 = sumOfSquares - sum * sum / (float32_t) blockSize;
+    if (block.m2 < 0.0f)
+    {
+      block.m2 = 0.0f;
+    }
+    block.min = minVal;
+    block.max = maxVal;
+    block.minIndex = minIdx;
+    block.maxIndex = maxIdx;
+
+    arm_stats_accum_merge_f32(S, &block);
+}
+#else
+void arm_stats_accum_f32(
+        arm_stats_accum_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        arm_stats_accum_instance_f32 block;            /* Statistics of the block */
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t i = 0U;                               /* Position in the block */
+        float32_t shift, in;
+        float32_t sum = 0.0f, sumOfSquares = 0.0f;
+        float32_t minVal, maxVal;
+        uint32_t minIdx = 0U, maxIdx = 0U;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  shift = (S->count > 0U) ? S->mean : pSrc[0];
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 samples at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i;
+    }
+
+    in -= shift;
+    sum += in;
+    sumOfSquares += in * in;
+
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i + 1U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i + 1U;
+    }
+
+    in -= shift;
+    sum += in;
+    sumOfSquares += in * in;
+
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i + 2U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i + 2U;
+    }
+
+    in -= shift;
+    sum += in;
+    sumOfSquares += in * in;
+
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i + 3U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i + 3U;
+    }
+
+    in -= shift;
+    sum += in;
+    sumOfSquares += in * in;
+
+    i += 4U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining samples */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Strict comparisons keep the first position */
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i;
+    }
+
+    /* Moments of the deviations from the shift */
+    in -= shift;
+    sum += in;
+    sumOfSquares += in * in;
+
+    i++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  block.count = blockSize;
+  block.mean = shift + sum / (float32_t) blockSize;
+  block.m2 = sumOfSquares - sum * sum / (float32_t) blockSize;
+  if (block.m2 < 0.0f)
+  {
+    block.m2 = 0.0f;
+  }
+  block.min = minVal;
+  block.max = maxVal;
+  block.minIndex = minIdx;
+  block.maxIndex = maxIdx;
+
+  arm_stats_accum_merge_f32(S, &block);
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of StatsAccum group
+ */
@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_init_f32.c
+ * Description:  Initialization function for the floating-point streaming statistics
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point streaming statistics accumulator.
+  @param[out]    S          points to an instance of the floating-point accumulator structure
+  @return        none
+ */
+void arm_stats_accum_init_f32(
+  arm_stats_accum_instance_f32 * S)
+{
+  S->count = 0U;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->min = 0.0f;
+  S->max = 0.0f;
+  S->minIndex = 0U;
+  S->maxIndex = 0U;
+}
+
+/**
+  @} end of StatsAccum group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_merge_f32.c
+ * Description:  Merge of two floating-point streaming statistics accumulators
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/**
+  @brief         Merges two floating-point streaming statistics accumulators.
+  @param[in,out] S          points to the accumulator receiving the merged statistics
+  @param[in]     pOther     points to the accumulator to merge into S
+  @return        none
+
+  @par           Details
+                   The samples of pOther are considered to follow the samples of S
+                   in the stream: the positions of the extrema of pOther are offset
+                   by the number of samples of S.
+ */
+void arm_stats_accum_merge_f32(
+        arm_stats_accum_instance_f32 * S,
+  const arm_stats_accum_instance_f32 * pOther)
+{
+  float32_t nA, nB, n;                           /* Number of samples as floats */
+  float32_t delta;                               /* Difference of the means */
+
+  if (pOther->count == 0U)
+  {
+    return;
+  }
+
+  if (S->count == 0U)
+  {
+    *S = *pOther;
+    return;
+  }
+
+  nA = (float32_t) S->count;
+  nB = (float32_t) pOther->count;
+  n = nA + nB;
+
+  delta = pOther->mean - S->mean;
+
+  S->mean += delta * (nB / n);
+  S->m2 += pOther->m2 + delta * delta * (nA * (nB / n));
+
+  /* Ties keep the first position in the stream */
+  if (pOther->min < S->min)
+  {
+    S->min = pOther->min;
+    S->minIndex = S->count + pOther->minIndex;
+  }
+
+  if (pOther->max > S->max)
+  {
+    S->max = pOther->max;
+    S->maxIndex = S->count + pOther->maxIndex;
+  }
+
+  S->count += pOther->count;
+}
+
+/**
+  @} end of StatsAccum group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_merge_q31.c
+ * Description:  Merge of two Q31 streaming statistics accumulators
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/* Product of two values in 2.31 format, truncated to 31 fractional bits */
+static q63_t arm_stats_accum_mult_q31(q63_t a, q63_t b)
+{
+  return (((q63_t) (q31_t) (a >> 1) * (q31_t) (b >> 1)) >> 29);
+}
+
+/**
+  @brief         Merges two Q31 streaming statistics accumulators.
+  @param[in,out] S          points to the accumulator receiving the merged statistics
+  @param[in]     pOther     points to the accumulator to merge into S
+  @return        none
+
+  @par           Details
+                   The samples of pOther are considered to follow the samples of S
+                   in the stream: the positions of the extrema of pOther are offset
+                   by the number of samples of S.
+                   The sums of pOther are moved to the reference value of S.
+                   It is exact when both accumulators have the same reference value.
+
+  @par           Scaling and Overflow Behavior
+                   There is no saturation. The merged accumulator has the same limit on
+                   the number of samples as arm_stats_accum_q31.
+ */
+void arm_stats_accum_merge_q31(
+        arm_stats_accum_instance_q31 * S,
+  const arm_stats_accum_instance_q31 * pOther)
+{
+  q63_t delta;                                   /* Difference of the reference values */
+  q63_t nB;                                      /* Number of samples of pOther */
+  q63_t meanB;                                   /* Mean of the shifted samples of pOther */
+  q63_t rem;                                     /* Remainder of the mean division */
+
+  if (pOther->count == 0U)
+  {
+    return;
+  }
+
+  if (S->count == 0U)
+  {
+    *S = *pOther;
+    return;
+  }
+
+  S->sum += pOther->sum;
+  S->sumOfSquares += pOther->sumOfSquares;
+
+  delta = (q63_t) pOther->shift - S->shift;
+  if (delta != 0)
+  {
+    /*
+     * sum((x - shiftA)^2) = sum((x - shiftB)^2) + 2 * delta * sum(x - shiftB) + nB * delta^2
+     * The sum of pOther is split into nB * meanB + rem so that all the
+     * products are between values in 2.31 format.
+     */
+    nB = (q63_t) pOther->count;
+    meanB = pOther->sum / nB;
+    rem = pOther->sum - meanB * nB;
+
+    S->sumOfSquares += nB * (2 * arm_stats_accum_mult_q31(delta, meanB)
+                             + arm_stats_accum_mult_q31(delta, delta))
+                     + 2 * arm_stats_accum_mult_q31(delta, rem);
+    S->sum += nB * delta;
+  }
+
+  /* Ties keep the first position in the stream */
+  if (pOther->min < S->min)
+  {
+    S->min = pOther->min;
+    S->minIndex = S->count + pOther->minIndex;
+  }
+
+  if (pOther->max > S->max)
+  {
+    S->max = pOther->max;
+    S->maxIndex = S->count + pOther->maxIndex;
+  }
+
+  S->count += pOther->count;
+}
+
+/**
+  @} end of StatsAccum group
+ */
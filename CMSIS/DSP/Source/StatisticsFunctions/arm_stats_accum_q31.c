@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_q31.c
+ * Description:  Streaming statistics of a Q31 vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/**
+  @brief         Accumulates a block of Q31 samples.
+  @param[in,out] S          points to an instance of the Q31 accumulator structure
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The first sample of the stream is subtracted from all the samples, which
+                   gives values in 2.31 format. They are accumulated in a 33.31 sum.
+                   Their squares are computed with one bit of precision lost on each operand
+                   and truncated to 31 fractional bits before being accumulated in 33.31 format.
+                   There is no saturation on intermediate additions.
+                   A squared deviation is at most 2^33 in 33.31 format, so the sum of squares
+                   can hold 2^30 - 1 samples whatever their values. When the deviations from
+                   the first sample of the stream are bounded by |deviation| in 2.31 format,
+                   it can hold about 2^32 / deviation^2 samples.
+                   The accumulator must not receive more samples: the results are undefined
+                   after an overflow.
+ */
+void arm_stats_accum_q31(
+        arm_stats_accum_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        arm_stats_accum_instance_q31 block;            /* Statistics of the block */
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t i = 0U;                               /* Position in the block */
+        q31_t shift, in, half;
+        q63_t dev;                                     /* Deviation from the shift in 2.31 format */
+        q63_t sum = 0, sumOfSquares = 0;
+        q31_t minVal, maxVal;
+        uint32_t minIdx = 0U, maxIdx = 0U;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  shift = (S->count > 0U) ? S->shift : pSrc[0];
+  minVal = pSrc[0];
+  maxVal = pSrc[0];
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 samples at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i;
+    }
+
+    dev = (q63_t) in - shift;
+    sum += dev;
+    half = (q31_t) (dev >> 1);
+    sumOfSquares += ((q63_t) half * half) >> 29;
+
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i + 1U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i + 1U;
+    }
+
+    dev = (q63_t) in - shift;
+    sum += dev;
+    half = (q31_t) (dev >> 1);
+    sumOfSquares += ((q63_t) half * half) >> 29;
+
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i + 2U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i + 2U;
+    }
+
+    dev = (q63_t) in - shift;
+    sum += dev;
+    half = (q31_t) (dev >> 1);
+    sumOfSquares += ((q63_t) half * half) >> 29;
+
+    in = *pSrc++;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i + 3U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i + 3U;
+    }
+
+    dev = (q63_t) in - shift;
+    sum += dev;
+    half = (q31_t) (dev >> 1);
+    sumOfSquares += ((q63_t) half * half) >> 29;
+
+    i += 4U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining samples */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Strict comparisons keep the first position */
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = i;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = i;
+    }
+
+    /* The deviation is in 2.31 format so it is halved before being squared */
+    dev = (q63_t) in - shift;
+    sum += dev;
+    half = (q31_t) (dev >> 1);
+    sumOfSquares += ((q63_t) half * half) >> 29;
+
+    i++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  block.count = blockSize;
+  block.shift = shift;
+  block.sum = sum;
+  block.sumOfSquares = sumOfSquares;
+  block.min = minVal;
+  block.max = maxVal;
+  block.minIndex = minIdx;
+  block.maxIndex = maxIdx;
+
+  arm_stats_accum_merge_q31(S, &block);
+}
+
+/**
+  @} end of StatsAccum group
+ */
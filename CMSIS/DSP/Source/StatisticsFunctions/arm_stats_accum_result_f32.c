@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_result_f32.c
+ * Description:  Statistics of a floating-point streaming statistics accumulator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/**
+  @brief         Statistics of a floating-point streaming statistics accumulator.
+  @param[in]     S          points to an instance of the floating-point accumulator structure
+  @param[out]    pMean      mean value returned here
+  @param[out]    pVar       variance value returned here
+  @param[out]    pStd       standard deviation value returned here
+  @param[out]    pRms       root mean square value returned here
+  @return        none
+
+  @par           Details
+                   The minimum and maximum, and their positions, are available in
+                   the accumulator structure.
+ */
+void arm_stats_accum_result_f32(
+  const arm_stats_accum_instance_f32 * S,
+        float32_t * pMean,
+        float32_t * pVar,
+        float32_t * pStd,
+        float32_t * pRms)
+{
+  float32_t n;                                   /* Number of samples as float */
+  float32_t var;                                 /* Variance */
+  float32_t meanOfSquares;                       /* Mean of the squared samples */
+
+  if (S->count == 0U)
+  {
+    *pMean = 0.0f;
+    *pVar = 0.0f;
+    *pStd = 0.0f;
+    *pRms = 0.0f;
+    return;
+  }
+
+  n = (float32_t) S->count;
+
+  var = (S->count > 1U) ? S->m2 / (n - 1.0f) : 0.0f;
+  meanOfSquares = S->m2 / n + S->mean * S->mean;
+
+  *pMean = S->mean;
+  *pVar = var;
+  arm_sqrt_f32(var, pStd);
+  arm_sqrt_f32(meanOfSquares, pRms);
+}
+
+/**
+  @} end of StatsAccum group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accum_result_q15.c
+ * Description:  Statistics of a Q15 streaming statistics accumulator
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsAccum
+  @{
+ */
+
+/**
+  @brief         Statistics of a Q15 streaming statistics accumulator.
+  @param[in]     S          points to an instance of the Q15 accumulator structure
+  @param[out]    pMean      mean value returned here
+  @param[out]    pVar       variance value returned here
+  @param[out]    pStd       standard deviation value returned here
+  @param[out]    pRms       root mean square value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The mean of the shifted samples is computed in 2.30 format.
+                   The variance and mean of squares are computed in 3.30 format and
+                   truncated to 1.15 format with saturation.
+
+  @par           Details
+                   The minimum and maximum, and their positions, are available in
+                   the accumulator structure.
+ */
+void arm_stats_accum_result_q15(
+  const arm_stats_accum_instance_q15 * S,
+        q15_t * pMean,
+        q15_t * pVar,
+        q15_t * pStd,
+        q15_t * pRms)
+{
+  q63_t n;                                       /* Number of samples */
+  q63_t meanDev;                                 /* Mean of the shifted samples in 2.30 format */
+  q63_t mean;                                    /* Mean in 2.30 format */
+  q63_t varPop;                                  /* Variance with a n normalization */
+  q63_t var;                                     /* Variance with a (n - 1) normalization */
+
+  if (S->count == 0U)
+  {
+    *pMean = 0;
+    *pVar = 0;
+    *pStd = 0;
+    *pRms = 0;
+    return;
+  }
+
+  n = (q63_t) S->count;
+
+  meanDev = (S->sum << 15) / n;
+  mean = ((q63_t) S->shift << 15) + meanDev;
+
+  /* Mean of the squared deviations minus the squared mean deviation */
+  varPop = S->sumOfSquares / n - ((meanDev * meanDev) >> 30);
+  if (varPop < 0)
+  {
+    varPop = 0;
+  }
+
+  var = (n > 1) ? varPop + varPop / (n - 1) : 0;
+
+  *pMean = (q15_t) __SSAT((q31_t) (mean >> 15), 16);
+  *pVar = (q15_t) __SSAT((q31_t) (var >> 15), 16);
+  arm_sqrt_q15(*pVar, pStd);
+  arm_sqrt_q15((q15_t) __SSAT((q31_t) ((varPop + ((mean * mean) >> 30)) >> 15), 16), pRms);
+}
+
+/**
+  @} end of StatsAccum group
+ */
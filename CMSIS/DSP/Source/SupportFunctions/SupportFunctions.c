@@ -26,27 +26,55 @@
  * limitations under the License.
  */
 
+#include "arm_argsort_f32.c"
+#include "arm_argsort_init_f32.c"
 #include "arm_barycenter_f32.c"
 #include "arm_bitonic_sort_f32.c"
 #include "arm_bubble_sort_f32.c"
+#include "arm_cmplx_merge_f32.c"
+#include "arm_cmplx_merge_q15.c"
+#include "arm_cmplx_merge_q31.c"
+#include "arm_cmplx_split_f32.c"
+#include "arm_cmplx_split_q15.c"
+#include "arm_cmplx_split_q31.c"
 #include "arm_copy_f32.c"
 #include "arm_copy_q15.c"
 #include "arm_copy_q31.c"
 #include "arm_copy_q7.c"
+#include "arm_deinterleave_f32.c"
+#include "arm_deinterleave_q15.c"
+#include "arm_deinterleave_q31.c"
 #include "arm_fill_f32.c"
 #include "arm_fill_q15.c"
 #include "arm_fill_q31.c"
 #include "arm_fill_q7.c"
 #include "arm_heap_sort_f32.c"
 #include "arm_insertion_sort_f32.c"
+#include "arm_interleave_f32.c"
+#include "arm_interleave_q15.c"
+#include "arm_interleave_q31.c"
 #include "arm_merge_sort_f32.c"
 #include "arm_merge_sort_init_f32.c"
 #include "arm_quick_sort_f32.c"
+#include "arm_radix_sort_f32.c"
 #include "arm_selection_sort_f32.c"
 #include "arm_sort_f32.c"
 #include "arm_sort_init_f32.c"
+#include "arm_topk_f32.c"
 #include "arm_weighted_sum_f32.c"
 
+#include "arm_convert_affine_f32_q15.c"
+#include "arm_convert_affine_f32_q31.c"
+#include "arm_convert_affine_f32_q7.c"
+#include "arm_convert_affine_q15_f32.c"
+#include "arm_convert_affine_q15_q31.c"
+#include "arm_convert_affine_q15_q7.c"
+#include "arm_convert_affine_q31_f32.c"
+#include "arm_convert_affine_q31_q15.c"
+#include "arm_convert_affine_q31_q7.c"
+#include "arm_convert_affine_q7_f32.c"
+#include "arm_convert_affine_q7_q15.c"
+#include "arm_convert_affine_q7_q31.c"
 #include "arm_float_to_q15.c"
 #include "arm_float_to_q31.c"
 #include "arm_float_to_q7.c"
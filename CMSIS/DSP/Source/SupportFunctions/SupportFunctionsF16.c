@@ -34,3 +34,11 @@
 #include "arm_float_to_f16.c"
 #include "arm_weighted_sum_f16.c"
 #include "arm_barycenter_f16.c"
+#include "arm_convert_affine_f16_f32.c"
+#include "arm_convert_affine_f16_q15.c"
+#include "arm_convert_affine_f16_q31.c"
+#include "arm_convert_affine_f16_q7.c"
+#include "arm_convert_affine_f32_f16.c"
+#include "arm_convert_affine_q15_f16.c"
+#include "arm_convert_affine_q31_f16.c"
+#include "arm_convert_affine_q7_f16.c"
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_argsort_f32.c
+ * Description:  Floating point argsort
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  S          points to an instance of the argsort structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               The argsort computes the permutation which sorts the input:
+   *               pSrc[pIndex[0]], pSrc[pIndex[1]], ... is sorted. The input
+   *               is not modified.
+   *
+   * @par          The values are mapped to unsigned keys having the same order
+   *               and sorted with a least significant digit radix sort on 8-bit
+   *               digits. The number of operations is O(n) and does not depend
+   *               on the order of the input. The passes on digits which are
+   *               identical for all the keys are skipped.
+   *
+   * @par          The sort is stable: the indices of equal values are in
+   *               increasing order, for both directions.
+   *
+   * @par          A work array of 3 * blockSize words is needed. It must be
+   *               allocated by the user and linked to the instance at
+   *               initialization time.
+   */
+void arm_argsort_f32(
+  const arm_argsort_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t * pIndex,
+        uint32_t blockSize)
+{
+    uint32_t pCount[256];
+    uint32_t *pKeyA = S->buffer;
+    uint32_t *pKeyB = S->buffer + blockSize;
+    uint32_t *pIdxA = pIndex;
+    uint32_t *pIdxB = S->buffer + 2U * blockSize;
+    uint32_t *pTmp;
+    uint32_t i, b, d, sum, shift, u;
+
+    if (blockSize == 0U)
+    {
+        return;
+    }
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        memcpy(&u, &pSrc[i], sizeof(uint32_t));
+
+        /* Unsigned key with the same order as the float */
+        u = (u & 0x80000000U) ? ~u : (u | 0x80000000U);
+
+        pKeyA[i] = (S->dir == ARM_SORT_DESCENDING) ? ~u : u;
+        pIdxA[i] = i;
+    }
+
+    for (shift = 0U; shift < 32U; shift += 8U)
+    {
+        for (b = 0U; b < 256U; b++)
+        {
+            pCount[b] = 0U;
+        }
+
+        for (i = 0U; i < blockSize; i++)
+        {
+            pCount[(pKeyA[i] >> shift) & 0xFFU]++;
+        }
+
+        /* Nothing to do when all the keys have the same digit */
+        if (pCount[(pKeyA[0] >> shift) & 0xFFU] == blockSize)
+        {
+            continue;
+        }
+
+        sum = 0U;
+        for (b = 0U; b < 256U; b++)
+        {
+            d = pCount[b];
+            pCount[b] = sum;
+            sum += d;
+        }
+
+        /* Stable scatter in the other buffers */
+        for (i = 0U; i < blockSize; i++)
+        {
+            d = (pKeyA[i] >> shift) & 0xFFU;
+            pKeyB[pCount[d]] = pKeyA[i];
+            pIdxB[pCount[d]] = pIdxA[i];
+            pCount[d]++;
+        }
+
+        pTmp = pKeyA; pKeyA = pKeyB; pKeyB = pTmp;
+        pTmp = pIdxA; pIdxA = pIdxB; pIdxB = pTmp;
+    }
+
+    if (pIdxA != pIndex)
+    {
+        memcpy(pIndex, pIdxA, blockSize * sizeof(uint32_t));
+    }
+}
+
+/**
+  @} end of Sorting group
+ */
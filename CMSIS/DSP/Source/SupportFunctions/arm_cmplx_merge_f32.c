@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_merge_f32.c
+ * Description:  Merges real and imaginary parts into a floating-point complex vector
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief         Merges real and imaginary parts into a floating-point complex vector.
+  @param[in]     pReal      points to the real part input vector
+  @param[in]     pImag      points to the imaginary part input vector
+  @param[out]    pDst       points to the complex output vector
+  @param[in]     numSamples number of complex samples in the output vector
+  @return        none
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_cmplx_merge_f32(
+  const float32_t * pReal,
+  const float32_t * pImag,
+        float32_t * pDst,
+        uint32_t numSamples)
+{
+    uint32_t        blkCnt;                        /* Loop counter */
+    f32x4x2_t       vecOut;
+
+    blkCnt = numSamples >> 2;
+    while (blkCnt > 0U)
+    {
+        vecOut.val[0] = vld1q(pReal);
+        vecOut.val[1] = vld1q(pImag);
+        /* Interleaving store */
+        vst2q(pDst, vecOut);
+
+        pReal += 4;
+        pImag += 4;
+        pDst += 8;
+        blkCnt--;
+    }
+
+    blkCnt = numSamples & 3;
+    while (blkCnt > 0U)
+    {
+        *pDst++ = *pReal++;
+        *pDst++ = *pImag++;
+        blkCnt--;
+    }
+}
+#else
+void arm_cmplx_merge_f32(
+  const float32_t * pReal,
+  const float32_t * pImag,
+        float32_t * pDst,
+        uint32_t numSamples)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = numSamples >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C[2 * n] = A[n], C[2 * n + 1] = B[n] */
+    *pDst++ = *pReal++;
+    *pDst++ = *pImag++;
+
+    *pDst++ = *pReal++;
+    *pDst++ = *pImag++;
+
+    *pDst++ = *pReal++;
+    *pDst++ = *pImag++;
+
+    *pDst++ = *pReal++;
+    *pDst++ = *pImag++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[2 * n] = A[n], C[2 * n + 1] = B[n] */
+    *pDst++ = *pReal++;
+    *pDst++ = *pImag++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of cmplx_split group
+ */
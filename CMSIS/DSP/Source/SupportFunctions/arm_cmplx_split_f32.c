@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_split_f32.c
+ * Description:  Splits a floating-point complex vector into real and imaginary parts
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup cmplx_split Complex Split and Merge
+
+  Converts between an interleaved complex vector and separate vectors for
+  the real and imaginary parts.
+
+  A complex vector is stored as (real, imag, real, imag, ...) as for the other
+  functions of the library. Some processing is simpler on the separate parts,
+  for instance when only the real part is filtered.
+  <pre>
+      pReal[n] = pSrc[(2*n)+0];
+      pImag[n] = pSrc[(2*n)+1];
+  </pre>
+  On Helium, the functions use the structure loads and stores (VLD2/VST2).
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief         Splits a floating-point complex vector into its real and imaginary parts.
+  @param[in]     pSrc       points to the complex input vector
+  @param[out]    pReal      points to the real part output vector
+  @param[out]    pImag      points to the imaginary part output vector
+  @param[in]     numSamples number of complex samples in the input vector
+  @return        none
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_cmplx_split_f32(
+  const float32_t * pSrc,
+        float32_t * pReal,
+        float32_t * pImag,
+        uint32_t numSamples)
+{
+    uint32_t        blkCnt;                        /* Loop counter */
+    f32x4x2_t       vecIn;
+
+    blkCnt = numSamples >> 2;
+    while (blkCnt > 0U)
+    {
+        /* De-interleaving load */
+        vecIn = vld2q(pSrc);
+        vst1q(pReal, vecIn.val[0]);
+        vst1q(pImag, vecIn.val[1]);
+
+        pSrc += 8;
+        pReal += 4;
+        pImag += 4;
+        blkCnt--;
+    }
+
+    blkCnt = numSamples & 3;
+    while (blkCnt > 0U)
+    {
+        *pReal++ = *pSrc++;
+        *pImag++ = *pSrc++;
+        blkCnt--;
+    }
+}
+#else
+void arm_cmplx_split_f32(
+  const float32_t * pSrc,
+        float32_t * pReal,
+        float32_t * pImag,
+        uint32_t numSamples)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = numSamples >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C[n] = A[2 * n], D[n] = A[2 * n + 1] */
+    *pReal++ = *pSrc++;
+    *pImag++ = *pSrc++;
+
+    *pReal++ = *pSrc++;
+    *pImag++ = *pSrc++;
+
+    *pReal++ = *pSrc++;
+    *pImag++ = *pSrc++;
+
+    *pReal++ = *pSrc++;
+    *pImag++ = *pSrc++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C[n] = A[2 * n], D[n] = A[2 * n + 1] */
+    *pReal++ = *pSrc++;
+    *pImag++ = *pSrc++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of cmplx_split group
+ */
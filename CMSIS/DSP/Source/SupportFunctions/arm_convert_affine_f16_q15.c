@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_f16_q15.c
+ * Description:  Converts a f16 vector to Q15 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/*
+ * Saturation done on the float value: converting a float which is
+ * outside of the range of the integer type is undefined in C.
+ */
+__STATIC_FORCEINLINE q15_t arm_convert_affine_sat_q15(float32_t in)
+{
+  in = (in < -32768.0f) ? -32768.0f : in;
+  in = (in > 32767.0f) ? 32767.0f : in;
+
+  return ((q15_t) in);
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a f16 vector to a Q15 vector with a scale and an offset.
+  @param[in]     pSrc       points to the f16 input vector
+  @param[in]     scale      scale factor
+  @param[in]     offset     offset added after the scaling
+  @param[out]    pDst       points to the Q15 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (q15_t)((pSrc[n] * scale + offset) * 32768);   0 <= n < blockSize.
+  </pre>
+                   The computation is done in single precision.
+
+  @par           Scaling and Overflow Behavior
+                   The function uses saturating arithmetic.
+                   Results outside of the allowable Q15 range [0x8000 0x7FFF] are saturated.
+
+  @note
+                   In order to apply rounding, the library should be rebuilt with the ROUNDING macro
+                   defined in the preprocessor section of project options.
+ */
+void arm_convert_affine_f16_q15(
+  const float16_t * pSrc,
+        float16_t scale,
+        float16_t offset,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t k = (float32_t) scale * 32768.0f;    /* Scale including the Q15 conversion */
+        float32_t o = (float32_t) offset * 32768.0f;   /* Offset in Q15 */
+        float32_t in;
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    in = (float32_t) *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q15(in);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_f32_f16.c
+ * Description:  Converts a floating-point vector to f16 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a floating-point vector to a f16 vector with a scale and an offset.
+  @param[in]     pSrc       points to the floating-point input vector
+  @param[in]     scale      scale factor
+  @param[in]     offset     offset added after the scaling
+  @param[out]    pDst       points to the f16 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (float16_t)(pSrc[n] * scale + offset);   0 <= n < blockSize.
+  </pre>
+                   The computation is done in single precision.
+
+  @par           Scaling and Overflow Behavior
+                   Results outside of the f16 range are saturated to the largest
+                   finite f16 values instead of being converted to infinity.
+ */
+void arm_convert_affine_f32_f16(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t in;
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    in = *pSrc++ * scale + offset;
+    in = (in > (float32_t) F16_MAX) ? (float32_t) F16_MAX : in;
+    in = (in < (float32_t) F16_MIN) ? (float32_t) F16_MIN : in;
+    *pDst++ = (float16_t) in;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_f32_q15.c
+ * Description:  Converts a floating-point vector to Q15 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/*
+ * Saturation done on the float value: converting a float which is
+ * outside of the range of the integer type is undefined in C.
+ */
+__STATIC_FORCEINLINE q15_t arm_convert_affine_sat_q15(float32_t in)
+{
+  in = (in < -32768.0f) ? -32768.0f : in;
+  in = (in > 32767.0f) ? 32767.0f : in;
+
+  return ((q15_t) in);
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a floating-point vector to a Q15 vector with a scale and an offset.
+  @param[in]     pSrc       points to the floating-point input vector
+  @param[in]     scale      scale factor
+  @param[in]     offset     offset added after the scaling
+  @param[out]    pDst       points to the Q15 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (q15_t)((pSrc[n] * scale + offset) * 32768);   0 <= n < blockSize.
+  </pre>
+
+  @par           Scaling and Overflow Behavior
+                   The function uses saturating arithmetic.
+                   Results outside of the allowable Q15 range [0x8000 0x7FFF] are saturated,
+                   so there is no need to clip the input.
+
+  @note
+                   In order to apply rounding in scalar version, the library should be rebuilt with the ROUNDING macro
+                   defined in the preprocessor section of project options.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_convert_affine_f32_q15(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+    uint32_t        blkCnt;                        /* Loop counter */
+    float32_t       k = scale * 32768.0f;          /* Scale including the Q15 conversion */
+    float32_t       o = offset * 32768.0f;         /* Offset in Q15 */
+    f32x4_t         vecOffset = vdupq_n_f32(o);
+    f32x4x2_t       tmp;
+    q15x8_t         vecDst;
+    float32_t       in;
+
+    blkCnt = blockSize >> 3;
+    while (blkCnt > 0U)
+    {
+        /* C = (A * scale + offset) * 32768 */
+        tmp = vld2q(pSrc);
+
+        tmp.val[0] = vfmaq(vecOffset, tmp.val[0], k);
+        tmp.val[1] = vfmaq(vecOffset, tmp.val[1], k);
+
+        /* Narrowing with saturation */
+        vecDst = vqmovnbq(vecDst, vcvtaq_s32_f32(tmp.val[0]));
+        vecDst = vqmovntq(vecDst, vcvtaq_s32_f32(tmp.val[1]));
+        vst1q(pDst, vecDst);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+        pDst += 8;
+        pSrc += 8;
+    }
+
+    blkCnt = blockSize & 7;
+    while (blkCnt > 0U)
+    {
+      /* C = (A * scale + offset) * 32768 */
+      in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+      in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+      *pDst++ = arm_convert_affine_sat_q15(in);
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+}
+#else
+void arm_convert_affine_f32_q15(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t k = scale * 32768.0f;                /* Scale including the Q15 conversion */
+        float32_t o = offset * 32768.0f;               /* Offset in Q15 */
+        float32_t in;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A * scale + offset) * 32768 */
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q15(in);
+
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q15(in);
+
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q15(in);
+
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q15(in);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A * scale + offset) * 32768 */
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q15(in);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of convert_affine group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_f32_q31.c
+ * Description:  Converts a floating-point vector to Q31 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/*
+ * Saturation done on the float value: converting a float which is
+ * outside of the range of the integer type is undefined in C.
+ * 0x7FFFFFFF is not a float so the upper bound is 2^31, which is then
+ * saturated by clip_q63_to_q31.
+ */
+__STATIC_FORCEINLINE q31_t arm_convert_affine_sat_q31(float32_t in)
+{
+  in = (in < -2147483648.0f) ? -2147483648.0f : in;
+  in = (in > 2147483648.0f) ? 2147483648.0f : in;
+
+  return (clip_q63_to_q31((q63_t) in));
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a floating-point vector to a Q31 vector with a scale and an offset.
+  @param[in]     pSrc       points to the floating-point input vector
+  @param[in]     scale      scale factor
+  @param[in]     offset     offset added after the scaling
+  @param[out]    pDst       points to the Q31 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (q31_t)((pSrc[n] * scale + offset) * 2147483648);   0 <= n < blockSize.
+  </pre>
+
+  @par           Scaling and Overflow Behavior
+                   The function uses saturating arithmetic.
+                   Results outside of the allowable Q31 range [0x80000000 0x7FFFFFFF] are saturated,
+                   so there is no need to clip the input.
+
+  @note
+                   In order to apply rounding, the library should be rebuilt with the ROUNDING macro
+                   defined in the preprocessor section of project options.
+ */
+void arm_convert_affine_f32_q31(
+  const float32_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t k = scale * 2147483648.0f;           /* Scale including the Q31 conversion */
+        float32_t o = offset * 2147483648.0f;          /* Offset in Q31 */
+        float32_t in;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A * scale + offset) * 2147483648 */
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q31(in);
+
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q31(in);
+
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q31(in);
+
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q31(in);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A * scale + offset) * 2147483648 */
+    in = *pSrc++ * k + o;
+#ifdef ARM_MATH_ROUNDING
+    in += in > 0.0f ? 0.5f : -0.5f;
+#endif /* #ifdef ARM_MATH_ROUNDING */
+    *pDst++ = arm_convert_affine_sat_q31(in);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_q15_f16.c
+ * Description:  Converts a Q15 vector to f16 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a Q15 vector to a f16 vector with a scale and an offset.
+  @param[in]     pSrc       points to the Q15 input vector
+  @param[in]     scale      scale factor
+  @param[in]     offset     offset added after the scaling
+  @param[out]    pDst       points to the f16 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (float16_t)((float32_t) pSrc[n] / 32768 * scale + offset);   0 <= n < blockSize.
+  </pre>
+                   The computation is done in single precision.
+
+  @par           Scaling and Overflow Behavior
+                   Results outside of the f16 range are saturated to the largest
+                   finite f16 values instead of being converted to infinity.
+ */
+void arm_convert_affine_q15_f16(
+  const q15_t * pSrc,
+        float16_t scale,
+        float16_t offset,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t k = (float32_t) scale / 32768.0f;    /* Scale including the Q15 conversion */
+        float32_t o = (float32_t) offset;
+        float32_t in;
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    in = (float32_t) *pSrc++ * k + o;
+    in = (in > (float32_t) F16_MAX) ? (float32_t) F16_MAX : in;
+    in = (in < (float32_t) F16_MIN) ? (float32_t) F16_MIN : in;
+    *pDst++ = (float16_t) in;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
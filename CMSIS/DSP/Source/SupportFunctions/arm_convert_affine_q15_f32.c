@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_q15_f32.c
+ * Description:  Converts a Q15 vector to floating-point with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup convert_affine Fused Conversion with Scale and Offset
+
+  Converts a vector to another format and applies a scale and an offset
+  in the same pass:
+  <pre>
+      pDst[n] = saturate(pSrc[n] * scale + offset);   0 <= n < blockSize.
+  </pre>
+  The values are the real values represented by the samples, so that
+  for a Q15 to floating-point conversion with a scale of 1 and an offset
+  of 0 the result is the same as \ref arm_q15_to_float.
+
+  These functions replace a sequence like a format conversion followed
+  by \ref arm_scale_f32 and \ref arm_offset_f32, or a clipping followed by a
+  format conversion. Each sample is read and written once instead of once
+  per pass, which matters when the processing is limited by the memory
+  bandwidth.
+
+  When the destination is in fixed-point, the result is saturated to the
+  range of the destination format. For the fixed-point to fixed-point
+  conversions, the scale is given as a fractional part and a shift as in
+  \ref arm_scale_q15 and the offset is in the destination format. For the
+  conversions involving floating-point formats, the scale and offset are
+  floating-point values.
+
+  The function names are arm_convert_affine_<source format>_<destination format>.
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a Q15 vector to a floating-point vector with a scale and an offset.
+  @param[in]     pSrc       points to the Q15 input vector
+  @param[in]     scale      scale factor
+  @param[in]     offset     offset added after the scaling
+  @param[out]    pDst       points to the floating-point output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The equation used for the conversion process is:
+  <pre>
+      pDst[n] = (float32_t) pSrc[n] / 32768 * scale + offset;   0 <= n < blockSize.
+  </pre>
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_convert_affine_q15_f32(
+  const q15_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+  float32_t k = scale / 32768.0f;                      /* Scale including the Q15 conversion */
+  q31x4_t vecIn;
+  f32x4_t vecOffset = vdupq_n_f32(offset);
+
+  blkCnt = blockSize >> 2;
+  while (blkCnt > 0U)
+  {
+      /* C = (float32_t) A / 32768 * scale + offset */
+      vecIn = vldrhq_s32(pSrc);
+      pSrc += 4;
+      vstrwq(pDst, vfmaq(vecOffset, vcvtq_f32_s32(vecIn), k));
+      pDst += 4;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+  }
+
+  blkCnt = blockSize & 3;
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 32768 * scale + offset */
+    *pDst++ = (float32_t) *pSrc++ * k + offset;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+#else
+void arm_convert_affine_q15_f32(
+  const q15_t * pSrc,
+        float32_t scale,
+        float32_t offset,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t k = scale / 32768.0f;                /* Scale including the Q15 conversion */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 32768 * scale + offset */
+    *pDst++ = (float32_t) *pSrc++ * k + offset;
+    *pDst++ = (float32_t) *pSrc++ * k + offset;
+    *pDst++ = (float32_t) *pSrc++ * k + offset;
+    *pDst++ = (float32_t) *pSrc++ * k + offset;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 32768 * scale + offset */
+    *pDst++ = (float32_t) *pSrc++ * k + offset;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of convert_affine group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_q15_q31.c
+ * Description:  Converts a Q15 vector to Q31 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/*
+ * Left shift of the product. It is done on the unsigned representation
+ * since shifting a negative value to the left is undefined in C.
+ * The product is at most 2^30 in magnitude, so the shifted value is
+ * still in range for a shift of at most 31.
+ */
+__STATIC_FORCEINLINE q63_t arm_convert_affine_lsl_q63(q63_t x, int32_t lShift)
+{
+  return ((q63_t) ((uint64_t) x << lShift));
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a Q15 vector to a Q31 vector with a scale and an offset.
+  @param[in]     pSrc       points to the Q15 input vector
+  @param[in]     scaleFract fractional portion of the scale factor in Q15 format
+  @param[in]     shift      number of bits to shift the result by
+  @param[in]     offset     offset in Q31 format added after the scaling
+  @param[out]    pDst       points to the Q31 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The scale is scaleFract * 2^shift as in \ref arm_scale_q15.
+                   The result is truncated to the Q31 format before the offset is added.
+                   The shift must be between -1 and 31. Larger shifts saturate all the
+                   nonzero results.
+
+  @par           Scaling and Overflow Behavior
+                   The product is computed with 64-bit precision and the result is saturated.
+                   Results outside of the allowable Q31 range [0x80000000 0x7FFFFFFF] are saturated.
+ */
+void arm_convert_affine_q15_q31(
+  const q15_t * pSrc,
+        q15_t scaleFract,
+        int8_t shift,
+        q31_t offset,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        int32_t lShift = 1 + shift;                    /* Left shift of the product */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = clip_q63_to_q31(arm_convert_affine_lsl_q63((q63_t) *pSrc++ * scaleFract, lShift) + offset);
+    *pDst++ = clip_q63_to_q31(arm_convert_affine_lsl_q63((q63_t) *pSrc++ * scaleFract, lShift) + offset);
+    *pDst++ = clip_q63_to_q31(arm_convert_affine_lsl_q63((q63_t) *pSrc++ * scaleFract, lShift) + offset);
+    *pDst++ = clip_q63_to_q31(arm_convert_affine_lsl_q63((q63_t) *pSrc++ * scaleFract, lShift) + offset);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = clip_q63_to_q31(arm_convert_affine_lsl_q63((q63_t) *pSrc++ * scaleFract, lShift) + offset);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
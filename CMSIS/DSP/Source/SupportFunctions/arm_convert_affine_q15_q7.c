@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_q15_q7.c
+ * Description:  Converts a Q15 vector to Q7 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a Q15 vector to a Q7 vector with a scale and an offset.
+  @param[in]     pSrc       points to the Q15 input vector
+  @param[in]     scaleFract fractional portion of the scale factor in Q15 format
+  @param[in]     shift      number of bits to shift the result by
+  @param[in]     offset     offset in Q7 format added after the scaling
+  @param[out]    pDst       points to the Q7 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The scale is scaleFract * 2^shift as in \ref arm_scale_q15.
+                   The result is truncated to the Q7 format before the offset is added.
+                   The shift must be lower than or equal to 23.
+                   Below -8, the right shift of the 32-bit product is limited to 31 bits
+                   so the scaled value is 0 or -1 before the offset is added.
+
+  @par           Scaling and Overflow Behavior
+                   The product is computed with 32-bit precision and the result is saturated.
+                   Results outside of the allowable Q7 range [0x80 0x7F] are saturated.
+ */
+void arm_convert_affine_q15_q7(
+  const q15_t * pSrc,
+        q15_t scaleFract,
+        int8_t shift,
+        q7_t offset,
+        q7_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        int32_t rShift = 23 - shift;                   /* Right shift of the product */
+
+  /* A shift by the width of the product or more is undefined */
+  if (rShift > 31)
+  {
+    rShift = 31;
+  }
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = (q7_t) __SSAT((((q31_t) *pSrc++ * scaleFract) >> rShift) + offset, 8);
+    *pDst++ = (q7_t) __SSAT((((q31_t) *pSrc++ * scaleFract) >> rShift) + offset, 8);
+    *pDst++ = (q7_t) __SSAT((((q31_t) *pSrc++ * scaleFract) >> rShift) + offset, 8);
+    *pDst++ = (q7_t) __SSAT((((q31_t) *pSrc++ * scaleFract) >> rShift) + offset, 8);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = (q7_t) __SSAT((((q31_t) *pSrc++ * scaleFract) >> rShift) + offset, 8);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
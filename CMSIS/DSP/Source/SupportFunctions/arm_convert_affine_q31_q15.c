@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_affine_q31_q15.c
+ * Description:  Converts a Q31 vector to Q15 with scale and offset
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup convert_affine
+  @{
+ */
+
+/**
+  @brief         Converts a Q31 vector to a Q15 vector with a scale and an offset.
+  @param[in]     pSrc       points to the Q31 input vector
+  @param[in]     scaleFract fractional portion of the scale factor in Q31 format
+  @param[in]     shift      number of bits to shift the result by
+  @param[in]     offset     offset in Q15 format added after the scaling
+  @param[out]    pDst       points to the Q15 output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The scale is scaleFract * 2^shift as in \ref arm_scale_q31.
+                   The result is truncated to the Q15 format before the offset is added.
+                   The shift must be lower than or equal to 47.
+                   Below -16, the right shift of the 64-bit product is limited to 63 bits
+                   so the scaled value is 0 or -1 before the offset is added.
+
+  @par           Scaling and Overflow Behavior
+                   The product is computed with 64-bit precision and the result is saturated.
+                   Results outside of the allowable Q15 range [0x8000 0x7FFF] are saturated.
+ */
+void arm_convert_affine_q31_q15(
+  const q31_t * pSrc,
+        q31_t scaleFract,
+        int8_t shift,
+        q15_t offset,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        int32_t rShift = 47 - shift;                   /* Right shift of the product */
+
+  /* A shift by the width of the product or more is undefined */
+  if (rShift > 63)
+  {
+    rShift = 63;
+  }
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = (q15_t) __SSAT(clip_q63_to_q31((((q63_t) *pSrc++ * scaleFract) >> rShift) + offset), 16);
+    *pDst++ = (q15_t) __SSAT(clip_q63_to_q31((((q63_t) *pSrc++ * scaleFract) >> rShift) + offset), 16);
+    *pDst++ = (q15_t) __SSAT(clip_q63_to_q31((((q63_t) *pSrc++ * scaleFract) >> rShift) + offset), 16);
+    *pDst++ = (q15_t) __SSAT(clip_q63_to_q31((((q63_t) *pSrc++ * scaleFract) >> rShift) + offset), 16);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale + offset */
+    *pDst++ = (q15_t) __SSAT(clip_q63_to_q31((((q63_t) *pSrc++ * scaleFract) >> rShift) + offset), 16);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of convert_affine group
+ */
@@ -0,0 +1,244 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_deinterleave_f32.c
+ * Description:  De-interleaves a floating-point multichannel buffer
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup interleave Vector Interleaving
+
+  Converts between interleaved and planar multichannel buffers.
+
+  An interleaved buffer holds blockSize frames of numChannels samples, as
+  produced by a stereo codec or a TDM interface:
+  <pre>
+      x0[0] x1[0] ... xN[0] x0[1] x1[1] ... xN[1] ...
+  </pre>
+  A planar buffer holds the numChannels channels one after the other, each
+  of them being a vector of blockSize samples which can be given to the
+  other functions of the library:
+  <pre>
+      x0[0] x0[1] ... x0[blockSize-1] x1[0] x1[1] ... x1[blockSize-1] ...
+  </pre>
+  The functions support any number of channels. On Helium, the 2 and 4 channel
+  cases use the structure loads and stores (VLD2/VLD4, VST2/VST4) and the other
+  channel counts use gather loads and scatter stores.
+
+  The source and destination buffers must not overlap.
+ */
+
+/**
+  @addtogroup interleave
+  @{
+ */
+
+/**
+  @brief         De-interleaves a floating-point multichannel buffer.
+  @param[in]     pSrc        points to the interleaved input buffer of blockSize frames
+  @param[in]     numChannels number of channels
+  @param[out]    pDst        points to the planar output buffer of numChannels vectors of blockSize samples
+  @param[in]     blockSize   number of samples in each channel
+  @return        none
+
+  @par           Details
+  <pre>
+      pDst[(ch * blockSize) + n] = pSrc[(n * numChannels) + ch];   0 <= n < blockSize, 0 <= ch < numChannels.
+  </pre>
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_deinterleave_f32(
+  const float32_t * pSrc,
+        uint32_t numChannels,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    uint32_t        blkCnt;                        /* Loop counter */
+    uint32_t        ch;                            /* Channel counter */
+    const float32_t     *pIn;                           /* Input pointer */
+
+    if (numChannels == 2U)
+    {
+        f32x4x2_t       vecIn;
+        float32_t       *pOut0 = pDst;
+        float32_t       *pOut1 = pDst + blockSize;
+
+        blkCnt = blockSize >> 2;
+        while (blkCnt > 0U)
+        {
+            /* De-interleaving load */
+            vecIn = vld2q(pSrc);
+            vst1q(pOut0, vecIn.val[0]);
+            vst1q(pOut1, vecIn.val[1]);
+
+            pSrc += 8;
+            pOut0 += 4;
+            pOut1 += 4;
+            blkCnt--;
+        }
+
+        blkCnt = blockSize & 3;
+        while (blkCnt > 0U)
+        {
+            *pOut0++ = *pSrc++;
+            *pOut1++ = *pSrc++;
+            blkCnt--;
+        }
+    }
+    else if (numChannels == 4U)
+    {
+        f32x4x4_t       vecIn;
+        float32_t       *pOut0 = pDst;
+        float32_t       *pOut1 = pDst + blockSize;
+        float32_t       *pOut2 = pDst + 2U * blockSize;
+        float32_t       *pOut3 = pDst + 3U * blockSize;
+
+        blkCnt = blockSize >> 2;
+        while (blkCnt > 0U)
+        {
+            /* De-interleaving load */
+            vecIn = vld4q(pSrc);
+            vst1q(pOut0, vecIn.val[0]);
+            vst1q(pOut1, vecIn.val[1]);
+            vst1q(pOut2, vecIn.val[2]);
+            vst1q(pOut3, vecIn.val[3]);
+
+            pSrc += 16;
+            pOut0 += 4;
+            pOut1 += 4;
+            pOut2 += 4;
+            pOut3 += 4;
+            blkCnt--;
+        }
+
+        blkCnt = blockSize & 3;
+        while (blkCnt > 0U)
+        {
+            *pOut0++ = *pSrc++;
+            *pOut1++ = *pSrc++;
+            *pOut2++ = *pSrc++;
+            *pOut3++ = *pSrc++;
+            blkCnt--;
+        }
+    }
+    else
+    {
+        /* Offsets of 4 consecutive frames */
+        uint32x4_t      vecOffs = vmulq_n_u32(vidupq_n_u32(0U, 1), numChannels);
+
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+            pIn = pSrc + ch;
+
+            blkCnt = blockSize >> 2;
+            while (blkCnt > 0U)
+            {
+                vst1q(pDst, vldrwq_gather_shifted_offset_f32(pIn, vecOffs));
+
+                pIn += 4U * numChannels;
+                pDst += 4;
+                blkCnt--;
+            }
+
+            blkCnt = blockSize & 3;
+            while (blkCnt > 0U)
+            {
+                *pDst++ = *pIn;
+                pIn += numChannels;
+                blkCnt--;
+            }
+        }
+    }
+}
+#else
+void arm_deinterleave_f32(
+  const float32_t * pSrc,
+        uint32_t numChannels,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t ch;                                   /* Channel counter */
+  const float32_t *pIn;                                /* Input pointer */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* C[ch][n] = A[n * numChannels + ch] */
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      /* C[ch][n] = A[n * numChannels + ch] */
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of interleave group
+ */
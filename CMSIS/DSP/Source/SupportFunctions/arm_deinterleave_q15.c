@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_deinterleave_q15.c
+ * Description:  De-interleaves a Q15 multichannel buffer
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup interleave
+  @{
+ */
+
+/**
+  @brief         De-interleaves a Q15 multichannel buffer.
+  @param[in]     pSrc        points to the interleaved input buffer of blockSize frames
+  @param[in]     numChannels number of channels
+  @param[out]    pDst        points to the planar output buffer of numChannels vectors of blockSize samples
+  @param[in]     blockSize   number of samples in each channel
+  @return        none
+
+  @par           Details
+  <pre>
+      pDst[(ch * blockSize) + n] = pSrc[(n * numChannels) + ch];   0 <= n < blockSize, 0 <= ch < numChannels.
+  </pre>
+ */
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_deinterleave_q15(
+  const q15_t * pSrc,
+        uint32_t numChannels,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+    uint32_t        blkCnt;                        /* Loop counter */
+    uint32_t        ch;                            /* Channel counter */
+    const q15_t     *pIn;                           /* Input pointer */
+
+    if (numChannels == 2U)
+    {
+        q15x8x2_t       vecIn;
+        q15_t       *pOut0 = pDst;
+        q15_t       *pOut1 = pDst + blockSize;
+
+        blkCnt = blockSize >> 3;
+        while (blkCnt > 0U)
+        {
+            /* De-interleaving load */
+            vecIn = vld2q(pSrc);
+            vst1q(pOut0, vecIn.val[0]);
+            vst1q(pOut1, vecIn.val[1]);
+
+            pSrc += 16;
+            pOut0 += 8;
+            pOut1 += 8;
+            blkCnt--;
+        }
+
+        blkCnt = blockSize & 7;
+        while (blkCnt > 0U)
+        {
+            *pOut0++ = *pSrc++;
+            *pOut1++ = *pSrc++;
+            blkCnt--;
+        }
+    }
+    else if (numChannels == 4U)
+    {
+        q15x8x4_t       vecIn;
+        q15_t       *pOut0 = pDst;
+        q15_t       *pOut1 = pDst + blockSize;
+        q15_t       *pOut2 = pDst + 2U * blockSize;
+        q15_t       *pOut3 = pDst + 3U * blockSize;
+
+        blkCnt = blockSize >> 3;
+        while (blkCnt > 0U)
+        {
+            /* De-interleaving load */
+            vecIn = vld4q(pSrc);
+            vst1q(pOut0, vecIn.val[0]);
+            vst1q(pOut1, vecIn.val[1]);
+            vst1q(pOut2, vecIn.val[2]);
+            vst1q(pOut3, vecIn.val[3]);
+
+            pSrc += 32;
+            pOut0 += 8;
+            pOut1 += 8;
+            pOut2 += 8;
+            pOut3 += 8;
+            blkCnt--;
+        }
+
+        blkCnt = blockSize & 7;
+        while (blkCnt > 0U)
+        {
+            *pOut0++ = *pSrc++;
+            *pOut1++ = *pSrc++;
+            *pOut2++ = *pSrc++;
+            *pOut3++ = *pSrc++;
+            blkCnt--;
+        }
+    }
+    else
+    {
+        /* Offsets of 8 consecutive frames */
+        uint16x8_t      vecOffs = vmulq_n_u16(vidupq_n_u16(0U, 1), (uint16_t) numChannels);
+
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+            pIn = pSrc + ch;
+
+            blkCnt = blockSize >> 3;
+            while (blkCnt > 0U)
+            {
+                vst1q(pDst, vldrhq_gather_shifted_offset_s16(pIn, vecOffs));
+
+                pIn += 8U * numChannels;
+                pDst += 8;
+                blkCnt--;
+            }
+
+            blkCnt = blockSize & 7;
+            while (blkCnt > 0U)
+            {
+                *pDst++ = *pIn;
+                pIn += numChannels;
+                blkCnt--;
+            }
+        }
+    }
+}
+#else
+void arm_deinterleave_q15(
+  const q15_t * pSrc,
+        uint32_t numChannels,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t ch;                                   /* Channel counter */
+  const q15_t *pIn;                                    /* Input pointer */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* C[ch][n] = A[n * numChannels + ch] */
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      /* C[ch][n] = A[n * numChannels + ch] */
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+#endif /* defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of interleave group
+ */
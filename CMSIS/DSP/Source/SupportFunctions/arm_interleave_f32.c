@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_interleave_f32.c
+ * Description:  Interleaves floating-point channels
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup interleave
+  @{
+ */
+
+/**
+  @brief         Interleaves floating-point channels into a multichannel buffer.
+  @param[in]     pSrc        points to the planar input buffer of numChannels vectors of blockSize samples
+  @param[in]     numChannels number of channels
+  @param[out]    pDst        points to the interleaved output buffer of blockSize frames
+  @param[in]     blockSize   number of samples in each channel
+  @return        none
+
+  @par           Details
+  <pre>
+      pDst[(n * numChannels) + ch] = pSrc[(ch * blockSize) + n];   0 <= n < blockSize, 0 <= ch < numChannels.
+  </pre>
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_interleave_f32(
+  const float32_t * pSrc,
+        uint32_t numChannels,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    uint32_t        blkCnt;                        /* Loop counter */
+    uint32_t        ch;                            /* Channel counter */
+    float32_t       *pOut;                          /* Output pointer */
+
+    if (numChannels == 2U)
+    {
+        f32x4x2_t       vecOut;
+        const float32_t *pIn0 = pSrc;
+        const float32_t *pIn1 = pSrc + blockSize;
+
+        blkCnt = blockSize >> 2;
+        while (blkCnt > 0U)
+        {
+            vecOut.val[0] = vld1q(pIn0);
+            vecOut.val[1] = vld1q(pIn1);
+            /* Interleaving store */
+            vst2q(pDst, vecOut);
+
+            pIn0 += 4;
+            pIn1 += 4;
+            pDst += 8;
+            blkCnt--;
+        }
+
+        blkCnt = blockSize & 3;
+        while (blkCnt > 0U)
+        {
+            *pDst++ = *pIn0++;
+            *pDst++ = *pIn1++;
+            blkCnt--;
+        }
+    }
+    else if (numChannels == 4U)
+    {
+        f32x4x4_t       vecOut;
+        const float32_t *pIn0 = pSrc;
+        const float32_t *pIn1 = pSrc + blockSize;
+        const float32_t *pIn2 = pSrc + 2U * blockSize;
+        const float32_t *pIn3 = pSrc + 3U * blockSize;
+
+        blkCnt = blockSize >> 2;
+        while (blkCnt > 0U)
+        {
+            vecOut.val[0] = vld1q(pIn0);
+            vecOut.val[1] = vld1q(pIn1);
+            vecOut.val[2] = vld1q(pIn2);
+            vecOut.val[3] = vld1q(pIn3);
+            /* Interleaving store */
+            vst4q(pDst, vecOut);
+
+            pIn0 += 4;
+            pIn1 += 4;
+            pIn2 += 4;
+            pIn3 += 4;
+            pDst += 16;
+            blkCnt--;
+        }
+
+        blkCnt = blockSize & 3;
+        while (blkCnt > 0U)
+        {
+            *pDst++ = *pIn0++;
+            *pDst++ = *pIn1++;
+            *pDst++ = *pIn2++;
+            *pDst++ = *pIn3++;
+            blkCnt--;
+        }
+    }
+    else
+    {
+        /* Offsets of 4 consecutive frames */
+        uint32x4_t      vecOffs = vmulq_n_u32(vidupq_n_u32(0U, 1), numChannels);
+
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+            pOut = pDst + ch;
+
+            blkCnt = blockSize >> 2;
+            while (blkCnt > 0U)
+            {
+                vstrwq_scatter_shifted_offset_f32(pOut, vecOffs, vld1q(pSrc));
+
+                pSrc += 4;
+                pOut += 4U * numChannels;
+                blkCnt--;
+            }
+
+            blkCnt = blockSize & 3;
+            while (blkCnt > 0U)
+            {
+                *pOut = *pSrc++;
+                pOut += numChannels;
+                blkCnt--;
+            }
+        }
+    }
+}
+#else
+void arm_interleave_f32(
+  const float32_t * pSrc,
+        uint32_t numChannels,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t ch;                                   /* Channel counter */
+        float32_t *pOut;                               /* Output pointer */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      /* C[n * numChannels + ch] = A[ch][n] */
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      /* C[n * numChannels + ch] = A[ch][n] */
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of interleave group
+ */
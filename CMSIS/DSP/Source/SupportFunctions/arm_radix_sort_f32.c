@@ -0,0 +1,238 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_f32.c
+ * Description:  Floating point radix sort
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/* Below this size, a bucket is sorted with an insertion sort */
+#define ARM_RADIX_SMALL_SIZE 32U
+
+/*
+ * Maps the bit pattern of a float to an unsigned key with the same order.
+ * Positive values get the sign bit set and negative values are inverted.
+ */
+__STATIC_FORCEINLINE uint32_t arm_radix_key_f32(uint32_t u)
+{
+    return ((u & 0x80000000U) ? ~u : (u | 0x80000000U));
+}
+
+__STATIC_FORCEINLINE uint32_t arm_radix_unkey_f32(uint32_t key)
+{
+    return ((key & 0x80000000U) ? (key & 0x7FFFFFFFU) : ~key);
+}
+
+static void arm_radix_insertion_sort(uint32_t * pKey, uint32_t n)
+{
+    uint32_t i, j, key;
+
+    for (i = 1U; i < n; i++)
+    {
+        key = pKey[i];
+        j = i;
+        while ((j > 0U) && (pKey[j - 1U] > key))
+        {
+            pKey[j] = pKey[j - 1U];
+            j--;
+        }
+        pKey[j] = key;
+    }
+}
+
+/*
+ * Permutes the keys in place so that they are grouped by the digit
+ * (key >> shift) & 0xFF. pHead and pEnd are used for the bounds of the
+ * buckets.
+ */
+static void arm_radix_partition(uint32_t * pKey, uint32_t n, uint32_t shift,
+                                uint32_t * pHead, uint32_t * pEnd)
+{
+    uint32_t i, b, d, sum, key, tmp;
+
+    for (b = 0U; b < 256U; b++)
+    {
+        pEnd[b] = 0U;
+    }
+
+    /* Histogram of the digit */
+    for (i = 0U; i < n; i++)
+    {
+        pEnd[(pKey[i] >> shift) & 0xFFU]++;
+    }
+
+    sum = 0U;
+    for (b = 0U; b < 256U; b++)
+    {
+        pHead[b] = sum;
+        sum += pEnd[b];
+        pEnd[b] = sum;
+    }
+
+    /* Each key is moved directly to its bucket */
+    for (b = 0U; b < 256U; b++)
+    {
+        while (pHead[b] < pEnd[b])
+        {
+            key = pKey[pHead[b]];
+            d = (key >> shift) & 0xFFU;
+            while (d != b)
+            {
+                tmp = pKey[pHead[d]];
+                pKey[pHead[d]] = key;
+                pHead[d]++;
+                key = tmp;
+                d = (key >> shift) & 0xFFU;
+            }
+            pKey[pHead[b]] = key;
+            pHead[b]++;
+        }
+    }
+}
+
+/*
+ * The bucket bounds are shared by all the digits : they are only used
+ * during the partition. The buckets are then found again by scanning the
+ * keys, which are now grouped by digit.
+ */
+static void arm_radix_sort_core(uint32_t * pKey, uint32_t n, uint32_t shift,
+                                uint32_t * pHead, uint32_t * pEnd)
+{
+    uint32_t start, end, d;
+
+    if (n <= ARM_RADIX_SMALL_SIZE)
+    {
+        arm_radix_insertion_sort(pKey, n);
+        return;
+    }
+
+    arm_radix_partition(pKey, n, shift, pHead, pEnd);
+
+    if (shift == 0U)
+    {
+        return;
+    }
+
+    /* Sort each bucket on the next digit */
+    start = 0U;
+    while (start < n)
+    {
+        d = (pKey[start] >> shift) & 0xFFU;
+        end = start + 1U;
+        while ((end < n) && (((pKey[end] >> shift) & 0xFFU) == d))
+        {
+            end++;
+        }
+
+        if (end - start > 1U)
+        {
+            arm_radix_sort_core(pKey + start, end - start, shift - 8U, pHead, pEnd);
+        }
+        start = end;
+    }
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @private
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               The radix sort sorts the bit patterns of the values, mapped to
+   *               unsigned keys having the same order as the values. It is an
+   *               in-place most significant digit radix sort (American flag sort)
+   *               on 8-bit digits: the keys are permuted into 256 buckets according
+   *               to their first byte, then each bucket is sorted on the next byte.
+   *               Small buckets are sorted with an insertion sort.
+   *
+   * @par          The number of operations is O(n) and does not depend on the order
+   *               of the input. The bounds of the 256 buckets use 2 kB of stack. They are
+   *               shared by the 4 digits since the buckets are found again by scanning
+   *               the partitioned keys before sorting them on the next digit.
+   *
+   * @par          -0 is sorted before +0. NaN values are sorted after +Inf or before
+   *               -Inf according to their sign.
+   *
+   * @par          It's an in-place algorithm. In order to obtain an out-of-place
+   *               function, a memcpy of the source vector is performed.
+   */
+void arm_radix_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    uint32_t pHead[256];
+    uint32_t pEnd[256];
+    uint32_t * pKey;
+    uint32_t i;
+
+    if(pSrc != pDst) // out-of-place
+    {
+        memcpy(pDst, pSrc, blockSize*sizeof(float32_t) );
+    }
+
+    /* The keys are computed in place in the output buffer */
+    pKey = (uint32_t *)pDst;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pKey[i] = arm_radix_key_f32(pKey[i]);
+
+        /* Descending order is the ascending order of the complemented keys */
+        if (S->dir == ARM_SORT_DESCENDING)
+        {
+            pKey[i] = ~pKey[i];
+        }
+    }
+
+    arm_radix_sort_core(pKey, blockSize, 24U, pHead, pEnd);
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        if (S->dir == ARM_SORT_DESCENDING)
+        {
+            pKey[i] = ~pKey[i];
+        }
+
+        pKey[i] = arm_radix_unkey_f32(pKey[i]);
+    }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -78,6 +78,10 @@ void arm_sort_f32(
         case ARM_SORT_SELECTION:
         arm_selection_sort_f32(S, pSrc, pDst, blockSize);
         break;
+
+        case ARM_SORT_RADIX:
+        arm_radix_sort_f32(S, pSrc, pDst, blockSize);
+        break;
     }
 }
 
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_f32.c
+ * Description:  Floating point top-k selection
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+
+/* Is the value a with index ia ranked before the value b with index ib ? */
+__STATIC_FORCEINLINE int32_t arm_topk_before_f32(
+    float32_t a, uint32_t ia,
+    float32_t b, uint32_t ib,
+    arm_sort_dir dir)
+{
+    if (a == b)
+    {
+        return (ia < ib);
+    }
+
+    return ((dir == ARM_SORT_DESCENDING) ? (a > b) : (a < b));
+}
+
+/*
+ * Heap whose root is the element ranked last. It is used to keep
+ * the k best elements seen so far.
+ */
+static void arm_topk_sift_down_f32(
+    float32_t * pVal,
+    uint32_t * pIdx,
+    uint32_t i,
+    uint32_t n,
+    arm_sort_dir dir)
+{
+    uint32_t child, last;
+    float32_t tmpVal;
+    uint32_t tmpIdx;
+
+    while ((child = 2U * i + 1U) < n)
+    {
+        /* Child ranked last */
+        last = child;
+        if ((child + 1U < n) &&
+            arm_topk_before_f32(pVal[child], pIdx[child], pVal[child + 1U], pIdx[child + 1U], dir))
+        {
+            last = child + 1U;
+        }
+
+        if (!arm_topk_before_f32(pVal[i], pIdx[i], pVal[last], pIdx[last], dir))
+        {
+            break;
+        }
+
+        tmpVal = pVal[i]; pVal[i] = pVal[last]; pVal[last] = tmpVal;
+        tmpIdx = pIdx[i]; pIdx[i] = pIdx[last]; pIdx[last] = tmpIdx;
+        i = last;
+    }
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  blockSize  number of samples to process.
+   * @param[in]  k          number of values to select.
+   * @param[in]  dir        ARM_SORT_DESCENDING for the k largest values, ARM_SORT_ASCENDING for the k smallest ones.
+   * @param[out] pDst       points to the k selected values.
+   * @param[out] pIndex     points to the indices of the k selected values.
+   *
+   * @par        Algorithm
+   *               The top-k is a partial sort. The k first values of the sorted
+   *               input are returned, in order, with their indices in the input.
+   *               The input is not modified.
+   *
+   * @par          The k best values are kept in a heap built in the output buffers,
+   *               whose root is the worst of the k values. Each new value only has
+   *               to be compared to the root, and replaces it when it is better.
+   *               The number of operations is O(n log k) and no work array is needed.
+   *
+   * @par          Equal values are ranked by increasing index. When k is greater
+   *               than blockSize, only blockSize values are returned.
+   */
+void arm_topk_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        uint32_t k,
+        arm_sort_dir dir,
+        float32_t * pDst,
+        uint32_t * pIndex)
+{
+    uint32_t i;
+    float32_t tmpVal;
+    uint32_t tmpIdx;
+
+    if (k > blockSize)
+    {
+        k = blockSize;
+    }
+
+    if (k == 0U)
+    {
+        return;
+    }
+
+    /* Heap of the k first values */
+    for (i = 0U; i < k; i++)
+    {
+        pDst[i] = pSrc[i];
+        pIndex[i] = i;
+    }
+
+    for (i = k / 2U; i > 0U; i--)
+    {
+        arm_topk_sift_down_f32(pDst, pIndex, i - 1U, k, dir);
+    }
+
+    /* The next values replace the root when they are better */
+    for (i = k; i < blockSize; i++)
+    {
+        if (arm_topk_before_f32(pSrc[i], i, pDst[0], pIndex[0], dir))
+        {
+            pDst[0] = pSrc[i];
+            pIndex[0] = i;
+            arm_topk_sift_down_f32(pDst, pIndex, 0U, k, dir);
+        }
+    }
+
+    /* Heap sort: the worst value is moved to the end */
+    for (i = k - 1U; i > 0U; i--)
+    {
+        tmpVal = pDst[0]; pDst[0] = pDst[i]; pDst[i] = tmpVal;
+        tmpIdx = pIndex[0]; pIndex[0] = pIndex[i]; pIndex[i] = tmpIdx;
+        arm_topk_sift_down_f32(pDst, pIndex, 0U, i, dir);
+    }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_tree_ensemble_predict_f32.c
+ * Description:  Floating-point tree ensemble prediction
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.10.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/tree_functions.h"
+
+/**
+  @ingroup groupTree
+ */
+
+/**
+  @defgroup TreeEnsemble Tree Ensemble
+
+  Batched prediction of an ensemble of decision trees.
+
+  The scores of all the input vectors are first initialized with
+  the base values. Then the trees are evaluated one after the other
+  for all the input vectors, so that the nodes of a tree stay in the
+  cache while the batch is processed.
+
+  For each tree, the nodes are traversed with:
+  <pre>
+      n = leftChildren[n] + (x[featureIndexes[n]] > thresholds[n])
+  </pre>
+  repeated treeDepths[t] times. Four input vectors are traversed
+  together to hide the latency of the loads.
+ */
+
+/**
+  @addtogroup TreeEnsemble
+  @{
+ */
+
+/**
+ * @brief Floating-point tree ensemble prediction.
+ * @param[in]  S          points to an instance of the floating-point tree ensemble structure.
+ * @param[in]  pSrc       points to the input vectors. One row of vectorDimension samples per vector.
+ * @param[in]  nbVectors  number of input vectors.
+ * @param[out] pScores    points to the scores. One row of numberOfOutputs samples per vector.
+ */
+void arm_tree_ensemble_predict_f32(
+  const arm_tree_ensemble_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t nbVectors,
+        float32_t * pScores)
+{
+    const uint16_t *pFeature = S->featureIndexes;
+    const float32_t *pThreshold = S->thresholds;
+    const uint32_t *pChildren = S->leftChildren;
+    const uint32_t dim = S->vectorDimension;
+    const uint32_t nbOutputs = S->numberOfOutputs;
+    const uint32_t nbLeafValues = S->numberOfLeafValues;
+    const float32_t *pIn0, *pIn1, *pIn2, *pIn3;
+    const float32_t *pLeaf0, *pLeaf1, *pLeaf2, *pLeaf3;
+    float32_t *pDst;
+    uint32_t n0, n1, n2, n3;
+    uint32_t tree, depth, blkCnt, k, i;
+
+    /* Initialize the scores with the base values */
+    pDst = pScores;
+    for (i = 0; i < nbVectors; i++)
+    {
+        for (k = 0; k < nbOutputs; k++)
+        {
+            *pDst++ = S->baseValues[k];
+        }
+    }
+
+    for (tree = 0; tree < S->numberOfTrees; tree++)
+    {
+        const uint32_t root = S->treeRoots[tree];
+        const uint32_t treeDepth = S->treeDepths[tree];
+
+        pIn0 = pSrc;
+        pDst = pScores + S->treeOutputs[tree];
+
+        /* Four input vectors are traversed together */
+        blkCnt = nbVectors >> 2U;
+        while (blkCnt > 0U)
+        {
+            pIn1 = pIn0 + dim;
+            pIn2 = pIn1 + dim;
+            pIn3 = pIn2 + dim;
+
+            n0 = root;
+            n1 = root;
+            n2 = root;
+            n3 = root;
+
+            for (depth = 0; depth < treeDepth; depth++)
+            {
+                n0 = pChildren[n0] + (uint32_t) (pIn0[pFeature[n0]] > pThreshold[n0]);
+                n1 = pChildren[n1] + (uint32_t) (pIn1[pFeature[n1]] > pThreshold[n1]);
+                n2 = pChildren[n2] + (uint32_t) (pIn2[pFeature[n2]] > pThreshold[n2]);
+                n3 = pChildren[n3] + (uint32_t) (pIn3[pFeature[n3]] > pThreshold[n3]);
+            }
+
+            pLeaf0 = S->leafValues + S->leafIndexes[n0] * nbLeafValues;
+            pLeaf1 = S->leafValues + S->leafIndexes[n1] * nbLeafValues;
+            pLeaf2 = S->leafValues + S->leafIndexes[n2] * nbLeafValues;
+            pLeaf3 = S->leafValues + S->leafIndexes[n3] * nbLeafValues;
+
+            for (k = 0; k < nbLeafValues; k++)
+            {
+                pDst[k] += pLeaf0[k];
+                pDst[nbOutputs + k] += pLeaf1[k];
+                pDst[2*nbOutputs + k] += pLeaf2[k];
+                pDst[3*nbOutputs + k] += pLeaf3[k];
+            }
+
+            pIn0 += 4*dim;
+            pDst += 4*nbOutputs;
+            blkCnt--;
+        }
+
+        blkCnt = nbVectors & 3U;
+        while (blkCnt > 0U)
+        {
+            n0 = root;
+            for (depth = 0; depth < treeDepth; depth++)
+            {
+                n0 = pChildren[n0] + (uint32_t) (pIn0[pFeature[n0]] > pThreshold[n0]);
+            }
+
+            pLeaf0 = S->leafValues + S->leafIndexes[n0] * nbLeafValues;
+            for (k = 0; k < nbLeafValues; k++)
+            {
+                pDst[k] += pLeaf0[k];
+            }
+
+            pIn0 += dim;
+            pDst += nbOutputs;
+            blkCnt--;
+        }
+    }
+}
+
+/**
+  @} end of TreeEnsemble group
+ */
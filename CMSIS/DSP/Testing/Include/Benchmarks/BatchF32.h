@@ -0,0 +1,31 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/matrix_functions.h"
+
+class BatchF32:public Client::Suite
+    {
+        public:
+            BatchF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "BatchF32_decl.h"
+            Client::Pattern<float32_t> input1;
+            Client::Pattern<float32_t> input2;
+
+            Client::LocalPattern<float32_t> a;
+            Client::LocalPattern<float32_t> b;
+            Client::LocalPattern<float32_t> output;
+
+            int nb;
+            int count;
+
+            arm_matrix_instance_f32 in1;
+            arm_matrix_instance_f32 in2;
+            arm_matrix_instance_f32 out;
+
+            float32_t *ap;
+            float32_t *bp;
+            float32_t *outp;
+    };
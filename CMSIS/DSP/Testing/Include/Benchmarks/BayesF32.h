@@ -3,6 +3,9 @@
 
 #include "dsp/bayes_functions.h"
 
+/* Number of input vectors of the batch benchmarks */
+#define NB_BATCH 64
+
 class BayesF32:public Client::Suite
     {
         public:
@@ -24,7 +27,7 @@ class BayesF32:public Client::Suite
             Client::RefPattern<int16_t> predicts;
 
             int classNb,vecDim;
-            int nb=0;
+            int nb=0,nbLoop=0,nbBatch=0;
             const float32_t *theta;
             const float32_t *sigma;
             const float32_t *classPrior;
@@ -35,4 +38,8 @@ class BayesF32:public Client::Suite
             const float32_t *inp;
             float32_t *bufp,*tempp;
 
+            /* Batch benchmarks */
+            Client::LocalPattern<float32_t> batch;
+            Client::LocalPattern<int32_t> batchResult;
+
     };
@@ -18,6 +18,13 @@ class ControllerF32:public Client::Suite
             int nbSamples;
 
             arm_pid_instance_f32  instPid;
+
+            arm_pid_bank_instance_f32 instPidBank;
+            Client::LocalPattern<float32_t> bankCoeffs;
+            Client::LocalPattern<float32_t> bankState;
+
+            /* Id, Iq, sin and cos outputs of the FOC transform */
+            Client::LocalPattern<float32_t> focOutput;
             float32_t *pSrc;
             float32_t *pDst;
             
@@ -18,6 +18,13 @@ class ControllerQ31:public Client::Suite
             int nbSamples;
 
             arm_pid_instance_q31  instPid;
+
+            arm_pid_bank_instance_q31 instPidBank;
+            Client::LocalPattern<q31_t> bankCoeffs;
+            Client::LocalPattern<q31_t> bankState;
+
+            /* Id, Iq, sin and cos outputs of the FOC transform */
+            Client::LocalPattern<q31_t> focOutput;
             q31_t *pSrc;
             q31_t *pDst;
             
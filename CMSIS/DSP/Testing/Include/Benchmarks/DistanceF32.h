@@ -3,6 +3,9 @@
 
 #include "dsp/distance_functions.h"
 
+/* Number of neighbours of the kNN benchmark */
+#define KNN_K 5
+
 class DistanceF32:public Client::Suite
     {
         public:
@@ -17,6 +20,9 @@ class DistanceF32:public Client::Suite
 
             Client::LocalPattern<float32_t> tmpA;
             Client::LocalPattern<float32_t> tmpB;
+            Client::LocalPattern<float32_t> templates;
+            Client::LocalPattern<float32_t> norms;
+            Client::LocalPattern<float32_t> dist;
 
             int vecDim;
 
@@ -25,6 +31,11 @@ class DistanceF32:public Client::Suite
 
             float32_t *tmpAp;
             float32_t *tmpBp;
+            float32_t *distp;
+
+            arm_cdist_instance_f32 cdistS;
+            float32_t knnDist[KNN_K];
+            uint32_t knnIndex[KNN_K];
 
 
     };
@@ -3,6 +3,9 @@
 
 #include "dsp/distance_functions.h"
 
+/* Number of matches selected by the top-k benchmarks */
+#define TOPK_K 5
+
 class DistanceU32:public Client::Suite
     {
         public:
@@ -18,6 +21,9 @@ class DistanceU32:public Client::Suite
             Client::LocalPattern<uint32_t> tmpA;
             Client::LocalPattern<uint32_t> tmpB;
 
+            Client::LocalPattern<uint32_t> templates;
+            Client::LocalPattern<float32_t> dist;
+
             int vecDim;
 
             const uint32_t *inpA;
@@ -26,5 +32,9 @@ class DistanceU32:public Client::Suite
             uint32_t *tmpAp;
             uint32_t *tmpBp;
 
+            const uint32_t *templatesp;
+            float32_t *distp;
+            uint32_t knnIndex[TOPK_K];
+
 
     };
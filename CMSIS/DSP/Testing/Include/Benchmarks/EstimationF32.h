@@ -0,0 +1,34 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/estimation_functions.h"
+
+class EstimationF32:public Client::Suite
+    {
+        public:
+            EstimationF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "EstimationF32_decl.h"
+            Client::Pattern<float32_t> input1;
+
+            /* Model matrices, state and workspace */
+            Client::LocalPattern<float32_t> model;
+            Client::LocalPattern<float32_t> state;
+            Client::LocalPattern<float32_t> work;
+
+            int nbStates;
+            int nbMeas;
+
+            const float32_t *measp;
+
+            arm_kalman_instance_f32 kalman;
+            arm_rls_instance_f32 rls;
+
+            /* Matrices of the matrix function chain */
+            arm_matrix_instance_f32 F, Ft, H, Ht, Q, R, P;
+            arm_matrix_instance_f32 tmpNN1, tmpNN2, tmpNM, tmpMN, tmpMM1, tmpMM2;
+            arm_matrix_instance_f32 K, I;
+            float32_t *xp, *tmpN, *tmpM;
+    };
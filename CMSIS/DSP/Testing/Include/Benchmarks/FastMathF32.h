@@ -14,11 +14,15 @@ class FastMathF32:public Client::Suite
             Client::Pattern<float32_t> samples;
 
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> output2;
+            Client::LocalPattern<float32_t> input2;
             
             int nbSamples;
 
             float32_t *pSrc;
+            float32_t *pSrc2;
             float32_t *pDst;
+            float32_t *pDst2;
             
             
     };
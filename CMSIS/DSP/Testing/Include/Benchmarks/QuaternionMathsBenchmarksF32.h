@@ -15,6 +15,10 @@ class QuaternionMathsBenchmarksF32:public Client::Suite
             Client::Pattern<float32_t> input2;
             Client::LocalPattern<float32_t> output;
 
+            /* Inputs of the SoA functions */
+            Client::LocalPattern<float32_t> soaInput1;
+            Client::LocalPattern<float32_t> soaInput2;
+
             Client::RefPattern<float32_t> ref;
 
 
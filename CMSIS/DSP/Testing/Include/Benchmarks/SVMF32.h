@@ -2,6 +2,14 @@
 #include "Pattern.h"
 
 #include "dsp/svm_functions.h"
+#include "dsp/support_functions.h"
+
+/* Number of classes of the multi-class benchmarks.
+   Each class has NBVECS support vectors. */
+#define NB_CLASSES 6
+
+/* Number of input vectors of the batch benchmarks */
+#define NB_BATCH 64
 
 
 class SVMF32:public Client::Suite
@@ -22,6 +30,22 @@ class SVMF32:public Client::Suite
             arm_svm_rbf_instance_f32 rbf;
             arm_svm_sigmoid_instance_f32 sigmoid;
 
+            /* Multi-class benchmarks */
+            arm_svm_multiclass_instance_f32 multiclass;
+            arm_svm_rbf_instance_f32 pairs[NB_CLASSES*(NB_CLASSES-1)/2];
+            Client::LocalPattern<float32_t> mcSupport;
+            Client::LocalPattern<float32_t> mcDualCoefs;
+            Client::LocalPattern<float32_t> mcIntercepts;
+            Client::LocalPattern<float32_t> mcState;
+            int32_t mcClasses[NB_CLASSES];
+            uint32_t mcNbPerClass[NB_CLASSES];
+            int32_t votes[NB_CLASSES];
+
+            /* Batch benchmarks */
+            Client::LocalPattern<float32_t> batch;
+            Client::LocalPattern<float32_t> batchScratch;
+            Client::LocalPattern<int32_t> batchResult;
+
             int vecDim,nbSupportVectors,nbTestSamples,degree;
             int32_t classes[2]={0,0};
             float32_t intercept;
@@ -33,6 +57,8 @@ class SVMF32:public Client::Suite
 
 
             int nbLinear=0,nbPoly=0,nbRBF=0,nbSigmoid=0;
+            int nbRBFLoop=0,nbMulticlass=0;
+            int nbLinearLoop=0,nbLinearBatch=0;
 
 
             enum {
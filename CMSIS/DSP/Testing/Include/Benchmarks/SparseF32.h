@@ -0,0 +1,36 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/matrix_functions.h"
+
+class SparseF32:public Client::Suite
+    {
+        public:
+            SparseF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "SparseF32_decl.h"
+            Client::Pattern<float32_t> input1;
+            Client::Pattern<float32_t> input2;
+            Client::Pattern<float32_t> vec;
+
+            Client::LocalPattern<float32_t> a;
+            Client::LocalPattern<float32_t> output;
+
+            Client::LocalPattern<float32_t> values;
+            Client::LocalPattern<int16_t> colIdx;
+            uint32_t rowPtr[64+1];
+
+            int nb;
+            int density;
+
+            arm_matrix_instance_f32 in1;
+            arm_matrix_instance_f32 in2;
+            arm_matrix_instance_f32 out;
+
+            arm_spmat_instance_f32 sp;
+
+            float32_t *vecp;
+            float32_t *outp;
+    };
@@ -24,6 +24,8 @@ class StatsF32:public Client::Suite
             float32_t *outp;
             float32_t *tmpp;
 
+            arm_stats_accum_instance_f32 accum;
+
             int nb;
            
 
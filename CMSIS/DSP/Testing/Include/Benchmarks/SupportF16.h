@@ -14,9 +14,15 @@ class SupportF16:public Client::Suite
             Client::Pattern<float16_t> samples;
             Client::Pattern<float16_t> weights;
             Client::Pattern<q15_t> samplesQ15;
+            Client::Pattern<q31_t> samplesQ31;
+            Client::Pattern<q7_t> samplesQ7;
             Client::Pattern<float32_t> samplesF32;
 
             Client::LocalPattern<float16_t> output;
+            Client::LocalPattern<q15_t> outputQ15;
+            Client::LocalPattern<q31_t> outputQ31;
+            Client::LocalPattern<q7_t> outputQ7;
+            Client::LocalPattern<float32_t> outputF32;
             
             int nbSamples;
 
@@ -25,7 +31,13 @@ class SupportF16:public Client::Suite
 
             float32_t *pSrcF32;
             q15_t *pSrcQ15;
+            q31_t *pSrcQ31;
+            q7_t *pSrcQ7;
 
             float16_t *pDst;
+            q15_t *pDstQ15;
+            q31_t *pDstQ31;
+            q7_t *pDstQ7;
+            float32_t *pDstF32;
             
     };
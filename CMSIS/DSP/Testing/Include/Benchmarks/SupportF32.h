@@ -2,6 +2,7 @@
 #include "Pattern.h"
 
 #include "dsp/support_functions.h"
+#include "dsp/basic_math_functions.h"
 
 class SupportF32:public Client::Suite
     {
@@ -18,8 +19,16 @@ class SupportF32:public Client::Suite
             Client::Pattern<q7_t> samplesQ7;
 
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> ordered;
+            Client::LocalPattern<float32_t> tmp;
+            Client::LocalPattern<q7_t> outputQ7;
+            Client::LocalPattern<q15_t> outputQ15;
+            Client::LocalPattern<q31_t> outputQ31;
+            Client::LocalPattern<int32_t> index;
+            Client::LocalPattern<int32_t> work;
             
             int nbSamples;
+            uint32_t nbChannels;
 
             float32_t *pSrc;
             float32_t *pWeights;
@@ -29,5 +38,13 @@ class SupportF32:public Client::Suite
             q7_t *pSrcQ7;
 
             float32_t *pDst;
+            float32_t *pTmp;
+            q7_t *pDstQ7;
+            q15_t *pDstQ15;
+            q31_t *pDstQ31;
+            uint32_t *pIndex;
+
+            arm_sort_instance_f32 sortS;
+            arm_argsort_instance_f32 argsortS;
             
     };
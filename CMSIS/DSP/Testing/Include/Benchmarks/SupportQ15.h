@@ -2,6 +2,7 @@
 #include "Pattern.h"
 
 #include "dsp/support_functions.h"
+#include "dsp/basic_math_functions.h"
 
 class SupportQ15:public Client::Suite
     {
@@ -17,6 +18,9 @@ class SupportQ15:public Client::Suite
             Client::Pattern<q7_t> samplesQ7;
 
             Client::LocalPattern<q15_t> output;
+            Client::LocalPattern<q15_t> tmp;
+            Client::LocalPattern<q31_t> outputQ31;
+            Client::LocalPattern<q7_t> outputQ7;
             
             int nbSamples;
 
@@ -26,5 +30,8 @@ class SupportQ15:public Client::Suite
             q7_t *pSrcQ7;
 
             q15_t *pDst;
+            q15_t *pTmp;
+            q31_t *pDstQ31;
+            q7_t *pDstQ7;
             
     };
@@ -0,0 +1,32 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/tree_functions.h"
+
+class TreeF32:public Client::Suite
+    {
+        public:
+            TreeF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "TreeF32_decl.h"
+            
+            Client::Pattern<float32_t> input;
+            Client::Pattern<int16_t> dims;
+            Client::Pattern<int16_t> structure;
+            Client::Pattern<uint32_t> nodes;
+            Client::Pattern<float32_t> thresholds;
+            Client::Pattern<float32_t> leaves;
+            Client::Pattern<float32_t> base;
+
+            Client::LocalPattern<float32_t> output;
+
+            int nbVectors;
+
+            arm_tree_ensemble_instance_f32 tree;
+
+            const float32_t *inp;
+            float32_t *outp;
+
+    };
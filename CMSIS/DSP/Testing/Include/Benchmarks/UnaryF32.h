@@ -18,18 +18,23 @@ class UnaryF32:public Client::Suite
 
             Client::LocalPattern<float32_t> a;
             Client::LocalPattern<float32_t> b;
+            Client::LocalPattern<float32_t> c;
             Client::LocalPattern<float32_t> output;
 
             Client::LocalPattern<float32_t> outputll;
             Client::LocalPattern<float32_t> outputd;
             Client::LocalPattern<int16_t> outputp;
 
+            Client::LocalPattern<float32_t> vals;
+
             arm_matrix_instance_f32 in1;
             arm_matrix_instance_f32 in2;
             arm_matrix_instance_f32 out;
 
             arm_matrix_instance_f32 outll;
             arm_matrix_instance_f32 outd;
+
+            arm_matrix_instance_f32 outv;
             
             int nbr;
             int nbc;
@@ -39,5 +44,8 @@ class UnaryF32:public Client::Suite
 
             int16_t *outpp;
 
+            float32_t *valsp;
+            float32_t *scratchp;
+
             
     };
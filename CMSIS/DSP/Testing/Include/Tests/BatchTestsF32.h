@@ -0,0 +1,34 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/matrix_functions.h"
+
+/* Upper bound of the batch size used by Python */
+#define MAXBATCHSAMPLES 1000
+
+/* Padding between the matrices of the batch and the stride */
+#define BATCHPADDING 3
+
+class BatchTestsF32:public Client::Suite
+    {
+        public:
+            BatchTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "BatchTestsF32_decl.h"
+            Client::Pattern<float32_t> input1;
+            Client::Pattern<float32_t> input2;
+            Client::Pattern<float32_t> ref;
+            Client::Pattern<int16_t> dims;
+            Client::LocalPattern<float32_t> output;
+
+            /* Batches with a stride bigger than the number of matrices */
+            Client::LocalPattern<float32_t> a;
+            Client::LocalPattern<float32_t> b;
+            Client::LocalPattern<float32_t> c;
+
+            arm_matrix_instance_f32 in1;
+            arm_matrix_instance_f32 in2;
+            arm_matrix_instance_f32 out;
+    };
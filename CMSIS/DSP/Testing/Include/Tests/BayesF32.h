@@ -19,6 +19,7 @@ class BayesF32:public Client::Suite
             Client::LocalPattern<float32_t> outputProbas;
             Client::LocalPattern<float32_t> temp;
             Client::LocalPattern<int16_t> outputPredicts;
+            Client::LocalPattern<int32_t> outputBatch;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> probas;
@@ -0,0 +1,31 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/bayes_functions.h"
+
+class BayesQ15:public Client::Suite
+    {
+        public:
+            BayesQ15(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "BayesQ15_decl.h"
+            
+            Client::Pattern<q15_t> input;
+            Client::Pattern<q15_t> params;
+            Client::Pattern<q31_t> constants;
+            Client::Pattern<int16_t> dims;
+
+            Client::LocalPattern<q31_t> outputScores;
+            Client::LocalPattern<int16_t> outputPredicts;
+
+            // Reference patterns are not loaded when we are in dump mode
+            Client::RefPattern<q31_t> scores;
+            Client::RefPattern<int16_t> predicts;
+
+            int nbPatterns,classNb,vecDim;
+
+            arm_gaussian_naive_bayes_instance_q15 bayes;
+
+    };
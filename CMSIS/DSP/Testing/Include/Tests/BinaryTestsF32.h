@@ -29,4 +29,8 @@ class BinaryTestsF32:public Client::Suite
             arm_matrix_instance_f32 in1;
             arm_matrix_instance_f32 in2;
             arm_matrix_instance_f32 out;
+
+            arm_matrix_instance_f32_ext in1ext;
+            arm_matrix_instance_f32_ext in2ext;
+            arm_matrix_instance_f32_ext outext;
     };
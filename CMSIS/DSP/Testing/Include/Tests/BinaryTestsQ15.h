@@ -30,4 +30,8 @@ class BinaryTestsQ15:public Client::Suite
             arm_matrix_instance_q15 in1;
             arm_matrix_instance_q15 in2;
             arm_matrix_instance_q15 out;
+
+            arm_matrix_instance_q15_ext in1ext;
+            arm_matrix_instance_q15_ext in2ext;
+            arm_matrix_instance_q15_ext outext;
     };
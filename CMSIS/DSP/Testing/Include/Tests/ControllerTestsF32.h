@@ -0,0 +1,25 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/controller_functions.h"
+
+class ControllerTestsF32:public Client::Suite
+    {
+        public:
+            ControllerTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "ControllerTestsF32_decl.h"
+            Client::Pattern<float32_t> input;
+            Client::Pattern<int16_t> dims;
+            Client::LocalPattern<float32_t> output;
+            // Reference patterns are not loaded when we are in dump mode
+            Client::RefPattern<float32_t> ref;
+
+            /* State of the controllers */
+            Client::LocalPattern<float32_t> state;
+
+            /* Result of the chained sin_cos, Clarke and Park transforms */
+            Client::LocalPattern<float32_t> chain;
+    };
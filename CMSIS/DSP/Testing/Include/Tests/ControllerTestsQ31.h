@@ -0,0 +1,25 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/controller_functions.h"
+
+class ControllerTestsQ31:public Client::Suite
+    {
+        public:
+            ControllerTestsQ31(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "ControllerTestsQ31_decl.h"
+            Client::Pattern<q31_t> input;
+            Client::Pattern<int16_t> dims;
+            Client::LocalPattern<q31_t> output;
+            // Reference patterns are not loaded when we are in dump mode
+            Client::RefPattern<q31_t> ref;
+
+            /* State of the controllers */
+            Client::LocalPattern<q31_t> state;
+
+            /* Result of the chained sin_cos, Clarke and Park transforms */
+            Client::LocalPattern<q31_t> chain;
+    };
@@ -25,6 +25,7 @@ class DistanceTestsF16:public Client::Suite
 
             int vecDim;
             int nbPatterns;
+            int nbVectors;
 
 
     };
@@ -19,6 +19,8 @@ class DistanceTestsF32:public Client::Suite
             Client::LocalPattern<float32_t> output;
             Client::LocalPattern<float32_t> tmpA;
             Client::LocalPattern<float32_t> tmpB;
+            Client::LocalPattern<q7_t> tmpQ7;
+            Client::LocalPattern<q31_t> tmpQ31;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
@@ -2,6 +2,7 @@
 #include "Pattern.h"
 
 #include "dsp/distance_functions.h"
+#include "dsp/support_functions.h"
 
 class DistanceTestsU32:public Client::Suite
     {
@@ -17,6 +18,8 @@ class DistanceTestsU32:public Client::Suite
             Client::Pattern<int16_t> dims;
 
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> batch;
+            Client::LocalPattern<float32_t> topkRef;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
@@ -0,0 +1,31 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/estimation_functions.h"
+
+/* Biggest dimensions used by Python */
+#define MAXNBSTATES 12
+#define MAXNBMEAS 6
+#define MAXNBPARAMS 13
+
+class EstimationTestsF32:public Client::Suite
+    {
+        public:
+            EstimationTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "EstimationTestsF32_decl.h"
+            Client::Pattern<float32_t> input;
+            Client::Pattern<int16_t> dims;
+            Client::LocalPattern<float32_t> output;
+            // Reference patterns are not loaded when we are in dump mode
+            Client::RefPattern<float32_t> ref;
+
+            /* State, covariance, parameters and workspace */
+            Client::LocalPattern<float32_t> state;
+            Client::LocalPattern<float32_t> cov;
+            Client::LocalPattern<float32_t> work;
+            /* Square roots of the noise covariances */
+            Client::LocalPattern<float32_t> noise;
+    };
@@ -13,6 +13,7 @@ class FastMathF16:public Client::Suite
             #include "FastMathF16_decl.h"
             
             Client::Pattern<float16_t> input;
+            Client::Pattern<float16_t> input2;
 
             Client::LocalPattern<float16_t> output;
 
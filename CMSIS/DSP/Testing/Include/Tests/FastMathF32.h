@@ -13,11 +13,14 @@ class FastMathF32:public Client::Suite
             #include "FastMathF32_decl.h"
             
             Client::Pattern<float32_t> input;
+            Client::Pattern<float32_t> input2;
 
             Client::LocalPattern<float32_t> output;
+            Client::LocalPattern<float32_t> output2;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
+            Client::RefPattern<float32_t> ref2;
 
            
     };
@@ -13,6 +13,7 @@ class FastMathQ15:public Client::Suite
             #include "FastMathQ15_decl.h"
             
             Client::Pattern<q15_t> input;
+            Client::Pattern<q15_t> input2;
 
             Client::Pattern<q15_t> numerator;
             Client::Pattern<q15_t> denominator;
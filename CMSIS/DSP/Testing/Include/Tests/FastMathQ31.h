@@ -13,6 +13,7 @@ class FastMathQ31:public Client::Suite
             #include "FastMathQ31_decl.h"
             
             Client::Pattern<q31_t> input;
+            Client::Pattern<q31_t> input2;
 
             Client::LocalPattern<q31_t> output;
 
@@ -15,6 +15,12 @@ class QuaternionTestsF32:public Client::Suite
             Client::Pattern<float32_t> input1;
             Client::Pattern<float32_t> input2;
             Client::LocalPattern<float32_t> output;
+            
+            /* Inputs and output of the SoA functions */
+            Client::LocalPattern<float32_t> soaInput1;
+            Client::LocalPattern<float32_t> soaInput2;
+            Client::LocalPattern<float32_t> soaOutput;
+
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
     };
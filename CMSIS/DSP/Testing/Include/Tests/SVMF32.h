@@ -3,6 +3,8 @@
 
 #include "dsp/svm_functions.h"
 
+#define MAX_NB_CLASSES 8
+
 
 class SVMF32:public Client::Suite
     {
@@ -23,6 +25,7 @@ class SVMF32:public Client::Suite
             arm_svm_polynomial_instance_f32 poly;
             arm_svm_rbf_instance_f32 rbf;
             arm_svm_sigmoid_instance_f32 sigmoid;
+            arm_svm_multiclass_instance_f32 multiclass;
 
             int vecDim,nbSupportVectors,nbTestSamples,degree;
             int32_t classes[2]={0,0};
@@ -31,6 +34,12 @@ class SVMF32:public Client::Suite
             const float32_t *dualCoefs;
             float32_t coef0, gamma;
 
+            /* Multi-class tests */
+            int32_t multiClasses[MAX_NB_CLASSES];
+            uint32_t nbPerClass[MAX_NB_CLASSES];
+            const float32_t *intercepts;
+            Client::LocalPattern<float32_t> state;
+
             enum {
                 LINEAR=1,
                 POLY=2,
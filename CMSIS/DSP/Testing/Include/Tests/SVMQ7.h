@@ -0,0 +1,43 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+
+
+class SVMQ7:public Client::Suite
+    {
+        public:
+            SVMQ7(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "SVMQ7_decl.h"
+            Client::Pattern<q7_t> samples;
+            Client::Pattern<q7_t> support;
+            Client::Pattern<int16_t> dims;
+            Client::Pattern<q15_t> params;
+
+            Client::RefPattern<int32_t> ref;
+            Client::LocalPattern<int32_t> output;
+            Client::LocalPattern<q31_t> norms;
+
+            arm_svm_linear_instance_q7 linear;
+            arm_svm_polynomial_instance_q7 poly;
+            arm_svm_rbf_instance_q7 rbf;
+
+            int vecDim,nbSupportVectors,nbTestSamples,degree,gammaShift;
+            int32_t classes[2]={0,0};
+            q15_t intercept;
+            const q7_t *supportVectors;
+            const q15_t *dualCoefs;
+            q15_t coef0, gamma;
+
+            enum {
+                LINEAR=1,
+                POLY=2,
+                RBF=3
+            } kind;
+
+            
+    };
@@ -0,0 +1,39 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/matrix_functions.h"
+
+/* Upper bound of maximum matrix dimension used by Python */
+#define MAXSPARSEDIM 64
+
+class SparseTestsF32:public Client::Suite
+    {
+        public:
+            SparseTestsF32(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "SparseTestsF32_decl.h"
+            Client::Pattern<float32_t> input1;
+            Client::Pattern<float32_t> input2;
+            Client::Pattern<float32_t> ref;
+            Client::Pattern<int16_t> dims;
+            Client::LocalPattern<float32_t> output;
+
+            /* Local copies of inputs since matrix instance in CMSIS-DSP are not using
+               pointers to const.
+            */
+            Client::LocalPattern<float32_t> a;
+            Client::LocalPattern<float32_t> b;
+
+            /* Sparse matrix storage */
+            Client::LocalPattern<float32_t> values;
+            Client::LocalPattern<int16_t> colIdx;
+            uint32_t rowPtr[MAXSPARSEDIM+1];
+
+            arm_matrix_instance_f32 in1;
+            arm_matrix_instance_f32 in2;
+            arm_matrix_instance_f32 out;
+
+            arm_spmat_instance_f32 sp;
+    };
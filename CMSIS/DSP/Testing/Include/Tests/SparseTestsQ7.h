@@ -0,0 +1,36 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/matrix_functions.h"
+
+/* Upper bound of maximum matrix dimension used by Python */
+#define MAXSPARSEDIM 64
+
+class SparseTestsQ7:public Client::Suite
+    {
+        public:
+            SparseTestsQ7(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "SparseTestsQ7_decl.h"
+            Client::Pattern<q7_t> input1;
+            Client::Pattern<q7_t> input2;
+            Client::Pattern<q7_t> ref;
+            Client::Pattern<int16_t> dims;
+            Client::LocalPattern<q7_t> output;
+
+            /* Local copies of inputs since matrix instance in CMSIS-DSP are not using
+               pointers to const.
+            */
+            Client::LocalPattern<q7_t> a;
+
+            /* Sparse matrix storage */
+            Client::LocalPattern<q7_t> values;
+            Client::LocalPattern<int16_t> colIdx;
+            uint32_t rowPtr[MAXSPARSEDIM+1];
+
+            arm_matrix_instance_q7 in1;
+
+            arm_spmat_instance_q7 sp;
+    };
@@ -18,12 +18,14 @@ class StatsTestsF32:public Client::Suite
 
             Client::LocalPattern<float32_t> output;
             Client::LocalPattern<int16_t> index;
+            Client::LocalPattern<int32_t> hist;
             Client::LocalPattern<float32_t> tmp;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
             Client::Pattern<int16_t> maxIndexes;
             Client::Pattern<int16_t> minIndexes;
+            Client::RefPattern<int32_t> refHist;
 
             int nbPatterns;
             int vecDim;
@@ -19,6 +19,7 @@ class StatsTestsQ15:public Client::Suite
             Client::LocalPattern<q15_t> output;
             Client::LocalPattern<q63_t> outputPower;
             Client::LocalPattern<int16_t> index;
+            Client::LocalPattern<int32_t> hist;
             Client::LocalPattern<q15_t> tmp;
 
             // Reference patterns are not loaded when we are in dump mode
@@ -26,6 +27,7 @@ class StatsTestsQ15:public Client::Suite
             Client::RefPattern<q63_t> refPower;
             Client::Pattern<int16_t> maxIndexes;
             Client::Pattern<int16_t> minIndexes;
+            Client::RefPattern<int32_t> refHist;
 
             int nbPatterns;
             int vecDim;
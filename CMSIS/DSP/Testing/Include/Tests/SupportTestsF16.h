@@ -14,17 +14,23 @@ class SupportTestsF16:public Client::Suite
             
             Client::Pattern<float16_t> input;
             Client::Pattern<q15_t> inputQ15;
+            Client::Pattern<q31_t> inputQ31;
+            Client::Pattern<q7_t> inputQ7;
             Client::Pattern<float32_t> inputF32;
             Client::Pattern<float16_t> coefs;
             Client::LocalPattern<float16_t> buffer;
 
             Client::LocalPattern<float16_t> output;
             Client::LocalPattern<q15_t> outputQ15;
+            Client::LocalPattern<q31_t> outputQ31;
+            Client::LocalPattern<q7_t> outputQ7;
             Client::LocalPattern<float32_t> outputF32;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float16_t> ref;
             Client::RefPattern<q15_t> refQ15;
+            Client::RefPattern<q31_t> refQ31;
+            Client::RefPattern<q7_t> refQ7;
             Client::RefPattern<float32_t> refF32;
 
             int nbSamples;
@@ -20,14 +20,18 @@ class SupportTestsF32:public Client::Suite
             Client::LocalPattern<q15_t> outputQ15;
             Client::LocalPattern<q31_t> outputQ31;
             Client::LocalPattern<q7_t> outputQ7;
+            Client::LocalPattern<int32_t> index;
+            Client::LocalPattern<int32_t> work;
 
             // Reference patterns are not loaded when we are in dump mode
             Client::RefPattern<float32_t> ref;
             Client::RefPattern<q15_t> refQ15;
             Client::RefPattern<q31_t> refQ31;
             Client::RefPattern<q7_t> refQ7;
+            Client::RefPattern<int32_t> refIndex;
 
             int nbSamples;
+            int nbChannels;
             int offset;
 
     };
@@ -26,5 +26,6 @@ class SupportTestsQ15:public Client::Suite
             Client::RefPattern<q7_t> refQ7;
 
             int nbSamples;
+            int nbChannels;
 
     };
@@ -0,0 +1,32 @@
+#include "Test.h"
+#include "Pattern.h"
+
+#include "dsp/tree_functions.h"
+
+class TreeQ15:public Client::Suite
+    {
+        public:
+            TreeQ15(Testing::testID_t id);
+            virtual void setUp(Testing::testID_t,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr);
+            virtual void tearDown(Testing::testID_t,Client::PatternMgr *mgr);
+        private:
+            #include "TreeQ15_decl.h"
+            
+            Client::Pattern<q15_t> input;
+            Client::Pattern<int16_t> dims;
+            Client::Pattern<int16_t> structure;
+            Client::Pattern<uint32_t> nodes;
+            Client::Pattern<q15_t> thresholds;
+            Client::Pattern<q15_t> leaves;
+            Client::Pattern<q31_t> base;
+
+            Client::LocalPattern<q31_t> output;
+
+            // Reference patterns are not loaded when we are in dump mode
+            Client::RefPattern<q31_t> ref;
+
+            int nbPatterns;
+
+            arm_tree_ensemble_instance_q15 tree;
+
+    };
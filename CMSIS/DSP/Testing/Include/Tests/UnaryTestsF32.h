@@ -51,6 +51,10 @@ class UnaryTestsF32:public Client::Suite
             
             arm_matrix_instance_f32 out;
 
+            arm_matrix_instance_f32_ext in1ext;
+            arm_matrix_instance_f32_ext in2ext;
+            arm_matrix_instance_f32_ext outext;
+
             arm_matrix_instance_f32 outll;
             arm_matrix_instance_f32 outd;
 
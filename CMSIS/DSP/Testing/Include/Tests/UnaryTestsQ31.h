@@ -29,4 +29,8 @@ class UnaryTestsQ31:public Client::Suite
             arm_matrix_instance_q31 in1;
             arm_matrix_instance_q31 in2;
             arm_matrix_instance_q31 out;
+
+            arm_matrix_instance_q31_ext in1ext;
+            arm_matrix_instance_q31_ext in2ext;
+            arm_matrix_instance_q31_ext outext;
     };
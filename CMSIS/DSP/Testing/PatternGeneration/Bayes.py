@@ -1,4 +1,5 @@
 import os.path
+import sys
 import itertools
 import Tools
 import random
@@ -142,6 +143,45 @@ def generateNewTest(config,nb):
 def writeTests(config):
     generateNewTest(config,1)
 
+# The q15 model is quantized with the helper of the Python wrapper
+# which is also a bit exact model of the q15 function.
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)),"..","..","PythonWrapper"))
+
+def writeQuantizedTests(config):
+    import mlquantization
+
+    nb = 1
+    classNb = BAYESCLASSES[nb % len(BAYESCLASSES)]
+    vecDim = VECDIM[nb % len(VECDIM)]
+
+    training = []
+    for _ in range(0,NBTRAININGSAMPLES):
+        v,c=newRandomVector(classNb,vecDim,TRAININGRATIO)
+        training.append(v)
+    gb = trainGaussian(classNb,vecDim)
+
+    inputs = []
+    for _ in range(0,NBTESTSAMPLES):
+        v,c=newRandomVector(classNb,vecDim,PREDICTRATIO)
+        inputs.append(v)
+
+    params = mlquantization.quantizeGaussianNB(gb,training)
+    inputsQ = mlquantization.quantizeInputs(inputs,params["inputShift"])
+    predicts, scores = mlquantization.gaussianNBScoresFixed(params,inputsQ)
+    # The quantized model must be close to the float one for the test to be meaningful
+    assert(np.mean(np.array(params["classes"])[predicts] == gb.predict(inputs)) >= 0.9)
+
+    dims = np.array([NBTESTSAMPLES,classNb,vecDim])
+    p = np.concatenate((params["theta"].reshape(classNb*vecDim),
+         params["invSigma"].reshape(classNb*vecDim)))
+
+    config.writeInputS16(nb, inputsQ.reshape(NBTESTSAMPLES*vecDim),"Inputs")
+    config.writeInputS16(nb, dims,"Dims")
+    config.writeInputS16(nb, p,"Params")
+    config.writeInputS32(nb, params["classConstants"],"Constants")
+    config.writeReferenceS32(nb, scores.reshape(NBTESTSAMPLES*classNb),"Scores")
+    config.writeReferenceS16(nb, predicts,"Predicts")
+
 def writeBenchmark(config):
     someLists=[VECDIM,BAYESCLASSES]
     
@@ -201,5 +241,8 @@ def generatePatterns():
     writeBenchmark(configf32)
     writeBenchmark(configf16)
 
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+    writeQuantizedTests(configq15)
+
 if __name__ == '__main__':
   generatePatterns()
\ No newline at end of file
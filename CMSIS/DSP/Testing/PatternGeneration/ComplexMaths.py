@@ -13,6 +13,17 @@ def randComplex(nb):
     data_comp = data.view(dtype=np.complex128)
     return(data_comp)
 
+# Frequency (cycles per sample) and initial phase (cycles) of the NCO tests
+NCO_FREQ = 0.1234567
+NCO_PHASE = 0.3
+
+def ncoParam(x,format):
+    # Value of the parameter as seen by the implementation
+    if format==31 or format==15:
+        return(np.round(x * 2**31) / 2**31)
+    else:
+        return(float(np.float32(x)))
+
 def asReal(a):
     #return(a.view(dtype=np.float64))
     return(a.reshape(np.size(a)).view(dtype=np.float64))
@@ -99,6 +110,14 @@ def writeTests(config,format):
         config.writeReferenceQ31(9, asReal(ref))
     else:
         config.writeReference(9, asReal(ref))
+
+    if format != 16:
+       n = np.arange(NBSAMPLES)
+       osc = np.exp(2j*np.pi*(ncoParam(NCO_FREQ,format) * n + ncoParam(NCO_PHASE,format)))
+       config.writeReference(10, asReal(osc))
+
+       ref = data3 * np.conj(osc)
+       config.writeReference(11, asReal(ref))
     
 def  generatePatterns():
      PATTERNDIR = os.path.join("Patterns","DSP","ComplexMaths","ComplexMaths")
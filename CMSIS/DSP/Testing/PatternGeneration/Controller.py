@@ -16,6 +16,184 @@ def writeTests(config):
     samples = Tools.normalize(samples)
     config.writeInput(1, samples,"Samples")
 
+# Reference PID controller bank
+def pidBank(coefs,errors):
+    n = coefs.shape[1]
+    Kp,Ki,Kd,Kf,outMin,outMax = coefs
+    I = np.zeros(n)
+    E = np.zeros(n)
+    D = np.zeros(n)
+    outputs = []
+    for e in errors:
+        D = Kf * D + Kd * (e - E)
+        inc = Ki * e
+        newI = I + inc
+        u = Kp * e + newI + D
+        # Anti-windup
+        freeze = ((u > outMax) & (inc > 0)) | ((u < outMin) & (inc < 0))
+        I = np.where(freeze, I, newI)
+        E = e
+        outputs.append(np.clip(u, outMin, outMax))
+    return(np.array(outputs),np.concatenate([I,E,D]))
+
+# Bit exact reference of the Q31 PID controller bank
+def clipQ31(v):
+    return(max(min(v,0x7FFFFFFF),-0x80000000))
+
+def pidBankQ31(coefs,errors,postShift):
+    n = coefs.shape[1]
+    shift = 31 - postShift
+    Kp,Ki,Kd,Kf,outMin,outMax = coefs
+    I = [0] * n
+    E = [0] * n
+    D = [0] * n
+    outputs = []
+    for e in errors:
+        for i in range(n):
+            D[i] = clipQ31(((Kf[i] * D[i]) >> 31) + ((Kd[i] * (e[i] - E[i])) >> shift))
+            inc = clipQ31((Ki[i] * e[i]) >> shift)
+            newI = clipQ31(I[i] + inc)
+            u = clipQ31((Kp[i] * e[i]) >> shift) + newI + D[i]
+            if u > outMax[i]:
+                u = outMax[i]
+                if inc > 0:
+                    newI = I[i]
+            elif u < outMin[i]:
+                u = outMin[i]
+                if inc < 0:
+                    newI = I[i]
+            I[i] = newI
+            E[i] = e[i]
+            outputs.append(u)
+    return(outputs,I + E + D)
+
+# Errors and coefficients of a bank of 7 controllers (not a multiple of 4).
+# Each column is a controller:
+# 0 : generic controller
+# 1 : saturated at outMax. The integrator is frozen and unwinds when the error changes sign
+# 2 : only the filtered derivative. After the step of the error D decays by Kf
+# 3 : saturated at outMin with asymmetric limits
+# 4-6 : random controllers
+def pidBankScenario(nbSteps,gainScale):
+    rng = np.random.RandomState(0)
+    n = 7
+    Kp = np.array([0.5,0.2,0.0,0.3] + list(0.5*rng.rand(3))) * gainScale
+    Ki = np.array([0.1,0.2,0.0,0.1] + list(0.2*rng.rand(3))) * gainScale
+    Kd = np.array([0.2,0.0,0.5,0.0] + list(0.3*rng.rand(3))) * gainScale
+    Kf = np.array([0.0,0.0,0.8,0.0] + list(0.9*rng.rand(3)))
+    outMin = np.array([-0.9,-0.25,-0.99,-0.1,-0.9,-0.9,-0.9])
+    outMax = np.array([0.9,0.25,0.99,0.6,0.9,0.9,0.9])
+
+    errors = 0.1 * rng.randn(nbSteps,n)
+    half = nbSteps // 2
+    errors[:half,1] = 0.5
+    errors[half:,1] = -0.3
+    errors[:,2] = 0.5
+    errors[:half,3] = -0.4
+    errors[half:,3] = 0.2
+    return(np.array([Kp,Ki,Kd,Kf,outMin,outMax]),errors)
+
+def writePIDBankTests(config,format):
+    NBSTEPS=20
+    if format == 31:
+        # Gains up to 4 with a postShift of 2 and big errors
+        # saturate the terms of some controllers
+        postShift = 2
+        coefs,errors = pidBankScenario(NBSTEPS,0.25)
+        errors[:,0] = 0.9 * np.sign(errors[:,0])
+        coefs[0,0] = 3.5 / 4.0
+        coefs[4:6,0] = [-1.0,1.0 - 2**-31]
+        toQ31 = lambda x : np.array([clipQ31(int(round(v * 2**31))) for v in x.reshape(-1)]).reshape(x.shape)
+        qcoefs = toQ31(coefs)
+        qerrors = toQ31(errors)
+        outputs,state = pidBankQ31(qcoefs,qerrors,postShift)
+        config.writeInputS16(1, [coefs.shape[1],NBSTEPS,postShift],"DimsPIDBank")
+        config.writeInput(1, np.concatenate([qcoefs.reshape(-1),qerrors.reshape(-1)]) / 2**31,"InputPIDBank")
+        config.writeReference(1, np.array(outputs + state) / 2**31,"RefPIDBank")
+    else:
+        coefs,errors = pidBankScenario(NBSTEPS,1.0)
+        outputs,state = pidBank(coefs,errors)
+        config.writeInputS16(1, [coefs.shape[1],NBSTEPS],"DimsPIDBank")
+        config.writeInput(1, np.concatenate([coefs.reshape(-1),errors.reshape(-1)]),"InputPIDBank")
+        config.writeReference(1, np.concatenate([outputs.reshape(-1),state]),"RefPIDBank")
+
+
+# Reference FOC transform : Clarke and Park transforms with the exact sine and cosine
+def focTransform(Ia,Ib,theta):
+    s = np.sin(theta * np.pi / 180.0)
+    c = np.cos(theta * np.pi / 180.0)
+    Ialpha = Ia
+    Ibeta = (Ia + 2.0 * Ib) / np.sqrt(3.0)
+    Id = Ialpha * c + Ibeta * s
+    Iq = -Ialpha * s + Ibeta * c
+    return(np.concatenate([Id,Iq,s,c]))
+
+# Sector based space vector modulation.
+# Switching states of the active vectors of each sector
+SVPWM_SECTORS=[((1,0,0),(1,1,0)),
+               ((1,1,0),(0,1,0)),
+               ((0,1,0),(0,1,1)),
+               ((0,1,1),(0,0,1)),
+               ((0,0,1),(1,0,1)),
+               ((1,0,1),(1,0,0))]
+
+def svpwmSector(valpha,vbeta):
+    m = np.hypot(valpha,vbeta)
+    angle = np.mod(np.arctan2(vbeta,valpha),2*np.pi)
+    sector = min(int(angle / (np.pi / 3)),5)
+    a = angle - sector * np.pi / 3
+    # Time of the two active vectors and of the zero vectors
+    t1 = np.sqrt(3.0) * m * np.sin(np.pi / 3 - a)
+    t2 = np.sqrt(3.0) * m * np.sin(a)
+    t0 = 1.0 - t1 - t2
+    v1,v2 = SVPWM_SECTORS[sector]
+    return([t1 * v1[k] + t2 * v2[k] + t0 / 2 for k in range(3)])
+
+# Min-max injection with clamping, valid in the overmodulation region
+def svpwmMinMax(valpha,vbeta):
+    va = valpha
+    vb = -valpha / 2 + np.sqrt(3.0) / 2 * vbeta
+    vc = -valpha / 2 - np.sqrt(3.0) / 2 * vbeta
+    off = 0.5 - (max(va,vb,vc) + min(va,vb,vc)) / 2
+    return([np.clip(v + off,0.0,1.0) for v in (va,vb,vc)])
+
+def writeFOCTests(config,format):
+    # 13 motors (not a multiple of 4)
+    NBMOTORS=13
+    rng = np.random.RandomState(1)
+    Ia = 0.3 * (2 * rng.rand(NBMOTORS) - 1)
+    Ib = 0.3 * (2 * rng.rand(NBMOTORS) - 1)
+    if format == 31:
+        # Angles in [-180 180) are in [-1 1)
+        theta = 360.0 * rng.rand(NBMOTORS) - 180.0
+        theta[0:3] = [-180.0,-90.0,-30.0]
+        config.writeInput(1, np.concatenate([Ia,Ib,theta / 180.0]),"InputFOC")
+    else:
+        # Negative angles and angles beyond one turn
+        theta = 1440.0 * rng.rand(NBMOTORS) - 720.0
+        theta[0:3] = [-90.0,-30.0,-400.0]
+        config.writeInput(1, np.concatenate([Ia,Ib,theta]),"InputFOC")
+    config.writeReference(1, focTransform(Ia,Ib,theta),"RefFOC")
+
+    # Voltage vectors in all the sectors in the linear region
+    # followed by overmodulated vectors
+    NBLINEAR=24
+    NBOVER=7
+    angles = 2 * np.pi * rng.rand(NBLINEAR + NBOVER) - np.pi
+    angles[0:6] = np.pi / 6 + np.arange(6) * np.pi / 3 - np.pi
+    mag = np.concatenate([rng.rand(NBLINEAR) / np.sqrt(3.0) * 0.99,
+                          1.0 / np.sqrt(3.0) + 0.3 * rng.rand(NBOVER)])
+    valpha = mag * np.cos(angles)
+    vbeta = mag * np.sin(angles)
+    duty = [svpwmSector(a,b) for (a,b) in zip(valpha[:NBLINEAR],vbeta[:NBLINEAR])]
+    duty += [svpwmMinMax(a,b) for (a,b) in zip(valpha[NBLINEAR:],vbeta[NBLINEAR:])]
+    duty = np.array(duty).T
+    if format == 31:
+        # Duty cycles are in [0 1)
+        duty = np.minimum(duty,1.0 - 2**-31)
+    config.writeInput(1, np.concatenate([valpha,vbeta]),"InputSVPWM")
+    config.writeReference(1, duty.reshape(-1),"RefSVPWM")
+
     
 def generatePatterns():
     PATTERNDIR = os.path.join("Patterns","DSP","Controller","Controller")
@@ -32,6 +210,12 @@ def generatePatterns():
     writeTests(configq31)
     writeTests(configq15)
 
+    writePIDBankTests(configf32,0)
+    writePIDBankTests(configq31,31)
+
+    writeFOCTests(configf32,0)
+    writeFOCTests(configq31,31)
+
 if __name__ == '__main__':
   generatePatterns()
 
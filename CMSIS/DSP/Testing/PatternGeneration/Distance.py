@@ -193,6 +193,27 @@ def writeFTests(config):
 def writeBTests(config):
     writeBTest(config,[dice,hamming,jaccard,kulsinski,rogerstanimoto,russellrao,sokalmichener,sokalsneath,yule])
 
+def writeCdistTest(config):
+    # Distance matrix between NBQUERIES queries and NBREFS reference vectors.
+    # Odd numbers so that the blocks of 2 queries and of 4 reference
+    # vectors have a remainder.
+    NBQUERIES=5
+    NBREFS=7
+    vecDim=VECDIM[0]
+    rng = np.random.RandomState(10)
+
+    queries = rng.randn(NBQUERIES,vecDim)
+    refs = rng.randn(NBREFS,vecDim)
+
+    outputE = [euclidean(q,r) for q in queries for r in refs]
+    outputC = [cosine(q,r) for q in queries for r in refs]
+
+    config.writeInputS16(10, [NBQUERIES,NBREFS,vecDim],"Dims")
+    config.writeInput(10, queries.reshape(-1),"InputA")
+    config.writeInput(10, refs.reshape(-1),"InputB")
+    config.writeReference(10, outputE,"Ref")
+    config.writeReference(11, outputC,"Ref")
+
 def writeFBenchmark(config):
     NBSAMPLES=256
 
@@ -235,6 +256,7 @@ def  generatePatterns():
      
      writeFTests(configf32)
      writeFTests(configf16)
+     writeCdistTest(configf16)
      writeBTests(configu32)
 
      writeFBenchmark(configf32)
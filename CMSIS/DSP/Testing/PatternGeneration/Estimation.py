@@ -0,0 +1,155 @@
+import os.path
+import numpy as np
+import itertools
+import Tools
+
+# Reference Kalman filter in double precision
+def kalman(F,H,Q,R,P0,z):
+    n = F.shape[0]
+    x = np.zeros(n)
+    P = P0
+    states = []
+    for y in z:
+        x = np.dot(F,x)
+        P = np.dot(np.dot(F,P),F.T) + Q
+
+        S = np.dot(np.dot(H,P),H.T) + R
+        K = np.dot(np.dot(P,H.T),np.linalg.inv(S))
+        x = x + np.dot(K,y - np.dot(H,x))
+        # Joseph form to keep the reference accurate for ill-conditioned covariances
+        I = np.identity(n) - np.dot(K,H)
+        P = np.dot(np.dot(I,P),I.T) + np.dot(np.dot(K,R),K.T)
+        states.append(x)
+    return(np.array(states).reshape(-1))
+
+# Reference exponentially weighted RLS in double precision
+def rls(u,d,lamb,delta):
+    p = u.shape[1]
+    w = np.zeros(p)
+    P = delta * np.identity(p)
+    errors = []
+    for (r,y) in zip(u,d):
+        pi = np.dot(P,r)
+        denom = lamb + np.dot(r,pi)
+        e = y - np.dot(w,r)
+        w = w + e / denom * pi
+        P = (P - np.outer(pi,pi) / denom) / lamb
+        errors.append(e)
+    return(np.array(errors),w)
+
+def randomSPD(n,scale):
+    a = np.random.randn(n,n)
+    return((np.dot(a,a.T) / n + np.identity(n)) * scale)
+
+def writeTests(config):
+    config.setOverwrite(False)
+
+    # (number of states, number of measurements, number of steps)
+    kalmanSizes=[(2,1,20),(3,3,10),(4,2,20),(6,3,15),(8,4,10),(12,6,5)]
+    dims=[]
+    inputs=[]
+    refs=[]
+    for (n,m,steps) in kalmanSizes:
+        dims += [n,m,steps]
+
+        F = np.identity(n) + 0.05 * np.random.randn(n,n)
+        H = np.random.randn(m,n) / np.sqrt(n)
+        Q = randomSPD(n,0.01)
+        R = randomSPD(m,0.1)
+        P0 = randomSPD(n,1.0)
+
+        # Simulated system
+        x = np.random.randn(n)
+        z = []
+        for k in range(steps):
+            x = np.dot(F,x) + 0.1 * np.random.randn(n)
+            z.append(np.dot(H,x) + 0.3 * np.random.randn(m))
+        z = np.array(z)
+
+        inputs += list(F.reshape(-1)) + list(H.reshape(-1)) + list(Q.reshape(-1))
+        inputs += list(R.reshape(-1)) + list(P0.reshape(-1)) + list(z.reshape(-1))
+        refs += list(kalman(F,H,Q,R,P0,z))
+
+    config.writeInputS16(1, dims,"DimsKalman")
+    config.writeInput(1, inputs,"InputKalman")
+    config.writeReference(1, refs,"RefKalman")
+
+    # (number of parameters, number of steps)
+    # lambda = 0.98 and delta = 100 in the tests
+    rlsSizes=[(1,20),(2,50),(5,60),(8,100),(13,100)]
+    dims=[]
+    inputs=[]
+    refs=[]
+    for (p,steps) in rlsSizes:
+        dims += [p,steps]
+
+        # Adaptive FIR identification
+        coefs = np.random.randn(p) / np.sqrt(p)
+        sig = Tools.normalize(np.random.randn(steps + p))
+        u = np.array([sig[k:k+p][::-1] for k in range(steps)])
+        d = np.dot(u,coefs) + 0.01 * np.random.randn(steps)
+
+        e,w = rls(u,d,0.98,100.0)
+
+        inputs += list(u.reshape(-1)) + list(d)
+        refs += list(e) + list(w)
+
+    config.writeInputS16(1, dims,"DimsRLS")
+    config.writeInput(1, inputs,"InputRLS")
+    config.writeReference(1, refs,"RefRLS")
+
+def writeIllConditionedTests(config):
+    # Almost perfect measurements of a system whose initial covariance
+    # has a condition number of 1e8 and without process noise.
+    # Covariance updates of the form P - K H P lose the positive definiteness
+    # in single precision.
+    # (seed, number of states, number of measurements, number of steps)
+    kalmanSizes=[(0,3,1,10),(4,4,1,10),(1,6,2,10)]
+    dims=[]
+    inputs=[]
+    refs=[]
+    for (seed,n,m,steps) in kalmanSizes:
+        dims += [n,m,steps]
+        rng = np.random.RandomState(seed)
+
+        F = np.identity(n) + 0.01 * rng.randn(n,n)
+        U,_ = np.linalg.qr(rng.randn(n,n))
+        P0 = np.dot(np.dot(U,np.diag(np.logspace(0,-8,n))),U.T)
+        H = rng.randn(m,n)
+        Q = np.zeros((n,n))
+        R = 1.0e-6 * np.identity(m)
+
+        x = rng.randn(n)
+        z = []
+        for k in range(steps):
+            x = np.dot(F,x)
+            z.append(np.dot(H,x) + 1.0e-3 * rng.randn(m))
+        z = np.array(z)
+
+        # The noise matrices are given as square roots
+        inputs += list(F.reshape(-1)) + list(H.reshape(-1)) + list(np.sqrt(Q).reshape(-1))
+        inputs += list(np.sqrt(R).reshape(-1)) + list(P0.reshape(-1)) + list(z.reshape(-1))
+        refs += list(kalman(F,H,Q,R,P0,z))
+
+    config.writeInputS16(2, dims,"DimsKalman")
+    config.writeInput(2, inputs,"InputKalman")
+    config.writeReference(2, refs,"RefKalman")
+
+def writeBenchmarks(config):
+    # State transition, observation and noise matrices for the benchmarks
+    NBSAMPLES=12*12
+    data1 = Tools.normalize(np.random.randn(NBSAMPLES))
+    config.writeInput(1, data1,"InputA")
+
+def generatePatterns():
+    PATTERNDIR = os.path.join("Patterns","DSP","Estimation","Estimation")
+    PARAMDIR = os.path.join("Parameters","DSP","Estimation","Estimation")
+    
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    
+    writeTests(configf32)
+    writeIllConditionedTests(configf32)
+    writeBenchmarks(configf32)
+
+if __name__ == '__main__':
+  generatePatterns()
@@ -132,6 +132,57 @@ def writeTestsFloat(config,format):
     config.setOverwrite(True)
 
 
+def quantize(format,x):
+    x = np.array(x)
+    if format == 0:
+       return(x.astype(np.float32).astype(np.float64))
+    if format == 16:
+       return(x.astype(np.float16).astype(np.float64))
+    if format == 31:
+       return(np.clip(np.round(x * 2**31),-2**31,2**31-1) / 2**31)
+    if format == 15:
+       return(np.clip(np.round(x * 2**15),-2**15,2**15-1) / 2**15)
+
+# The references are computed from the quantized inputs
+def writeTranscendentalTests(config,format):
+    # Axis, diagonal and origin points then random points in all quadrants
+    y = np.concatenate((np.array([0.0,0.5,0.0,-0.5,0.25,-0.25,0.25,-0.25,0.0]),0.4*np.random.randn(38)))
+    x = np.concatenate((np.array([0.5,0.0,-0.5,0.0,0.25,0.25,-0.25,-0.25,0.0]),0.4*np.random.randn(38)))
+    y = quantize(format,np.clip(y,-0.99,0.99))
+    x = quantize(format,np.clip(x,-0.99,0.99))
+    v = np.arctan2(y,x)
+    config.writeInput(1, y,"Atan2InputY")
+    config.writeInput(1, x,"Atan2InputX")
+    if format == 31 or format == 15:
+       # Angles in Q2.29 or Q2.13
+       config.writeReference(1, v / 4.0,"Atan2Ref")
+       return
+    config.writeReference(1, v,"Atan2Ref")
+
+    samples = quantize(format,np.concatenate((np.array([0.0,1e-3,-1e-3,0.5,-0.5,20.0,-20.0]),np.linspace(-6,6,38))))
+    config.writeInput(1, samples,"TanhInput")
+    config.writeReference(1, np.tanh(samples),"TanhRef")
+
+    samples = quantize(format,np.concatenate((np.array([0.0,-30.0,30.0]),np.linspace(-12,12,42))))
+    config.writeInput(1, samples,"SigmoidInput")
+    config.writeReference(1, 1.0 / (1.0 + np.exp(-samples)),"SigmoidRef")
+
+    base = quantize(format,np.concatenate((np.array([0.0,2.0,1.0]),np.random.uniform(0.25,4.0,40))))
+    exponent = quantize(format,np.concatenate((np.array([2.0,0.0,3.5]),np.random.uniform(-3.0,3.0,40))))
+    config.writeInput(1, base,"PowInputA")
+    config.writeInput(1, exponent,"PowInputB")
+    config.writeReference(1, np.power(base,exponent),"PowRef")
+
+    if format == 16:
+       return
+
+    samples = quantize(format,np.concatenate((np.array([0.0,1.0,-1.0,0.5,-126.0,100.0]),np.random.uniform(-30,30,37))))
+    config.writeInput(1, samples,"Exp2Input")
+    config.writeReference(1, np.exp2(samples),"Exp2Ref")
+
+    samples = quantize(format,np.concatenate((np.array([1.0,2.0,0.5,1.4142135,1e-30,1e30]),10.0**np.random.uniform(-6,6,37))))
+    config.writeInput(1, samples,"Log2Input")
+    config.writeReference(1, np.log2(samples),"Log2Ref")
 
 
     
@@ -150,6 +201,11 @@ def generatePatterns():
     #writeTests(configq31,31)
     writeTests(configq15,15)
 
+    writeTranscendentalTests(configf32,0)
+    writeTranscendentalTests(configf16,16)
+    writeTranscendentalTests(configq31,31)
+    writeTranscendentalTests(configq15,15)
+
 
 if __name__ == '__main__':
   generatePatterns()
@@ -6,6 +6,7 @@ import Controller
 import Convolutions
 import Decimate
 import Distance
+import Estimation
 import FastMath
 import FIR
 import Matrix
@@ -14,6 +15,7 @@ import Stats
 import Support
 import SVM 
 import Transform
+import Tree
 
 BasicMaths.generatePatterns()
 Bayes.generatePatterns()
@@ -23,6 +25,7 @@ Controller.generatePatterns()
 Convolutions.generatePatterns()
 Decimate.generatePatterns()
 Distance.generatePatterns()
+Estimation.generatePatterns()
 FastMath.generatePatterns()
 FIR.generatePatterns()
 Interpolate.generatePatterns()
@@ -32,3 +35,4 @@ Stats.generatePatterns()
 Support.generatePatterns()
 SVM.generatePatterns() 
 Transform.generatePatterns()
+Tree.generatePatterns()
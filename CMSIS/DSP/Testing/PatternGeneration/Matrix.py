@@ -910,6 +910,197 @@ def writeUnaryTests(config,format):
     config.writeReferenceS16(1, permvals,"RefLDLT_PERM_SDPO")
 
 
+def writeEigSvdTests(config):
+    config.setOverwrite(False)
+
+    # Symmetric eigen decomposition
+    dims=[1,2,3,4,7,8,9,15,16,23,32]
+    inp=[]
+    vals=[]
+    for d in dims:
+       a = np.random.randn(d*d)
+       a = Tools.normalize(a)
+       a = a.reshape(d,d)
+       ma = (a + np.transpose(a)) / 2.0
+       inp = inp + list(ma.reshape(d*d))
+
+       # Eigenvalues sorted by decreasing value
+       w = np.linalg.eigvalsh(ma)
+       vals = vals + list(np.flip(w))
+
+    config.writeInputS16(1, dims,"DimsEig")
+    config.writeInput(1, inp,"InputEig")
+    config.writeReference(1, vals,"RefEigVal")
+
+    # Singular value decomposition (rows >= columns)
+    svdSizes=[(1,1),(2,1),(2,2),(3,2),(4,4),(7,5),(8,8),(9,3),(15,15),(16,9),(23,16),(32,32)]
+    dims=[]
+    inp=[]
+    vals=[]
+    for (r,c) in svdSizes:
+       dims.append(r)
+       dims.append(c)
+       a = np.random.randn(r*c)
+       a = Tools.normalize(a)
+       inp = inp + list(a)
+       s = np.linalg.svd(a.reshape(r,c),compute_uv=False)
+       vals = vals + list(s)
+
+    config.writeInputS16(1, dims,"DimsSVD")
+    config.writeInput(1, inp,"InputSVD")
+    config.writeReference(1, vals,"RefSVD_S")
+
+    r=np.array([(4,4),(8,8),(16,16),(32,32),(64,64)])
+    r=r.reshape(2*5)
+    config.writeParam(1, r,"ParamsEig")
+
+def writeSmallParams(configUnary,configBinary):
+    # Square sizes handled by the fixed size kernels
+    r=np.array([(d,d) for d in range(2,7)])
+    r=r.reshape(2*5)
+    configUnary.writeParam(1, r,"ParamsSmall")
+
+    r=np.array([(d,d,d) for d in range(2,7)])
+    r=r.reshape(3*5)
+    configBinary.writeParam(1, r,"ParamsSmall")
+
+def getSparseMatrix(r,c,density=0.3):
+    a = np.random.randn(r*c)
+    a = Tools.normalize(a)
+    mask = np.random.rand(r*c) < density
+    a = a * mask
+    return(a.reshape(r,c))
+
+def writeSparseTests(config,format):
+    config.setOverwrite(False)
+
+    NBVECSAMPLES=64
+
+    vecdata=np.random.randn(NBVECSAMPLES)
+    vecdata = Tools.normalize(vecdata)
+    if format == Tools.Q7:
+       vecdata = vecdata / 4.0
+
+    config.writeInput(1, vecdata,"InputSparseVec")
+
+    # Sparse matrix and vector multiplication
+    sparseSizes = cartesian([1,4,9,16],[1,5,16,33,64])
+    dims=[]
+    inp=[]
+    vals=[]
+    for (r,c) in sparseSizes:
+       dims.append(r)
+       dims.append(c)
+       ma = getSparseMatrix(r,c)
+       # One empty row
+       if r > 1:
+          ma[r-1,:] = 0.0
+       inp = inp + list(ma.reshape(r*c))
+       v = np.copy(vecdata[0:c])
+       vals = vals + list(ma.dot(v))
+
+    config.writeInputS16(1, dims,"DimsSparse")
+    config.writeInput(1, inp,"InputSparse")
+    config.writeReference(1, vals,"RefSparseVecMul")
+
+    # Sparse matrix and dense matrix multiplication
+    if format == Tools.F32:
+       multSizes = cartesian([1,4,9],[1,5,16,33],[1,3,4,7,8,16])
+       dims=[]
+       inpa=[]
+       inpb=[]
+       vals=[]
+       for (r,i,c) in multSizes:
+          dims.append(r)
+          dims.append(i)
+          dims.append(c)
+          ma = getSparseMatrix(r,i)
+          mb = np.random.randn(i*c)
+          mb = Tools.normalize(mb).reshape(i,c)
+          inpa = inpa + list(ma.reshape(r*i))
+          inpb = inpb + list(mb.reshape(i*c))
+          vals = vals + list(np.dot(ma,mb).reshape(r*c))
+
+       config.writeInputS16(1, dims,"DimsSparseMult")
+       config.writeInput(1, inpa,"InputSparseMultA")
+       config.writeInput(1, inpb,"InputSparseMultB")
+       config.writeReference(1, vals,"RefSparseMult")
+
+       # For benchmarks : dense inputs sparsified in the benchmark
+       NBSAMPLES=64*64
+       data1=np.random.randn(NBSAMPLES)
+       data1 = Tools.normalize(data1)
+       data2=np.random.randn(NBSAMPLES)
+       data2 = Tools.normalize(data2)
+
+       config.writeInput(1, data1,"InputA")
+       config.writeInput(1, data2,"InputB")
+
+def getRandomInvertibleMatrix(d):
+    # Orthogonal transform of a diagonal with well separated values
+    q,r = np.linalg.qr(np.random.randn(d,d))
+    a = np.diag(np.linspace(0.5,1.5,d))
+    return(np.matmul(q,np.matmul(a,np.transpose(q))) + 0.1*np.random.randn(d,d))
+
+def toSoA(matrixes):
+    # Element (i,j) of matrix k at index (i*cols+j)*count + k
+    m = np.array(matrixes)
+    count = m.shape[0]
+    return(list(m.reshape(count,-1).transpose().reshape(-1)))
+
+def writeBatchTests(config):
+    config.setOverwrite(False)
+
+    # (dimension, number of matrices in the batch)
+    batchSizes=[(1,3),(2,5),(3,4),(4,1),(4,7),(4,50),(5,9),(6,13),(8,6)]
+    dims=[]
+    inpa=[]
+    inpb=[]
+    refmult=[]
+    inpinv=[]
+    refinv=[]
+    inpchol=[]
+    refchol=[]
+    for (d,count) in batchSizes:
+       dims.append(d)
+       dims.append(count)
+
+       ma = [Tools.normalize(np.random.randn(d*d)).reshape(d,d) for k in range(count)]
+       mb = [Tools.normalize(np.random.randn(d*d)).reshape(d,d) for k in range(count)]
+       inpa = inpa + toSoA(ma)
+       inpb = inpb + toSoA(mb)
+       refmult = refmult + toSoA([np.matmul(a,b) for (a,b) in zip(ma,mb)])
+
+       mi = [getRandomInvertibleMatrix(d) for k in range(count)]
+       inpinv = inpinv + toSoA(mi)
+       refinv = refinv + toSoA([np.linalg.inv(a) for a in mi])
+
+       mc = []
+       for k in range(count):
+          a = np.random.randn(d,d)
+          mc.append((np.matmul(a,np.transpose(a)) + d*np.identity(d)) / (2*d))
+       inpchol = inpchol + toSoA(mc)
+       refchol = refchol + toSoA([np.linalg.cholesky(a) for a in mc])
+
+    config.writeInputS16(1, dims,"DimsBatch")
+    config.writeInput(1, inpa,"InputBatchMultA")
+    config.writeInput(1, inpb,"InputBatchMultB")
+    config.writeReference(1, refmult,"RefBatchMult")
+    config.writeInput(1, inpinv,"InputBatchInv")
+    config.writeReference(1, refinv,"RefBatchInv")
+    config.writeInput(1, inpchol,"InputBatchChol")
+    config.writeReference(1, refchol,"RefBatchChol")
+
+    # For benchmarks
+    NBSAMPLES=6*6*200
+    data1=np.random.randn(NBSAMPLES)
+    data1 = Tools.normalize(data1)
+    data2=np.random.randn(NBSAMPLES)
+    data2 = Tools.normalize(data2)
+
+    config.writeInput(1, data1,"InputA")
+    config.writeInput(1, data2,"InputB")
+
 def generatePatterns():
     PATTERNBINDIR = os.path.join("Patterns","DSP","Matrix","Binary","Binary")
     PARAMBINDIR = os.path.join("Parameters","DSP","Matrix","Binary","Binary")
@@ -961,5 +1152,27 @@ def generatePatterns():
     writeUnaryTests(configUnaryq15,Tools.Q15)
     writeUnaryTests(configUnaryq7,Tools.Q7)
 
+    writeEigSvdTests(configUnaryf32)
+
+    writeSmallParams(configUnaryf32,configBinaryf32)
+
+    PATTERNSPDIR = os.path.join("Patterns","DSP","Matrix","Sparse","Sparse")
+    PARAMSPDIR = os.path.join("Parameters","DSP","Matrix","Sparse","Sparse")
+
+    configSparsef32=Tools.Config(PATTERNSPDIR,PARAMSPDIR,"f32")
+    configSparseq15=Tools.Config(PATTERNSPDIR,PARAMSPDIR,"q15")
+    configSparseq7=Tools.Config(PATTERNSPDIR,PARAMSPDIR,"q7")
+
+    writeSparseTests(configSparsef32,Tools.F32)
+    writeSparseTests(configSparseq15,Tools.Q15)
+    writeSparseTests(configSparseq7,Tools.Q7)
+
+    PATTERNBATCHDIR = os.path.join("Patterns","DSP","Matrix","Batch","Batch")
+    PARAMBATCHDIR = os.path.join("Parameters","DSP","Matrix","Batch","Batch")
+
+    configBatchf32=Tools.Config(PATTERNBATCHDIR,PARAMBATCHDIR,"f32")
+
+    writeBatchTests(configBatchf32)
+
 if __name__ == '__main__':
   generatePatterns()
\ No newline at end of file
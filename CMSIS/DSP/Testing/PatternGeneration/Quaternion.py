@@ -57,6 +57,58 @@ def writeTests(config,format):
     
 
 
+# Interpolation factor of the slerp test.
+# Must be consistent with the C test.
+SLERP_T = 0.3
+
+def randomUnitQuaternions(nb):
+    q = np.random.randn(nb,4)
+    return(q / np.linalg.norm(q,axis=1).reshape(nb,1))
+
+def rotate(q,v):
+    w = q[0]
+    u = q[1:]
+    t = 2.0 * np.cross(u,v)
+    return(v + w * t + np.cross(u,t))
+
+def slerp(qa,qb,t):
+    d = np.dot(qa,qb)
+    if d < 0:
+        qb = -qb
+        d = -d
+    theta = np.arccos(min(d,1.0))
+    if theta < 1e-12:
+        return(qa)
+    return((np.sin((1-t)*theta)*qa + np.sin(t*theta)*qb) / np.sin(theta))
+
+def writeSoATests(config):
+    """ Patterns for the vector rotation and slerp.
+
+    The patterns are in the usual AoS layout. The tests
+    convert them to the SoA layout.
+    """
+    NBSAMPLES=128
+
+    np.random.seed(0)
+    a = randomUnitQuaternions(NBSAMPLES)
+    b = randomUnitQuaternions(NBSAMPLES)
+    # Close quaternions (linear interpolation) and
+    # quaternions in opposite hemispheres (shortest path)
+    b[0:8] = a[0:8] + 1e-4 * np.random.randn(8,4)
+    b[0:8] = b[0:8] / np.linalg.norm(b[0:8],axis=1).reshape(8,1)
+    b[8:16] = -b[8:16] * np.sign(np.sum(a[8:16]*b[8:16],axis=1)).reshape(8,1)
+    v = np.random.randn(NBSAMPLES,3)
+
+    config.writeInput(8, a.reshape(4*NBSAMPLES))
+    config.writeInput(9, b.reshape(4*NBSAMPLES))
+    config.writeInput(10, v.reshape(3*NBSAMPLES))
+
+    rotateTest = np.array([rotate(a[i],v[i]) for i in range(NBSAMPLES)])
+    config.writeReference(8, rotateTest.reshape(3*NBSAMPLES))
+
+    slerpTest = np.array([slerp(a[i],b[i],SLERP_T) for i in range(NBSAMPLES)])
+    config.writeReference(9, slerpTest.reshape(4*NBSAMPLES))
+
 def generatePatterns():
     PATTERNDIR = os.path.join("Patterns","DSP","QuaternionMaths","QuaternionMaths")
     PARAMDIR = os.path.join("Parameters","DSP","QuaternionMaths","QuaternionMaths")
@@ -68,6 +120,8 @@ def generatePatterns():
     writeTests(configf32,0)
     writeTests(configf16,16)
 
+    writeSoATests(configf32)
+
 
     # Params just as example
     someLists=[[1,3,5],[1,3,5],[1,3,5]]
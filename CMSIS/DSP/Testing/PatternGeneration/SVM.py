@@ -1,4 +1,5 @@
 import os.path
+import sys
 import itertools
 import Tools
 from sklearn import svm
@@ -157,6 +158,140 @@ def writeTests(config):
     newSVMTest(config,RBF,[-1,1],clf,5)
 
 
+# Multi-class tests
+NBCLASSES = 4
+NBVECTORSMULTI = 40
+ONEVSONE = 0
+ONEVSREST = 1
+MULTICLASSES = [2,4,6,8]
+
+def genMultiVector(c,scale):
+    v = np.random.randn(VECDIM) * CENTER_DISTANCE * scale
+    v[c] = v[c] + CENTER_DISTANCE
+    return(v.tolist())
+
+def newSVMMulticlassTest(config,kind,strategy,clf,X,nb):
+    inputs = [] 
+    for i in range(NBTESTSAMPLE):
+        c = np.random.choice(range(NBCLASSES))
+        inputs.append(genMultiVector(c,1.0/2.0/6.0))
+    references=clf.predict(inputs)
+    inputs=np.array(inputs).reshape(NBTESTSAMPLE*VECDIM)
+
+    config.writeInput(nb, inputs,"Samples")
+
+    if strategy == ONEVSONE:
+       supportVectors = clf.support_vectors_
+       nbSupportVectors = supportVectors.shape[0]
+       dualCoefs = clf.dual_coef_
+       intercepts = clf.intercept_
+       nbPerClass = list(clf.n_support_)
+       svc = clf
+    else:
+       # Union of the support vectors of the binary classifiers
+       # and coefficients set to 0 for the unused ones
+       support = sorted(set(itertools.chain(*[e.support_ for e in clf.estimators_])))
+       supportVectors = np.array([X[i] for i in support])
+       nbSupportVectors = len(support)
+       dualCoefs = np.zeros((NBCLASSES,nbSupportVectors))
+       intercepts = []
+       for c,e in enumerate(clf.estimators_):
+           for k,i in enumerate(e.support_):
+               dualCoefs[c,support.index(i)] = e.dual_coef_[0,k]
+           intercepts.append(e.intercept_[0])
+       intercepts = np.array(intercepts)
+       nbPerClass = [0] * NBCLASSES
+       svc = clf.estimators_[0]
+
+    degree = svc.degree if kind == POLY else 0
+    dims=np.array([kind,strategy,NBCLASSES,NBTESTSAMPLE,VECDIM,nbSupportVectors,degree] + MULTICLASSES + nbPerClass)
+    config.writeInputS16(nb, dims,"Dims")
+
+    params=np.concatenate((supportVectors.reshape(nbSupportVectors*VECDIM),
+       dualCoefs.reshape(dualCoefs.size),
+       intercepts,
+       np.array([svc.coef0]),
+       np.array([svc._gamma])))
+    config.writeInput(nb, params,"Params")
+
+    config.writeReferenceS32(nb, references,"Reference")
+
+def writeMulticlassTests(config):
+    from sklearn.multiclass import OneVsRestClassifier
+
+    X = []
+    y = []
+    for i in range(NBVECTORSMULTI):
+        # Each class is needed
+        c = i if i < NBCLASSES else np.random.choice(range(NBCLASSES))
+        X.append(genMultiVector(c,1.0/2.0/10))
+        y.append(MULTICLASSES[c])
+
+    clf = svm.SVC(kernel='rbf',gamma='auto')
+    clf.fit(X, y)
+    newSVMMulticlassTest(config,RBF,ONEVSONE,clf,X,7)
+
+    clf = svm.SVC(kernel='poly',gamma='auto', coef0=1.1)
+    clf.fit(X, y)
+    newSVMMulticlassTest(config,POLY,ONEVSONE,clf,X,8)
+
+    clf = OneVsRestClassifier(svm.SVC(kernel='rbf',gamma='auto'))
+    clf.fit(X, y)
+    newSVMMulticlassTest(config,RBF,ONEVSREST,clf,X,9)
+
+# Fixed-point tests. The models are quantized with the helper of the
+# Python wrapper which is also a bit exact model of the q15 and q7 functions.
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)),"..","..","PythonWrapper"))
+
+def newQuantizedSVMTest(config,format,clf,nb):
+    import mlquantization
+
+    inputs = []
+    for i in range(NBTESTSAMPLE):
+        v = np.random.randn(VECDIM) * CENTER_DISTANCE/2.0/6.0
+        if np.random.choice([0,1]) == 1:
+            v = v + C1[0]
+        inputs.append(v.tolist())
+
+    params = mlquantization.quantizeSVM(clf,X,format)
+    inputsQ = mlquantization.quantizeInputs(inputs,params["inputShift"],format)
+    references = mlquantization.svmPredictFixed(params,inputsQ)
+    # The quantized model must be close to the float one for the test to be meaningful
+    assert(np.mean(references == clf.predict(inputs)) >= 0.95)
+
+    supportVectors = params["supportVectors"]
+    nbSupportVectors = supportVectors.shape[0]
+
+    dims=np.array([params["kind"],params["classes"][0],params["classes"][1],
+        NBTESTSAMPLE,VECDIM,nbSupportVectors,params["degree"],params["gammaShift"]])
+    config.writeInputS16(nb, dims,"Dims")
+
+    p=np.concatenate((params["dualCoefficients"],
+        np.array([params["intercept"],params["coef0"],params["gamma"]])))
+    config.writeInputS16(nb, p,"Params")
+
+    if format == "q7":
+       config.writeInputS8(nb, inputsQ.reshape(NBTESTSAMPLE*VECDIM),"Samples")
+       config.writeInputS8(nb, supportVectors.reshape(nbSupportVectors*VECDIM),"Support")
+    else:
+       config.writeInputS16(nb, inputsQ.reshape(NBTESTSAMPLE*VECDIM),"Samples")
+       config.writeInputS16(nb, supportVectors.reshape(nbSupportVectors*VECDIM),"Support")
+
+    config.writeReferenceS32(nb, references,"Reference")
+
+def writeQuantizedTests(config,format):
+    clf = svm.SVC(kernel='linear')
+    clf.fit(X, y)
+    newQuantizedSVMTest(config,format,clf,1)
+
+    clf = svm.SVC(kernel='poly',gamma='auto', coef0=1.1)
+    clf.fit(X, y)
+    newQuantizedSVMTest(config,format,clf,2)
+
+    clf = svm.SVC(kernel='rbf',gamma='auto')
+    clf.fit(X, y)
+    newQuantizedSVMTest(config,format,clf,3)
+
 def genSVMBenchmark(vecDim,nbVecs,k):
     # We need to enforce a specific number of support vectors
     # But it is a result of the training and not an input
@@ -289,6 +424,14 @@ def generatePatterns():
     writeTests(configf32)
     writeTests(configf16)
 
+    writeMulticlassTests(configf32)
+
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+    configq7=Tools.Config(PATTERNDIR,PARAMDIR,"q7")
+
+    writeQuantizedTests(configq15,"q15")
+    writeQuantizedTests(configq7,"q7")
+
     writeBenchmarks(configf32,Tools.F32)
     writeBenchmarks(configf16,Tools.F16)
 
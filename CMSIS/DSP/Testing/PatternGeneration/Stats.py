@@ -458,6 +458,166 @@ def writeNewsTests(config,nb,format):
 
     config.setOverwrite(False)
 
+def writeAccumTests(config,nb,format):
+    NBSAMPLES = 300
+    data1=np.random.randn(NBSAMPLES)
+
+    # The offset makes the mean much bigger than the standard
+    # deviation which is the difficult case for a single pass
+    # algorithm.
+    data1 = 0.5 + 0.25*Tools.normalize(data1)
+
+    if format==31:
+       data1=floatRound(data1,31)
+
+    if format==15:
+       data1=floatRound(data1,15)
+
+    vals=[np.average(data1),
+          np.var(data1,ddof=1),
+          np.std(data1,ddof=1),
+          math.sqrt(np.dot(data1,data1)/data1.size)]
+    indexes=[np.argmin(data1),np.argmax(data1)]
+
+    config.writeInput(nb, data1,"InputAccum")
+    config.writeReference(nb, vals,"AccumVals")
+    config.writeInputS16(nb, indexes,"AccumIndexes")
+    return(nb+1)
+
+def writeMovingTests(config,nb,format):
+    NBSAMPLES = 300
+    WINDOW = 16
+    HOP = 5
+    data1=np.random.randn(NBSAMPLES)
+    data1 = 0.5 + 0.25*Tools.normalize(data1)
+
+    if format==31:
+       data1=floatRound(data1,31)
+
+    if format==15:
+       data1=floatRound(data1,15)
+
+    # Statistics of the window after each hop
+    vals=[]
+    for i in range(HOP,NBSAMPLES+1,HOP):
+        w=data1[max(0,i-WINDOW):i]
+        vals += [np.average(w),
+                 np.var(w,ddof=1),
+                 math.sqrt(np.dot(w,w)/w.size),
+                 np.min(w),
+                 np.max(w)]
+
+    config.writeInput(nb, data1,"InputMoving")
+    config.writeReference(nb, vals,"MovingVals")
+    return(nb+1)
+
+def writeHistogramTests(config,nb,format):
+    NBSAMPLES = 500
+    # Uniform bins used by the test
+    HISTMIN = -0.5
+    HISTMAX = 0.75
+    HISTBINS = 10
+    data1=np.random.randn(NBSAMPLES)
+    data1 = Tools.normalize(data1)
+    edges = np.array([-0.9,-0.5,-0.2,0.0,0.1,0.3,0.8])
+
+    if format==15:
+       data1=floatRound(data1,15)
+       edges=floatRound(edges,15)
+       # Integer bins of the Q15 version
+       x = np.round(data1 * 2**15).astype(int)
+       lo = int(round(HISTMIN * 2**15))
+       hi = int(round(HISTMAX * 2**15))
+       x = x[(x >= lo) & (x <= hi)]
+       uniform = np.bincount((x - lo) * HISTBINS // (hi - lo + 1), minlength=HISTBINS)
+    else:
+       uniform,_ = np.histogram(data1,bins=HISTBINS,range=(HISTMIN,HISTMAX))
+
+    custom,_ = np.histogram(data1,bins=edges)
+
+    config.writeInput(nb, data1,"InputHist")
+    config.writeInput(nb, edges,"HistEdges")
+    config.writeReferenceS32(nb, uniform,"HistVals")
+    config.writeReferenceS32(nb, custom,"HistEdgesVals")
+    return(nb+1)
+
+def writePercentileTests(config,nb,format):
+    NBSAMPLES = 300
+    data1=np.random.randn(NBSAMPLES)
+    data1 = Tools.normalize(data1)
+    # Some repeated values
+    data1[10:20] = data1[0]
+
+    percentages = [0,1,10,25,50,75,90,99,100]
+    vals=[np.percentile(data1,p) for p in percentages]
+    # Median of an odd and of an even number of samples
+    medians=[np.median(data1[:NBSAMPLES-1]),np.median(data1)]
+
+    config.writeInput(nb, data1,"InputPercentile")
+    config.writeInput(nb, percentages,"Percentages")
+    config.writeReference(nb, vals,"PercentileVals")
+    config.writeReference(nb, medians,"MedianVals")
+    return(nb+1)
+
+def p2Quantile(data,p):
+    """ P-square estimator of Jain and Chlamtac
+
+    It is computed in single precision like the f32 version. In double
+    precision, some markers move one sample earlier or later.
+    """
+    f=np.float32
+    p=f(p)
+    q=sorted([f(x) for x in data[:5]])
+    n=[0,1,2,3,4]
+    d=[f(0),f(2)*p-f(1),f(4)*p-f(2),f(2)*p-f(1),f(0)]
+    incr=[f(0),f(0.5)*p,p,f(0.5)*(f(1)+p),f(1)]
+    for x in data[5:]:
+        x=f(x)
+        if x < q[0]:
+           q[0]=x
+           k=0
+        elif x >= q[4]:
+           q[4]=x
+           k=3
+        else:
+           k=0
+           while x >= q[k+1]:
+              k=k+1
+        for i in range(k+1,5):
+            n[i] += 1
+            d[i] = f(d[i] - f(1))
+        for i in range(5):
+            d[i] = f(d[i] + incr[i])
+        for i in range(1,4):
+            if (d[i] >= 1 and n[i+1]-n[i] > 1) or (d[i] <= -1 and n[i]-n[i-1] > 1):
+               s = f(1) if d[i] >= 1 else f(-1)
+               np1 = f(n[i+1]-n[i])
+               nm1 = f(n[i]-n[i-1])
+               qp = q[i] + s / (np1+nm1) * ((nm1+s)*(q[i+1]-q[i])/np1 + (np1-s)*(q[i]-q[i-1])/nm1)
+               if q[i-1] < qp < q[i+1]:
+                  q[i]=f(qp)
+               elif s > 0:
+                  q[i] = f(q[i] + (q[i+1]-q[i])/np1)
+               else:
+                  q[i] = f(q[i] + (q[i-1]-q[i])/nm1)
+               n[i] += int(s)
+               d[i] = f(d[i] - s)
+    return(float(q[2]))
+
+def writeP2Tests(config,nb,format):
+    NBSAMPLES = 2000
+    data1=np.random.randn(NBSAMPLES)
+    data1 = Tools.normalize(data1)
+    data1 = data1.astype(np.float32).astype(np.float64)
+
+    quantiles=[0.1,0.5,0.9]
+    vals=[p2Quantile(list(data1),p) for p in quantiles]
+
+    config.writeInput(nb, data1,"InputP2")
+    config.writeInput(nb, quantiles,"Quantiles")
+    config.writeReference(nb, vals,"P2Vals")
+    return(nb+1)
+
 def generateBenchmark(config,format):
     NBSAMPLES = 256
     data1=np.random.randn(NBSAMPLES)
@@ -500,14 +660,23 @@ def generatePatterns():
     nb=writeTests(configf32,1,0)
     nb=writeF32OnlyTests(configf32,22)
     writeNewsTests(configf32,nb,Tools.F32)
+    writeAccumTests(configf32,28,Tools.F32)
+    writeMovingTests(configf32,29,Tools.F32)
+    writeHistogramTests(configf32,30,Tools.F32)
+    writePercentileTests(configf32,31,Tools.F32)
+    writeP2Tests(configf32,32,Tools.F32)
 
     writeF64OnlyTests(configf64,22)
 
     nb=writeTests(configq31,1,31)
     writeNewsTests(configq31,nb,Tools.Q31)
+    writeAccumTests(configq31,10,Tools.Q31)
 
     nb=writeTests(configq15,1,15)
     writeNewsTests(configq15,nb,Tools.Q15)
+    writeAccumTests(configq15,10,Tools.Q15)
+    writeMovingTests(configq15,11,Tools.Q15)
+    writeHistogramTests(configq15,12,Tools.Q15)
 
     nb=writeTests(configq7,1,7)
     writeNewsTests(configq7,nb,Tools.Q7)
@@ -102,6 +102,8 @@ def writeTestsF16(config):
     va = Tools.normalize(va)
     config.writeInputF32(1,va,"Samples")
     config.writeInputQ15(3,va,"Samples")
+    config.writeInputQ31(4,va,"Samples")
+    config.writeInputQ7(5,va,"Samples")
     config.writeInput(11,va,"Samples")
 
     # This is for benchmarking the weighted sum and we use only one test pattern
@@ -179,6 +181,114 @@ def writeTests2(config, format):
     config.writeReference(10, ref)
 
 
+def writeRadixTests(config):
+    # Large enough for the radix passes, with repeated values
+    TOPK = 10
+    data = np.random.randn(600)
+    data = Tools.normalize(data)
+    data[100:120] = data[7]
+    data[200:210] = 0.0
+    config.writeInput(12, data)
+    ref = np.sort(data)
+    config.writeReference(12, ref)
+    config.writeReference(12, ref[::-1], "RefDesc")
+    config.writeReferenceS32(12, np.argsort(data, kind='stable'), "RefArgsort")
+    # Largest values first, equal values ranked by increasing index
+    topk = sorted(range(len(data)), key=lambda i: (-data[i], i))[:TOPK]
+    config.writeReference(12, data[topk], "RefTopk")
+    config.writeReferenceS32(12, topk, "RefTopkIndex")
+
+
+def sat(v, bits):
+    return np.clip(v, -2**(bits-1), 2**(bits-1)-1)
+
+def quantize(v, bits):
+    return sat(np.round(v * 2**(bits-1)), bits).astype(np.int64)
+
+def writeAffineTests(configf32,configf16,configq31,configq15,configq7):
+    # Fused conversions with scale and offset.
+    # Fixed-point references are computed with the same truncations
+    # as the C code and written as exact fractional values.
+    NBSAMPLES=255
+
+    # Floating-point sources are going beyond the destination range
+    # to check the saturation
+    x = np.random.uniform(-1.5,1.5,NBSAMPLES).astype(np.float32)
+    configf32.writeInput(13, x, "InputAffine")
+    y = x * np.float32(0.8) - np.float32(0.1)
+    configf32.writeInputQ31(13, y, "RefAffine")
+    configf32.writeInputQ15(13, y, "RefAffine")
+    configf32.writeInputQ7(13, y, "RefAffine")
+
+    # Q31 source
+    x = quantize(np.random.uniform(-1.0,1.0,NBSAMPLES), 32)
+    configq31.writeInput(13, x / 2**31, "InputAffine")
+    configq31.writeInputF32(13, x / 2**31 * 2.0 - 0.25, "RefAffine")
+    r = sat(((x * 0x60000000) >> (47 - 1)) - 100, 16)
+    configq31.writeInputQ15(13, r / 2**15, "RefAffine")
+    r = sat(((x * 0x40000000) >> 55) + 3, 8)
+    configq31.writeInputQ7(13, r / 2**7, "RefAffine")
+
+    # Q15 source
+    x = quantize(np.random.uniform(-1.0,1.0,NBSAMPLES), 16)
+    configq15.writeInput(13, x / 2**15, "InputAffine")
+    configq15.writeInputF32(13, x / 2**15 * 0.7 + 0.1, "RefAffine")
+    r = sat(((x * 0x6000) << (1 + 1)) + 0x01000000, 32)
+    configq15.writeInputQ31(13, r / 2**31, "RefAffine")
+    r = sat(((x * 0x6000) >> (23 - 1)) + 2, 8)
+    configq15.writeInputQ7(13, r / 2**7, "RefAffine")
+
+    # Q7 source
+    x = quantize(np.random.uniform(-1.0,1.0,NBSAMPLES), 8)
+    configq7.writeInput(13, x / 2**7, "InputAffine")
+    configq7.writeInputF32(13, x / 2**7 * 0.5 + 0.25, "RefAffine")
+    r = sat(((x * 0x6000) >> (7 - 1)) + 0x100, 16)
+    configq7.writeInputQ15(13, r / 2**15, "RefAffine")
+    r = sat(((x * 0x4000) << 9) - 0x10000, 32)
+    configq7.writeInputQ31(13, r / 2**31, "RefAffine")
+
+    # f16 conversions are computed in single precision
+    x = np.random.uniform(-1.5,1.5,NBSAMPLES).astype(np.float16)
+    configf16.writeInput(13, x, "InputAffine")
+    y = x.astype(np.float32) * np.float32(0.75) - np.float32(0.125)
+    configf16.writeInputQ15(13, y, "RefAffine")
+    y = x.astype(np.float32) * np.float32(3.0) + np.float32(1.0)
+    configf16.writeInputF32(13, y, "RefAffine")
+
+    xq = quantize(np.random.uniform(-1.0,1.0,NBSAMPLES), 16)
+    configf16.writeInputQ15(14, xq / 2**15, "InputAffine")
+    y = (xq / 2**15 * 0.5 + 0.25).astype(np.float16)
+    configf16.writeReference(14, y, "RefAffine")
+
+    # Large values to check the saturation to the f16 range
+    xf = np.random.uniform(-1.5,1.5,NBSAMPLES).astype(np.float32)
+    configf16.writeInputF32(15, xf, "InputAffine")
+    y = np.clip(xf * np.float32(60000.0), -65504.0, 65504.0).astype(np.float16)
+    configf16.writeReference(15, y, "RefAffine")
+
+
+def writeAffineTestsF16Fixed(configf16):
+    # Q7 and Q31 conversions to and from f16
+    NBSAMPLES=255
+
+    x = np.random.uniform(-1.5,1.5,NBSAMPLES).astype(np.float16)
+    configf16.writeInput(16, x, "InputAffine")
+    y = x.astype(np.float32) * np.float32(0.75) - np.float32(0.125)
+    configf16.writeInputQ7(16, y, "RefAffine")
+    y = x.astype(np.float32) * np.float32(1.0) - np.float32(0.125)
+    configf16.writeInputQ31(16, y, "RefAffine")
+
+    xq = quantize(np.random.uniform(-1.0,1.0,NBSAMPLES), 8)
+    configf16.writeInputQ7(17, xq / 2**7, "InputAffine")
+    y = (xq / 2**7 * 0.5 + 0.25).astype(np.float16)
+    configf16.writeReference(17, y, "RefAffine")
+
+    xq = quantize(np.random.uniform(-1.0,1.0,NBSAMPLES), 32)
+    configf16.writeInputQ31(18, xq / 2**31, "InputAffine")
+    y = (xq / 2**31 * 0.5 + 0.25).astype(np.float16)
+    configf16.writeReference(18, y, "RefAffine")
+
+
 def generatePatterns():
     PATTERNDIR = os.path.join("Patterns","DSP","Support","Support")
     PARAMDIR = os.path.join("Parameters","DSP","Support","Support")
@@ -196,6 +306,9 @@ def generatePatterns():
     writeTestsQ7(configq7)
 
     writeTests2(configf32,0)
+    writeRadixTests(configf32)
+    writeAffineTests(configf32,configf16,configq31,configq15,configq7)
+    writeAffineTestsF16Fixed(configf16)
     
 
     
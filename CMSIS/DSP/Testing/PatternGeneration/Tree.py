@@ -0,0 +1,98 @@
+import os.path
+import sys
+import Tools
+import numpy as np
+from sklearn.datasets import make_classification, make_regression
+from sklearn.ensemble import RandomForestClassifier, GradientBoostingClassifier, GradientBoostingRegressor
+
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)),"..","..","PythonWrapper"))
+import treeexport
+
+# Number of vectors to test for each test.
+# Not a multiple of 4 so that the tail of the batch is tested.
+NBTESTSAMPLES = 37
+# Dimension of the vectors
+VECDIM = 8
+# Number of vectors for training
+NBTRAININGSAMPLES = 300
+
+RANDOMFOREST = 1
+GRADIENTBOOSTING = 2
+REGRESSION = 3
+
+def newModel(kind):
+    """ Trained model, training vectors and test vectors """
+    if kind == REGRESSION:
+        X, y = make_regression(n_samples=NBTRAININGSAMPLES + NBTESTSAMPLES,
+            n_features=VECDIM, noise=1.0, random_state=kind)
+        y = y / np.max(np.abs(y))
+        model = GradientBoostingRegressor(n_estimators=10, max_depth=3, random_state=0)
+    else:
+        X, y = make_classification(n_samples=NBTRAININGSAMPLES + NBTESTSAMPLES,
+            n_features=VECDIM, n_informative=5, n_classes=3, random_state=kind)
+        X = 2.0 * X
+        if kind == RANDOMFOREST:
+            model = RandomForestClassifier(n_estimators=8, max_depth=5, random_state=0)
+        else:
+            model = GradientBoostingClassifier(n_estimators=5, max_depth=3, random_state=0)
+
+    training = X[:NBTRAININGSAMPLES]
+    model.fit(training, y[:NBTRAININGSAMPLES])
+    return(model, training, X[NBTRAININGSAMPLES:])
+
+def referenceScores(model, kind, X):
+    if kind == RANDOMFOREST:
+        return(model.predict_proba(X))
+    if kind == GRADIENTBOOSTING:
+        return(model.decision_function(X))
+    return(model.predict(X))
+
+def writeStructure(config, nb, params):
+    dims = np.array([NBTESTSAMPLES, VECDIM,
+        params["numberOfTrees"], params["numberOfNodes"],
+        params["numberOfOutputs"], params["numberOfLeafValues"]])
+    structure = np.concatenate((params["treeDepths"], params["treeOutputs"], params["featureIndexes"]))
+    nodes = np.concatenate((params["treeRoots"], params["leftChildren"], params["leafIndexes"]))
+
+    config.writeInputS16(nb, dims, "Dims")
+    config.writeInputS16(nb, structure, "Structure")
+    config.writeInputU32(nb, nodes, "Nodes")
+
+def writeTests(configf32, configq15):
+    for kind in [RANDOMFOREST, GRADIENTBOOSTING, REGRESSION]:
+        model, training, inputs = newModel(kind)
+
+        params = treeexport.exportTreeEnsemble(model, "f32")
+        # The exported model must give the scikit-learn scores
+        ref = referenceScores(model, kind, inputs).reshape(NBTESTSAMPLES, params["numberOfOutputs"])
+        assert(np.max(np.abs(treeexport.treeEnsembleScores(params, inputs) - ref)) < 1e-5)
+
+        writeStructure(configf32, kind, params)
+        configf32.writeInput(kind, inputs.reshape(NBTESTSAMPLES*VECDIM), "Inputs")
+        configf32.writeInput(kind, params["thresholds"], "Thresholds")
+        configf32.writeInput(kind, params["leafValues"], "Leaves")
+        configf32.writeInput(kind, params["baseValues"], "Base")
+        configf32.writeReference(kind, ref.reshape(ref.size), "Ref")
+
+        params = treeexport.exportTreeEnsemble(model, "q15", training)
+        inputsQ = treeexport.quantizeInputs(inputs, params["inputShift"], "q15")
+        scores = treeexport.treeEnsembleScores(params, inputsQ)
+
+        writeStructure(configq15, kind, params)
+        configq15.writeInputS16(kind, inputsQ.reshape(NBTESTSAMPLES*VECDIM), "Inputs")
+        configq15.writeInputS16(kind, params["thresholds"], "Thresholds")
+        configq15.writeInputS16(kind, params["leafValues"], "Leaves")
+        configq15.writeInputS32(kind, params["baseValues"], "Base")
+        configq15.writeReferenceS32(kind, scores.reshape(scores.size), "Ref")
+
+def generatePatterns():
+    PATTERNDIR = os.path.join("Patterns","DSP","Tree","Tree")
+    PARAMDIR = os.path.join("Parameters","DSP","Tree","Tree")
+
+    configf32=Tools.Config(PATTERNDIR,PARAMDIR,"f32")
+    configq15=Tools.Config(PATTERNDIR,PARAMDIR,"q15")
+
+    writeTests(configf32, configq15)
+
+if __name__ == '__main__':
+  generatePatterns()
@@ -0,0 +1,159 @@
+#include "BatchF32.h"
+#include "Error.h"
+
+/*
+
+The loop versions process the matrices one after the other
+with the non batched functions. The matrices are contiguous
+in memory (array of structures).
+
+The batched versions use the structure of arrays layout
+with a stride equal to the number of matrices.
+
+*/
+
+#define LOOPINIT()                     \
+      this->in1.pData = ap;            \
+      this->in2.pData = bp;            \
+      this->out.pData = outp;
+
+#define LOOPNEXT()                     \
+      this->in1.pData += nbSamples;    \
+      this->in2.pData += nbSamples;    \
+      this->out.pData += nbSamples;
+
+    void BatchF32::test_mat_mult_loop_f32()
+    {     
+      const int nbSamples = this->nb*this->nb;
+
+      LOOPINIT();
+      for(int k=0; k < this->count; k++)
+      {
+         arm_mat_mult_f32(&this->in1,&this->in2,&this->out);
+         LOOPNEXT();
+      }
+    } 
+
+    void BatchF32::test_mat_mult_batch_f32()
+    {     
+      arm_mat_mult_batch_f32(&this->in1,&this->in2,&this->out,this->count,this->count);
+    } 
+
+    void BatchF32::test_mat_inverse_loop_f32()
+    {     
+      const int nbSamples = this->nb*this->nb;
+
+      LOOPINIT();
+      for(int k=0; k < this->count; k++)
+      {
+         arm_mat_inverse_f32(&this->in1,&this->out);
+         LOOPNEXT();
+      }
+    } 
+
+    void BatchF32::test_mat_inverse_batch_f32()
+    {     
+      arm_mat_inverse_batch_f32(&this->in1,&this->out,this->count,this->count);
+    } 
+
+    void BatchF32::test_mat_cholesky_loop_f32()
+    {     
+      const int nbSamples = this->nb*this->nb;
+
+      LOOPINIT();
+      for(int k=0; k < this->count; k++)
+      {
+         arm_mat_cholesky_f32(&this->in1,&this->out);
+         LOOPNEXT();
+      }
+    } 
+
+    void BatchF32::test_mat_cholesky_batch_f32()
+    {     
+      arm_mat_cholesky_batch_f32(&this->in1,&this->out,this->count,this->count);
+    } 
+
+    
+    void BatchF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+       const float32_t *p;
+       int nbSamples;
+
+       std::vector<Testing::param_t>::iterator it = params.begin();
+       this->nb = *it++;
+       this->count = *it;
+
+       nbSamples = this->nb*this->nb*this->count;
+
+       input1.reload(BatchF32::INPUTA_F32_ID,mgr,nbSamples);
+       input2.reload(BatchF32::INPUTB_F32_ID,mgr,nbSamples);
+
+       a.create(nbSamples,BatchF32::TMPA_F32_ID,mgr);
+       b.create(nbSamples,BatchF32::TMPB_F32_ID,mgr);
+       output.create(nbSamples,BatchF32::OUT_F32_ID,mgr);
+
+       ap = a.ptr();
+       bp = b.ptr();
+       outp = output.ptr();
+
+       memcpy(ap,input1.ptr(),sizeof(float32_t)*nbSamples);
+       memcpy(bp,input2.ptr(),sizeof(float32_t)*nbSamples);
+
+       switch(id)
+       {
+          case TEST_MAT_CHOLESKY_LOOP_F32_5:
+          case TEST_MAT_CHOLESKY_BATCH_F32_6:
+          {
+             /* Positive definite matrices : A A^t + nb I */
+             int elemStride,matStride;
+
+             if (id == TEST_MAT_CHOLESKY_LOOP_F32_5)
+             {
+                elemStride = 1;
+                matStride = this->nb*this->nb;
+             }
+             else
+             {
+                elemStride = this->count;
+                matStride = 1;
+             }
+
+             p = input1.ptr();
+             for(int k=0; k < this->count; k++)
+             {
+                for(int r=0; r < this->nb; r++)
+                {
+                   for(int c=0; c < this->nb; c++)
+                   {
+                      float32_t acc = (r == c) ? (float32_t)this->nb : 0.0f;
+                      for(int l=0; l < this->nb; l++)
+                      {
+                         acc += p[k*matStride + (r*this->nb + l)*elemStride] * 
+                                p[k*matStride + (c*this->nb + l)*elemStride];
+                      }
+                      ap[k*matStride + (r*this->nb + c)*elemStride] = acc;
+                   }
+                }
+             }
+          }
+          break;
+       }
+
+       this->in1.numRows = this->nb;
+       this->in1.numCols = this->nb;
+       this->in1.pData = ap;
+
+       this->in2.numRows = this->nb;
+       this->in2.numCols = this->nb;
+       this->in2.pData = bp;
+
+       this->out.numRows = this->nb;
+       this->out.numCols = this->nb;
+       this->out.pData = outp;
+    }
+
+    void BatchF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+      (void)id;
+      (void)mgr;
+    }
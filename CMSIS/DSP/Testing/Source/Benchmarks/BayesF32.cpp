@@ -15,6 +15,30 @@
 
     } 
 
+
+    void BayesF32::test_gaussian_naive_bayes_loop_f32()
+    {
+       const float32_t *pIn = batch.ptr();
+       uint32_t *pResult = (uint32_t*)batchResult.ptr();
+
+       for(int i=0; i < NB_BATCH; i++)
+       {
+          *pResult++ = arm_gaussian_naive_bayes_predict_f32(&bayes, 
+                pIn, 
+                bufp,tempp);
+          pIn += this->vecDim;
+       }
+    } 
+
+    void BayesF32::test_gaussian_naive_bayes_batch_f32()
+    {
+       arm_gaussian_naive_bayes_predict_batch_f32(&bayes, 
+                batch.ptr(), 
+                NB_BATCH,
+                tempp,
+                (uint32_t*)batchResult.ptr());
+    } 
+
   
     void BayesF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -26,9 +50,24 @@
        switch(id)
        {
           case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_F32_1:
+          case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_LOOP_F32_2:
+          case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_BATCH_F32_3:
           {
 
-            int nbp,nbi;
+            int nbp,nbi,nbt;
+
+            switch(id)
+            {
+               case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_LOOP_F32_2:
+                 nbt = this->nbLoop;
+               break;
+               case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_BATCH_F32_3:
+                 nbt = this->nbBatch;
+               break;
+               default:
+                 nbt = this->nb;
+               break;
+            }
 
             input.reload(BayesF32::INPUTS2_F32_ID,mgr);
             params.reload(BayesF32::PARAMS2_F32_ID,mgr);
@@ -36,8 +75,8 @@
 
             int16_t *dimsp=dims.ptr();
 
-            nbi = dimsp[2*this->nb];
-            nbp = dimsp[2*this->nb + 1];
+            nbi = dimsp[2*nbt];
+            nbp = dimsp[2*nbt + 1];
 
             const float32_t *paramsp = params.ptr() + nbp;
 
@@ -65,6 +104,24 @@
             this->bufp = outputProbas.ptr();
             this->tempp = temp.ptr();
 
+            if (id != BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_F32_1)
+            {
+               /* The batch is NB_BATCH copies of the benchmark input */
+               float32_t *p;
+
+               batch.create(NB_BATCH*this->vecDim,BayesF32::OUT_PROBA_F32_ID,mgr);
+               batchResult.create(NB_BATCH,BayesF32::OUT_PROBA_F32_ID,mgr);
+               temp.create(this->classNb*(this->vecDim + 2),BayesF32::OUT_PROBA_F32_ID,mgr);
+               this->tempp = temp.ptr();
+
+               p = batch.ptr();
+               for(int i=0; i < NB_BATCH; i++)
+               {
+                  memcpy(p,this->inp,sizeof(float32_t)*this->vecDim);
+                  p += this->vecDim;
+               }
+            }
+
           }
           break;
 
@@ -76,6 +133,18 @@
 
     void BayesF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
     {
-        (void)id;
-        this->nb++;
+        switch(id)
+        {
+           case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_F32_1:
+             this->nb++;
+           break;
+
+           case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_LOOP_F32_2:
+             this->nbLoop++;
+           break;
+
+           case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_BATCH_F32_3:
+             this->nbBatch++;
+           break;
+        }
     }
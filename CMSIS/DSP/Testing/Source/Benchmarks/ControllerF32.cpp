@@ -60,6 +60,56 @@
         }
     }
     
+    void ControllerF32::test_pid_bank_f32() 
+    {
+        /* One update of a bank of nbSamples controllers */
+        arm_pid_bank_f32(&instPidBank, this->pSrc, this->pDst);
+    }
+
+    void ControllerF32::test_sin_cos_clarke_park_f32() 
+    {
+        float32_t Ialpha,Ibeta,sinVal,cosVal;
+        float32_t *pId = focOutput.ptr();
+        float32_t *pIq = pId + this->nbSamples;
+
+        for(int i=0; i < this->nbSamples; i++)
+        {
+           arm_sin_cos_f32(this->pSrc[i],&sinVal,&cosVal);
+           arm_clarke_f32(this->pSrc[i],this->pSrc[i],&Ialpha,&Ibeta);
+           arm_park_f32(Ialpha,Ibeta,&pId[i],&pIq[i],sinVal,cosVal);
+        }
+    }
+
+    void ControllerF32::test_foc_transform_f32() 
+    {
+        float32_t sinVal,cosVal;
+        float32_t *pId = focOutput.ptr();
+        float32_t *pIq = pId + this->nbSamples;
+
+        for(int i=0; i < this->nbSamples; i++)
+        {
+           arm_foc_transform_f32(this->pSrc[i],this->pSrc[i],this->pSrc[i],&pId[i],&pIq[i],&sinVal,&cosVal);
+        }
+    }
+
+    void ControllerF32::test_foc_transform_block_f32() 
+    {
+        /* One motor per sample */
+        float32_t *pId = focOutput.ptr();
+
+        arm_foc_transform_block_f32(this->pSrc,this->pSrc,this->pSrc,
+           pId,pId + this->nbSamples,pId + 2*this->nbSamples,pId + 3*this->nbSamples,
+           this->nbSamples);
+    }
+
+    void ControllerF32::test_svpwm_f32() 
+    {
+        /* One motor per sample */
+        float32_t *pDa = focOutput.ptr();
+
+        arm_svpwm_f32(this->pSrc,this->pSrc,pDa,pDa + this->nbSamples,pDa + 2*this->nbSamples,this->nbSamples);
+    }
+
     void ControllerF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -69,6 +119,7 @@
 
        samples.reload(ControllerF32::SAMPLES_F32_ID,mgr,this->nbSamples);
        output.create(this->nbSamples,ControllerF32::OUT_SAMPLES_F32_ID,mgr);
+       focOutput.create(4*this->nbSamples,ControllerF32::OUT_SAMPLES_F32_ID,mgr);
 
        switch(id)
        {
@@ -76,6 +127,24 @@
               arm_pid_init_f32(&instPid,1);
            break;
 
+           case TEST_PID_BANK_F32_7:
+              bankCoeffs.create(6*this->nbSamples,ControllerF32::OUT_SAMPLES_F32_ID,mgr);
+              bankState.create(3*this->nbSamples,ControllerF32::OUT_SAMPLES_F32_ID,mgr);
+              {
+                 float32_t *pCoeffs = bankCoeffs.ptr();
+                 for(int i=0; i < this->nbSamples; i++)
+                 {
+                    pCoeffs[i] = 0.5f;
+                    pCoeffs[this->nbSamples + i] = 0.1f;
+                    pCoeffs[2*this->nbSamples + i] = 0.2f;
+                    pCoeffs[3*this->nbSamples + i] = 0.5f;
+                    pCoeffs[4*this->nbSamples + i] = -0.5f;
+                    pCoeffs[5*this->nbSamples + i] = 0.5f;
+                 }
+              }
+              arm_pid_bank_init_f32(&instPidBank,this->nbSamples,bankCoeffs.ptr(),bankState.ptr());
+           break;
+
        }
 
        this->pSrc=samples.ptr();
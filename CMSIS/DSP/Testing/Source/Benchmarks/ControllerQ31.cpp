@@ -60,6 +60,56 @@
         }
     }
     
+    void ControllerQ31::test_pid_bank_q31() 
+    {
+        /* One update of a bank of nbSamples controllers */
+        arm_pid_bank_q31(&instPidBank, this->pSrc, this->pDst);
+    }
+
+    void ControllerQ31::test_sin_cos_clarke_park_q31() 
+    {
+        q31_t Ialpha,Ibeta,sinVal,cosVal;
+        q31_t *pId = focOutput.ptr();
+        q31_t *pIq = pId + this->nbSamples;
+
+        for(int i=0; i < this->nbSamples; i++)
+        {
+           arm_sin_cos_q31(this->pSrc[i],&sinVal,&cosVal);
+           arm_clarke_q31(this->pSrc[i],this->pSrc[i],&Ialpha,&Ibeta);
+           arm_park_q31(Ialpha,Ibeta,&pId[i],&pIq[i],sinVal,cosVal);
+        }
+    }
+
+    void ControllerQ31::test_foc_transform_q31() 
+    {
+        q31_t sinVal,cosVal;
+        q31_t *pId = focOutput.ptr();
+        q31_t *pIq = pId + this->nbSamples;
+
+        for(int i=0; i < this->nbSamples; i++)
+        {
+           arm_foc_transform_q31(this->pSrc[i],this->pSrc[i],this->pSrc[i],&pId[i],&pIq[i],&sinVal,&cosVal);
+        }
+    }
+
+    void ControllerQ31::test_foc_transform_block_q31() 
+    {
+        /* One motor per sample */
+        q31_t *pId = focOutput.ptr();
+
+        arm_foc_transform_block_q31(this->pSrc,this->pSrc,this->pSrc,
+           pId,pId + this->nbSamples,pId + 2*this->nbSamples,pId + 3*this->nbSamples,
+           this->nbSamples);
+    }
+
+    void ControllerQ31::test_svpwm_q31() 
+    {
+        /* One motor per sample */
+        q31_t *pDa = focOutput.ptr();
+
+        arm_svpwm_q31(this->pSrc,this->pSrc,pDa,pDa + this->nbSamples,pDa + 2*this->nbSamples,this->nbSamples);
+    }
+
     void ControllerQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -69,6 +119,7 @@
 
        samples.reload(ControllerQ31::SAMPLES_Q31_ID,mgr,this->nbSamples);
        output.create(this->nbSamples,ControllerQ31::OUT_SAMPLES_Q31_ID,mgr);
+       focOutput.create(4*this->nbSamples,ControllerQ31::OUT_SAMPLES_Q31_ID,mgr);
 
        switch(id)
        {
@@ -76,6 +127,24 @@
               arm_pid_init_q31(&instPid,1);
            break;
 
+           case TEST_PID_BANK_Q31_7:
+              bankCoeffs.create(6*this->nbSamples,ControllerQ31::OUT_SAMPLES_Q31_ID,mgr);
+              bankState.create(3*this->nbSamples,ControllerQ31::OUT_SAMPLES_Q31_ID,mgr);
+              {
+                 q31_t *pCoeffs = bankCoeffs.ptr();
+                 for(int i=0; i < this->nbSamples; i++)
+                 {
+                    pCoeffs[i] = 0x40000000;
+                    pCoeffs[this->nbSamples + i] = 0x0CCCCCCD;
+                    pCoeffs[2*this->nbSamples + i] = 0x1999999A;
+                    pCoeffs[3*this->nbSamples + i] = 0x40000000;
+                    pCoeffs[4*this->nbSamples + i] = (q31_t)0xC0000000;
+                    pCoeffs[5*this->nbSamples + i] = 0x40000000;
+                 }
+              }
+              arm_pid_bank_init_q31(&instPidBank,this->nbSamples,bankCoeffs.ptr(),bankState.ptr(),0);
+           break;
+
        }
 
        this->pSrc=samples.ptr();
@@ -3,6 +3,8 @@
 #include "Error.h"
 #include "Test.h"
 
+/* Number of reference vectors of the distance matrix benchmarks */
+#define NB_TEMPLATES 32
 
 
     void DistanceF32::test_braycurtis_distance_f32()
@@ -84,6 +86,43 @@
     } 
   
   
+    void DistanceF32::test_pairwise_euclidean_f32()
+    {
+       const float32_t *pTemplates = templates.ptr();
+
+       for(int i=0; i < NB_TEMPLATES; i++)
+       {
+          distp[i] = arm_euclidean_distance_f32(inpA, pTemplates, this->vecDim);
+          pTemplates += this->vecDim;
+       }
+    } 
+
+    void DistanceF32::test_cdist_euclidean_f32()
+    {
+       arm_cdist_f32(&this->cdistS, inpA, 1, distp);
+    } 
+
+    void DistanceF32::test_pairwise_cosine_f32()
+    {
+       const float32_t *pTemplates = templates.ptr();
+
+       for(int i=0; i < NB_TEMPLATES; i++)
+       {
+          distp[i] = arm_cosine_distance_f32(inpA, pTemplates, this->vecDim);
+          pTemplates += this->vecDim;
+       }
+    } 
+
+    void DistanceF32::test_cdist_cosine_f32()
+    {
+       arm_cdist_f32(&this->cdistS, inpA, 1, distp);
+    } 
+
+    void DistanceF32::test_knn_f32()
+    {
+       arm_knn_f32(&this->cdistS, inpA, KNN_K, distp, this->knnDist, this->knnIndex);
+    } 
+  
     void DistanceF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         std::vector<Testing::param_t>::iterator it = paramsArgs.begin();
@@ -112,6 +151,37 @@
 
        inpA=inputA.ptr();
        inpB=inputB.ptr();
+
+       switch(id)
+       {
+          case DistanceF32::TEST_PAIRWISE_EUCLIDEAN_F32_10:
+          case DistanceF32::TEST_CDIST_EUCLIDEAN_F32_11:
+          case DistanceF32::TEST_PAIRWISE_COSINE_F32_12:
+          case DistanceF32::TEST_CDIST_COSINE_F32_13:
+          case DistanceF32::TEST_KNN_F32_14:
+          {
+             float32_t *pTemplates;
+
+             templates.create(NB_TEMPLATES*this->vecDim,DistanceF32::TMPA_F32_ID,mgr);
+             norms.create(NB_TEMPLATES,DistanceF32::TMPB_F32_ID,mgr);
+             dist.create(NB_TEMPLATES,DistanceF32::TMPB_F32_ID,mgr);
+
+             /* The values have no effect on the timing */
+             pTemplates = templates.ptr();
+             for(int i=0; i < NB_TEMPLATES; i++)
+             {
+                memcpy(pTemplates, inpB, sizeof(float32_t) * this->vecDim);
+                pTemplates += this->vecDim;
+             }
+             distp = dist.ptr();
+
+             /* The norms of the templates are computed once, out of the measured function */
+             arm_cdist_init_f32(&this->cdistS,
+                (id == DistanceF32::TEST_CDIST_COSINE_F32_13) ? ARM_CDIST_COSINE : ARM_CDIST_EUCLIDEAN,
+                templates.ptr(), NB_TEMPLATES, this->vecDim, norms.ptr());
+          }
+          break;
+       }
        
 
     }
@@ -3,6 +3,8 @@
 #include "Error.h"
 #include "Test.h"
 
+/* Number of vectors in the batch of the one-to-many benchmarks */
+#define NB_TEMPLATES 64
 
 
   void DistanceU32::test_dice_distance_u32()
@@ -81,6 +83,50 @@
 
   
   
+    void DistanceU32::test_hamming_distance_loop_u32()
+    {
+       const uint32_t *pB = templatesp;
+       uint32_t nbWords = (this->vecDim + 31) >> 5;
+
+       for(int i=0; i < NB_TEMPLATES; i++)
+       {
+          distp[i] = arm_hamming_distance(inpA, pB, this->vecDim);
+          pB += nbWords;
+       }
+    }
+
+    void DistanceU32::test_hamming_distance_batch_u32()
+    {
+       arm_hamming_distance_batch(inpA, templatesp, NB_TEMPLATES, this->vecDim, distp);
+    }
+
+    void DistanceU32::test_hamming_topk_u32()
+    {
+       arm_hamming_topk(inpA, templatesp, NB_TEMPLATES, this->vecDim, TOPK_K, distp, knnIndex);
+    }
+
+    void DistanceU32::test_jaccard_distance_loop_u32()
+    {
+       const uint32_t *pB = templatesp;
+       uint32_t nbWords = (this->vecDim + 31) >> 5;
+
+       for(int i=0; i < NB_TEMPLATES; i++)
+       {
+          distp[i] = arm_jaccard_distance(inpA, pB, this->vecDim);
+          pB += nbWords;
+       }
+    }
+
+    void DistanceU32::test_jaccard_distance_batch_u32()
+    {
+       arm_jaccard_distance_batch(inpA, templatesp, NB_TEMPLATES, this->vecDim, distp);
+    }
+
+    void DistanceU32::test_jaccard_topk_u32()
+    {
+       arm_jaccard_topk(inpA, templatesp, NB_TEMPLATES, this->vecDim, TOPK_K, distp, knnIndex);
+    }
+
     void DistanceU32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         std::vector<Testing::param_t>::iterator it = paramsArgs.begin();
@@ -93,6 +139,36 @@
        
         inpA=inputA.ptr();
         inpB=inputB.ptr();
+
+        switch(id)
+        {
+            case DistanceU32::TEST_HAMMING_DISTANCE_LOOP_U32_10:
+            case DistanceU32::TEST_HAMMING_DISTANCE_BATCH_U32_11:
+            case DistanceU32::TEST_HAMMING_TOPK_U32_12:
+            case DistanceU32::TEST_JACCARD_DISTANCE_LOOP_U32_13:
+            case DistanceU32::TEST_JACCARD_DISTANCE_BATCH_U32_14:
+            case DistanceU32::TEST_JACCARD_TOPK_U32_15:
+            {
+              /* The batch is built from the B pattern with a different
+                 scrambling for each vector */
+              uint32_t nbWords = (this->vecDim + 31) >> 5;
+              uint32_t nbInput = inputB.nbSamples();
+              uint32_t *p;
+
+              templates.create(NB_TEMPLATES*nbWords,DistanceU32::TMP_U32_ID,mgr);
+              dist.create(NB_TEMPLATES,DistanceU32::OUT_F32_ID,mgr);
+
+              p = templates.ptr();
+              for(uint32_t i=0; i < NB_TEMPLATES*nbWords; i++)
+              {
+                 p[i] = inpB[i % nbInput] ^ ((i / nbWords) * 0x9E3779B9U);
+              }
+
+              templatesp = templates.ptr();
+              distp = dist.ptr();
+            }
+            break;
+        }
        
 
     }
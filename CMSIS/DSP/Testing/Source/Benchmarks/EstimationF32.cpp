@@ -0,0 +1,201 @@
+#include "EstimationF32.h"
+#include "Error.h"
+
+/*
+
+The chain version is the usual covariance form of the
+Kalman filter written with the matrix functions:
+
+x = F x
+P = F P F^t + Q
+K = P H^t (H P H^t + R)^-1
+x = x + K (z - H x)
+P = (I - K H) P
+
+The temporaries are allocated in setUp so that only
+the computations are measured.
+
+*/
+
+    void EstimationF32::test_kalman_chain_f32()
+    {     
+      const int n = this->nbStates;
+      const int m = this->nbMeas;
+
+      /* Prediction */
+      arm_mat_vec_mult_f32(&this->F,this->xp,this->tmpN);
+      memcpy(this->xp,this->tmpN,sizeof(float32_t)*n);
+
+      arm_mat_mult_f32(&this->F,&this->P,&this->tmpNN1);
+      arm_mat_mult_f32(&this->tmpNN1,&this->Ft,&this->tmpNN2);
+      arm_mat_add_f32(&this->tmpNN2,&this->Q,&this->P);
+
+      /* Gain */
+      arm_mat_mult_f32(&this->P,&this->Ht,&this->tmpNM);
+      arm_mat_mult_f32(&this->H,&this->tmpNM,&this->tmpMM1);
+      arm_mat_add_f32(&this->tmpMM1,&this->R,&this->tmpMM1);
+      arm_mat_inverse_f32(&this->tmpMM1,&this->tmpMM2);
+      arm_mat_mult_f32(&this->tmpNM,&this->tmpMM2,&this->K);
+
+      /* Update */
+      arm_mat_vec_mult_f32(&this->H,this->xp,this->tmpM);
+      arm_sub_f32(this->measp,this->tmpM,this->tmpM,m);
+      arm_mat_vec_mult_f32(&this->K,this->tmpM,this->tmpN);
+      arm_add_f32(this->xp,this->tmpN,this->xp,n);
+
+      arm_mat_mult_f32(&this->K,&this->H,&this->tmpNN1);
+      arm_mat_sub_f32(&this->I,&this->tmpNN1,&this->tmpNN1);
+      arm_mat_mult_f32(&this->tmpNN1,&this->P,&this->tmpNN2);
+      memcpy(this->P.pData,this->tmpNN2.pData,sizeof(float32_t)*n*n);
+    } 
+
+    void EstimationF32::test_kalman_f32()
+    {     
+      arm_kalman_f32(&this->kalman,this->measp);
+    } 
+
+    void EstimationF32::test_rls_f32()
+    {     
+      arm_rls_f32(&this->rls,this->measp,this->measp + this->nbStates,this->tmpM,1);
+    } 
+
+    
+    void EstimationF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+       float32_t *modelp;
+       float32_t *Fp,*Hp,*Qp,*Rp,*P0p,*Pp;
+       const float32_t *inp;
+       int n,m;
+
+       std::vector<Testing::param_t>::iterator it = params.begin();
+       this->nbStates = *it++;
+       this->nbMeas = *it;
+
+       n = this->nbStates;
+       m = this->nbMeas;
+
+       input1.reload(EstimationF32::INPUTA_F32_ID,mgr);
+       inp = input1.ptr();
+
+       /* F, H, Q, R, P0, P, I and the chain temporaries */
+       model.create(7*n*n + m*n + m*m,EstimationF32::MODEL_F32_ID,mgr);
+       state.create(n+n*n,EstimationF32::STATE_F32_ID,mgr);
+       /* Big enough for the chain temporaries too */
+       work.create(ARM_KALMAN_WORKSPACE_SIZE_F32(n,m) + 3*n*m + 2*m*m + n + m,EstimationF32::WORK_F32_ID,mgr);
+
+       modelp = model.ptr();
+       Fp = modelp;
+       Hp = Fp + n*n;
+       Qp = Hp + m*n;
+       Rp = Qp + n*n;
+       P0p = Rp + m*m;
+       Pp = P0p + n*n;
+
+       /* Stable transition matrix, noise covariances are diagonal */
+       for(int i=0; i < n*n; i++)
+       {
+          Fp[i] = 0.05f * inp[i];
+          Qp[i] = 0.0f;
+          P0p[i] = 0.0f;
+       }
+       for(int i=0; i < n; i++)
+       {
+          Fp[i*n+i] += 1.0f;
+          Qp[i*n+i] = 0.01f;
+          P0p[i*n+i] = 1.0f;
+       }
+       for(int i=0; i < m*n; i++)
+       {
+          Hp[i] = inp[i];
+       }
+       for(int i=0; i < m*m; i++)
+       {
+          Rp[i] = 0.0f;
+       }
+       for(int i=0; i < m; i++)
+       {
+          Rp[i*m+i] = 0.1f;
+       }
+
+       /* Measurements for the Kalman filter, regressors and desired output for the RLS */
+       this->measp = inp + m*n;
+
+       this->xp = state.ptr();
+       memset(this->xp,0,sizeof(float32_t)*n);
+
+       switch(id)
+       {
+          case TEST_KALMAN_CHAIN_F32_1:
+          {
+             float32_t *p = Pp + n*n;
+             float32_t *workp = work.ptr();
+
+             memcpy(Pp,P0p,sizeof(float32_t)*n*n);
+
+             arm_mat_init_f32(&this->F,n,n,Fp);
+             arm_mat_init_f32(&this->H,m,n,Hp);
+             arm_mat_init_f32(&this->Q,n,n,Qp);
+             arm_mat_init_f32(&this->R,m,m,Rp);
+             arm_mat_init_f32(&this->P,n,n,Pp);
+
+             arm_mat_init_f32(&this->I,n,n,p);
+             memset(p,0,sizeof(float32_t)*n*n);
+             for(int i=0; i < n; i++)
+             {
+                p[i*n+i] = 1.0f;
+             }
+             p += n*n;
+
+             arm_mat_init_f32(&this->Ft,n,n,p);
+             arm_mat_trans_f32(&this->F,&this->Ft);
+             p += n*n;
+
+             arm_mat_init_f32(&this->tmpNN1,n,n,p);
+             p += n*n;
+             arm_mat_init_f32(&this->tmpNN2,n,n,p);
+
+             arm_mat_init_f32(&this->Ht,n,m,workp);
+             arm_mat_trans_f32(&this->H,&this->Ht);
+             workp += n*m;
+
+             arm_mat_init_f32(&this->tmpNM,n,m,workp);
+             workp += n*m;
+             arm_mat_init_f32(&this->K,n,m,workp);
+             workp += n*m;
+             arm_mat_init_f32(&this->tmpMM1,m,m,workp);
+             workp += m*m;
+             arm_mat_init_f32(&this->tmpMM2,m,m,workp);
+             workp += m*m;
+
+             this->tmpN = workp;
+             workp += n;
+             this->tmpM = workp;
+          }
+          break;
+
+          case TEST_KALMAN_F32_2:
+             /* The filter is using square roots of the diagonal noise covariances */
+             for(int i=0; i < n; i++)
+             {
+                Qp[i*n+i] = sqrtf(Qp[i*n+i]);
+             }
+             for(int i=0; i < m; i++)
+             {
+                Rp[i*m+i] = sqrtf(Rp[i*m+i]);
+             }
+             arm_kalman_init_f32(&this->kalman,n,m,this->xp,Pp,P0p,Fp,Hp,Qp,Rp,work.ptr());
+          break;
+
+          case TEST_RLS_F32_3:
+             /* The number of parameters is the number of states */
+             arm_rls_init_f32(&this->rls,n,0.98f,100.0f,this->xp,Pp,work.ptr());
+             this->tmpM = work.ptr() + n;
+          break;
+       }
+    }
+
+    void EstimationF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+      (void)id;
+      (void)mgr;
+    }
@@ -1,5 +1,6 @@
 #include "FastMathF32.h"
 #include "Error.h"
+#include <math.h>
 
    
     void FastMathF32::test_cos_f32()
@@ -27,6 +28,104 @@
        }
     } 
 
+    void FastMathF32::test_vsin_f32()
+    {
+       arm_vsin_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_vcos_f32()
+    {
+       arm_vcos_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_vsincos_f32()
+    {
+       arm_vsincos_f32(this->pSrc,this->pDst,this->pDst2,this->nbSamples);
+    } 
+
+    void FastMathF32::test_vsqrt_f32()
+    {
+       arm_vsqrt_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_vtanh_f32()
+    {
+       arm_vtanh_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_tanh_libm_f32()
+    {
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          *this->pDst++ = tanhf(*this->pSrc++);
+       }
+    } 
+
+    void FastMathF32::test_vsigmoid_f32()
+    {
+       arm_vsigmoid_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_sigmoid_libm_f32()
+    {
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          *this->pDst++ = 1.0f / (1.0f + expf(-*this->pSrc++));
+       }
+    } 
+
+    void FastMathF32::test_vexp2_f32()
+    {
+       arm_vexp2_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_exp2_libm_f32()
+    {
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          *this->pDst++ = exp2f(*this->pSrc++);
+       }
+    } 
+
+    void FastMathF32::test_vlog2_f32()
+    {
+       arm_vlog2_f32(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_log2_libm_f32()
+    {
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          *this->pDst++ = log2f(*this->pSrc++);
+       }
+    } 
+
+    void FastMathF32::test_vpow_f32()
+    {
+       arm_vpow_f32(this->pSrc,this->pSrc2,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_pow_libm_f32()
+    {
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          *this->pDst++ = powf(*this->pSrc++,*this->pSrc2++);
+       }
+    } 
+
+    void FastMathF32::test_atan2_f32()
+    {
+       arm_atan2_f32(this->pSrc,this->pSrc2,this->pDst,this->nbSamples);
+    } 
+
+    void FastMathF32::test_atan2_libm_f32()
+    {
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          *this->pDst++ = atan2f(*this->pSrc++,*this->pSrc2++);
+       }
+    } 
+
     void FastMathF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -40,6 +139,17 @@
 
        this->pSrc=samples.ptr();
        this->pDst=output.ptr();
+
+       output2.create(this->nbSamples,FastMathF32::OUT_SAMPLES_F32_ID,mgr);
+       this->pDst2=output2.ptr();
+
+       /* Second operand of pow and atan2 : the samples in reverse order */
+       input2.create(this->nbSamples,FastMathF32::OUT_SAMPLES_F32_ID,mgr);
+       this->pSrc2=input2.ptr();
+       for(int i=0; i < this->nbSamples; i++)
+       {
+          this->pSrc2[i] = this->pSrc[this->nbSamples - 1 - i];
+       }
        
     }
 
@@ -27,6 +27,11 @@
        }
     } 
 
+    void FastMathQ15::test_vsqrt_q15()
+    {
+       arm_vsqrt_q15(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
     void FastMathQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
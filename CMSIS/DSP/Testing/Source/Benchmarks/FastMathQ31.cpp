@@ -27,6 +27,11 @@
        }
     } 
 
+    void FastMathQ31::test_vsqrt_q31()
+    {
+       arm_vsqrt_q31(this->pSrc,this->pDst,this->nbSamples);
+    } 
+
     void FastMathQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
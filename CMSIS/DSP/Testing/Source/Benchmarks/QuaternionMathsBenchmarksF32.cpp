@@ -1,6 +1,17 @@
 #include "QuaternionMathsBenchmarksF32.h"
 #include "Error.h"
 
+/* The SoA functions are benchmarked with the AoS patterns converted to SoA */
+static void aos_to_soa(const float32_t *pSrc, float32_t *pDst, int nb, int stride)
+{
+    for(int i=0; i < nb; i++)
+    {
+        for(int k=0; k < stride; k++)
+        {
+            pDst[k*nb + i] = pSrc[i*stride + k];
+        }
+    }
+}
    
     void QuaternionMathsBenchmarksF32::test_quaternion_norm_f32()
     {
@@ -69,6 +80,48 @@
 
         
 
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_quaternion_conjugate_soa_f32()
+    {
+        arm_quaternion_conjugate_soa_f32(this->inp1,this->outp,this->nb);
+
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_quaternion_normalize_soa_f32()
+    {
+        arm_quaternion_normalize_soa_f32(this->inp1,this->outp,this->nb);
+
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_quaternion_product_soa_f32()
+    {
+        arm_quaternion_product_soa_f32(this->inp1,this->inp2,this->outp,this->nb);
+
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_quaternion2rotation_soa_f32()
+    {
+        arm_quaternion2rotation_soa_f32(this->inp1,this->outp,this->nb);
+
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_rotation2quaternion_soa_f32()
+    {
+        arm_rotation2quaternion_soa_f32(this->inp1,this->outp,this->nb);
+
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_quaternion_rotate_soa_f32()
+    {
+        arm_quaternion_rotate_soa_f32(this->inp1,this->inp2,this->outp,this->nb);
+
+    } 
+
+    void QuaternionMathsBenchmarksF32::test_quaternion_slerp_soa_f32()
+    {
+        arm_quaternion_slerp_soa_f32(this->inp1,this->inp2,0.3f,this->outp,this->nb);
+
     } 
 
     
@@ -150,6 +203,95 @@
             this->outp=output.ptr();
           break;
 
+          case QuaternionMathsBenchmarksF32::TEST_QUATERNION_CONJUGATE_SOA_F32_9:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT1_F32_ID,mgr,this->nb*4);
+            soaInput1.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,4);
+
+            this->inp1=soaInput1.ptr();
+            this->outp=output.ptr();
+          break;
+
+          case QuaternionMathsBenchmarksF32::TEST_QUATERNION_NORMALIZE_SOA_F32_10:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT1_F32_ID,mgr,this->nb*4);
+            soaInput1.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,4);
+
+            this->inp1=soaInput1.ptr();
+            this->outp=output.ptr();
+          break;
+
+          case QuaternionMathsBenchmarksF32::TEST_QUATERNION_PRODUCT_SOA_F32_11:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT1_F32_ID,mgr,this->nb*4);
+            input2.reload(QuaternionMathsBenchmarksF32::INPUT2_F32_ID,mgr,this->nb*4);
+            soaInput1.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            soaInput2.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,4);
+            aos_to_soa(input2.ptr(),soaInput2.ptr(),this->nb,4);
+
+            this->inp1=soaInput1.ptr();
+            this->inp2=soaInput2.ptr();
+            this->outp=output.ptr();
+          break;
+
+          case QuaternionMathsBenchmarksF32::TEST_QUATERNION2ROTATION_SOA_F32_12:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT1_F32_ID,mgr,this->nb*4);
+            soaInput1.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*9,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,4);
+
+            this->inp1=soaInput1.ptr();
+            this->outp=output.ptr();
+          break;
+
+          case QuaternionMathsBenchmarksF32::TEST_ROTATION2QUATERNION_SOA_F32_13:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT_ROT_F32_ID,mgr,this->nb*9);
+            soaInput1.create(this->nb*9,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,9);
+
+            this->inp1=soaInput1.ptr();
+            this->outp=output.ptr();
+          break;
+
+          case QuaternionMathsBenchmarksF32::TEST_QUATERNION_ROTATE_SOA_F32_14:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT_UNIT_F32_ID,mgr,this->nb*4);
+            input2.reload(QuaternionMathsBenchmarksF32::INPUT_VEC_F32_ID,mgr,this->nb*3);
+            soaInput1.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            soaInput2.create(this->nb*3,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*3,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,4);
+            aos_to_soa(input2.ptr(),soaInput2.ptr(),this->nb,3);
+
+            this->inp1=soaInput1.ptr();
+            this->inp2=soaInput2.ptr();
+            this->outp=output.ptr();
+          break;
+
+          case QuaternionMathsBenchmarksF32::TEST_QUATERNION_SLERP_SOA_F32_15:
+            input1.reload(QuaternionMathsBenchmarksF32::INPUT_UNIT_F32_ID,mgr,this->nb*4);
+            input2.reload(QuaternionMathsBenchmarksF32::INPUT_UNIT2_F32_ID,mgr,this->nb*4);
+            soaInput1.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            soaInput2.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+            output.create(this->nb*4,QuaternionMathsBenchmarksF32::OUT_SAMPLES_F32_ID,mgr);
+
+            aos_to_soa(input1.ptr(),soaInput1.ptr(),this->nb,4);
+            aos_to_soa(input2.ptr(),soaInput2.ptr(),this->nb,4);
+
+            this->inp1=soaInput1.ptr();
+            this->inp2=soaInput2.ptr();
+            this->outp=output.ptr();
+          break;
+
        }
     }
 
@@ -2,6 +2,9 @@
 #include <stdio.h>
 #include "Error.h"
 
+/* Number of binary classifiers of the one vs one benchmarks */
+#define NB_PAIRS (NB_CLASSES*(NB_CLASSES-1)/2)
+
 
 void SVMF32::test_svm_linear_predict_f32()
 {
@@ -40,6 +43,42 @@ void SVMF32::test_svm_sigmoid_predict_f32()
 
 } 
 
+void SVMF32::test_svm_rbf_ovo_loop_f32()
+{
+      int32_t result;
+
+      for(int i=0; i < NB_PAIRS; i++)
+      {
+         arm_svm_rbf_predict_f32(&this->pairs[i],inp,&result);
+         this->votes[result]++;
+      }
+}
+
+void SVMF32::test_svm_multiclass_ovo_f32()
+{
+      int32_t result;
+
+      arm_svm_multiclass_predict_f32(&this->multiclass,inp,&result);
+}
+
+void SVMF32::test_svm_linear_loop_f32()
+{
+      const float32_t *pIn = batch.ptr();
+      int32_t *pResult = batchResult.ptr();
+
+      for(int i=0; i < NB_BATCH; i++)
+      {
+         arm_svm_linear_predict_f32(&this->linear,pIn,pResult);
+         pIn += this->vecDim;
+         pResult++;
+      }
+}
+
+void SVMF32::test_svm_linear_batch_f32()
+{
+      arm_svm_linear_predict_batch_f32(&this->linear,batch.ptr(),NB_BATCH,batchScratch.ptr(),batchResult.ptr());
+}
+
 void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparams,Client::PatternMgr *mgr)
 {
       
@@ -54,7 +93,23 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
       switch(id)
       {
           case SVMF32::TEST_SVM_LINEAR_PREDICT_F32_1:
+          case SVMF32::TEST_SVM_LINEAR_LOOP_F32_7:
+          case SVMF32::TEST_SVM_LINEAR_BATCH_F32_8:
           {
+             int nb;
+
+             switch(id)
+             {
+                case SVMF32::TEST_SVM_LINEAR_LOOP_F32_7:
+                  nb = this->nbLinearLoop;
+                break;
+                case SVMF32::TEST_SVM_LINEAR_BATCH_F32_8:
+                  nb = this->nbLinearBatch;
+                break;
+                default:
+                  nb = this->nbLinear;
+                break;
+             }
 
              samples.reload(SVMF32::INPUT_F32_ID,mgr,this->vecDim);
              params.reload(SVMF32::PARAMS_LINEAR_F32_ID,mgr);
@@ -62,8 +117,8 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
 
              int16_t *dimsp=dims.ptr();
 
-             nbi = dimsp[2*this->nbLinear];
-             nbp = dimsp[2*this->nbLinear + 1];
+             nbi = dimsp[2*nb];
+             nbp = dimsp[2*nb + 1];
 
              paramsp = params.ptr() + nbp;
 
@@ -115,6 +170,28 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
           }
           break;
 
+          case SVMF32::TEST_SVM_RBF_OVO_LOOP_F32_5:
+          case SVMF32::TEST_SVM_MULTICLASS_OVO_F32_6:
+          {
+             int nb = (id == SVMF32::TEST_SVM_RBF_OVO_LOOP_F32_5) ? this->nbRBFLoop : this->nbMulticlass;
+             
+             samples.reload(SVMF32::INPUT_F32_ID,mgr,this->vecDim);
+             params.reload(SVMF32::PARAMS_RBF_F32_ID,mgr);
+             dims.reload(SVMF32::DIMS_RBF_S16_ID,mgr);
+
+             int16_t *dimsp=dims.ptr();
+
+             nbi = dimsp[2*nb];
+             nbp = dimsp[2*nb + 1];
+
+             paramsp = params.ptr() + nbp;
+
+             inp=samples.ptr() + nbi;
+
+             kind = SVMF32::RBF;
+          }
+          break;
+
           case SVMF32::TEST_SVM_SIGMOID_PREDICT_F32_4:
           {
              samples.reload(SVMF32::INPUT_F32_ID,mgr,this->vecDim);
@@ -171,6 +248,8 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
        switch(id)
        {
           case SVMF32::TEST_SVM_LINEAR_PREDICT_F32_1:
+          case SVMF32::TEST_SVM_LINEAR_LOOP_F32_7:
+          case SVMF32::TEST_SVM_LINEAR_BATCH_F32_8:
           {
              
              arm_svm_linear_init_f32(&linear, 
@@ -180,6 +259,23 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
                  this->dualCoefs,
                  this->supportVectors,
                  this->classes);
+
+             if (id != SVMF32::TEST_SVM_LINEAR_PREDICT_F32_1)
+             {
+                /* The batch is NB_BATCH copies of the benchmark input */
+                float32_t *p;
+
+                batch.create(NB_BATCH*this->vecDim,SVMF32::TMP_F32_ID,mgr);
+                batchScratch.create(this->vecDim + NB_BATCH,SVMF32::TMP_F32_ID,mgr);
+                batchResult.create(NB_BATCH,SVMF32::OUT_S32_ID,mgr);
+
+                p = batch.ptr();
+                for(int i=0; i < NB_BATCH; i++)
+                {
+                   memcpy(p,this->inp,sizeof(float32_t)*this->vecDim);
+                   p += this->vecDim;
+                }
+             }
           }
           break;
 
@@ -230,6 +326,66 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
                  );
           }
           break;
+
+          case SVMF32::TEST_SVM_RBF_OVO_LOOP_F32_5:
+          case SVMF32::TEST_SVM_MULTICLASS_OVO_F32_6:
+          {
+             /* The benchmark support vectors are all the same. Each class
+                gets nbSupportVectors copies and each pair classifier
+                uses 2*nbSupportVectors of them as with scikit-learn. */
+             int nbSV = NB_CLASSES*this->nbSupportVectors;
+             float32_t *p;
+
+             mcSupport.create(nbSV*this->vecDim,SVMF32::TMP_F32_ID,mgr);
+             mcDualCoefs.create((NB_CLASSES-1)*nbSV,SVMF32::TMP_F32_ID,mgr);
+             mcIntercepts.create(NB_PAIRS,SVMF32::TMP_F32_ID,mgr);
+             mcState.create(2*nbSV+NB_CLASSES,SVMF32::TMP_F32_ID,mgr);
+
+             p = mcSupport.ptr();
+             for(int i=0; i < nbSV; i++)
+             {
+                memcpy(p,this->supportVectors,sizeof(float32_t)*this->vecDim);
+                p += this->vecDim;
+             }
+             arm_fill_f32(this->dualCoefs[0],mcDualCoefs.ptr(),(NB_CLASSES-1)*nbSV);
+             arm_fill_f32(this->intercept,mcIntercepts.ptr(),NB_PAIRS);
+
+             for(int i=0; i < NB_CLASSES; i++)
+             {
+                this->mcClasses[i] = i;
+                this->mcNbPerClass[i] = this->nbSupportVectors;
+                this->votes[i] = 0;
+             }
+
+             for(int i=0; i < NB_PAIRS; i++)
+             {
+                arm_svm_rbf_init_f32(&this->pairs[i],
+                    2*this->nbSupportVectors,
+                    this->vecDim,
+                    this->intercept,
+                    mcDualCoefs.ptr(),
+                    mcSupport.ptr(),
+                    this->classes,
+                    this->gamma);
+             }
+
+             arm_svm_multiclass_init_f32(&multiclass,
+                 ARM_SVM_ONE_VS_ONE,
+                 ARM_ML_KERNEL_RBF,
+                 NB_CLASSES,
+                 nbSV,
+                 this->vecDim,
+                 this->mcNbPerClass,
+                 mcIntercepts.ptr(),
+                 mcDualCoefs.ptr(),
+                 mcSupport.ptr(),
+                 this->mcClasses,
+                 0,
+                 0.0f,
+                 this->gamma,
+                 mcState.ptr());
+          }
+          break;
        }
 
 
@@ -255,6 +411,22 @@ void SVMF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
              case SVMF32::TEST_SVM_SIGMOID_PREDICT_F32_4:
               nbSigmoid++;
              break;
+
+             case SVMF32::TEST_SVM_RBF_OVO_LOOP_F32_5:
+              nbRBFLoop++;
+             break;
+
+             case SVMF32::TEST_SVM_MULTICLASS_OVO_F32_6:
+              nbMulticlass++;
+             break;
+
+             case SVMF32::TEST_SVM_LINEAR_LOOP_F32_7:
+              nbLinearLoop++;
+             break;
+
+             case SVMF32::TEST_SVM_LINEAR_BATCH_F32_8:
+              nbLinearBatch++;
+             break;
         }
 }
 
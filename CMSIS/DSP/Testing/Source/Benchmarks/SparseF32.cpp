@@ -0,0 +1,87 @@
+#include "SparseF32.h"
+#include "Error.h"
+
+   
+    void SparseF32::test_mat_vec_mult_f32()
+    {     
+      arm_mat_vec_mult_f32(&this->in1, vecp, outp);
+    } 
+
+    void SparseF32::test_spmat_vec_mult_f32()
+    {     
+      arm_spmat_vec_mult_f32(&this->sp, vecp, outp);
+    } 
+
+    void SparseF32::test_mat_mult_f32()
+    {     
+      arm_mat_mult_f32(&this->in1,&this->in2,&this->out);
+    } 
+
+    void SparseF32::test_spmat_mult_dense_f32()
+    {     
+      arm_spmat_mult_dense_f32(&this->sp,&this->in2,&this->out);
+    } 
+
+    
+    void SparseF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+       float32_t *p, *aPtr;
+       uint32_t r;
+
+       (void)id;
+
+       std::vector<Testing::param_t>::iterator it = params.begin();
+       this->nb = *it++;
+       this->density = *it;
+
+       input1.reload(SparseF32::INPUTA_F32_ID,mgr,this->nb*this->nb);
+       input2.reload(SparseF32::INPUTB_F32_ID,mgr,this->nb*this->nb);
+       vec.reload(SparseF32::INPUTVEC_F32_ID,mgr,this->nb);
+
+       a.create(this->nb*this->nb,SparseF32::TMPA_F32_ID,mgr);
+       values.create(this->nb*this->nb,SparseF32::TMPV_F32_ID,mgr);
+       colIdx.create(this->nb*this->nb,SparseF32::TMPI_S16_ID,mgr);
+       output.create(this->nb*this->nb,SparseF32::OUT_F32_ID,mgr);
+
+       /* Keep a pseudo random subset of the input values
+          with the requested percentage of non zero values */
+       p = input1.ptr();
+       aPtr = a.ptr();
+       for(int i=0; i < this->nb*this->nb; i++)
+       {
+          r = (uint32_t)i * 2654435761U;
+          if ((int)((r >> 16) % 100U) < this->density)
+          {
+            aPtr[i] = p[i];
+          }
+          else
+          {
+            aPtr[i] = 0.0f;
+          }
+       }
+
+       this->in1.numRows = this->nb;
+       this->in1.numCols = this->nb;
+       this->in1.pData = aPtr;   
+
+       this->in2.numRows = this->nb;
+       this->in2.numCols = this->nb;
+       this->in2.pData = input2.ptr();   
+
+       this->out.numRows = this->nb;
+       this->out.numCols = this->nb;
+       this->out.pData = output.ptr();     
+
+       this->sp.pRowPtr = rowPtr;
+       this->sp.pColIdx = (uint16_t*)colIdx.ptr();
+       this->sp.pData = values.ptr();
+
+       arm_spmat_from_mat_f32(&this->in1,&this->sp,this->nb*this->nb);
+
+       vecp = vec.ptr();
+       outp = output.ptr();
+    }
+
+    void SparseF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+    }
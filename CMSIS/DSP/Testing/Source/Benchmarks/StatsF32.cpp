@@ -178,6 +178,31 @@
       
     } 
 
+
+    void StatsF32::test_stats_separate_f32()
+    {
+        float32_t mean, var, std, rms, minVal, maxVal;
+        uint32_t  minIndex, maxIndex;
+
+        arm_mean_f32(inap,this->nb,&mean);
+        arm_var_f32(inap,this->nb,&var);
+        arm_std_f32(inap,this->nb,&std);
+        arm_rms_f32(inap,this->nb,&rms);
+        arm_min_f32(inap,this->nb,&minVal,&minIndex);
+        arm_max_f32(inap,this->nb,&maxVal,&maxIndex);
+
+    }
+
+    void StatsF32::test_stats_accum_f32()
+    {
+        float32_t mean, var, std, rms;
+
+        arm_stats_accum_init_f32(&this->accum);
+        arm_stats_accum_f32(&this->accum,inap,this->nb);
+        arm_stats_accum_result_f32(&this->accum,&mean,&var,&std,&rms);
+
+    }
+
    
   
     void StatsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
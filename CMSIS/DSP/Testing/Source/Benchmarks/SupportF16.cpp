@@ -1,6 +1,10 @@
 #include "SupportF16.h"
 #include "Error.h"
 
+/* Scale and offset of the conversion benchmarks */
+#define AFFINE_SCALE 0.8f
+#define AFFINE_OFFSET (-0.1f)
+
    
     void SupportF16::test_copy_f16()
     {
@@ -28,6 +32,46 @@
       arm_weighted_sum_f16(this->pSrc, this->pWeights,this->nbSamples);
     }
 
+    void SupportF16::test_convert_affine_q15_f16()
+    {
+      arm_convert_affine_q15_f16(this->pSrcQ15,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_q7_f16()
+    {
+      arm_convert_affine_q7_f16(this->pSrcQ7,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_q31_f16()
+    {
+      arm_convert_affine_q31_f16(this->pSrcQ31,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_f32_f16()
+    {
+      arm_convert_affine_f32_f16(this->pSrcF32,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_f16_q15()
+    {
+      arm_convert_affine_f16_q15(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstQ15,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_f16_q7()
+    {
+      arm_convert_affine_f16_q7(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstQ7,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_f16_q31()
+    {
+      arm_convert_affine_f16_q31(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstQ31,this->nbSamples);
+    }
+
+    void SupportF16::test_convert_affine_f16_f32()
+    {
+      arm_convert_affine_f16_f32(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstF32,this->nbSamples);
+    }
+
     void SupportF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -64,6 +108,42 @@
               this->pWeights=weights.ptr();
            break;
 
+           case TEST_CONVERT_AFFINE_Q15_F16_6:
+             samplesQ15.reload(SupportF16::SAMPLES_Q15_ID,mgr,this->nbSamples);
+             this->pSrcQ15=samplesQ15.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_Q7_F16_7:
+             samplesQ7.reload(SupportF16::SAMPLES_Q7_ID,mgr,this->nbSamples);
+             this->pSrcQ7=samplesQ7.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_Q31_F16_8:
+             samplesQ31.reload(SupportF16::SAMPLES_Q31_ID,mgr,this->nbSamples);
+             this->pSrcQ31=samplesQ31.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_F32_F16_9:
+             samplesF32.reload(SupportF16::SAMPLES_F32_ID,mgr,this->nbSamples);
+             this->pSrcF32=samplesF32.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_F16_Q15_10:
+           case TEST_CONVERT_AFFINE_F16_Q7_11:
+           case TEST_CONVERT_AFFINE_F16_Q31_12:
+           case TEST_CONVERT_AFFINE_F16_F32_13:
+             samples.reload(SupportF16::SAMPLES_F16_ID,mgr,this->nbSamples);
+             outputQ15.create(this->nbSamples,SupportF16::OUT_SAMPLES_F16_ID,mgr);
+             outputQ7.create(this->nbSamples,SupportF16::OUT_SAMPLES_F16_ID,mgr);
+             outputQ31.create(this->nbSamples,SupportF16::OUT_SAMPLES_F16_ID,mgr);
+             outputF32.create(this->nbSamples,SupportF16::OUT_SAMPLES_F16_ID,mgr);
+             this->pSrc=samples.ptr();
+             this->pDstQ15=outputQ15.ptr();
+             this->pDstQ7=outputQ7.ptr();
+             this->pDstQ31=outputQ31.ptr();
+             this->pDstF32=outputF32.ptr();
+           break;
+
        }
 
        this->pDst=output.ptr();
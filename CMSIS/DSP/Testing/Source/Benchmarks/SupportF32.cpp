@@ -1,6 +1,18 @@
 #include "SupportF32.h"
 #include "Error.h"
 
+/* Number of values selected by the top-k benchmark */
+#define TOPK 10
+
+/* Order of the input of the sort benchmarks */
+#define ORDER_RANDOM 0
+#define ORDER_SORTED 1
+#define ORDER_REVERSED 2
+
+/* Scale and offset of the conversion benchmarks */
+#define AFFINE_SCALE 0.8f
+#define AFFINE_OFFSET (-0.1f)
+
    
     void SupportF32::test_copy_f32()
     {
@@ -32,11 +44,97 @@
       arm_weighted_sum_f32(this->pSrc, this->pWeights,this->nbSamples);
     }
 
+    void SupportF32::test_quick_sort_f32()
+    {
+      arm_sort_f32(&this->sortS, this->pSrc, this->pDst, this->nbSamples);
+    }
+
+    void SupportF32::test_radix_sort_f32()
+    {
+      arm_sort_f32(&this->sortS, this->pSrc, this->pDst, this->nbSamples);
+    }
+
+    void SupportF32::test_argsort_f32()
+    {
+      arm_argsort_f32(&this->argsortS, this->pSrc, this->pIndex, this->nbSamples);
+    }
+
+    void SupportF32::test_topk_f32()
+    {
+      arm_topk_f32(this->pSrc, this->nbSamples, TOPK, ARM_SORT_DESCENDING, this->pDst, this->pIndex);
+    }
+
+    void SupportF32::test_affine_q15_f32_unfused()
+    {
+      arm_q15_to_float(this->pSrcQ15,this->pDst,this->nbSamples);
+      arm_scale_f32(this->pDst,AFFINE_SCALE,this->pDst,this->nbSamples);
+      arm_offset_f32(this->pDst,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_convert_affine_q15_f32()
+    {
+      arm_convert_affine_q15_f32(this->pSrcQ15,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_affine_f32_q7_unfused()
+    {
+      arm_scale_f32(this->pSrc,AFFINE_SCALE,this->pTmp,this->nbSamples);
+      arm_offset_f32(this->pTmp,AFFINE_OFFSET,this->pTmp,this->nbSamples);
+      arm_clip_f32(this->pTmp,this->pTmp,-1.0f,127.0f/128.0f,this->nbSamples);
+      arm_float_to_q7(this->pTmp,this->pDstQ7,this->nbSamples);
+    }
+
+    void SupportF32::test_convert_affine_f32_q7()
+    {
+      arm_convert_affine_f32_q7(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstQ7,this->nbSamples);
+    }
+
+    void SupportF32::test_deinterleave_f32()
+    {
+      arm_deinterleave_f32(this->pSrc,this->nbChannels,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_interleave_f32()
+    {
+      arm_interleave_f32(this->pSrc,this->nbChannels,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_cmplx_split_f32()
+    {
+      arm_cmplx_split_f32(this->pSrc,this->pDst,this->pDst + this->nbSamples,this->nbSamples);
+    }
+
+    void SupportF32::test_cmplx_merge_f32()
+    {
+      arm_cmplx_merge_f32(this->pSrc,this->pSrc + this->nbSamples,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_convert_affine_q7_f32()
+    {
+      arm_convert_affine_q7_f32(this->pSrcQ7,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_convert_affine_q31_f32()
+    {
+      arm_convert_affine_q31_f32(this->pSrcQ31,AFFINE_SCALE,AFFINE_OFFSET,this->pDst,this->nbSamples);
+    }
+
+    void SupportF32::test_convert_affine_f32_q15()
+    {
+      arm_convert_affine_f32_q15(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstQ15,this->nbSamples);
+    }
+
+    void SupportF32::test_convert_affine_f32_q31()
+    {
+      arm_convert_affine_f32_q31(this->pSrc,AFFINE_SCALE,AFFINE_OFFSET,this->pDstQ31,this->nbSamples);
+    }
+
     void SupportF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
 
        std::vector<Testing::param_t>::iterator it = params.begin();
+       int order = -1;
        this->nbSamples = *it;
 
        output.create(this->nbSamples,SupportF32::OUT_SAMPLES_F32_ID,mgr);
@@ -72,9 +170,121 @@
               this->pWeights=weights.ptr();
            break;
 
+           case TEST_QUICK_SORT_F32_7:
+           case TEST_QUICK_SORT_F32_8:
+           case TEST_QUICK_SORT_F32_9:
+              arm_sort_init_f32(&this->sortS, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+              order = (id - TEST_QUICK_SORT_F32_7);
+           break;
+
+           case TEST_RADIX_SORT_F32_10:
+           case TEST_RADIX_SORT_F32_11:
+           case TEST_RADIX_SORT_F32_12:
+              arm_sort_init_f32(&this->sortS, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+              order = (id - TEST_RADIX_SORT_F32_10);
+           break;
+
+           case TEST_ARGSORT_F32_13:
+           case TEST_ARGSORT_F32_14:
+           case TEST_ARGSORT_F32_15:
+              work.create(3*this->nbSamples,SupportF32::TMP_INDEX_ID,mgr);
+              arm_argsort_init_f32(&this->argsortS, ARM_SORT_ASCENDING, (uint32_t*)work.ptr());
+              order = (id - TEST_ARGSORT_F32_13);
+           break;
+
+           case TEST_TOPK_F32_16:
+           case TEST_TOPK_F32_17:
+           case TEST_TOPK_F32_18:
+              order = (id - TEST_TOPK_F32_16);
+           break;
+
+           case TEST_AFFINE_Q15_F32_UNFUSED_19:
+           case TEST_CONVERT_AFFINE_Q15_F32_20:
+             samplesQ15.reload(SupportF32::SAMPLES_Q15_ID,mgr,this->nbSamples);
+             this->pSrcQ15=samplesQ15.ptr();
+           break;
+
+           case TEST_AFFINE_F32_Q7_UNFUSED_21:
+           case TEST_CONVERT_AFFINE_F32_Q7_22:
+             samples.reload(SupportF32::SAMPLES_F32_ID,mgr,this->nbSamples);
+             tmp.create(this->nbSamples,SupportF32::TMP_F32_ID,mgr);
+             outputQ7.create(this->nbSamples,SupportF32::OUT_SAMPLES_F32_ID,mgr);
+             this->pSrc=samples.ptr();
+             this->pTmp=tmp.ptr();
+             this->pDstQ7=outputQ7.ptr();
+           break;
+
+           case TEST_DEINTERLEAVE_F32_23:
+           case TEST_DEINTERLEAVE_F32_24:
+           case TEST_DEINTERLEAVE_F32_25:
+           case TEST_INTERLEAVE_F32_26:
+           case TEST_INTERLEAVE_F32_27:
+           case TEST_INTERLEAVE_F32_28:
+           case TEST_CMPLX_SPLIT_F32_29:
+           case TEST_CMPLX_MERGE_F32_30:
+             if (id <= TEST_INTERLEAVE_F32_28)
+             {
+               /* 2, 4 and 6 channels */
+               this->nbChannels = 2 * (1 + (id - TEST_DEINTERLEAVE_F32_23) % 3);
+             }
+             else
+             {
+               this->nbChannels = 2;
+             }
+
+             /* The content of the buffers has no effect on the timing */
+             tmp.create(this->nbChannels*this->nbSamples,SupportF32::TMP_F32_ID,mgr);
+             output.create(this->nbChannels*this->nbSamples,SupportF32::OUT_SAMPLES_F32_ID,mgr);
+             this->pSrc=tmp.ptr();
+             arm_fill_f32(1.0f,this->pSrc,this->nbChannels*this->nbSamples);
+           break;
+
+           case TEST_CONVERT_AFFINE_Q7_F32_31:
+             samplesQ7.reload(SupportF32::SAMPLES_Q7_ID,mgr,this->nbSamples);
+             this->pSrcQ7=samplesQ7.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_Q31_F32_32:
+             samplesQ31.reload(SupportF32::SAMPLES_Q31_ID,mgr,this->nbSamples);
+             this->pSrcQ31=samplesQ31.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_F32_Q15_33:
+           case TEST_CONVERT_AFFINE_F32_Q31_34:
+             samples.reload(SupportF32::SAMPLES_F32_ID,mgr,this->nbSamples);
+             outputQ15.create(this->nbSamples,SupportF32::OUT_SAMPLES_F32_ID,mgr);
+             outputQ31.create(this->nbSamples,SupportF32::OUT_SAMPLES_F32_ID,mgr);
+             this->pSrc=samples.ptr();
+             this->pDstQ15=outputQ15.ptr();
+             this->pDstQ31=outputQ31.ptr();
+           break;
+
        }
 
        this->pDst=output.ptr();
+
+       /* Random, sorted or reversed input for the sort benchmarks */
+       if (order >= 0)
+       {
+          arm_sort_instance_f32 S;
+
+          samples.reload(SupportF32::SAMPLES_F32_ID,mgr,this->nbSamples);
+          ordered.create(this->nbSamples,SupportF32::TMP_F32_ID,mgr);
+          index.create(this->nbSamples,SupportF32::OUT_INDEX_ID,mgr);
+
+          this->pSrc=ordered.ptr();
+          this->pIndex=(uint32_t*)index.ptr();
+
+          if (order == ORDER_RANDOM)
+          {
+             memcpy(this->pSrc,samples.ptr(),sizeof(float32_t)*this->nbSamples);
+          }
+          else
+          {
+             arm_sort_init_f32(&S, ARM_SORT_HEAP, order == ORDER_SORTED ? ARM_SORT_ASCENDING : ARM_SORT_DESCENDING);
+             arm_sort_f32(&S, samples.ptr(), this->pSrc, this->nbSamples);
+          }
+       }
        
     }
 
@@ -1,6 +1,11 @@
 #include "SupportQ15.h"
 #include "Error.h"
 
+/* Scale of the conversion benchmarks : 0x6000 * 2^1 = 1.5 */
+#define AFFINE_SCALE ((q15_t)0x6000)
+#define AFFINE_SHIFT 1
+#define AFFINE_SCALE_Q31 ((q31_t)0x60000000)
+
    
     void SupportQ15::test_copy_q15()
     {
@@ -22,6 +27,50 @@
 
     }
 
+    void SupportQ15::test_affine_q15_q7_unfused()
+    {
+      arm_scale_q15(this->pSrc,AFFINE_SCALE,AFFINE_SHIFT,this->pTmp,this->nbSamples);
+      arm_offset_q15(this->pTmp,0x0200,this->pTmp,this->nbSamples);
+      arm_q15_to_q7(this->pTmp,this->pDstQ7,this->nbSamples);
+    }
+
+    void SupportQ15::test_convert_affine_q15_q7()
+    {
+      arm_convert_affine_q15_q7(this->pSrc,AFFINE_SCALE,AFFINE_SHIFT,0x02,this->pDstQ7,this->nbSamples);
+    }
+
+    void SupportQ15::test_affine_q15_q31_unfused()
+    {
+      arm_scale_q15(this->pSrc,AFFINE_SCALE,AFFINE_SHIFT,this->pTmp,this->nbSamples);
+      arm_q15_to_q31(this->pTmp,this->pDstQ31,this->nbSamples);
+      arm_offset_q31(this->pDstQ31,0x01000000,this->pDstQ31,this->nbSamples);
+    }
+
+    void SupportQ15::test_convert_affine_q15_q31()
+    {
+      arm_convert_affine_q15_q31(this->pSrc,AFFINE_SCALE,AFFINE_SHIFT,0x01000000,this->pDstQ31,this->nbSamples);
+    }
+
+    void SupportQ15::test_convert_affine_q7_q15()
+    {
+      arm_convert_affine_q7_q15(this->pSrcQ7,AFFINE_SCALE,AFFINE_SHIFT,0x0100,this->pDst,this->nbSamples);
+    }
+
+    void SupportQ15::test_convert_affine_q31_q15()
+    {
+      arm_convert_affine_q31_q15(this->pSrcQ31,AFFINE_SCALE_Q31,AFFINE_SHIFT,0x0100,this->pDst,this->nbSamples);
+    }
+
+    void SupportQ15::test_convert_affine_q7_q31()
+    {
+      arm_convert_affine_q7_q31(this->pSrcQ7,AFFINE_SCALE,AFFINE_SHIFT,0x01000000,this->pDstQ31,this->nbSamples);
+    }
+
+    void SupportQ15::test_convert_affine_q31_q7()
+    {
+      arm_convert_affine_q31_q7(this->pSrcQ31,AFFINE_SCALE_Q31,AFFINE_SHIFT,0x02,this->pDstQ7,this->nbSamples);
+    }
+
 
     void SupportQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
@@ -50,6 +99,34 @@
              this->pSrcQ7=samplesQ7.ptr();
            break;
 
+           case TEST_AFFINE_Q15_Q7_UNFUSED_5:
+           case TEST_CONVERT_AFFINE_Q15_Q7_6:
+           case TEST_AFFINE_Q15_Q31_UNFUSED_7:
+           case TEST_CONVERT_AFFINE_Q15_Q31_8:
+             samples.reload(SupportQ15::SAMPLES_Q15_ID,mgr,this->nbSamples);
+             tmp.create(this->nbSamples,SupportQ15::OUT_SAMPLES_Q15_ID,mgr);
+             outputQ31.create(this->nbSamples,SupportQ15::OUT_SAMPLES_Q15_ID,mgr);
+             outputQ7.create(this->nbSamples,SupportQ15::OUT_SAMPLES_Q15_ID,mgr);
+             this->pSrc=samples.ptr();
+             this->pTmp=tmp.ptr();
+             this->pDstQ31=outputQ31.ptr();
+             this->pDstQ7=outputQ7.ptr();
+           break;
+
+           case TEST_CONVERT_AFFINE_Q7_Q15_9:
+           case TEST_CONVERT_AFFINE_Q31_Q15_10:
+           case TEST_CONVERT_AFFINE_Q7_Q31_11:
+           case TEST_CONVERT_AFFINE_Q31_Q7_12:
+             samplesQ7.reload(SupportQ15::SAMPLES_Q7_ID,mgr,this->nbSamples);
+             samplesQ31.reload(SupportQ15::SAMPLES_Q31_ID,mgr,this->nbSamples);
+             outputQ31.create(this->nbSamples,SupportQ15::OUT_SAMPLES_Q15_ID,mgr);
+             outputQ7.create(this->nbSamples,SupportQ15::OUT_SAMPLES_Q15_ID,mgr);
+             this->pSrcQ7=samplesQ7.ptr();
+             this->pSrcQ31=samplesQ31.ptr();
+             this->pDstQ31=outputQ31.ptr();
+             this->pDstQ7=outputQ7.ptr();
+           break;
+
        }
        this->pDst=output.ptr();
        
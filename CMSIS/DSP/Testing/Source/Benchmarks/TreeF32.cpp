@@ -0,0 +1,80 @@
+#include "TreeF32.h"
+#include "Error.h"
+
+/*
+
+The loop version is predicting the input vectors one after the
+other. The batch version is predicting all of them with one call
+so that each tree is evaluated for all the vectors.
+
+*/
+
+    void TreeF32::test_tree_ensemble_loop_f32()
+    {
+       const float32_t *pIn = this->inp;
+       float32_t *pOut = this->outp;
+
+       for(int i=0; i < this->nbVectors; i++)
+       {
+          arm_tree_ensemble_predict_f32(&tree,pIn,1,pOut);
+          pIn += tree.vectorDimension;
+          pOut += tree.numberOfOutputs;
+       }
+    } 
+
+    void TreeF32::test_tree_ensemble_batch_f32()
+    {
+       arm_tree_ensemble_predict_f32(&tree,this->inp,this->nbVectors,this->outp);
+    } 
+
+  
+    void TreeF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+       (void)id;
+
+       std::vector<Testing::param_t>::iterator it = paramsArgs.begin();
+       this->nbVectors = *it++;
+
+       /* Random forest model of the tests */
+       dims.reload(TreeF32::DIMS1_S16_ID,mgr);
+       structure.reload(TreeF32::STRUCTURE1_S16_ID,mgr);
+       nodes.reload(TreeF32::NODES1_U32_ID,mgr);
+       input.reload(TreeF32::INPUTS1_F32_ID,mgr);
+       thresholds.reload(TreeF32::THRESHOLDS1_F32_ID,mgr);
+       leaves.reload(TreeF32::LEAVES1_F32_ID,mgr);
+       base.reload(TreeF32::BASE1_F32_ID,mgr);
+
+       /* Dims : nbPatterns, vecDim, nbTrees, nbNodes, nbOutputs, nbLeafValues */
+       const int16_t *dimsp = dims.ptr();
+       const uint16_t *structp = (const uint16_t*)structure.ptr();
+       const uint32_t *nodesp = nodes.ptr();
+
+       tree.vectorDimension = dimsp[1];
+       tree.numberOfTrees = dimsp[2];
+       tree.numberOfNodes = dimsp[3];
+       tree.numberOfOutputs = dimsp[4];
+       tree.numberOfLeafValues = dimsp[5];
+
+       tree.treeDepths = structp;
+       tree.treeOutputs = structp + tree.numberOfTrees;
+       tree.featureIndexes = structp + 2*tree.numberOfTrees;
+
+       tree.treeRoots = nodesp;
+       tree.leftChildren = nodesp + tree.numberOfTrees;
+       tree.leafIndexes = nodesp + tree.numberOfTrees + tree.numberOfNodes;
+
+       tree.thresholds = thresholds.ptr();
+       tree.leafValues = leaves.ptr();
+       tree.baseValues = base.ptr();
+
+       output.create(this->nbVectors*tree.numberOfOutputs,TreeF32::OUT_F32_ID,mgr);
+
+       this->inp = input.ptr();
+       this->outp = output.ptr();
+    }
+
+    void TreeF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        (void)mgr;
+    }
@@ -1,5 +1,6 @@
 #include "UnaryF32.h"
 #include "Error.h"
+#include "dsp/matrix_utils.h"
 
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
@@ -94,7 +95,24 @@ static int cholesky_offset(int d)
         arm_mat_ldlt_f32(&this->in1,&this->outll,&this->outd,(uint16_t*)outp);
     }
 
+    void UnaryF32::test_mat_eig_sym_f32()
+    {
+        arm_mat_eig_sym_f32(&this->in1,&this->out,valsp,scratchp);
+    }
+
+    void UnaryF32::test_mat_svd_f32()
+    {
+        arm_mat_svd_f32(&this->in1,&this->out,valsp,&this->outv,scratchp);
+    }
+
     
+    void UnaryF32::test_mat_inverse_nxn_f32()
+    {
+       /* Generic Gauss-Jordan kernel with a dimension only known at runtime
+          for comparison with the fixed size kernels */
+       arm_mat_inverse_nxn_f32(this->in1.pData,this->out.pData,this->nbr);
+    }
+
     void UnaryF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -108,6 +126,7 @@ static int cholesky_offset(int d)
        switch(id)
        {
           case TEST_MAT_VEC_MULT_F32_6:
+          case TEST_MAT_VEC_MULT_F32_16:
              input1.reload(UnaryF32::INPUTA_F32_ID,mgr,this->nbr*this->nbc);
              vec.reload(UnaryF32::INPUTVEC1_F32_ID,mgr,this->nbc);
              output.create(this->nbr,UnaryF32::OUT_F32_ID,mgr);
@@ -119,6 +138,7 @@ static int cholesky_offset(int d)
              this->in1.pData = input1.ptr();   
           break;
           case TEST_MAT_TRANS_F32_3:
+          case TEST_MAT_TRANS_F32_15:
               input1.reload(UnaryF32::INPUTA_F32_ID,mgr,this->nbr*this->nbc);
               output.create(this->nbr*this->nbc,UnaryF32::OUT_F32_ID,mgr);
               
@@ -297,6 +317,58 @@ static int cholesky_offset(int d)
           }
           break;
 
+          case TEST_MAT_EIG_SYM_F32_12:
+          case TEST_MAT_SVD_F32_13:
+          {
+             float32_t *p, *aPtr;
+             int nbSamples;
+
+             input1.reload(UnaryF32::INPUTA_F32_ID,mgr);
+
+             a.create(this->nbr*this->nbc,UnaryF32::TMPA_F32_ID,mgr);
+             b.create(this->nbr*this->nbc,UnaryF32::TMPB_F32_ID,mgr);
+             c.create(this->nbc*this->nbc,UnaryF32::TMPC_F32_ID,mgr);
+             output.create(this->nbr*this->nbc,UnaryF32::OUT_F32_ID,mgr);
+             vals.create(this->nbc,UnaryF32::VAL_F32_ID,mgr);
+
+             /* The input pattern is smaller than the biggest matrix
+                so it is reused. The matrix is made symmetric for the
+                eigen decomposition. */
+             p = input1.ptr();
+             aPtr = a.ptr();
+             nbSamples = input1.nbSamples();
+             for(int r=0; r < this->nbr; r++)
+             {
+               for(int k=0; k < this->nbc; k++)
+               {
+                 if (k <= r)
+                 {
+                   aPtr[r*this->nbc + k] = p[(r*this->nbc + k) % nbSamples];
+                 }
+                 else
+                 {
+                   aPtr[r*this->nbc + k] = p[(k*this->nbc + r) % nbSamples];
+                 }
+               }
+             }
+
+             this->in1.numRows = this->nbr;
+             this->in1.numCols = this->nbc;
+             this->in1.pData = aPtr; 
+
+             this->out.numRows = this->nbr;
+             this->out.numCols = this->nbc;
+             this->out.pData = output.ptr(); 
+
+             this->outv.numRows = this->nbc;
+             this->outv.numCols = this->nbc;
+             this->outv.pData = c.ptr(); 
+
+             valsp = vals.ptr();
+             scratchp = b.ptr();
+          }
+          break;
+
           default:
               input1.reload(UnaryF32::INPUTA_F32_ID,mgr,this->nbr*this->nbc);
               output.create(this->nbr*this->nbc,UnaryF32::OUT_F32_ID,mgr);
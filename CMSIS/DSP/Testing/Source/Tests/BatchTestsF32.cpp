@@ -0,0 +1,250 @@
+#include "BatchTestsF32.h"
+#include "Error.h"
+
+
+#define SNR_THRESHOLD 120
+#define SNR_THRESHOLD_INV 100
+
+/* 
+
+Reference patterns are generated with
+a double precision computation.
+
+*/
+#define REL_ERROR (1.0e-5)
+#define ABS_ERROR (1.0e-5)
+
+#define REL_ERROR_INV (1.0e-4)
+#define ABS_ERROR_INV (1.0e-4)
+
+/*
+
+Copy a batch of nb samples per element from the pattern (stride = count)
+to a buffer with a bigger stride.
+
+*/
+static void toStride(float32_t *dst,const float32_t *src,int nbElems,int count,int stride)
+{
+   for(int e=0; e < nbElems; e++)
+   {
+      memcpy(&dst[e*stride],&src[e*count],sizeof(float32_t)*count);
+   }
+}
+
+static void fromStride(float32_t *dst,const float32_t *src,int nbElems,int count,int stride)
+{
+   for(int e=0; e < nbElems; e++)
+   {
+      memcpy(&dst[e*count],&src[e*stride],sizeof(float32_t)*count);
+   }
+}
+
+#define LOADBATCH()                           \
+      const float32_t *inp1=input1.ptr();     \
+      float32_t *ap=a.ptr();                  \
+      float32_t *cp=c.ptr();                  \
+      float32_t *outp=output.ptr();           \
+      int16_t *dimsp = dims.ptr();            \
+      int nbBatches = dims.nbSamples() >> 1;  \
+      int n,count,stride;                     \
+      int i;                                  \
+      arm_status status;
+
+#define PREPAREBATCH()                        \
+      in1.numRows=n;                          \
+      in1.numCols=n;                          \
+      in1.pData = ap;                         \
+                                              \
+      out.numRows=n;                          \
+      out.numCols=n;                          \
+      out.pData = cp;                         \
+                                              \
+      toStride(ap,inp1,n*n,count,stride);
+
+    void BatchTestsF32::test_mat_mult_batch_f32()
+    {     
+      LOADBATCH();
+      const float32_t *inp2=input2.ptr();
+      float32_t *bp=b.ptr();
+
+      for(i=0;i < nbBatches ; i ++)
+      {
+          n = *dimsp++;
+          count = *dimsp++;
+          stride = count + BATCHPADDING;
+
+          PREPAREBATCH();
+
+          in2.numRows=n;
+          in2.numCols=n;
+          in2.pData = bp;
+          toStride(bp,inp2,n*n,count,stride);
+
+          status=arm_mat_mult_batch_f32(&this->in1,&this->in2,&this->out,count,stride);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          fromStride(outp,cp,n*n,count,stride);
+
+          outp += n*n*count;
+          inp1 += n*n*count;
+          inp2 += n*n*count;
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void BatchTestsF32::test_mat_inverse_batch_f32()
+    {     
+      LOADBATCH();
+
+      for(i=0;i < nbBatches ; i ++)
+      {
+          n = *dimsp++;
+          count = *dimsp++;
+          stride = count + BATCHPADDING;
+
+          PREPAREBATCH();
+
+          status=arm_mat_inverse_batch_f32(&this->in1,&this->out,count,stride);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          fromStride(outp,cp,n*n,count,stride);
+
+          outp += n*n*count;
+          inp1 += n*n*count;
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD_INV);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_INV,REL_ERROR_INV);
+
+    } 
+
+    void BatchTestsF32::test_mat_inverse_batch_singular_f32()
+    {     
+      float32_t *ap=a.ptr();
+      float32_t *cp=c.ptr();
+      const int n = 3;
+      const int count = 5;
+      arm_status status;
+
+      /* Identity matrices except a singular one in the batch */
+      for(int e=0; e < n*n*count; e++)
+      {
+         ap[e] = ((e / count) % (n+1)) == 0 ? 1.0f : 0.0f;
+      }
+      ap[(1*n+1)*count + 3] = 0.0f;
+
+      in1.numRows=n;
+      in1.numCols=n;
+      in1.pData = ap;
+
+      out.numRows=n;
+      out.numCols=n;
+      out.pData = cp;
+
+      status=arm_mat_inverse_batch_f32(&this->in1,&this->out,count,count);
+      ASSERT_TRUE(status==ARM_MATH_SINGULAR);
+
+      /* The other matrices of the batch are inverted */
+      for(int e=0; e < n*n; e++)
+      {
+         ASSERT_TRUE(cp[e*count] == ((e % (n+1)) == 0 ? 1.0f : 0.0f));
+      }
+
+    } 
+
+    void BatchTestsF32::test_mat_cholesky_batch_f32()
+    {     
+      LOADBATCH();
+
+      for(i=0;i < nbBatches ; i ++)
+      {
+          n = *dimsp++;
+          count = *dimsp++;
+          stride = count + BATCHPADDING;
+
+          PREPAREBATCH();
+
+          status=arm_mat_cholesky_batch_f32(&this->in1,&this->out,count,stride);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          fromStride(outp,cp,n*n,count,stride);
+
+          outp += n*n*count;
+          inp1 += n*n*count;
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void BatchTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case TEST_MAT_MULT_BATCH_F32_1:
+            input1.reload(BatchTestsF32::INPUTBATCHMULTA1_F32_ID,mgr);
+            input2.reload(BatchTestsF32::INPUTBATCHMULTB1_F32_ID,mgr);
+            dims.reload(BatchTestsF32::DIMSBATCH1_S16_ID,mgr);
+
+            ref.reload(BatchTestsF32::REFBATCHMULT1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),BatchTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXBATCHSAMPLES,BatchTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXBATCHSAMPLES,BatchTestsF32::TMPB_F32_ID,mgr);
+            c.create(MAXBATCHSAMPLES,BatchTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_INVERSE_BATCH_F32_2:
+            input1.reload(BatchTestsF32::INPUTBATCHINV1_F32_ID,mgr);
+            dims.reload(BatchTestsF32::DIMSBATCH1_S16_ID,mgr);
+
+            ref.reload(BatchTestsF32::REFBATCHINV1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),BatchTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXBATCHSAMPLES,BatchTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXBATCHSAMPLES,BatchTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_INVERSE_BATCH_SINGULAR_F32_3:
+            a.create(MAXBATCHSAMPLES,BatchTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXBATCHSAMPLES,BatchTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_CHOLESKY_BATCH_F32_4:
+            input1.reload(BatchTestsF32::INPUTBATCHCHOL1_F32_ID,mgr);
+            dims.reload(BatchTestsF32::DIMSBATCH1_S16_ID,mgr);
+
+            ref.reload(BatchTestsF32::REFBATCHCHOL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),BatchTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXBATCHSAMPLES,BatchTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXBATCHSAMPLES,BatchTestsF32::TMPC_F32_ID,mgr);
+         break;
+
+      }
+       
+
+    
+    }
+
+    void BatchTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
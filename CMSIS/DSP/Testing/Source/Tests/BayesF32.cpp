@@ -29,6 +29,25 @@
         ASSERT_EQ(outputPredicts,predicts);
     } 
 
+
+    void BayesF32::test_gaussian_naive_bayes_predict_batch_f32()
+    {
+       uint32_t *resultp = (uint32_t*)outputBatch.ptr();
+       int16_t *p = outputPredicts.ptr();
+
+       arm_gaussian_naive_bayes_predict_batch_f32(&bayes, 
+             input.ptr(), 
+             this->nbPatterns,
+             temp.ptr(),
+             resultp);
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          p[i] = (int16_t)resultp[i];
+       }
+
+       ASSERT_EQ(outputPredicts,predicts);
+    } 
   
     void BayesF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -39,6 +58,8 @@
        switch(id)
        {
           case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_F32_1:
+          case BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_BATCH_F32_2:
+          {
             
 
             input.reload(BayesF32::INPUTS1_F32_ID,mgr);
@@ -74,6 +95,13 @@
             bayes.classPriors=this->classPrior;
             bayes.epsilon=this->epsilon; 
 
+            if (id == BayesF32::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_BATCH_F32_2)
+            {
+               /* Batch buffer and predicted classes */
+               temp.create(this->classNb*(this->vecDim + 2),BayesF32::OUT_PROBA_F32_ID,mgr);
+               outputBatch.create(this->nbPatterns,BayesF32::OUT_BATCH_S32_ID,mgr);
+            }
+          }
           break;
 
        }
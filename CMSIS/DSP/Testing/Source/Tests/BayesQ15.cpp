@@ -0,0 +1,81 @@
+#include "BayesQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+
+
+    void BayesQ15::test_gaussian_naive_bayes_predict_q15()
+    {
+       const q15_t *inp = input.ptr();
+
+       q31_t *bufp = outputScores.ptr();
+       int16_t *p = outputPredicts.ptr();
+
+       
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          *p = arm_gaussian_naive_bayes_predict_q15(&bayes, 
+                inp, 
+                bufp);
+
+          inp += this->vecDim;
+          bufp += this->classNb;
+          p++;
+       }
+
+        ASSERT_EQ(outputScores,scores);
+        ASSERT_EQ(outputPredicts,predicts);
+    } 
+
+  
+    void BayesQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+
+
+       (void)paramsArgs;
+
+       switch(id)
+       {
+          case BayesQ15::TEST_GAUSSIAN_NAIVE_BAYES_PREDICT_Q15_1:
+          {
+
+            input.reload(BayesQ15::INPUTS1_Q15_ID,mgr);
+            params.reload(BayesQ15::PARAMS1_Q15_ID,mgr);
+            constants.reload(BayesQ15::CONSTANTS1_Q31_ID,mgr);
+            dims.reload(BayesQ15::DIMS1_S16_ID,mgr);
+
+            const int16_t *dimsp=dims.ptr();
+            const q15_t *paramsp = params.ptr();
+
+            this->nbPatterns=dimsp[0];
+            this->classNb=dimsp[1];
+            this->vecDim=dimsp[2];
+
+            // Reference patterns are not loaded when we are in dump mode
+            scores.reload(BayesQ15::SCORES1_Q31_ID,mgr);
+            predicts.reload(BayesQ15::PREDICTS1_S16_ID,mgr);
+
+            outputScores.create(this->nbPatterns*this->classNb,BayesQ15::OUT_SCORES_Q31_ID,mgr);
+            outputPredicts.create(this->nbPatterns,BayesQ15::OUT_PREDICT_S16_ID,mgr);
+
+            bayes.vectorDimension=this->vecDim;
+            bayes.numberOfClasses=this->classNb;
+            bayes.theta=paramsp;
+            bayes.invSigma=paramsp + (this->classNb * this->vecDim);
+            bayes.classConstants=constants.ptr();
+          }
+          break;
+
+       }
+       
+
+
+    }
+
+    void BayesQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        outputScores.dump(mgr);
+        outputPredicts.dump(mgr);
+    }
@@ -111,6 +111,37 @@ a double precision computation.
     } 
 
 
+    void BinaryTestsF32::test_mat_mult_ext_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_ext_f32(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_f32(&this->in2ext,this->in2.numRows,this->in2.numCols,this->in2.pData);
+          arm_mat_init_ext_f32(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_mult_ext_f32(&this->in1ext,&this->in2ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    }
+
     void BinaryTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -142,6 +173,18 @@ a double precision computation.
             b.create(2*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsF32::TMPB_F32_ID,mgr);
          break;
 
+         case TEST_MAT_MULT_EXT_F32_3:
+            input1.reload(BinaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(BinaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(BinaryTestsF32::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsF32::REFMUL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
          
 
     
@@ -117,6 +117,37 @@ a double precision computation.
     } 
 
 
+    void BinaryTestsQ15::test_mat_mult_ext_q15()
+    {     
+      LOADDATA2();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_ext_q15(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_q15(&this->in2ext,this->in2.numRows,this->in2.numCols,this->in2.pData);
+          arm_mat_init_ext_q15(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_mult_ext_q15(&this->in1ext,&this->in2ext,&this->outext,tmpPtr);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_LOW_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_HIGH_ERROR_Q15);
+
+    }
+
     void BinaryTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -150,6 +181,19 @@ a double precision computation.
             tmp.create(2*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMP_Q15_ID,mgr);
          break;
 
+         case TEST_MAT_MULT_EXT_Q15_3:
+            input1.reload(BinaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(BinaryTestsQ15::INPUTS2_Q15_ID,mgr);
+            dims.reload(BinaryTestsQ15::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ15::REFMUL1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMPB_Q15_ID,mgr);
+            tmp.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ15::TMP_Q15_ID,mgr);
+         break;
+
 
 
     
@@ -110,6 +110,37 @@ a double precision computation.
     } 
 
 
+    void BinaryTestsQ31::test_mat_mult_ext_q31()
+    {     
+      LOADDATA2();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_ext_q31(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_q31(&this->in2ext,this->in2.numRows,this->in2.numCols,this->in2.pData);
+          arm_mat_init_ext_q31(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_mult_ext_q31(&this->in1ext,&this->in2ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    }
+
     void BinaryTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -141,6 +172,18 @@ a double precision computation.
             b.create(2*MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPB_Q31_ID,mgr);
          break;
 
+         case TEST_MAT_MULT_EXT_Q31_3:
+            input1.reload(BinaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(BinaryTestsQ31::INPUTS2_Q31_ID,mgr);
+            dims.reload(BinaryTestsQ31::DIMSBINARY1_S16_ID,mgr);
+
+            ref.reload(BinaryTestsQ31::REFMUL1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),BinaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,BinaryTestsQ31::TMPB_Q31_ID,mgr);
+         break;
+
 
 
     
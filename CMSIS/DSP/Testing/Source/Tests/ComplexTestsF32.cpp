@@ -6,6 +6,56 @@
 
 #define REL_ERROR (7.0e-6)
 
+/* Block sizes of the first calls to the NCO. The remaining samples are
+   generated with a last call. They check the phase continuity between
+   blocks and the tails of the vectorized loops. */
+static const uint32_t ncoBlockSizes[4]={3,13,64,1};
+
+#define NCO_FREQ 0.1234567f
+#define NCO_PHASE 0.3f
+
+#define ABS_ERROR_NCO ((float32_t)2.0e-6)
+
+/* The spur test generates a tone exactly on one bin of a DFT so that
+   everything in the other bins is generated by the approximations. */
+#define SPUR_NB_SAMPLES 256
+#define SPUR_BIN 37
+#define SPUR_PI 3.14159265358979323846
+#define SPUR_THRESHOLD_DB (-120.0)
+
+/* Power of the biggest spur relative to the tone in dB */
+static float64_t spur_level(const float32_t *pSrc)
+{
+    float64_t re, im, a, x, y, p, tone = 0.0, spur = 0.0;
+    uint32_t k, n;
+
+    for(k = 0; k < SPUR_NB_SAMPLES; k++)
+    {
+        re = 0.0;
+        im = 0.0;
+        for(n = 0; n < SPUR_NB_SAMPLES; n++)
+        {
+           a = -2.0 * SPUR_PI * ((k * n) % SPUR_NB_SAMPLES) / SPUR_NB_SAMPLES;
+           x = (float64_t)pSrc[2*n];
+           y = (float64_t)pSrc[2*n+1];
+           re += x * cos(a) - y * sin(a);
+           im += x * sin(a) + y * cos(a);
+        }
+
+        p = re * re + im * im;
+        if (k == SPUR_BIN)
+        {
+            tone = p;
+        }
+        else if (p > spur)
+        {
+            spur = p;
+        }
+    }
+
+    return(10.0 * log10(spur / tone));
+}
+
     void ComplexTestsF32::test_cmplx_conj_f32()
     {
         const float32_t *inp1=input1.ptr();
@@ -105,6 +155,70 @@
         ASSERT_REL_ERROR(output,ref,REL_ERROR);
     } 
  
+    void ComplexTestsF32::test_nco_f32()
+    {
+        float32_t *outp=output.ptr();
+        uint32_t nb = output.nbSamples() >> 1;
+        uint32_t i, blockSize;
+        arm_nco_instance_f32 S;
+
+        arm_nco_init_f32(&S, NCO_FREQ, NCO_PHASE);
+
+        for(i = 0; nb > 0; i++)
+        {
+           blockSize = (i < 4) ? ncoBlockSizes[i] : nb;
+           arm_nco_f32(&S, outp, blockSize);
+
+           outp += 2*blockSize;
+           nb -= blockSize;
+        }
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO);
+    }
+
+    void ComplexTestsF32::test_mix_down_f32()
+    {
+        const float32_t *inp1=input1.ptr();
+        float32_t *outp=output.ptr();
+        uint32_t nb = input1.nbSamples();
+        uint32_t i, blockSize;
+        arm_nco_instance_f32 S;
+
+        arm_nco_init_f32(&S, NCO_FREQ, NCO_PHASE);
+
+        for(i = 0; nb > 0; i++)
+        {
+           blockSize = (i < 4) ? ncoBlockSizes[i] : nb;
+           arm_mix_down_f32(&S, inp1, outp, blockSize);
+
+           inp1 += blockSize;
+           outp += 2*blockSize;
+           nb -= blockSize;
+        }
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO);
+    }
+
+    void ComplexTestsF32::test_nco_spur_f32()
+    {
+        arm_nco_instance_f32 S;
+
+        arm_nco_init_f32(&S, ((float32_t)SPUR_BIN / SPUR_NB_SAMPLES), NCO_PHASE);
+        arm_nco_f32(&S, output.ptr(), SPUR_NB_SAMPLES);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_TRUE(spur_level(output.ptr()) < SPUR_THRESHOLD_DB);
+    }
+
     void ComplexTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -297,6 +411,24 @@
           output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
         break;
         
+        case ComplexTestsF32::TEST_NCO_F32_25:
+          nb = 256;
+          ref.reload(ComplexTestsF32::REF_NCO_F32_ID,mgr,nb << 1);
+
+          output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
+        break;
+
+        case ComplexTestsF32::TEST_MIX_DOWN_F32_26:
+          nb = 256;
+          ref.reload(ComplexTestsF32::REF_MIX_DOWN_F32_ID,mgr,nb << 1);
+          input1.reload(ComplexTestsF32::INPUT3_F32_ID,mgr,nb);
+
+          output.create(ref.nbSamples(),ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
+        break;
+
+        case ComplexTestsF32::TEST_NCO_SPUR_F32_27:
+          output.create(2*SPUR_NB_SAMPLES,ComplexTestsF32::OUT_SAMPLES_F32_ID,mgr);
+        break;
        }
       
     }
@@ -14,6 +14,56 @@ a double precision computation.
 #define ABS_ERROR_Q15 ((q15_t)50)
 #define ABS_ERROR_Q31 ((q31_t)(1<<15))
 
+/* Block sizes of the first calls to the NCO. The remaining samples are
+   generated with a last call. They check the phase continuity between
+   blocks and the tails of the vectorized loops. */
+static const uint32_t ncoBlockSizes[4]={3,13,64,1};
+
+#define NCO_FREQ ((q31_t)0x0FCD6DDC)
+#define NCO_PHASE ((q31_t)0x26666666)
+
+#define ABS_ERROR_NCO ((q15_t)2)
+
+/* The spur test generates a tone exactly on one bin of a DFT so that
+   everything in the other bins is generated by the approximations. */
+#define SPUR_NB_SAMPLES 256
+#define SPUR_BIN 37
+#define SPUR_PI 3.14159265358979323846
+#define SPUR_THRESHOLD_DB (-100.0)
+
+/* Power of the biggest spur relative to the tone in dB */
+static float64_t spur_level(const q15_t *pSrc)
+{
+    float64_t re, im, a, x, y, p, tone = 0.0, spur = 0.0;
+    uint32_t k, n;
+
+    for(k = 0; k < SPUR_NB_SAMPLES; k++)
+    {
+        re = 0.0;
+        im = 0.0;
+        for(n = 0; n < SPUR_NB_SAMPLES; n++)
+        {
+           a = -2.0 * SPUR_PI * ((k * n) % SPUR_NB_SAMPLES) / SPUR_NB_SAMPLES;
+           x = (float64_t)pSrc[2*n] / 32768.0;
+           y = (float64_t)pSrc[2*n+1] / 32768.0;
+           re += x * cos(a) - y * sin(a);
+           im += x * sin(a) + y * cos(a);
+        }
+
+        p = re * re + im * im;
+        if (k == SPUR_BIN)
+        {
+            tone = p;
+        }
+        else if (p > spur)
+        {
+            spur = p;
+        }
+    }
+
+    return(10.0 * log10(spur / tone));
+}
+
     void ComplexTestsQ15::test_cmplx_conj_q15()
     {
         const q15_t *inp1=input1.ptr();
@@ -119,6 +169,70 @@ a double precision computation.
 
     } 
  
+    void ComplexTestsQ15::test_nco_q15()
+    {
+        q15_t *outp=output.ptr();
+        uint32_t nb = output.nbSamples() >> 1;
+        uint32_t i, blockSize;
+        arm_nco_instance_q15 S;
+
+        arm_nco_init_q15(&S, NCO_FREQ, NCO_PHASE);
+
+        for(i = 0; nb > 0; i++)
+        {
+           blockSize = (i < 4) ? ncoBlockSizes[i] : nb;
+           arm_nco_q15(&S, outp, blockSize);
+
+           outp += 2*blockSize;
+           nb -= blockSize;
+        }
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO);
+    }
+
+    void ComplexTestsQ15::test_mix_down_q15()
+    {
+        const q15_t *inp1=input1.ptr();
+        q15_t *outp=output.ptr();
+        uint32_t nb = input1.nbSamples();
+        uint32_t i, blockSize;
+        arm_nco_instance_q15 S;
+
+        arm_nco_init_q15(&S, NCO_FREQ, NCO_PHASE);
+
+        for(i = 0; nb > 0; i++)
+        {
+           blockSize = (i < 4) ? ncoBlockSizes[i] : nb;
+           arm_mix_down_q15(&S, inp1, outp, blockSize);
+
+           inp1 += blockSize;
+           outp += 2*blockSize;
+           nb -= blockSize;
+        }
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_NCO);
+    }
+
+    void ComplexTestsQ15::test_nco_spur_q15()
+    {
+        arm_nco_instance_q15 S;
+
+        arm_nco_init_q15(&S, ((q31_t)(((q63_t)SPUR_BIN << 31) / SPUR_NB_SAMPLES)), NCO_PHASE);
+        arm_nco_q15(&S, output.ptr(), SPUR_NB_SAMPLES);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_TRUE(spur_level(output.ptr()) < SPUR_THRESHOLD_DB);
+    }
+
     void ComplexTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
       
@@ -307,6 +421,24 @@ a double precision computation.
 
           output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
         break;
+        case ComplexTestsQ15::TEST_NCO_Q15_24:
+          nb = 256;
+          ref.reload(ComplexTestsQ15::REF_NCO_Q15_ID,mgr,nb << 1);
+
+          output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
+        break;
+
+        case ComplexTestsQ15::TEST_MIX_DOWN_Q15_25:
+          nb = 256;
+          ref.reload(ComplexTestsQ15::REF_MIX_DOWN_Q15_ID,mgr,nb << 1);
+          input1.reload(ComplexTestsQ15::INPUT3_Q15_ID,mgr,nb);
+
+          output.create(ref.nbSamples(),ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
+        break;
+
+        case ComplexTestsQ15::TEST_NCO_SPUR_Q15_26:
+          output.create(2*SPUR_NB_SAMPLES,ComplexTestsQ15::OUT_SAMPLES_Q15_ID,mgr);
+        break;
        }
       
 
@@ -0,0 +1,170 @@
+#include "ControllerTestsF32.h"
+#include "Error.h"
+
+#define SNR_THRESHOLD 120
+
+/* 
+
+Reference patterns are generated with
+a double precision computation.
+
+*/
+#define REL_ERROR (1.0e-6)
+#define ABS_ERROR (1.0e-6)
+
+/* Accuracy of the sine and cosine from the table */
+#define REL_ERROR_FOC (1.0e-5)
+#define ABS_ERROR_FOC (1.0e-6)
+
+/* Different order of the operations on vector architectures */
+#define REL_ERROR_CHAIN (1.0e-5)
+#define ABS_ERROR_CHAIN (1.0e-6)
+
+/* Helper computing the FOC transform with the separate functions */
+static void foc_chain(const float32_t *pIa,const float32_t *pIb,const float32_t *pTheta,
+  float32_t *pDst,int nb)
+{
+    float32_t Ialpha,Ibeta;
+
+    for(int i=0; i < nb; i++)
+    {
+        arm_sin_cos_f32(pTheta[i],&pDst[2*nb + i],&pDst[3*nb + i]);
+        arm_clarke_f32(pIa[i],pIb[i],&Ialpha,&Ibeta);
+        arm_park_f32(Ialpha,Ibeta,&pDst[i],&pDst[nb + i],pDst[2*nb + i],pDst[3*nb + i]);
+    }
+}
+
+    void ControllerTestsF32::test_pid_bank_f32()
+    {     
+      const int16_t *dimsp=dims.ptr();
+      const int n = dimsp[0];
+      const int steps = dimsp[1];
+      const float32_t *coefsp=input.ptr();
+      const float32_t *inp=coefsp + 6*n;
+      float32_t *outp=output.ptr();
+      arm_pid_bank_instance_f32 S;
+
+      arm_pid_bank_init_f32(&S,n,coefsp,state.ptr());
+
+      /* One error per controller at each step */
+      for(int k=0; k < steps; k++)
+      {
+          arm_pid_bank_f32(&S,inp,outp);
+
+          inp += n;
+          outp += n;
+      }
+
+      /* The state checks the anti-windup and the derivative filter */
+      memcpy(outp,state.ptr(),sizeof(float32_t)*3*n);
+      outp += 3*n;
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void ControllerTestsF32::test_foc_transform_f32()
+    {     
+      const int nb = input.nbSamples() / 3;
+      const float32_t *pIa=input.ptr();
+      const float32_t *pIb=pIa + nb;
+      const float32_t *pTheta=pIb + nb;
+      float32_t *outp=output.ptr();
+
+      for(int i=0; i < nb; i++)
+      {
+          arm_foc_transform_f32(pIa[i],pIb[i],pTheta[i],
+            &outp[i],&outp[nb + i],&outp[2*nb + i],&outp[3*nb + i]);
+      }
+
+      foc_chain(pIa,pIb,pTheta,chain.ptr(),nb);
+
+      /* Bit exact with the separate functions */
+      ASSERT_NEAR_EQ(output,chain,0.0f);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_FOC,REL_ERROR_FOC);
+
+    } 
+
+    void ControllerTestsF32::test_foc_transform_block_f32()
+    {     
+      const int nb = input.nbSamples() / 3;
+      const float32_t *pIa=input.ptr();
+      const float32_t *pIb=pIa + nb;
+      const float32_t *pTheta=pIb + nb;
+      float32_t *outp=output.ptr();
+
+      arm_foc_transform_block_f32(pIa,pIb,pTheta,
+        outp,outp + nb,outp + 2*nb,outp + 3*nb,nb);
+
+      foc_chain(pIa,pIb,pTheta,chain.ptr(),nb);
+
+      ASSERT_CLOSE_ERROR(output,chain,ABS_ERROR_CHAIN,REL_ERROR_CHAIN);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_FOC,REL_ERROR_FOC);
+
+    } 
+
+    void ControllerTestsF32::test_svpwm_f32()
+    {     
+      const int nb = input.nbSamples() / 2;
+      const float32_t *pValpha=input.ptr();
+      const float32_t *pVbeta=pValpha + nb;
+      float32_t *outp=output.ptr();
+
+      arm_svpwm_f32(pValpha,pVbeta,outp,outp + nb,outp + 2*nb,nb);
+
+      /* The duty cycles are clamped for the overmodulated vectors */
+      for(int i=0; i < 3*nb; i++)
+      {
+          ASSERT_TRUE((outp[i] >= 0.0f) && (outp[i] <= 1.0f));
+      }
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void ControllerTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case ControllerTestsF32::TEST_PID_BANK_F32_1:
+            input.reload(ControllerTestsF32::INPUTPIDBANK1_F32_ID,mgr);
+            dims.reload(ControllerTestsF32::DIMSPIDBANK1_S16_ID,mgr);
+            ref.reload(ControllerTestsF32::REFPIDBANK1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),ControllerTestsF32::OUT_F32_ID,mgr);
+            state.create(3*dims.ptr()[0],ControllerTestsF32::STATE_F32_ID,mgr);
+         break;
+
+         case ControllerTestsF32::TEST_FOC_TRANSFORM_F32_2:
+         case ControllerTestsF32::TEST_FOC_TRANSFORM_BLOCK_F32_3:
+            input.reload(ControllerTestsF32::INPUTFOC1_F32_ID,mgr);
+            ref.reload(ControllerTestsF32::REFFOC1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),ControllerTestsF32::OUT_F32_ID,mgr);
+            chain.create(ref.nbSamples(),ControllerTestsF32::CHAIN_F32_ID,mgr);
+         break;
+
+         case ControllerTestsF32::TEST_SVPWM_F32_4:
+            input.reload(ControllerTestsF32::INPUTSVPWM1_F32_ID,mgr);
+            ref.reload(ControllerTestsF32::REFSVPWM1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),ControllerTestsF32::OUT_F32_ID,mgr);
+         break;
+      }
+    
+    }
+
+    void ControllerTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
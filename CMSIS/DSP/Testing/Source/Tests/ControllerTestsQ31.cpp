@@ -0,0 +1,165 @@
+#include "ControllerTestsQ31.h"
+#include "Error.h"
+
+/* 
+
+Reference patterns are generated with
+a bit exact model of the Q31 computation
+for the PID bank and with a double precision
+computation for the other tests.
+
+*/
+
+/* Accuracy of the sine and cosine */
+#define ABS_ERROR_FOC ((q31_t)16)
+
+#define ABS_ERROR_SVPWM ((q31_t)4)
+
+/* Helper computing the FOC transform with the separate functions */
+static void foc_chain(const q31_t *pIa,const q31_t *pIb,const q31_t *pTheta,
+  q31_t *pDst,int nb)
+{
+    q31_t Ialpha,Ibeta;
+
+    for(int i=0; i < nb; i++)
+    {
+        arm_sin_cos_q31(pTheta[i],&pDst[2*nb + i],&pDst[3*nb + i]);
+        arm_clarke_q31(pIa[i],pIb[i],&Ialpha,&Ibeta);
+        arm_park_q31(Ialpha,Ibeta,&pDst[i],&pDst[nb + i],pDst[2*nb + i],pDst[3*nb + i]);
+    }
+}
+
+    void ControllerTestsQ31::test_pid_bank_q31()
+    {     
+      const int16_t *dimsp=dims.ptr();
+      const int n = dimsp[0];
+      const int steps = dimsp[1];
+      const uint8_t postShift = (uint8_t)dimsp[2];
+      const q31_t *coefsp=input.ptr();
+      const q31_t *inp=coefsp + 6*n;
+      q31_t *outp=output.ptr();
+      arm_pid_bank_instance_q31 S;
+
+      arm_pid_bank_init_q31(&S,n,coefsp,state.ptr(),postShift);
+
+      /* One error per controller at each step */
+      for(int k=0; k < steps; k++)
+      {
+          arm_pid_bank_q31(&S,inp,outp);
+
+          inp += n;
+          outp += n;
+      }
+
+      /* The state checks the anti-windup and the derivative filter */
+      memcpy(outp,state.ptr(),sizeof(q31_t)*3*n);
+      outp += 3*n;
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_EQ(output,ref);
+
+    } 
+
+    void ControllerTestsQ31::test_foc_transform_q31()
+    {     
+      const int nb = input.nbSamples() / 3;
+      const q31_t *pIa=input.ptr();
+      const q31_t *pIb=pIa + nb;
+      const q31_t *pTheta=pIb + nb;
+      q31_t *outp=output.ptr();
+
+      for(int i=0; i < nb; i++)
+      {
+          arm_foc_transform_q31(pIa[i],pIb[i],pTheta[i],
+            &outp[i],&outp[nb + i],&outp[2*nb + i],&outp[3*nb + i]);
+      }
+
+      foc_chain(pIa,pIb,pTheta,chain.ptr(),nb);
+
+      /* Bit exact with the separate functions */
+      ASSERT_NEAR_EQ(output,chain,(q31_t)0);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_FOC);
+
+    } 
+
+    void ControllerTestsQ31::test_foc_transform_block_q31()
+    {     
+      const int nb = input.nbSamples() / 3;
+      const q31_t *pIa=input.ptr();
+      const q31_t *pIb=pIa + nb;
+      const q31_t *pTheta=pIb + nb;
+      q31_t *outp=output.ptr();
+
+      arm_foc_transform_block_q31(pIa,pIb,pTheta,
+        outp,outp + nb,outp + 2*nb,outp + 3*nb,nb);
+
+      foc_chain(pIa,pIb,pTheta,chain.ptr(),nb);
+
+      /* Bit exact with the separate functions */
+      ASSERT_NEAR_EQ(output,chain,(q31_t)0);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_FOC);
+
+    } 
+
+    void ControllerTestsQ31::test_svpwm_q31()
+    {     
+      const int nb = input.nbSamples() / 2;
+      const q31_t *pValpha=input.ptr();
+      const q31_t *pVbeta=pValpha + nb;
+      q31_t *outp=output.ptr();
+
+      arm_svpwm_q31(pValpha,pVbeta,outp,outp + nb,outp + 2*nb,nb);
+
+      /* The duty cycles are clamped for the overmodulated vectors */
+      for(int i=0; i < 3*nb; i++)
+      {
+          ASSERT_TRUE(outp[i] >= 0);
+      }
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_SVPWM);
+
+    } 
+
+    void ControllerTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case ControllerTestsQ31::TEST_PID_BANK_Q31_1:
+            input.reload(ControllerTestsQ31::INPUTPIDBANK1_Q31_ID,mgr);
+            dims.reload(ControllerTestsQ31::DIMSPIDBANK1_S16_ID,mgr);
+            ref.reload(ControllerTestsQ31::REFPIDBANK1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),ControllerTestsQ31::OUT_Q31_ID,mgr);
+            state.create(3*dims.ptr()[0],ControllerTestsQ31::STATE_Q31_ID,mgr);
+         break;
+
+         case ControllerTestsQ31::TEST_FOC_TRANSFORM_Q31_2:
+         case ControllerTestsQ31::TEST_FOC_TRANSFORM_BLOCK_Q31_3:
+            input.reload(ControllerTestsQ31::INPUTFOC1_Q31_ID,mgr);
+            ref.reload(ControllerTestsQ31::REFFOC1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),ControllerTestsQ31::OUT_Q31_ID,mgr);
+            chain.create(ref.nbSamples(),ControllerTestsQ31::CHAIN_Q31_ID,mgr);
+         break;
+
+         case ControllerTestsQ31::TEST_SVPWM_Q31_4:
+            input.reload(ControllerTestsQ31::INPUTSVPWM1_Q31_ID,mgr);
+            ref.reload(ControllerTestsQ31::REFSVPWM1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),ControllerTestsQ31::OUT_Q31_ID,mgr);
+         break;
+      }
+    
+    }
+
+    void ControllerTestsQ31::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
@@ -9,6 +9,8 @@
 
 #define REL_MK_ERROR (1e-2)
 
+#define ABS_COSINE_ERROR (5e-3)
+
 
     void DistanceTestsF16::test_braycurtis_distance_f16()
     {
@@ -193,11 +195,45 @@
     } 
   
   
+    void DistanceTestsF16::test_cdist_euclidean_f16()
+    {
+       const float16_t *inpA = inputA.ptr();
+       const float16_t *inpB = inputB.ptr();
+       arm_cdist_instance_f16 S;
+       arm_status status;
+
+       /* Rows of A are the queries and rows of B the reference vectors */
+       status = arm_cdist_init_f16(&S, ARM_CDIST_EUCLIDEAN, inpB, this->nbVectors, this->vecDim, tmpB.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       arm_cdist_f16(&S, inpA, this->nbPatterns, output.ptr());
+
+       ASSERT_REL_ERROR(output,ref,REL_ERROR);
+    } 
+
+    void DistanceTestsF16::test_cdist_cosine_f16()
+    {
+       const float16_t *inpA = inputA.ptr();
+       const float16_t *inpB = inputB.ptr();
+       arm_cdist_instance_f16 S;
+       arm_status status;
+
+       status = arm_cdist_init_f16(&S, ARM_CDIST_COSINE, inpB, this->nbVectors, this->vecDim, tmpB.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       arm_cdist_f16(&S, inpA, this->nbPatterns, output.ptr());
+
+       ASSERT_NEAR_EQ(output,ref,(float16_t)ABS_COSINE_ERROR);
+    } 
+
     void DistanceTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
         (void)paramsArgs;
-        if ((id != DistanceTestsF16::TEST_MINKOWSKI_DISTANCE_F16_9) && (id != DistanceTestsF16::TEST_JENSENSHANNON_DISTANCE_F16_8))
+        if ((id != DistanceTestsF16::TEST_MINKOWSKI_DISTANCE_F16_9) &&
+            (id != DistanceTestsF16::TEST_JENSENSHANNON_DISTANCE_F16_8) &&
+            (id != DistanceTestsF16::TEST_CDIST_EUCLIDEAN_F16_10) &&
+            (id != DistanceTestsF16::TEST_CDIST_COSINE_F16_11))
         {
             inputA.reload(DistanceTestsF16::INPUTA_F16_ID,mgr);
             inputB.reload(DistanceTestsF16::INPUTB_F16_ID,mgr);
@@ -288,6 +324,33 @@
             }
             break;
 
+            case DistanceTestsF16::TEST_CDIST_EUCLIDEAN_F16_10:
+            case DistanceTestsF16::TEST_CDIST_COSINE_F16_11:
+            {
+              inputA.reload(DistanceTestsF16::INPUTA_CDIST_F16_ID,mgr);
+              inputB.reload(DistanceTestsF16::INPUTB_CDIST_F16_ID,mgr);
+              dims.reload(DistanceTestsF16::DIMS_CDIST_S16_ID,mgr);
+
+              const int16_t   *dimsp = dims.ptr();
+
+              /* Number of queries, number of reference vectors, dimension */
+              this->nbPatterns=dimsp[0];
+              this->nbVectors=dimsp[1];
+              this->vecDim=dimsp[2];
+              output.create(this->nbPatterns*this->nbVectors,DistanceTestsF16::OUT_F16_ID,mgr);
+              tmpB.create(this->nbVectors,DistanceTestsF16::TMPB_F16_ID,mgr);
+
+              if (id == DistanceTestsF16::TEST_CDIST_EUCLIDEAN_F16_10)
+              {
+                ref.reload(DistanceTestsF16::REF10_F16_ID,mgr);
+              }
+              else
+              {
+                ref.reload(DistanceTestsF16::REF11_F16_ID,mgr);
+              }
+            }
+            break;
+
         }
 
        
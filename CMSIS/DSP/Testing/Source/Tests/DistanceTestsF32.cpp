@@ -2,6 +2,83 @@
 #include <stdio.h>
 #include "Error.h"
 #include "Test.h"
+#include "dsp/support_functions.h"
+
+/* Number of neighbours of the kNN test */
+#define KNN_K 3
+
+/* Sakoe-Chiba band of the constrained DTW tests */
+#define DTW_WINDOW 3
+
+/* Length of the second sequence of the DTW tests for the pattern i */
+#define DTW_LENB(I) (this->vecDim - 5*((I) % 4))
+
+/* DTW with the full cost matrix. pRowMin is the largest of the
+   minimums of the rows : the computation is abandoned for any
+   threshold below it. */
+template<typename T, typename ACC>
+static ACC ref_dtw(const T *pA, int lenA, const T *pB, int lenB, int window, ACC maxVal, ACC *pMat, ACC *pRowMin=NULL)
+{
+    int band = lenA > lenB ? lenA - lenB : lenB - lenA;
+    ACC m, d, rowMin, maxRowMin = 0;
+
+    if (window > band)
+    {
+        band = window;
+    }
+
+    pMat[0] = 0;
+    for(int j=1; j <= lenB; j++)
+    {
+        pMat[j] = maxVal;
+    }
+
+    /* The rows are the longer sequence as in arm_dtw_distance */
+    if (lenA < lenB)
+    {
+        return(ref_dtw(pB, lenB, pA, lenA, window, maxVal, pMat, pRowMin));
+    }
+
+    for(int i=1; i <= lenA; i++)
+    {
+        pMat[i*(lenB+1)] = maxVal;
+        rowMin = maxVal;
+        for(int j=1; j <= lenB; j++)
+        {
+            if ((i - j > band) || (j - i > band))
+            {
+                pMat[i*(lenB+1)+j] = maxVal;
+                continue;
+            }
+            m = pMat[(i-1)*(lenB+1)+j-1];
+            if (pMat[(i-1)*(lenB+1)+j] < m)
+            {
+                m = pMat[(i-1)*(lenB+1)+j];
+            }
+            if (pMat[i*(lenB+1)+j-1] < m)
+            {
+                m = pMat[i*(lenB+1)+j-1];
+            }
+            d = (ACC)pA[i-1] - (ACC)pB[j-1];
+            pMat[i*(lenB+1)+j] = m + (d > 0 ? d : -d);
+            if (pMat[i*(lenB+1)+j] < rowMin)
+            {
+                rowMin = pMat[i*(lenB+1)+j];
+            }
+        }
+        if (rowMin > maxRowMin)
+        {
+            maxRowMin = rowMin;
+        }
+    }
+
+    if (pRowMin != NULL)
+    {
+        *pRowMin = maxRowMin;
+    }
+
+    return(pMat[lenA*(lenB+1)+lenB]);
+}
 
 
 
@@ -188,6 +265,201 @@
     } 
   
   
+    void DistanceTestsF32::test_cdist_euclidean_f32()
+    {
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *refp = tmpA.ptr();
+       arm_cdist_instance_f32 S;
+       arm_status status;
+
+       /* Rows of A are the queries and rows of B the reference vectors */
+       status = arm_cdist_init_f32(&S, ARM_CDIST_EUCLIDEAN, inpB, this->nbPatterns, this->vecDim, tmpB.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       arm_cdist_f32(&S, inpA, this->nbPatterns, output.ptr());
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             *refp++ = arm_euclidean_distance_f32(inpA + i*this->vecDim, inpB + j*this->vecDim, this->vecDim);
+          }
+       }
+
+       ASSERT_NEAR_EQ(output,tmpA,(float32_t)1e-4);
+    } 
+
+    void DistanceTestsF32::test_cdist_cosine_f32()
+    {
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *refp = tmpA.ptr();
+       arm_cdist_instance_f32 S;
+       arm_status status;
+
+       status = arm_cdist_init_f32(&S, ARM_CDIST_COSINE, inpB, this->nbPatterns, this->vecDim, tmpB.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       arm_cdist_f32(&S, inpA, this->nbPatterns, output.ptr());
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             *refp++ = arm_cosine_distance_f32(inpA + i*this->vecDim, inpB + j*this->vecDim, this->vecDim);
+          }
+       }
+
+       ASSERT_NEAR_EQ(output,tmpA,(float32_t)1e-5);
+    } 
+
+    void DistanceTestsF32::test_knn_f32()
+    {
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *outp = output.ptr();
+       float32_t *refp = tmpA.ptr();
+       float32_t *scratch = tmpB.ptr() + this->nbPatterns;
+       uint32_t index[KNN_K];
+       arm_sort_instance_f32 sortS;
+       arm_cdist_instance_f32 S;
+       arm_status status;
+
+       status = arm_cdist_init_f32(&S, ARM_CDIST_EUCLIDEAN, inpB, this->nbPatterns, this->vecDim, tmpB.ptr());
+       ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+       arm_sort_init_f32(&sortS, ARM_SORT_INSERTION, ARM_SORT_ASCENDING);
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          arm_knn_f32(&S, inpA, KNN_K, scratch, outp, index);
+
+          /* The k smallest pairwise distances. The scratch buffer is reused. */
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             scratch[j] = arm_euclidean_distance_f32(inpA, inpB + j*this->vecDim, this->vecDim);
+          }
+          arm_sort_f32(&sortS, scratch, scratch, this->nbPatterns);
+          memcpy(refp, scratch, sizeof(float32_t) * KNN_K);
+
+          /* The indices must be the ones of the returned distances */
+          for(int k=0; k < KNN_K ; k ++)
+          {
+             ASSERT_TRUE(fabsf(outp[k] - arm_euclidean_distance_f32(inpA, inpB + index[k]*this->vecDim, this->vecDim)) < 1e-4f);
+          }
+
+          inpA += this->vecDim;
+          outp += KNN_K;
+          refp += KNN_K;
+       }
+
+       ASSERT_NEAR_EQ(output,tmpA,(float32_t)1e-4);
+    } 
+
+    void DistanceTestsF32::test_dtw_distance_f32()
+    {
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *outp = output.ptr();
+       float32_t *refp = tmpA.ptr();
+       float32_t *scratch = tmpB.ptr();
+       float32_t *mat = tmpB.ptr() + 2*(this->vecDim + 1);
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          int lenB = DTW_LENB(i);
+
+          outp[0] = arm_dtw_distance_f32(inpA, this->vecDim, inpB, lenB, this->vecDim, F32_MAX, scratch);
+          outp[1] = arm_dtw_distance_f32(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, F32_MAX, scratch);
+
+          refp[0] = ref_dtw(inpA, this->vecDim, inpB, lenB, this->vecDim, F32_MAX, mat);
+          refp[1] = ref_dtw(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, F32_MAX, mat);
+
+          /* Symmetry and identity */
+          ASSERT_TRUE(arm_dtw_distance_f32(inpB, lenB, inpA, this->vecDim, DTW_WINDOW, F32_MAX, scratch) == outp[1]);
+          ASSERT_TRUE(arm_dtw_distance_f32(inpA, this->vecDim, inpA, this->vecDim, 0, F32_MAX, scratch) == 0.0f);
+
+          /* The band can only increase the distance */
+          ASSERT_TRUE(outp[1] >= outp[0]);
+
+          inpA += this->vecDim;
+          inpB += this->vecDim;
+          outp += 2;
+          refp += 2;
+       }
+
+       ASSERT_NEAR_EQ(output,tmpA,(float32_t)1e-5);
+    }
+
+    void DistanceTestsF32::test_dtw_early_abandon_f32()
+    {
+       const float32_t *inpA = inputA.ptr();
+       const float32_t *inpB = inputB.ptr();
+       float32_t *outp = output.ptr();
+       float32_t *refp = tmpA.ptr();
+       float32_t *scratch = tmpB.ptr();
+       float32_t *mat = tmpB.ptr() + 2*(this->vecDim + 1);
+       float32_t rowMin;
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          int lenB = DTW_LENB(i);
+          float32_t d = ref_dtw(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, F32_MAX, mat, &rowMin);
+
+          /* Abandoned below the largest minimum of the rows */
+          ASSERT_TRUE(arm_dtw_distance_f32(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, 0.999f*rowMin, scratch) == F32_MAX);
+
+          /* Not abandoned for larger thresholds */
+          *outp = arm_dtw_distance_f32(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, rowMin, scratch);
+          *refp = d;
+
+          inpA += this->vecDim;
+          inpB += this->vecDim;
+          outp ++;
+          refp ++;
+       }
+
+       ASSERT_NEAR_EQ(output,tmpA,(float32_t)0.0f);
+    }
+
+    void DistanceTestsF32::test_dtw_distance_q7()
+    {
+       const q7_t *inpA = tmpQ7.ptr();
+       const q7_t *inpB = tmpQ7.ptr() + this->nbPatterns*this->vecDim;
+       float32_t *outp = output.ptr();
+       float32_t *refp = tmpA.ptr();
+       q31_t *scratch = tmpQ31.ptr();
+       q31_t *mat = tmpQ31.ptr() + 2*(this->vecDim + 1);
+       q31_t rowMin;
+
+       arm_float_to_q7(inputA.ptr(), tmpQ7.ptr(), this->nbPatterns*this->vecDim);
+       arm_float_to_q7(inputB.ptr(), tmpQ7.ptr() + this->nbPatterns*this->vecDim, this->nbPatterns*this->vecDim);
+
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          int lenB = DTW_LENB(i);
+
+          /* The distances are integers which are exact in float */
+          outp[0] = (float32_t)arm_dtw_distance_q7(inpA, this->vecDim, inpB, lenB, this->vecDim, Q31_MAX, scratch);
+          outp[1] = (float32_t)arm_dtw_distance_q7(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, Q31_MAX, scratch);
+
+          refp[0] = (float32_t)ref_dtw(inpA, this->vecDim, inpB, lenB, this->vecDim, Q31_MAX, mat);
+          refp[1] = (float32_t)ref_dtw(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, Q31_MAX, mat, &rowMin);
+
+          /* Early abandon */
+          ASSERT_TRUE(arm_dtw_distance_q7(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, rowMin - 1, scratch) == Q31_MAX);
+          ASSERT_TRUE(arm_dtw_distance_q7(inpA, this->vecDim, inpB, lenB, DTW_WINDOW, rowMin, scratch) != Q31_MAX);
+
+          inpA += this->vecDim;
+          inpB += this->vecDim;
+          outp += 2;
+          refp += 2;
+       }
+
+       ASSERT_NEAR_EQ(output,tmpA,(float32_t)0.0f);
+    }
+  
     void DistanceTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
 
@@ -283,6 +555,43 @@
             }
             break;
 
+            case DistanceTestsF32::TEST_CDIST_EUCLIDEAN_F32_10:
+            case DistanceTestsF32::TEST_CDIST_COSINE_F32_11:
+            {
+              output.create(this->nbPatterns*this->nbPatterns,DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*this->nbPatterns,DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpB.create(this->nbPatterns,DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_KNN_F32_12:
+            {
+              output.create(this->nbPatterns*KNN_K,DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(this->nbPatterns*KNN_K,DistanceTestsF32::TMPA_F32_ID,mgr);
+              /* Norms followed by the scratch buffer */
+              tmpB.create(2*this->nbPatterns,DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_DTW_DISTANCE_F32_13:
+            case DistanceTestsF32::TEST_DTW_EARLY_ABANDON_F32_14:
+            {
+              output.create(2*this->nbPatterns,DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(2*this->nbPatterns,DistanceTestsF32::TMPA_F32_ID,mgr);
+              /* Scratch buffer followed by the full cost matrix of the reference */
+              tmpB.create(2*(this->vecDim+1) + (this->vecDim+1)*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsF32::TEST_DTW_DISTANCE_Q7_15:
+            {
+              output.create(2*this->nbPatterns,DistanceTestsF32::OUT_F32_ID,mgr);
+              tmpA.create(2*this->nbPatterns,DistanceTestsF32::TMPA_F32_ID,mgr);
+              tmpQ7.create(2*this->nbPatterns*this->vecDim,DistanceTestsF32::TMPB_F32_ID,mgr);
+              tmpQ31.create(2*(this->vecDim+1) + (this->vecDim+1)*(this->vecDim+1),DistanceTestsF32::TMPB_F32_ID,mgr);
+            }
+            break;
+
         }
 
        
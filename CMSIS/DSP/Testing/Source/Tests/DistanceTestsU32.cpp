@@ -5,6 +5,9 @@
 
 #define ERROR_THRESHOLD 1e-8
 
+/* Number of neighbours of the top-k tests */
+#define TOPK_K 3
+
     void DistanceTestsU32::test_dice_distance()
     {
        const uint32_t *inpA = inputA.ptr();
@@ -177,6 +180,160 @@
     }
 
 
+    void DistanceTestsU32::test_hamming_distance_batch()
+    {
+       const uint32_t *inpA = inputA.ptr();
+       const uint32_t *inpB = inputB.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *batchp = batch.ptr();
+       
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          arm_hamming_distance_batch(inpA, inpB, this->nbPatterns, this->vecDim, batchp);
+
+          /* Each distance of the batch is the pairwise one */
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             ASSERT_TRUE(batchp[j] == arm_hamming_distance(inpA, inpB + j*this->bitVecDim, this->vecDim));
+          }
+
+          /* Reference is the distance between A[i] and B[i] */
+          *outp = batchp[i];
+         
+          inpA += this->bitVecDim ;
+          outp ++;
+       }
+
+       /* Vectors without any boolean : no word is read and the distances are 0 */
+       arm_hamming_distance_batch(inputA.ptr(), inputB.ptr(), this->nbPatterns, 0, batchp);
+       for(int j=0; j < this->nbPatterns ; j ++)
+       {
+          ASSERT_TRUE(batchp[j] == 0.0f);
+       }
+
+        ASSERT_NEAR_EQ(output,ref,(float32_t)ERROR_THRESHOLD);
+    } 
+
+    void DistanceTestsU32::test_jaccard_distance_batch()
+    {
+       const uint32_t *inpA = inputA.ptr();
+       const uint32_t *inpB = inputB.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *batchp = batch.ptr();
+       
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          arm_jaccard_distance_batch(inpA, inpB, this->nbPatterns, this->vecDim, batchp);
+
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             ASSERT_TRUE(batchp[j] == arm_jaccard_distance(inpA, inpB + j*this->bitVecDim, this->vecDim));
+          }
+
+          *outp = batchp[i];
+         
+          inpA += this->bitVecDim ;
+          outp ++;
+       }
+
+       /* Vectors without any boolean : no word is read and the distances are 0 */
+       arm_jaccard_distance_batch(inputA.ptr(), inputB.ptr(), this->nbPatterns, 0, batchp);
+       for(int j=0; j < this->nbPatterns ; j ++)
+       {
+          ASSERT_TRUE(batchp[j] == 0.0f);
+       }
+
+        ASSERT_NEAR_EQ(output,ref,(float32_t)ERROR_THRESHOLD);
+    } 
+
+    void DistanceTestsU32::test_hamming_topk()
+    {
+       const uint32_t *inpA = inputA.ptr();
+       const uint32_t *inpB = inputB.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *refp = topkRef.ptr();
+       float32_t *batchp = batch.ptr();
+       uint32_t index[TOPK_K];
+       arm_sort_instance_f32 sortS;
+
+       arm_sort_init_f32(&sortS, ARM_SORT_INSERTION, ARM_SORT_ASCENDING);
+       
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          arm_hamming_topk(inpA, inpB, this->nbPatterns, this->vecDim, TOPK_K, outp, index);
+
+          /* The k smallest pairwise distances */
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             batchp[j] = arm_hamming_distance(inpA, inpB + j*this->bitVecDim, this->vecDim);
+          }
+          arm_sort_f32(&sortS, batchp, batchp, this->nbPatterns);
+          memcpy(refp, batchp, sizeof(float32_t) * TOPK_K);
+
+          /* The indices must be the ones of the returned distances
+             and equal distances are ranked by increasing index */
+          for(int k=0; k < TOPK_K ; k ++)
+          {
+             ASSERT_TRUE(outp[k] == arm_hamming_distance(inpA, inpB + index[k]*this->bitVecDim, this->vecDim));
+             if (k > 0)
+             {
+                ASSERT_TRUE((outp[k-1] < outp[k]) || (index[k-1] < index[k]));
+             }
+          }
+         
+          inpA += this->bitVecDim ;
+          outp += TOPK_K;
+          refp += TOPK_K;
+       }
+
+        ASSERT_NEAR_EQ(output,topkRef,(float32_t)ERROR_THRESHOLD);
+    } 
+
+    void DistanceTestsU32::test_jaccard_topk()
+    {
+       const uint32_t *inpA = inputA.ptr();
+       const uint32_t *inpB = inputB.ptr();
+
+       float32_t *outp = output.ptr();
+       float32_t *refp = topkRef.ptr();
+       float32_t *batchp = batch.ptr();
+       uint32_t index[TOPK_K];
+       arm_sort_instance_f32 sortS;
+
+       arm_sort_init_f32(&sortS, ARM_SORT_INSERTION, ARM_SORT_ASCENDING);
+       
+       for(int i=0; i < this->nbPatterns ; i ++)
+       {
+          arm_jaccard_topk(inpA, inpB, this->nbPatterns, this->vecDim, TOPK_K, outp, index);
+
+          for(int j=0; j < this->nbPatterns ; j ++)
+          {
+             batchp[j] = arm_jaccard_distance(inpA, inpB + j*this->bitVecDim, this->vecDim);
+          }
+          arm_sort_f32(&sortS, batchp, batchp, this->nbPatterns);
+          memcpy(refp, batchp, sizeof(float32_t) * TOPK_K);
+
+          for(int k=0; k < TOPK_K ; k ++)
+          {
+             ASSERT_TRUE(outp[k] == arm_jaccard_distance(inpA, inpB + index[k]*this->bitVecDim, this->vecDim));
+             if (k > 0)
+             {
+                ASSERT_TRUE((outp[k-1] < outp[k]) || (index[k-1] < index[k]));
+             }
+          }
+         
+          inpA += this->bitVecDim ;
+          outp += TOPK_K;
+          refp += TOPK_K;
+       }
+
+        ASSERT_NEAR_EQ(output,topkRef,(float32_t)ERROR_THRESHOLD);
+    } 
+
+
   
   
     void DistanceTestsU32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
@@ -251,6 +408,29 @@
             }
             break;
 
+            case DistanceTestsU32::TEST_HAMMING_DISTANCE_BATCH_10:
+            {
+              ref.reload(DistanceTestsU32::REF2_F32_ID,mgr);
+              batch.create(this->nbPatterns,DistanceTestsU32::TMP_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_JACCARD_DISTANCE_BATCH_11:
+            {
+              ref.reload(DistanceTestsU32::REF3_F32_ID,mgr);
+              batch.create(this->nbPatterns,DistanceTestsU32::TMP_F32_ID,mgr);
+            }
+            break;
+
+            case DistanceTestsU32::TEST_HAMMING_TOPK_12:
+            case DistanceTestsU32::TEST_JACCARD_TOPK_13:
+            {
+              output.create(this->nbPatterns*TOPK_K,DistanceTestsU32::OUT_F32_ID,mgr);
+              topkRef.create(this->nbPatterns*TOPK_K,DistanceTestsU32::TMP_F32_ID,mgr);
+              batch.create(this->nbPatterns,DistanceTestsU32::TMP_F32_ID,mgr);
+            }
+            break;
+
         }
 
 
@@ -0,0 +1,250 @@
+#include "EstimationTestsF32.h"
+#include "Error.h"
+
+#define SNR_THRESHOLD 80
+
+/* 
+
+Reference patterns are generated with
+a double precision computation.
+
+The covariance is propagated as a Cholesky factor
+so the result is not bit exact with the reference.
+
+*/
+#define REL_ERROR (1.0e-3)
+#define ABS_ERROR (1.0e-4)
+
+#define REL_ERROR_RLS (5.0e-3)
+#define ABS_ERROR_RLS (5.0e-4)
+
+/* 
+
+Initial covariance with a condition number of 1e8
+and measurement noise of variance 1e-6.
+A filter propagating the covariance itself loses
+its positive definiteness in single precision.
+
+*/
+#define REL_ERROR_ILL (1.0e-3)
+#define ABS_ERROR_ILL (1.0e-3)
+
+/* The filter is using square roots of the noise covariances */
+static void sqrt_noise(const float32_t *pSrc,float32_t *pDst,int n)
+{
+    arm_matrix_instance_f32 A,L;
+
+    memset(pDst,0,sizeof(float32_t)*n*n);
+    arm_mat_init_f32(&A,n,n,(float32_t*)pSrc);
+    arm_mat_init_f32(&L,n,n,pDst);
+    arm_mat_cholesky_f32(&A,&L);
+}
+
+    void EstimationTestsF32::test_kalman_f32()
+    {     
+      const float32_t *inp=input.ptr();
+      const int16_t *dimsp=dims.ptr();
+      float32_t *outp=output.ptr();
+      float32_t *statep=state.ptr();
+      float32_t *covp=cov.ptr();
+      float32_t *workp=work.ptr();
+      float32_t *sqrtQp=noise.ptr();
+      float32_t *sqrtRp=sqrtQp + MAXNBSTATES*MAXNBSTATES;
+      int nbTests = dims.nbSamples() / 3;
+      int n,m,steps;
+      const float32_t *F,*H,*Q,*R,*P0;
+      arm_kalman_instance_f32 S;
+      arm_status status;
+
+      for(int i=0; i < nbTests; i++)
+      {
+          n = *dimsp++;
+          m = *dimsp++;
+          steps = *dimsp++;
+
+          F = inp;
+          H = F + n*n;
+          Q = H + m*n;
+          R = Q + n*n;
+          P0 = R + m*m;
+          inp = P0 + n*n;
+
+          sqrt_noise(Q,sqrtQp,n);
+          sqrt_noise(R,sqrtRp,m);
+
+          memset(statep,0,sizeof(float32_t)*n);
+          status=arm_kalman_init_f32(&S,n,m,statep,covp,P0,F,H,sqrtQp,sqrtRp,workp);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(int k=0; k < steps; k++)
+          {
+              status=arm_kalman_f32(&S,inp);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+              memcpy(outp,statep,sizeof(float32_t)*n);
+
+              inp += m;
+              outp += n;
+          }
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void EstimationTestsF32::test_kalman_not_positive_f32()
+    {     
+      float32_t *statep=state.ptr();
+      float32_t *covp=cov.ptr();
+      float32_t *workp=work.ptr();
+      const float32_t F[4]={1.0f,0.0f,0.0f,1.0f};
+      const float32_t H[2]={1.0f,0.0f};
+      const float32_t R[1]={1.0f};
+      /* Not positive definite */
+      const float32_t P0[4]={1.0f,2.0f,2.0f,1.0f};
+      arm_kalman_instance_f32 S;
+      arm_status status;
+
+      memset(statep,0,sizeof(float32_t)*2);
+      status=arm_kalman_init_f32(&S,2,1,statep,covp,P0,F,H,F,R,workp);
+      ASSERT_TRUE(status==ARM_MATH_DECOMPOSITION_FAILURE);
+
+    } 
+
+    void EstimationTestsF32::test_kalman_ill_conditioned_f32()
+    {     
+      const float32_t *inp=input.ptr();
+      const int16_t *dimsp=dims.ptr();
+      float32_t *outp=output.ptr();
+      float32_t *statep=state.ptr();
+      float32_t *covp=cov.ptr();
+      float32_t *workp=work.ptr();
+      int nbTests = dims.nbSamples() / 3;
+      int n,m,steps;
+      const float32_t *F,*H,*sqrtQ,*sqrtR,*P0;
+      arm_kalman_instance_f32 S;
+      arm_status status;
+
+      for(int i=0; i < nbTests; i++)
+      {
+          n = *dimsp++;
+          m = *dimsp++;
+          steps = *dimsp++;
+
+          /* The noise matrices are already square roots */
+          F = inp;
+          H = F + n*n;
+          sqrtQ = H + m*n;
+          sqrtR = sqrtQ + n*n;
+          P0 = sqrtR + m*m;
+          inp = P0 + n*n;
+
+          memset(statep,0,sizeof(float32_t)*n);
+          status=arm_kalman_init_f32(&S,n,m,statep,covp,P0,F,H,sqrtQ,sqrtR,workp);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          for(int k=0; k < steps; k++)
+          {
+              status=arm_kalman_f32(&S,inp);
+              ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+              memcpy(outp,statep,sizeof(float32_t)*n);
+
+              inp += m;
+              outp += n;
+          }
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_ILL,REL_ERROR_ILL);
+
+    } 
+
+    void EstimationTestsF32::test_rls_f32()
+    {     
+      const float32_t *inp=input.ptr();
+      const int16_t *dimsp=dims.ptr();
+      float32_t *outp=output.ptr();
+      float32_t *statep=state.ptr();
+      float32_t *covp=cov.ptr();
+      float32_t *workp=work.ptr();
+      int nbTests = dims.nbSamples() >> 1;
+      int p,steps,half;
+      arm_rls_instance_f32 S;
+
+      for(int i=0; i < nbTests; i++)
+      {
+          p = *dimsp++;
+          steps = *dimsp++;
+
+          memset(statep,0,sizeof(float32_t)*p);
+          arm_rls_init_f32(&S,p,0.98f,100.0f,statep,covp,workp);
+
+          /* Processed in two blocks to check the state is kept */
+          half = steps >> 1;
+          arm_rls_f32(&S,inp,inp + steps*p,outp,half);
+          arm_rls_f32(&S,inp + half*p,inp + steps*p + half,outp + half,steps - half);
+
+          memcpy(outp + steps,statep,sizeof(float32_t)*p);
+
+          inp += steps*p + steps;
+          outp += steps + p;
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_RLS,REL_ERROR_RLS);
+
+    } 
+
+    void EstimationTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case EstimationTestsF32::TEST_KALMAN_F32_1:
+            input.reload(EstimationTestsF32::INPUTKALMAN1_F32_ID,mgr);
+            dims.reload(EstimationTestsF32::DIMSKALMAN1_S16_ID,mgr);
+            ref.reload(EstimationTestsF32::REFKALMAN1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),EstimationTestsF32::OUT_F32_ID,mgr);
+         break;
+
+         case EstimationTestsF32::TEST_KALMAN_ILL_CONDITIONED_F32_4:
+            input.reload(EstimationTestsF32::INPUTKALMAN2_F32_ID,mgr);
+            dims.reload(EstimationTestsF32::DIMSKALMAN2_S16_ID,mgr);
+            ref.reload(EstimationTestsF32::REFKALMAN2_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),EstimationTestsF32::OUT_F32_ID,mgr);
+         break;
+
+         case EstimationTestsF32::TEST_RLS_F32_3:
+            input.reload(EstimationTestsF32::INPUTRLS1_F32_ID,mgr);
+            dims.reload(EstimationTestsF32::DIMSRLS1_S16_ID,mgr);
+            ref.reload(EstimationTestsF32::REFRLS1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),EstimationTestsF32::OUT_F32_ID,mgr);
+         break;
+      }
+
+      state.create(MAXNBPARAMS,EstimationTestsF32::STATE_F32_ID,mgr);
+      cov.create(MAXNBPARAMS*MAXNBPARAMS,EstimationTestsF32::COV_F32_ID,mgr);
+      work.create(ARM_KALMAN_WORKSPACE_SIZE_F32(MAXNBSTATES,MAXNBMEAS),EstimationTestsF32::WORK_F32_ID,mgr);
+      noise.create(MAXNBSTATES*MAXNBSTATES + MAXNBMEAS*MAXNBMEAS,EstimationTestsF32::NOISE_F32_ID,mgr);
+    
+    }
+
+    void EstimationTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
@@ -115,6 +115,60 @@ a double precision computation.
     }
 
   
+    void FastMathF16::test_vtanh_f16()
+    {
+        const float16_t *inp  = input.ptr();
+        float16_t *outp  = output.ptr();
+
+        arm_vtanh_f16(inp,outp,ref.nbSamples());
+
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_SNR(ref,output,(float16_t)SNR_THRESHOLD);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF16::test_vsigmoid_f16()
+    {
+        const float16_t *inp  = input.ptr();
+        float16_t *outp  = output.ptr();
+
+        arm_vsigmoid_f16(inp,outp,ref.nbSamples());
+
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_SNR(ref,output,(float16_t)SNR_THRESHOLD);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF16::test_vpow_f16()
+    {
+        const float16_t *inpA  = input.ptr();
+        const float16_t *inpB  = input2.ptr();
+        float16_t *outp  = output.ptr();
+
+        arm_vpow_f16(inpA,inpB,outp,ref.nbSamples());
+
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_SNR(ref,output,(float16_t)SNR_THRESHOLD);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF16::test_atan2_f16()
+    {
+        const float16_t *inpA  = input.ptr();
+        const float16_t *inpB  = input2.ptr();
+        float16_t *outp  = output.ptr();
+
+        arm_atan2_f16(inpA,inpB,outp,ref.nbSamples());
+
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_SNR(ref,output,(float16_t)SNR_THRESHOLD);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
     void FastMathF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -230,6 +284,44 @@ a double precision computation.
 
             }
             break;
+
+            case FastMathF16::TEST_VTANH_F16_13:
+            {
+               input.reload(FastMathF16::TANHINPUT1_F16_ID,mgr);
+               ref.reload(FastMathF16::TANHREF1_F16_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF16::OUT_F16_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF16::TEST_VSIGMOID_F16_14:
+            {
+               input.reload(FastMathF16::SIGMOIDINPUT1_F16_ID,mgr);
+               ref.reload(FastMathF16::SIGMOIDREF1_F16_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF16::OUT_F16_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF16::TEST_VPOW_F16_15:
+            {
+               input.reload(FastMathF16::POWINPUTA1_F16_ID,mgr);
+               input2.reload(FastMathF16::POWINPUTB1_F16_ID,mgr);
+               ref.reload(FastMathF16::POWREF1_F16_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF16::OUT_F16_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF16::TEST_ATAN2_F16_16:
+            {
+               input.reload(FastMathF16::ATAN2INPUTY1_F16_ID,mgr);
+               input2.reload(FastMathF16::ATAN2INPUTX1_F16_ID,mgr);
+               ref.reload(FastMathF16::ATAN2REF1_F16_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF16::OUT_F16_ID,mgr);
+
+            }
+            break;
         }
         
     }
@@ -17,6 +17,10 @@ a double precision computation.
 #define REL_ERROR (1.0e-6)
 #define ABS_ERROR (1.0e-5)
 
+/* About 3 ULP for the polynomial approximations */
+#define POLY_REL_ERROR (3.6e-7)
+#define POLY_ABS_ERROR (1.0e-30)
+
     void FastMathF32::test_cos_f32()
     {
         const float32_t *inp  = input.ptr();
@@ -95,7 +99,144 @@ a double precision computation.
 
     }
 
+    void FastMathF32::test_vtanh_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vtanh_f32(inp,outp,ref.nbSamples());
+    
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,POLY_ABS_ERROR,POLY_REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vsigmoid_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vsigmoid_f32(inp,outp,ref.nbSamples());
+    
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,POLY_ABS_ERROR,POLY_REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vexp2_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vexp2_f32(inp,outp,ref.nbSamples());
+    
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,POLY_ABS_ERROR,POLY_REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vlog2_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vlog2_f32(inp,outp,ref.nbSamples());
+    
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,POLY_ABS_ERROR,POLY_REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vpow_f32()
+    {
+        const float32_t *inpA  = input.ptr();
+        const float32_t *inpB  = input2.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vpow_f32(inpA,inpB,outp,ref.nbSamples());
+    
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,POLY_ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_atan2_f32()
+    {
+        const float32_t *inpA  = input.ptr();
+        const float32_t *inpB  = input2.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_atan2_f32(inpA,inpB,outp,ref.nbSamples());
+    
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,POLY_ABS_ERROR,POLY_REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
   
+    void FastMathF32::test_vsin_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vsin_f32(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vcos_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vcos_f32(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathF32::test_vsincos_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+        float32_t *outp2  = output2.ptr();
+
+        arm_vsincos_f32(inp,outp,outp2,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(ref2,output2,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref2,output2,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output2);
+
+    }
+
+    void FastMathF32::test_vsqrt_f32()
+    {
+        const float32_t *inp  = input.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_vsqrt_f32(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR,REL_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
     void FastMathF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -199,6 +340,100 @@ a double precision computation.
 
             }
             break;
+
+            case FastMathF32::TEST_VTANH_F32_12:
+            {
+               input.reload(FastMathF32::TANHINPUT1_F32_ID,mgr);
+               ref.reload(FastMathF32::TANHREF1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VSIGMOID_F32_13:
+            {
+               input.reload(FastMathF32::SIGMOIDINPUT1_F32_ID,mgr);
+               ref.reload(FastMathF32::SIGMOIDREF1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VEXP2_F32_14:
+            {
+               input.reload(FastMathF32::EXP2INPUT1_F32_ID,mgr);
+               ref.reload(FastMathF32::EXP2REF1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VLOG2_F32_15:
+            {
+               input.reload(FastMathF32::LOG2INPUT1_F32_ID,mgr);
+               ref.reload(FastMathF32::LOG2REF1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VPOW_F32_16:
+            {
+               input.reload(FastMathF32::POWINPUTA1_F32_ID,mgr);
+               input2.reload(FastMathF32::POWINPUTB1_F32_ID,mgr);
+               ref.reload(FastMathF32::POWREF1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_ATAN2_F32_17:
+            {
+               input.reload(FastMathF32::ATAN2INPUTY1_F32_ID,mgr);
+               input2.reload(FastMathF32::ATAN2INPUTX1_F32_ID,mgr);
+               ref.reload(FastMathF32::ATAN2REF1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VSIN_F32_18:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr);
+               ref.reload(FastMathF32::SIN1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VCOS_F32_19:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr);
+               ref.reload(FastMathF32::COS1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VSINCOS_F32_20:
+            {
+               input.reload(FastMathF32::ANGLES1_F32_ID,mgr);
+               ref.reload(FastMathF32::SIN1_F32_ID,mgr);
+               ref2.reload(FastMathF32::COS1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+               output2.create(ref2.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
+
+            case FastMathF32::TEST_VSQRT_F32_21:
+            {
+               input.reload(FastMathF32::SQRTINPUT1_F32_ID,mgr);
+               ref.reload(FastMathF32::SQRT1_F32_ID,mgr);
+               output.create(ref.nbSamples(),FastMathF32::OUT_F32_ID,mgr);
+
+            }
+            break;
         }
         
     }
@@ -14,6 +14,9 @@ a double precision computation.
 */
 #define ABS_ERROR ((q15_t)10)
 
+/* The two-argument arctangent is accurate to about 1 LSB */
+#define ATAN2_ABS_ERROR ((q15_t)2)
+
 
 
     void FastMathQ15::test_division_q15()
@@ -89,6 +92,33 @@ a double precision computation.
 
     }
 
+    void FastMathQ15::test_atan2_q15()
+    {
+        const q15_t *inpY  = input.ptr();
+        const q15_t *inpX  = input2.ptr();
+        q15_t *outp  = output.ptr();
+
+        arm_atan2_q15(inpY,inpX,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ATAN2_ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ15::test_vsqrt_q15()
+    {
+        const q15_t *inp  = input.ptr();
+        q15_t *outp  = output.ptr();
+
+        arm_vsqrt_q15(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
   
     void FastMathQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -135,6 +165,25 @@ a double precision computation.
 
             }
             break;
+
+            case FastMathQ15::TEST_ATAN2_Q15_5:
+            {
+               input.reload(FastMathQ15::ATAN2INPUTY1_Q15_ID,mgr);
+               input2.reload(FastMathQ15::ATAN2INPUTX1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::ATAN2REF1_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ15::TEST_VSQRT_Q15_6:
+            {
+               input.reload(FastMathQ15::SQRTINPUT1_Q15_ID,mgr);
+               ref.reload(FastMathQ15::SQRT1_Q15_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ15::OUT_Q15_ID,mgr);
+
+            }
+            break;
         }
         
     }
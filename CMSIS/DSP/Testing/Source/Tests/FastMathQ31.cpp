@@ -13,6 +13,9 @@ a double precision computation.
 */
 #define ABS_ERROR ((q31_t)2200)
 
+/* The two-argument arctangent is accurate to about 1 LSB */
+#define ATAN2_ABS_ERROR ((q31_t)2)
+
 
 
     void FastMathQ31::test_cos_q31()
@@ -65,6 +68,33 @@ a double precision computation.
 
     }
 
+    void FastMathQ31::test_atan2_q31()
+    {
+        const q31_t *inpY  = input.ptr();
+        const q31_t *inpX  = input2.ptr();
+        q31_t *outp  = output.ptr();
+
+        arm_atan2_q31(inpY,inpX,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ATAN2_ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
+    void FastMathQ31::test_vsqrt_q31()
+    {
+        const q31_t *inp  = input.ptr();
+        q31_t *outp  = output.ptr();
+
+        arm_vsqrt_q31(inp,outp,ref.nbSamples());
+
+        ASSERT_SNR(ref,output,(float32_t)SNR_THRESHOLD);
+        ASSERT_NEAR_EQ(ref,output,ABS_ERROR);
+        ASSERT_EMPTY_TAIL(output);
+
+    }
+
   
     void FastMathQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -97,6 +127,25 @@ a double precision computation.
 
             }
             break;
+
+            case FastMathQ31::TEST_ATAN2_Q31_4:
+            {
+               input.reload(FastMathQ31::ATAN2INPUTY1_Q31_ID,mgr);
+               input2.reload(FastMathQ31::ATAN2INPUTX1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::ATAN2REF1_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
+
+            case FastMathQ31::TEST_VSQRT_Q31_5:
+            {
+               input.reload(FastMathQ31::SQRTINPUT1_Q31_ID,mgr);
+               ref.reload(FastMathQ31::SQRT1_Q31_ID,mgr);
+               output.create(ref.nbSamples(),FastMathQ31::OUT_Q31_ID,mgr);
+
+            }
+            break;
         }
         
     }
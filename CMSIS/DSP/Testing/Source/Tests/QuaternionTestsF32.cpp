@@ -13,6 +13,42 @@ a double precision computation.
 #define REL_ERROR (1.0e-6)
 #define ABS_ERROR (1.0e-7)
 
+/* Interpolation factor of the slerp test.
+   Must be consistent with the Python script */
+#define SLERP_T 0.3f
+
+/* The rotated vectors are not normalized and
+   some coordinates are the result of a cancellation */
+#define ABS_ERROR_ROTATE (1.0e-6)
+
+/* 
+
+The SoA functions are tested with the AoS patterns.
+The inputs are converted to SoA and the output back to AoS.
+
+*/
+static void aos_to_soa(const float32_t *pSrc, float32_t *pDst, uint32_t nb, uint32_t stride)
+{
+    for(uint32_t i=0; i < nb; i++)
+    {
+        for(uint32_t k=0; k < stride; k++)
+        {
+            pDst[k*nb + i] = pSrc[i*stride + k];
+        }
+    }
+}
+
+static void soa_to_aos(const float32_t *pSrc, float32_t *pDst, uint32_t nb, uint32_t stride)
+{
+    for(uint32_t i=0; i < nb; i++)
+    {
+        for(uint32_t k=0; k < stride; k++)
+        {
+            pDst[i*stride + k] = pSrc[k*nb + i];
+        }
+    }
+}
+
 
 
     void QuaternionTestsF32::test_quaternion_norm_f32()
@@ -166,6 +202,136 @@ a double precision computation.
     } 
 
 
+    void QuaternionTestsF32::test_quaternion_conjugate_soa_f32()
+    {
+        const uint32_t nb = input1.nbSamples() >> 2;
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,4);
+        arm_quaternion_conjugate_soa_f32(soaInput1.ptr(),soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),output.ptr(),nb,4);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void QuaternionTestsF32::test_quaternion_normalize_soa_f32()
+    {
+        const uint32_t nb = input1.nbSamples() >> 2;
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,4);
+        arm_quaternion_normalize_soa_f32(soaInput1.ptr(),soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),output.ptr(),nb,4);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void QuaternionTestsF32::test_quaternion_product_soa_f32()
+    {
+        const uint32_t nb = input1.nbSamples() >> 2;
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,4);
+        aos_to_soa(input2.ptr(),soaInput2.ptr(),nb,4);
+        arm_quaternion_product_soa_f32(soaInput1.ptr(),soaInput2.ptr(),soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),output.ptr(),nb,4);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void QuaternionTestsF32::test_quaternion2rotation_soa_f32()
+    {
+        const uint32_t nb = input1.nbSamples() >> 2;
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,4);
+        arm_quaternion2rotation_soa_f32(soaInput1.ptr(),soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),output.ptr(),nb,9);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void QuaternionTestsF32::test_rotation2quaternion_soa_f32()
+    {
+        const uint32_t nb = output.nbSamples() >> 2;
+        float32_t *outp=output.ptr();
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,9);
+        arm_rotation2quaternion_soa_f32(soaInput1.ptr(),soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),outp,nb,4);
+
+        /*  Remove ambiguity */
+        for(uint32_t i=0; i < nb ; i++)
+        {
+            if (outp[0] < 0.0f)
+            {
+                outp[0] = -outp[0];
+                outp[1] = -outp[1];
+                outp[2] = -outp[2];
+                outp[3] = -outp[3];
+            }
+
+            outp += 4;
+        }
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void QuaternionTestsF32::test_quaternion_rotate_soa_f32()
+    {
+        const uint32_t nb = input1.nbSamples() >> 2;
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,4);
+        aos_to_soa(input2.ptr(),soaInput2.ptr(),nb,3);
+        arm_quaternion_rotate_soa_f32(soaInput1.ptr(),soaInput2.ptr(),soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),output.ptr(),nb,3);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR_ROTATE,REL_ERROR);
+
+    } 
+
+    void QuaternionTestsF32::test_quaternion_slerp_soa_f32()
+    {
+        const uint32_t nb = input1.nbSamples() >> 2;
+
+        aos_to_soa(input1.ptr(),soaInput1.ptr(),nb,4);
+        aos_to_soa(input2.ptr(),soaInput2.ptr(),nb,4);
+        arm_quaternion_slerp_soa_f32(soaInput1.ptr(),soaInput2.ptr(),SLERP_T,soaOutput.ptr(),nb);
+        soa_to_aos(soaOutput.ptr(),output.ptr(),nb,4);
+
+        ASSERT_EMPTY_TAIL(output);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
  
     void QuaternionTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
@@ -219,6 +385,61 @@ a double precision computation.
             ref.reload(QuaternionTestsF32::REF_ROT2QUAT_F32_ID,mgr,nb);
           break;
 
+          case QuaternionTestsF32::TEST_QUATERNION_CONJUGATE_SOA_F32_9:
+            input1.reload(QuaternionTestsF32::INPUT1_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_CONJUGATE_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
+          case QuaternionTestsF32::TEST_QUATERNION_NORMALIZE_SOA_F32_10:
+            input1.reload(QuaternionTestsF32::INPUT1_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_NORMALIZE_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
+          case QuaternionTestsF32::TEST_QUATERNION_PRODUCT_SOA_F32_11:
+            input1.reload(QuaternionTestsF32::INPUT1_F32_ID,mgr,nb);
+            input2.reload(QuaternionTestsF32::INPUT2_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_MULT_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaInput2.create(input2.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
+          case QuaternionTestsF32::TEST_QUATERNION2ROTATION_SOA_F32_12:
+            input1.reload(QuaternionTestsF32::INPUT1_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_QUAT2ROT_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
+          case QuaternionTestsF32::TEST_ROTATION2QUATERNION_SOA_F32_13:
+            input1.reload(QuaternionTestsF32::INPUT7_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_ROT2QUAT_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
+          case QuaternionTestsF32::TEST_QUATERNION_ROTATE_SOA_F32_14:
+            input1.reload(QuaternionTestsF32::INPUT8_F32_ID,mgr,nb);
+            input2.reload(QuaternionTestsF32::INPUT10_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_ROTATE_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaInput2.create(input2.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
+          case QuaternionTestsF32::TEST_QUATERNION_SLERP_SOA_F32_15:
+            input1.reload(QuaternionTestsF32::INPUT8_F32_ID,mgr,nb);
+            input2.reload(QuaternionTestsF32::INPUT9_F32_ID,mgr,nb);
+            ref.reload(QuaternionTestsF32::REF_SLERP_F32_ID,mgr,nb);
+            soaInput1.create(input1.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaInput2.create(input2.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+            soaOutput.create(ref.nbSamples(),QuaternionTestsF32::OUT_SAMPLES_F32_ID,mgr);
+          break;
+
        }
       
 
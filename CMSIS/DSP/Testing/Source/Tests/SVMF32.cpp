@@ -80,6 +80,37 @@ void SVMF32::test_svm_sigmoid_predict_f32()
 
 } 
 
+void SVMF32::test_svm_multiclass_predict_f32()
+{
+      const float32_t *inp  = samples.ptr();
+      int32_t *outp         = output.ptr();
+      int32_t *result;
+
+      result=outp;
+
+      for(int i =0; i < this->nbTestSamples; i++)
+      {
+         arm_svm_multiclass_predict_f32(&this->multiclass,inp,result);
+         result++;
+         inp += this->vecDim;
+      }
+
+      ASSERT_EQ(ref,output);
+
+} 
+
+void SVMF32::test_svm_linear_predict_batch_f32()
+{
+      arm_svm_linear_predict_batch_f32(&this->linear,
+         samples.ptr(),
+         this->nbTestSamples,
+         state.ptr(),
+         output.ptr());
+
+      ASSERT_EQ(ref,output);
+
+} 
+
 void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparams,Client::PatternMgr *mgr)
 {
       
@@ -89,7 +120,35 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
 
       switch(id)
       {
+          case SVMF32::TEST_SVM_MULTICLASS_PREDICT_F32_6:
+          {
+             samples.reload(SVMF32::SAMPLES7_F32_ID,mgr,nb);
+             params.reload(SVMF32::PARAMS7_F32_ID,mgr,nb);
+             dims.reload(SVMF32::DIMS7_S16_ID,mgr,nb);
+             ref.reload(SVMF32::REF7_S32_ID,mgr,nb);
+          }
+          break;
+
+          case SVMF32::TEST_SVM_MULTICLASS_PREDICT_F32_7:
+          {
+             samples.reload(SVMF32::SAMPLES8_F32_ID,mgr,nb);
+             params.reload(SVMF32::PARAMS8_F32_ID,mgr,nb);
+             dims.reload(SVMF32::DIMS8_S16_ID,mgr,nb);
+             ref.reload(SVMF32::REF8_S32_ID,mgr,nb);
+          }
+          break;
+
+          case SVMF32::TEST_SVM_MULTICLASS_PREDICT_F32_8:
+          {
+             samples.reload(SVMF32::SAMPLES9_F32_ID,mgr,nb);
+             params.reload(SVMF32::PARAMS9_F32_ID,mgr,nb);
+             dims.reload(SVMF32::DIMS9_S16_ID,mgr,nb);
+             ref.reload(SVMF32::REF9_S32_ID,mgr,nb);
+          }
+          break;
+
           case SVMF32::TEST_SVM_LINEAR_PREDICT_F32_1:
+          case SVMF32::TEST_SVM_LINEAR_PREDICT_BATCH_F32_9:
           {
              
              samples.reload(SVMF32::SAMPLES1_F32_ID,mgr,nb);
@@ -149,6 +208,60 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
       const float32_t  *paramsp = params.ptr();
       
       kind = dimsp[0];
+
+      if ((id >= SVMF32::TEST_SVM_MULTICLASS_PREDICT_F32_6) && (id <= SVMF32::TEST_SVM_MULTICLASS_PREDICT_F32_8))
+      {
+         /* kind, strategy, nb classes, nb test samples, vector dimension,
+            nb support vectors, degree, classes, nb support vectors per class */
+         arm_svm_multiclass_type strategy = (arm_svm_multiclass_type)dimsp[1];
+         int nbClasses = dimsp[2];
+         int nbClassifiers;
+         arm_status status;
+
+         this->nbTestSamples=dimsp[3];
+         this->vecDim = dimsp[4];
+         this->nbSupportVectors = dimsp[5];
+         this->degree = dimsp[6];
+
+         for(int i=0; i < nbClasses; i++)
+         {
+            this->multiClasses[i] = dimsp[7 + i];
+            this->nbPerClass[i] = dimsp[7 + nbClasses + i];
+         }
+
+         nbClassifiers = (strategy == ARM_SVM_ONE_VS_ONE) ? nbClasses*(nbClasses-1)/2 : nbClasses;
+
+         this->supportVectors=paramsp;
+         this->dualCoefs=paramsp + this->vecDim*this->nbSupportVectors;
+         /* nbClasses - 1 rows of dual coefficients for one vs one */
+         paramsp = this->dualCoefs + (nbClasses - (strategy == ARM_SVM_ONE_VS_ONE ? 1 : 0))*this->nbSupportVectors;
+         this->intercepts = paramsp;
+         this->coef0 = paramsp[nbClassifiers];
+         this->gamma = paramsp[nbClassifiers + 1];
+
+         /* Kernels, votes and squared norms of the support vectors */
+         state.create(2*this->nbSupportVectors + nbClasses,SVMF32::STATE_F32_ID,mgr);
+
+         status=arm_svm_multiclass_init_f32(&multiclass,
+                 strategy,
+                 kind == SVMF32::RBF ? ARM_ML_KERNEL_RBF : ARM_ML_KERNEL_POLYNOMIAL,
+                 nbClasses,
+                 this->nbSupportVectors,
+                 this->vecDim,
+                 this->nbPerClass,
+                 this->intercepts,
+                 this->dualCoefs,
+                 this->supportVectors,
+                 this->multiClasses,
+                 this->degree,
+                 this->coef0,
+                 this->gamma,
+                 state.ptr());
+         ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+         output.create(ref.nbSamples(),SVMF32::OUT_S32_ID,mgr);
+         return;
+      }
       
       this->classes[0] = dimsp[1];
       this->classes[1] = dimsp[2];
@@ -183,8 +296,13 @@ void SVMF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparam
        switch(id)
        {
           case SVMF32::TEST_SVM_LINEAR_PREDICT_F32_1:
+          case SVMF32::TEST_SVM_LINEAR_PREDICT_BATCH_F32_9:
           //case SVMF32::TEST_SVM_RBF_PREDICT_F32_5:
           {
+             if (id == SVMF32::TEST_SVM_LINEAR_PREDICT_BATCH_F32_9)
+             {
+                state.create(this->vecDim + this->nbTestSamples,SVMF32::STATE_F32_ID,mgr);
+             }
              
              arm_svm_linear_init_f32(&linear, 
                  this->nbSupportVectors,
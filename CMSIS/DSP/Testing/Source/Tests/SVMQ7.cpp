@@ -0,0 +1,190 @@
+#include "SVMQ7.h"
+#include <stdio.h>
+#include "Error.h"
+
+
+void SVMQ7::test_svm_linear_predict_q7()
+{
+      const q7_t *inp  = samples.ptr();
+      int32_t *outp         = output.ptr();
+      int32_t *result;
+
+      result=outp;
+
+      for(int i =0; i < this->nbTestSamples; i++)
+      {
+         arm_svm_linear_predict_q7(&this->linear,inp,result);
+         result++;
+         inp += this->vecDim;
+      }
+
+      ASSERT_EQ(ref,output);
+
+} 
+
+void SVMQ7::test_svm_polynomial_predict_q7()
+{
+      const q7_t *inp  = samples.ptr();
+      int32_t *outp         = output.ptr();
+      int32_t *result;
+
+      result=outp;
+
+      for(int i =0; i < this->nbTestSamples; i++)
+      {
+         arm_svm_polynomial_predict_q7(&this->poly,inp,result);
+         result++;
+         inp += this->vecDim;
+      }
+
+      ASSERT_EQ(ref,output);
+
+} 
+
+void SVMQ7::test_svm_rbf_predict_q7()
+{
+      const q7_t *inp  = samples.ptr();
+      int32_t *outp         = output.ptr();
+      int32_t *result;
+
+      result=outp;
+
+      for(int i =0; i < this->nbTestSamples; i++)
+      {
+         arm_svm_rbf_predict_q7(&this->rbf,inp,result);
+         result++;
+         inp += this->vecDim;
+      }
+
+      ASSERT_EQ(ref,output);
+
+} 
+
+void SVMQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& testparams,Client::PatternMgr *mgr)
+{
+      
+      Testing::nbSamples_t nb=MAX_NB_SAMPLES; 
+      (void)testparams;
+
+      switch(id)
+      {
+          case SVMQ7::TEST_SVM_LINEAR_PREDICT_Q7_1:
+          {
+             samples.reload(SVMQ7::SAMPLES1_Q7_ID,mgr,nb);
+             support.reload(SVMQ7::SUPPORT1_Q7_ID,mgr,nb);
+             params.reload(SVMQ7::PARAMS1_S16_ID,mgr,nb);
+             dims.reload(SVMQ7::DIMS1_S16_ID,mgr,nb);
+             ref.reload(SVMQ7::REF1_S32_ID,mgr,nb);
+          }
+          break;
+
+          case SVMQ7::TEST_SVM_POLYNOMIAL_PREDICT_Q7_2:
+          {
+             samples.reload(SVMQ7::SAMPLES2_Q7_ID,mgr,nb);
+             support.reload(SVMQ7::SUPPORT2_Q7_ID,mgr,nb);
+             params.reload(SVMQ7::PARAMS2_S16_ID,mgr,nb);
+             dims.reload(SVMQ7::DIMS2_S16_ID,mgr,nb);
+             ref.reload(SVMQ7::REF2_S32_ID,mgr,nb);
+          }
+          break;
+
+          case SVMQ7::TEST_SVM_RBF_PREDICT_Q7_3:
+          {
+             samples.reload(SVMQ7::SAMPLES3_Q7_ID,mgr,nb);
+             support.reload(SVMQ7::SUPPORT3_Q7_ID,mgr,nb);
+             params.reload(SVMQ7::PARAMS3_S16_ID,mgr,nb);
+             dims.reload(SVMQ7::DIMS3_S16_ID,mgr,nb);
+             ref.reload(SVMQ7::REF3_S32_ID,mgr,nb);
+          }
+          break;
+      }
+
+
+      const int16_t   *dimsp = dims.ptr();
+      const q15_t  *paramsp = params.ptr();
+
+      /* kind, classes, nb test samples, vector dimension, nb support vectors,
+         degree, gamma shift */
+      this->classes[0] = dimsp[1];
+      this->classes[1] = dimsp[2];
+      this->nbTestSamples=dimsp[3];
+      this->vecDim = dimsp[4];
+      this->nbSupportVectors = dimsp[5];
+      this->degree = dimsp[6];
+      this->gammaShift = dimsp[7];
+
+      /* dual coefficients, intercept, coef0, gamma */
+      this->supportVectors=support.ptr();
+      this->dualCoefs=paramsp;
+      this->intercept=paramsp[this->nbSupportVectors];
+      this->coef0=paramsp[this->nbSupportVectors + 1];
+      this->gamma=paramsp[this->nbSupportVectors + 2];
+
+      switch(id)
+      {
+          case SVMQ7::TEST_SVM_LINEAR_PREDICT_Q7_1:
+          {
+             arm_svm_linear_init_q7(&linear, 
+                 this->nbSupportVectors,
+                 this->vecDim,
+                 this->intercept,
+                 this->dualCoefs,
+                 this->supportVectors,
+                 this->classes);
+          }
+          break;
+
+          case SVMQ7::TEST_SVM_POLYNOMIAL_PREDICT_Q7_2:
+          {
+             arm_svm_polynomial_init_q7(&poly, 
+                 this->nbSupportVectors,
+                 this->vecDim,
+                 this->intercept,
+                 this->dualCoefs,
+                 this->supportVectors,
+                 this->classes,
+                 this->degree,
+                 this->coef0,
+                 this->gamma,
+                 this->gammaShift
+                 );
+          }
+          break;
+
+          case SVMQ7::TEST_SVM_RBF_PREDICT_Q7_3:
+          {
+             /* Squared norms of the support vectors as computed
+                by the Python quantization helper */
+             norms.create(this->nbSupportVectors,SVMQ7::NORMS_Q31_ID,mgr);
+             q31_t *normsp = norms.ptr();
+             for(int i = 0; i < this->nbSupportVectors; i++)
+             {
+                arm_dot_prod_q7(this->supportVectors + i * this->vecDim,
+                   this->supportVectors + i * this->vecDim,
+                   this->vecDim,
+                   &normsp[i]);
+             }
+
+             arm_svm_rbf_init_q7(&rbf, 
+                 this->nbSupportVectors,
+                 this->vecDim,
+                 this->intercept,
+                 this->dualCoefs,
+                 this->supportVectors,
+                 normsp,
+                 this->classes,
+                 this->gamma,
+                 this->gammaShift
+                 );
+          }
+          break;
+      }
+
+      output.create(ref.nbSamples(),SVMQ7::OUT_S32_ID,mgr);
+}
+
+void SVMQ7::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+{
+    (void)id;
+    output.dump(mgr);
+}
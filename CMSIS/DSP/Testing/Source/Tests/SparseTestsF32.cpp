@@ -0,0 +1,175 @@
+#include "SparseTestsF32.h"
+#include "Error.h"
+
+
+#define SNR_THRESHOLD 120
+
+/* 
+
+Reference patterns are generated with
+a double precision computation.
+
+*/
+#define REL_ERROR (1.0e-5)
+#define ABS_ERROR (1.0e-5)
+
+#define PREPARESPARSE()                                                  \
+      in1.numRows=rows;                                                  \
+      in1.numCols=columns;                                               \
+      memcpy((void*)ap,(const void*)inp1,sizeof(float32_t)*rows*columns);\
+      in1.pData = ap;                                                    \
+                                                                         \
+      sp.pRowPtr = rowPtr;                                               \
+      sp.pColIdx = (uint16_t*)colIdx.ptr();                              \
+      sp.pData = values.ptr();
+
+
+    void SparseTestsF32::test_spmat_vec_mult_f32()
+    {     
+      const float32_t *inp1=input1.ptr();
+      const float32_t *vecp=input2.ptr();
+      float32_t *ap=a.ptr();
+      float32_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples() >> 1;
+      int rows,columns;
+      int i;
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPARESPARSE();
+
+          status=arm_spmat_from_mat_f32(&this->in1,&this->sp,rows*columns);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* Buffer too small for the non zero values */
+          if (rowPtr[rows] > 0)
+          {
+             status=arm_spmat_from_mat_f32(&this->in1,&this->sp,rowPtr[rows]-1);
+             ASSERT_TRUE(status==ARM_MATH_LENGTH_ERROR);
+
+             status=arm_spmat_from_mat_f32(&this->in1,&this->sp,rowPtr[rows]);
+             ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+          }
+
+          arm_spmat_vec_mult_f32(&this->sp, vecp, outp);
+
+          outp += rows ;
+          inp1 += rows * columns;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void SparseTestsF32::test_spmat_mult_dense_f32()
+    {     
+      const float32_t *inp1=input1.ptr();
+      const float32_t *inp2=input2.ptr();
+      float32_t *ap=a.ptr();
+      float32_t *bp=b.ptr();
+      float32_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples() / 3;
+      int rows,internal,columns;
+      int i;
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+          columns = *dimsp++;
+
+          in1.numRows=rows;
+          in1.numCols=internal;
+          memcpy((void*)ap,(const void*)inp1,sizeof(float32_t)*rows*internal);
+          in1.pData = ap;
+
+          in2.numRows=internal;
+          in2.numCols=columns;
+          memcpy((void*)bp,(const void*)inp2,sizeof(float32_t)*internal*columns);
+          in2.pData = bp;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = outp;
+
+          sp.pRowPtr = rowPtr;
+          sp.pColIdx = (uint16_t*)colIdx.ptr();
+          sp.pData = values.ptr();
+
+          status=arm_spmat_from_mat_f32(&this->in1,&this->sp,rows*internal);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          status=arm_spmat_mult_dense_f32(&this->sp,&this->in2,&this->out);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += rows * columns;
+          inp1 += rows * internal;
+          inp2 += internal * columns;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    } 
+
+    void SparseTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case TEST_SPMAT_VEC_MULT_F32_1:
+            input1.reload(SparseTestsF32::INPUTSPARSE1_F32_ID,mgr);
+            input2.reload(SparseTestsF32::INPUTSPARSEVEC1_F32_ID,mgr);
+            dims.reload(SparseTestsF32::DIMSSPARSE1_S16_ID,mgr);
+
+            ref.reload(SparseTestsF32::REFSPARSEVECMUL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),SparseTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPA_F32_ID,mgr);
+            values.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPV_F32_ID,mgr);
+            colIdx.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPI_S16_ID,mgr);
+         break;
+
+         case TEST_SPMAT_MULT_DENSE_F32_2:
+            input1.reload(SparseTestsF32::INPUTSPARSEMULTA1_F32_ID,mgr);
+            input2.reload(SparseTestsF32::INPUTSPARSEMULTB1_F32_ID,mgr);
+            dims.reload(SparseTestsF32::DIMSSPARSEMULT1_S16_ID,mgr);
+
+            ref.reload(SparseTestsF32::REFSPARSEMULT1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),SparseTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPB_F32_ID,mgr);
+            values.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPV_F32_ID,mgr);
+            colIdx.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsF32::TMPI_S16_ID,mgr);
+         break;
+
+      }
+       
+
+    
+    }
+
+    void SparseTestsF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
@@ -0,0 +1,90 @@
+#include "SparseTestsQ15.h"
+#include <stdio.h>
+#include "Error.h"
+
+#define SNR_THRESHOLD 70
+
+/* 
+
+Reference patterns are generated with
+a double precision computation.
+
+*/
+#define ABS_ERROR_Q15 ((q15_t)4)
+
+
+    void SparseTestsQ15::test_spmat_vec_mult_q15()
+    {     
+      const q15_t *inp1=input1.ptr();
+      const q15_t *vecp=input2.ptr();
+      q15_t *ap=a.ptr();
+      q15_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples() >> 1;
+      int rows,columns;
+      int i;
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          in1.numRows=rows;
+          in1.numCols=columns;
+          memcpy((void*)ap,(const void*)inp1,sizeof(q15_t)*rows*columns);
+          in1.pData = ap;
+
+          sp.pRowPtr = rowPtr;
+          sp.pColIdx = (uint16_t*)colIdx.ptr();
+          sp.pData = values.ptr();
+
+          status=arm_spmat_from_mat_q15(&this->in1,&this->sp,rows*columns);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          arm_spmat_vec_mult_q15(&this->sp, vecp, outp);
+
+          outp += rows ;
+          inp1 += rows * columns;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    } 
+
+    void SparseTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case TEST_SPMAT_VEC_MULT_Q15_1:
+            input1.reload(SparseTestsQ15::INPUTSPARSE1_Q15_ID,mgr);
+            input2.reload(SparseTestsQ15::INPUTSPARSEVEC1_Q15_ID,mgr);
+            dims.reload(SparseTestsQ15::DIMSSPARSE1_S16_ID,mgr);
+
+            ref.reload(SparseTestsQ15::REFSPARSEVECMUL1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),SparseTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsQ15::TMPA_Q15_ID,mgr);
+            values.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsQ15::TMPV_Q15_ID,mgr);
+            colIdx.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsQ15::TMPI_S16_ID,mgr);
+         break;
+
+      }
+       
+
+    
+    }
+
+    void SparseTestsQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
@@ -0,0 +1,90 @@
+#include "SparseTestsQ7.h"
+#include <stdio.h>
+#include "Error.h"
+
+#define SNR_THRESHOLD 20
+
+/* 
+
+Reference patterns are generated with
+a double precision computation.
+
+*/
+#define ABS_ERROR_Q7 ((q7_t)2)
+
+
+    void SparseTestsQ7::test_spmat_vec_mult_q7()
+    {     
+      const q7_t *inp1=input1.ptr();
+      const q7_t *vecp=input2.ptr();
+      q7_t *ap=a.ptr();
+      q7_t *outp=output.ptr();
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples() >> 1;
+      int rows,columns;
+      int i;
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          in1.numRows=rows;
+          in1.numCols=columns;
+          memcpy((void*)ap,(const void*)inp1,sizeof(q7_t)*rows*columns);
+          in1.pData = ap;
+
+          sp.pRowPtr = rowPtr;
+          sp.pColIdx = (uint16_t*)colIdx.ptr();
+          sp.pData = values.ptr();
+
+          status=arm_spmat_from_mat_q7(&this->in1,&this->sp,rows*columns);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          arm_spmat_vec_mult_q7(&this->sp, vecp, outp);
+
+          outp += rows ;
+          inp1 += rows * columns;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q7_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q7);
+
+    } 
+
+    void SparseTestsQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
+    {
+
+
+      (void)params;
+      switch(id)
+      {
+         case TEST_SPMAT_VEC_MULT_Q7_1:
+            input1.reload(SparseTestsQ7::INPUTSPARSE1_Q7_ID,mgr);
+            input2.reload(SparseTestsQ7::INPUTSPARSEVEC1_Q7_ID,mgr);
+            dims.reload(SparseTestsQ7::DIMSSPARSE1_S16_ID,mgr);
+
+            ref.reload(SparseTestsQ7::REFSPARSEVECMUL1_Q7_ID,mgr);
+
+            output.create(ref.nbSamples(),SparseTestsQ7::OUT_Q7_ID,mgr);
+            a.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsQ7::TMPA_Q7_ID,mgr);
+            values.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsQ7::TMPV_Q7_ID,mgr);
+            colIdx.create(MAXSPARSEDIM*MAXSPARSEDIM,SparseTestsQ7::TMPI_S16_ID,mgr);
+         break;
+
+      }
+       
+
+    
+    }
+
+    void SparseTestsQ7::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+       (void)id;
+       output.dump(mgr);
+    }
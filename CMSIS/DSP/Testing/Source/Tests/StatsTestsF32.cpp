@@ -13,6 +13,15 @@ a double precision computation.
 */
 #define REL_ERROR (1.0e-5)
 
+/* Window and hop used to generate the moving statistics patterns */
+#define MOVING_WINDOW 16
+#define MOVING_HOP 5
+
+/* Uniform bins used to generate the histogram patterns */
+#define HIST_MIN (-0.5f)
+#define HIST_MAX (0.75f)
+#define HIST_BINS 10
+
     void StatsTestsF32::test_max_f32()
     {
         const float32_t *inp  = inputA.ptr();
@@ -377,6 +386,176 @@ a double precision computation.
 
    
   
+    void StatsTestsF32::test_stats_accum_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        const int16_t *refind = maxIndexes.ptr();
+
+        float32_t *outp  = output.ptr();
+        int16_t  *ind    = index.ptr();
+
+        arm_stats_accum_instance_f32 S, S2;
+        /* Irregular blocks covering the loop body and tail cases */
+        const uint32_t cuts[] = {1, 8, 37, 150, 151};
+        const uint32_t nbSamples = inputA.nbSamples();
+
+        /*
+
+        The first part of the input is accumulated into S and the last
+        part into S2. S2 is then merged into S.
+
+        */
+        arm_stats_accum_init_f32(&S);
+        arm_stats_accum_init_f32(&S2);
+
+        arm_stats_accum_f32(&S, inp, cuts[0]);
+        arm_stats_accum_f32(&S, inp + cuts[0], cuts[1] - cuts[0]);
+        arm_stats_accum_f32(&S, inp + cuts[1], cuts[2] - cuts[1]);
+        arm_stats_accum_f32(&S, inp + cuts[2], cuts[3] - cuts[2]);
+
+        arm_stats_accum_f32(&S2, inp + cuts[3], cuts[4] - cuts[3]);
+        arm_stats_accum_f32(&S2, inp + cuts[4], nbSamples - cuts[4]);
+
+        arm_stats_accum_merge_f32(&S, &S2);
+
+        arm_stats_accum_result_f32(&S, &outp[0], &outp[1], &outp[2], &outp[3]);
+
+        ind[0] = (int16_t)S.minIndex;
+        ind[1] = (int16_t)S.maxIndex;
+
+        ASSERT_TRUE(S.count == nbSamples);
+        ASSERT_EQ(ind[0],refind[0]);
+        ASSERT_EQ(ind[1],refind[1]);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_REL_ERROR(output,ref,REL_ERROR);
+    }
+
+    void StatsTestsF32::test_moving_stats_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        float32_t *outp  = output.ptr();
+
+        arm_moving_stats_instance_f32 S;
+        float32_t buffer[MOVING_WINDOW];
+        uint32_t minQueue[MOVING_WINDOW];
+        uint32_t maxQueue[MOVING_WINDOW];
+        const uint32_t nbHops = inputA.nbSamples() / MOVING_HOP;
+
+        arm_moving_stats_init_f32(&S, MOVING_WINDOW, buffer, minQueue, maxQueue);
+
+        /*
+
+        The statistics of the window are read after each hop.
+        The window is not full for the first hops.
+
+        */
+        for(uint32_t i=0; i < nbHops; i++)
+        {
+           arm_moving_stats_f32(&S, inp, MOVING_HOP);
+
+           arm_moving_stats_result_f32(&S, &outp[0], &outp[1], &outp[2], &outp[3], &outp[4]);
+
+           inp += MOVING_HOP;
+           outp += 5;
+        }
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_REL_ERROR(output,ref,REL_ERROR);
+    }
+
+    void StatsTestsF32::test_histogram_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        int32_t *outp  = hist.ptr();
+        arm_status status;
+
+        memset(outp, 0, sizeof(int32_t) * HIST_BINS);
+
+        /* The histogram is computed in two blocks */
+        status = arm_histogram_f32(inp, 7, HIST_MIN, HIST_MAX, HIST_BINS, (uint32_t*)outp);
+        ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+        status = arm_histogram_f32(inp + 7, inputA.nbSamples() - 7, HIST_MIN, HIST_MAX, HIST_BINS, (uint32_t*)outp);
+        ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+        ASSERT_EQ(hist,refHist);
+    }
+
+    void StatsTestsF32::test_histogram_edges_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        const float32_t *edges  = inputB.ptr();
+        int32_t *outp  = hist.ptr();
+
+        memset(outp, 0, sizeof(int32_t) * refHist.nbSamples());
+
+        arm_histogram_edges_f32(inp, inputA.nbSamples(), edges, inputB.nbSamples() - 1, (uint32_t*)outp);
+
+        ASSERT_EQ(hist,refHist);
+    }
+
+    void StatsTestsF32::test_percentile_f32()
+    {
+        const float32_t *percentages  = inputB.ptr();
+        float32_t *outp  = output.ptr();
+        float32_t *tmpp  = tmp.ptr();
+
+        for(unsigned long i=0; i < inputB.nbSamples(); i++)
+        {
+           arm_percentile_f32((float32_t*)inputA.ptr(), inputA.nbSamples(), percentages[i], tmpp, &outp[i]);
+        }
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_REL_ERROR(output,ref,REL_ERROR);
+    }
+
+    void StatsTestsF32::test_median_f32()
+    {
+        float32_t *inp  = tmp.ptr();
+        float32_t *outp  = output.ptr();
+
+        /* In place computation on a copy of the input */
+        memcpy(inp, inputA.ptr(), sizeof(float32_t) * inputA.nbSamples());
+        arm_median_f32(inp, inputA.nbSamples() - 1, inp, &outp[0]);
+
+        memcpy(inp, inputA.ptr(), sizeof(float32_t) * inputA.nbSamples());
+        arm_median_f32(inp, inputA.nbSamples(), inp, &outp[1]);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_REL_ERROR(output,ref,REL_ERROR);
+    }
+
+    void StatsTestsF32::test_p2_quantile_f32()
+    {
+        const float32_t *inp  = inputA.ptr();
+        const float32_t *quantiles  = inputB.ptr();
+        float32_t *outp  = output.ptr();
+        arm_p2_quantile_instance_f32 S;
+        arm_status status;
+
+        for(unsigned long i=0; i < inputB.nbSamples(); i++)
+        {
+           status = arm_p2_quantile_init_f32(&S, quantiles[i]);
+           ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+           /* Irregular blocks including the initialization */
+           arm_p2_quantile_f32(&S, inp, 3);
+           arm_p2_quantile_f32(&S, inp + 3, 100);
+           arm_p2_quantile_f32(&S, inp + 103, inputA.nbSamples() - 103);
+
+           arm_p2_quantile_result_f32(&S, &outp[i]);
+        }
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_REL_ERROR(output,ref,REL_ERROR);
+    }
+
     void StatsTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -859,6 +1038,83 @@ a double precision computation.
             }
             break;
 
+            case StatsTestsF32::TEST_STATS_ACCUM_F32_40:
+            {
+               inputA.reload(StatsTestsF32::INPUTACCUM_F32_ID,mgr);
+
+               maxIndexes.reload(StatsTestsF32::ACCUMINDEXES_S16_ID,mgr);
+               ref.reload(StatsTestsF32::ACCUMVALS_F32_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsF32::OUT_F32_ID,mgr);
+               index.create(2,StatsTestsF32::OUT_S16_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_MOVING_STATS_F32_41:
+            {
+               inputA.reload(StatsTestsF32::INPUTMOVING_F32_ID,mgr);
+
+               ref.reload(StatsTestsF32::MOVINGVALS_F32_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsF32::OUT_F32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_HISTOGRAM_F32_42:
+            {
+               inputA.reload(StatsTestsF32::INPUTHIST_F32_ID,mgr);
+
+               refHist.reload(StatsTestsF32::HISTVALS_S32_ID,mgr);
+
+               hist.create(refHist.nbSamples(),StatsTestsF32::OUT_S32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_HISTOGRAM_EDGES_F32_43:
+            {
+               inputA.reload(StatsTestsF32::INPUTHIST_F32_ID,mgr);
+               inputB.reload(StatsTestsF32::HISTEDGES_F32_ID,mgr);
+
+               refHist.reload(StatsTestsF32::HISTEDGESVALS_S32_ID,mgr);
+
+               hist.create(refHist.nbSamples(),StatsTestsF32::OUT_S32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_PERCENTILE_F32_44:
+            {
+               inputA.reload(StatsTestsF32::INPUTPERCENTILE_F32_ID,mgr);
+               inputB.reload(StatsTestsF32::PERCENTAGES_F32_ID,mgr);
+
+               ref.reload(StatsTestsF32::PERCENTILEVALS_F32_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsF32::OUT_F32_ID,mgr);
+               tmp.create(inputA.nbSamples(),StatsTestsF32::TMP_F32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_MEDIAN_F32_45:
+            {
+               inputA.reload(StatsTestsF32::INPUTPERCENTILE_F32_ID,mgr);
+
+               ref.reload(StatsTestsF32::MEDIANVALS_F32_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsF32::OUT_F32_ID,mgr);
+               tmp.create(inputA.nbSamples(),StatsTestsF32::TMP_F32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsF32::TEST_P2_QUANTILE_F32_46:
+            {
+               inputA.reload(StatsTestsF32::INPUTP2_F32_ID,mgr);
+               inputB.reload(StatsTestsF32::QUANTILES_F32_ID,mgr);
+
+               ref.reload(StatsTestsF32::P2VALS_F32_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsF32::OUT_F32_ID,mgr);
+            }
+            break;
+
 
         }
         
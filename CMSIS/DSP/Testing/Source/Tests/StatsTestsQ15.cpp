@@ -15,6 +15,15 @@ a double precision computation.
 #define ABS_ERROR_Q15 ((q15_t)100)
 #define ABS_ERROR_Q63 (1<<17)
 
+/* Window and hop used to generate the moving statistics patterns */
+#define MOVING_WINDOW 16
+#define MOVING_HOP 5
+
+/* Uniform bins used to generate the histogram patterns */
+#define HIST_MIN ((q15_t)-16384)
+#define HIST_MAX ((q15_t)24576)
+#define HIST_BINS 10
+
     void StatsTestsQ15::test_max_q15()
     {
         const q15_t *inp  = inputA.ptr();
@@ -231,6 +240,117 @@ a double precision computation.
 
   
   
+    void StatsTestsQ15::test_stats_accum_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        const int16_t *refind = maxIndexes.ptr();
+
+        q15_t *outp  = output.ptr();
+        int16_t  *ind    = index.ptr();
+
+        arm_stats_accum_instance_q15 S, S2;
+        /* Irregular blocks covering the loop body and tail cases */
+        const uint32_t cuts[] = {1, 8, 37, 150, 151};
+        const uint32_t nbSamples = inputA.nbSamples();
+
+        /*
+
+        The first part of the input is accumulated into S and the last
+        part into S2. S2 is then merged into S.
+
+        */
+        arm_stats_accum_init_q15(&S);
+        arm_stats_accum_init_q15(&S2);
+
+        arm_stats_accum_q15(&S, inp, cuts[0]);
+        arm_stats_accum_q15(&S, inp + cuts[0], cuts[1] - cuts[0]);
+        arm_stats_accum_q15(&S, inp + cuts[1], cuts[2] - cuts[1]);
+        arm_stats_accum_q15(&S, inp + cuts[2], cuts[3] - cuts[2]);
+
+        arm_stats_accum_q15(&S2, inp + cuts[3], cuts[4] - cuts[3]);
+        arm_stats_accum_q15(&S2, inp + cuts[4], nbSamples - cuts[4]);
+
+        arm_stats_accum_merge_q15(&S, &S2);
+
+        arm_stats_accum_result_q15(&S, &outp[0], &outp[1], &outp[2], &outp[3]);
+
+        ind[0] = (int16_t)S.minIndex;
+        ind[1] = (int16_t)S.maxIndex;
+
+        ASSERT_TRUE(S.count == nbSamples);
+        ASSERT_EQ(ind[0],refind[0]);
+        ASSERT_EQ(ind[1],refind[1]);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+    }
+
+    void StatsTestsQ15::test_moving_stats_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        q15_t *outp  = output.ptr();
+
+        arm_moving_stats_instance_q15 S;
+        q15_t buffer[MOVING_WINDOW];
+        uint32_t minQueue[MOVING_WINDOW];
+        uint32_t maxQueue[MOVING_WINDOW];
+        const uint32_t nbHops = inputA.nbSamples() / MOVING_HOP;
+
+        arm_moving_stats_init_q15(&S, MOVING_WINDOW, buffer, minQueue, maxQueue);
+
+        /*
+
+        The statistics of the window are read after each hop.
+        The window is not full for the first hops.
+
+        */
+        for(uint32_t i=0; i < nbHops; i++)
+        {
+           arm_moving_stats_q15(&S, inp, MOVING_HOP);
+
+           arm_moving_stats_result_q15(&S, &outp[0], &outp[1], &outp[2], &outp[3], &outp[4]);
+
+           inp += MOVING_HOP;
+           outp += 5;
+        }
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+    }
+
+    void StatsTestsQ15::test_histogram_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        int32_t *outp  = hist.ptr();
+        arm_status status;
+
+        memset(outp, 0, sizeof(int32_t) * HIST_BINS);
+
+        /* The histogram is computed in two blocks */
+        status = arm_histogram_q15(inp, 7, HIST_MIN, HIST_MAX, HIST_BINS, (uint32_t*)outp);
+        ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+        status = arm_histogram_q15(inp + 7, inputA.nbSamples() - 7, HIST_MIN, HIST_MAX, HIST_BINS, (uint32_t*)outp);
+        ASSERT_TRUE(status == ARM_MATH_SUCCESS);
+
+        ASSERT_EQ(hist,refHist);
+    }
+
+    void StatsTestsQ15::test_histogram_edges_q15()
+    {
+        const q15_t *inp  = inputA.ptr();
+        const q15_t *edges  = inputB.ptr();
+        int32_t *outp  = hist.ptr();
+
+        memset(outp, 0, sizeof(int32_t) * refHist.nbSamples());
+
+        arm_histogram_edges_q15(inp, inputA.nbSamples(), edges, inputB.nbSamples() - 1, (uint32_t*)outp);
+
+        ASSERT_EQ(hist,refHist);
+    }
+
     void StatsTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -584,6 +704,49 @@ a double precision computation.
             }
             break;
 
+            case StatsTestsQ15::TEST_STATS_ACCUM_Q15_28:
+            {
+               inputA.reload(StatsTestsQ15::INPUTACCUM_Q15_ID,mgr);
+
+               maxIndexes.reload(StatsTestsQ15::ACCUMINDEXES_S16_ID,mgr);
+               ref.reload(StatsTestsQ15::ACCUMVALS_Q15_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsQ15::OUT_Q15_ID,mgr);
+               index.create(2,StatsTestsQ15::OUT_S16_ID,mgr);
+            }
+            break;
+
+            case StatsTestsQ15::TEST_MOVING_STATS_Q15_29:
+            {
+               inputA.reload(StatsTestsQ15::INPUTMOVING_Q15_ID,mgr);
+
+               ref.reload(StatsTestsQ15::MOVINGVALS_Q15_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsQ15::OUT_Q15_ID,mgr);
+            }
+            break;
+
+            case StatsTestsQ15::TEST_HISTOGRAM_Q15_30:
+            {
+               inputA.reload(StatsTestsQ15::INPUTHIST_Q15_ID,mgr);
+
+               refHist.reload(StatsTestsQ15::HISTVALS_S32_ID,mgr);
+
+               hist.create(refHist.nbSamples(),StatsTestsQ15::OUT_S32_ID,mgr);
+            }
+            break;
+
+            case StatsTestsQ15::TEST_HISTOGRAM_EDGES_Q15_31:
+            {
+               inputA.reload(StatsTestsQ15::INPUTHIST_Q15_ID,mgr);
+               inputB.reload(StatsTestsQ15::HISTEDGES_Q15_ID,mgr);
+
+               refHist.reload(StatsTestsQ15::HISTEDGESVALS_S32_ID,mgr);
+
+               hist.create(refHist.nbSamples(),StatsTestsQ15::OUT_S32_ID,mgr);
+            }
+            break;
+
           
         }
         
@@ -231,6 +231,94 @@ a double precision computation.
 
   
   
+    void StatsTestsQ31::test_stats_accum_q31()
+    {
+        const q31_t *inp  = inputA.ptr();
+        const int16_t *refind = maxIndexes.ptr();
+
+        q31_t *outp  = output.ptr();
+        int16_t  *ind    = index.ptr();
+
+        arm_stats_accum_instance_q31 S, S2;
+        /* Irregular blocks covering the loop body and tail cases */
+        const uint32_t cuts[] = {1, 8, 37, 150, 151};
+        const uint32_t nbSamples = inputA.nbSamples();
+
+        /*
+
+        The first part of the input is accumulated into S and the last
+        part into S2. S2 is then merged into S.
+
+        */
+        arm_stats_accum_init_q31(&S);
+        arm_stats_accum_init_q31(&S2);
+
+        arm_stats_accum_q31(&S, inp, cuts[0]);
+        arm_stats_accum_q31(&S, inp + cuts[0], cuts[1] - cuts[0]);
+        arm_stats_accum_q31(&S, inp + cuts[1], cuts[2] - cuts[1]);
+        arm_stats_accum_q31(&S, inp + cuts[2], cuts[3] - cuts[2]);
+
+        arm_stats_accum_q31(&S2, inp + cuts[3], cuts[4] - cuts[3]);
+        arm_stats_accum_q31(&S2, inp + cuts[4], nbSamples - cuts[4]);
+
+        arm_stats_accum_merge_q31(&S, &S2);
+
+        arm_stats_accum_result_q31(&S, &outp[0], &outp[1], &outp[2], &outp[3]);
+
+        ind[0] = (int16_t)S.minIndex;
+        ind[1] = (int16_t)S.maxIndex;
+
+        ASSERT_TRUE(S.count == nbSamples);
+        ASSERT_EQ(ind[0],refind[0]);
+        ASSERT_EQ(ind[1],refind[1]);
+
+        ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+        ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+    }
+
+    void StatsTestsQ31::test_stats_accum_limit_q31()
+    {
+        /* Deviation of 0x80000000 from the first sample 0x7FFFFFFF is the largest one */
+        const q31_t pair[2] = {0x7FFFFFFF, (q31_t)0x80000000};
+        const q63_t nbMax = (1LL << 30) - 1;
+
+        arm_stats_accum_instance_q31 S, T, copy;
+        q31_t mean, var, std, rms;
+
+        /*
+
+        T holds 2^k pairs and is merged into S for k = 0 .. 29, so S
+        reaches 2^30 - 1 samples with the largest deviation. It is the
+        documented limit of the accumulator.
+
+        */
+        arm_stats_accum_init_q31(&S);
+        arm_stats_accum_init_q31(&T);
+        arm_stats_accum_q31(&T, pair, 2);
+
+        for(int k=0; k < 30; k++)
+        {
+           arm_stats_accum_merge_q31(&S, &T);
+           if (k < 29)
+           {
+              copy = T;
+              arm_stats_accum_merge_q31(&T, &copy);
+           }
+        }
+
+        ASSERT_TRUE(S.count == (uint64_t)(2 * nbMax));
+        ASSERT_TRUE(S.sum == -nbMax * 0xFFFFFFFFLL);
+        ASSERT_TRUE(S.sumOfSquares == (nbMax << 33));
+
+        arm_stats_accum_result_q31(&S, &mean, &var, &std, &rms);
+
+        ASSERT_TRUE(mean == 0);
+        ASSERT_TRUE(var == 0x7FFFFFFF);
+        ASSERT_TRUE(S.minIndex == 1);
+        ASSERT_TRUE(S.maxIndex == 0);
+    }
+
     void StatsTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
         (void)paramsArgs;
@@ -584,6 +672,18 @@ a double precision computation.
             }
             break;
 
+            case StatsTestsQ31::TEST_STATS_ACCUM_Q31_28:
+            {
+               inputA.reload(StatsTestsQ31::INPUTACCUM_Q31_ID,mgr);
+
+               maxIndexes.reload(StatsTestsQ31::ACCUMINDEXES_S16_ID,mgr);
+               ref.reload(StatsTestsQ31::ACCUMVALS_Q31_ID,mgr);
+
+               output.create(ref.nbSamples(),StatsTestsQ31::OUT_Q31_ID,mgr);
+               index.create(2,StatsTestsQ31::OUT_S16_ID,mgr);
+            }
+            break;
+
           
         }
         
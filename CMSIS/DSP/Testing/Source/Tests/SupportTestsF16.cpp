@@ -17,6 +17,12 @@
 #define ABS_Q31_ERROR ((q31_t)80)
 #define ABS_Q7_ERROR ((q7_t)10)
 
+#define ABS_AFFINE_F16_ERROR (1.0e-3)
+#define REL_AFFINE_F16_ERROR (1.0e-3)
+
+/* The f16 to Q31 conversion is computed in single precision */
+#define ABS_AFFINE_Q31_ERROR ((q31_t)256)
+
 
 void SupportTestsF16::test_weighted_sum_f16()
 {
@@ -123,6 +129,118 @@ void SupportTestsF16::test_f32_f16()
 
 } 
 
+void SupportTestsF16::test_convert_affine_f16_q15()
+{
+ const float16_t *inp = input.ptr();
+ q15_t *outp = outputQ15.ptr();
+
+
+ arm_convert_affine_f16_q15(inp, (float16_t)0.75f, (float16_t)-0.125f, outp, this->nbSamples);
+
+
+ ASSERT_NEAR_EQ(refQ15,outputQ15,ABS_Q15_ERROR);
+ ASSERT_EMPTY_TAIL(outputQ15);
+
+} 
+
+void SupportTestsF16::test_convert_affine_f16_f32()
+{
+ const float16_t *inp = input.ptr();
+ float32_t *outp = outputF32.ptr();
+
+
+ arm_convert_affine_f16_f32(inp, 3.0f, 1.0f, outp, this->nbSamples);
+
+
+ ASSERT_CLOSE_ERROR(refF32,outputF32,ABS_ERROR_F32,REL_ERROR_F32);
+ ASSERT_EMPTY_TAIL(outputF32);
+
+} 
+
+void SupportTestsF16::test_convert_affine_q15_f16()
+{
+ const q15_t *inp = inputQ15.ptr();
+ float16_t *outp = output.ptr();
+
+
+ arm_convert_affine_q15_f16(inp, (float16_t)0.5f, (float16_t)0.25f, outp, this->nbSamples);
+
+
+ ASSERT_CLOSE_ERROR(ref,output,ABS_AFFINE_F16_ERROR,REL_AFFINE_F16_ERROR);
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
+void SupportTestsF16::test_convert_affine_f32_f16()
+{
+ const float32_t *inp = inputF32.ptr();
+ float16_t *outp = output.ptr();
+
+
+ arm_convert_affine_f32_f16(inp, 60000.0f, 0.0f, outp, this->nbSamples);
+
+
+ ASSERT_CLOSE_ERROR(ref,output,ABS_AFFINE_F16_ERROR,REL_AFFINE_F16_ERROR);
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
+void SupportTestsF16::test_convert_affine_f16_q7()
+{
+ const float16_t *inp = input.ptr();
+ q7_t *outp = outputQ7.ptr();
+
+
+ arm_convert_affine_f16_q7(inp, (float16_t)0.75f, (float16_t)-0.125f, outp, this->nbSamples);
+
+
+ ASSERT_NEAR_EQ(refQ7,outputQ7,ABS_Q7_ERROR);
+ ASSERT_EMPTY_TAIL(outputQ7);
+
+} 
+
+void SupportTestsF16::test_convert_affine_f16_q31()
+{
+ const float16_t *inp = input.ptr();
+ q31_t *outp = outputQ31.ptr();
+
+
+ arm_convert_affine_f16_q31(inp, (float16_t)1.0f, (float16_t)-0.125f, outp, this->nbSamples);
+
+
+ ASSERT_NEAR_EQ(refQ31,outputQ31,ABS_AFFINE_Q31_ERROR);
+ ASSERT_EMPTY_TAIL(outputQ31);
+
+} 
+
+void SupportTestsF16::test_convert_affine_q7_f16()
+{
+ const q7_t *inp = inputQ7.ptr();
+ float16_t *outp = output.ptr();
+
+
+ arm_convert_affine_q7_f16(inp, (float16_t)0.5f, (float16_t)0.25f, outp, this->nbSamples);
+
+
+ ASSERT_CLOSE_ERROR(ref,output,ABS_AFFINE_F16_ERROR,REL_AFFINE_F16_ERROR);
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
+void SupportTestsF16::test_convert_affine_q31_f16()
+{
+ const q31_t *inp = inputQ31.ptr();
+ float16_t *outp = output.ptr();
+
+
+ arm_convert_affine_q31_f16(inp, (float16_t)0.5f, (float16_t)0.25f, outp, this->nbSamples);
+
+
+ ASSERT_CLOSE_ERROR(ref,output,ABS_AFFINE_F16_ERROR,REL_AFFINE_F16_ERROR);
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
 
 void SupportTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
 {
@@ -305,6 +423,70 @@ void SupportTestsF16::setUp(Testing::testID_t id,std::vector<Testing::param_t>&
 
     break;
 
+    case TEST_CONVERT_AFFINE_F16_Q15_22:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF16::INPUT_AFFINE_F16_ID,mgr,this->nbSamples);
+    refQ15.reload(SupportTestsF16::REF_AFFINE_Q15_ID,mgr,this->nbSamples);
+    outputQ15.create(this->nbSamples,SupportTestsF16::OUT_Q15_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_F16_F32_23:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF16::INPUT_AFFINE_F16_ID,mgr,this->nbSamples);
+    refF32.reload(SupportTestsF16::REF_AFFINE_F32_ID,mgr,this->nbSamples);
+    outputF32.create(this->nbSamples,SupportTestsF16::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_Q15_F16_24:
+    this->nbSamples = 255;
+    inputQ15.reload(SupportTestsF16::INPUT_AFFINE_Q15_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF16::REF_AFFINE_Q15_F16_ID,mgr,this->nbSamples);
+    output.create(this->nbSamples,SupportTestsF16::OUT_F16_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_F32_F16_25:
+    this->nbSamples = 255;
+    inputF32.reload(SupportTestsF16::INPUT_AFFINE_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF16::REF_AFFINE_F32_F16_ID,mgr,this->nbSamples);
+    output.create(this->nbSamples,SupportTestsF16::OUT_F16_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_F16_Q7_26:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF16::INPUT_AFFINE_F16_FIXED_ID,mgr,this->nbSamples);
+    refQ7.reload(SupportTestsF16::REF_AFFINE_Q7_ID,mgr,this->nbSamples);
+    outputQ7.create(this->nbSamples,SupportTestsF16::OUT_Q7_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_F16_Q31_27:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF16::INPUT_AFFINE_F16_FIXED_ID,mgr,this->nbSamples);
+    refQ31.reload(SupportTestsF16::REF_AFFINE_Q31_ID,mgr,this->nbSamples);
+    outputQ31.create(this->nbSamples,SupportTestsF16::OUT_Q31_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_Q7_F16_28:
+    this->nbSamples = 255;
+    inputQ7.reload(SupportTestsF16::INPUT_AFFINE_Q7_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF16::REF_AFFINE_Q7_F16_ID,mgr,this->nbSamples);
+    output.create(this->nbSamples,SupportTestsF16::OUT_F16_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_Q31_F16_29:
+    this->nbSamples = 255;
+    inputQ31.reload(SupportTestsF16::INPUT_AFFINE_Q31_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF16::REF_AFFINE_Q31_F16_ID,mgr,this->nbSamples);
+    output.create(this->nbSamples,SupportTestsF16::OUT_F16_ID,mgr);
+
+    break;
+
 
   }       
 
@@ -9,6 +9,7 @@
 #define ABS_Q15_ERROR ((q15_t)10)
 #define ABS_Q31_ERROR ((q31_t)80)
 #define ABS_Q7_ERROR ((q7_t)10)
+#define ABS_AFFINE_Q31_ERROR ((q31_t)400)
 
 
 void SupportTestsF32::test_weighted_sum_f32()
@@ -416,6 +417,248 @@ void SupportTestsF32::test_selection_sort_const_f32()
 
 } 
 
+void SupportTestsF32::test_radix_sort_out_f32()
+{
+ float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+
+ arm_sort_f32(&S,inp,outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ ASSERT_EQ(output,ref);
+
+} 
+
+void SupportTestsF32::test_radix_sort_in_f32()
+{
+ float32_t *inp = input.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+
+ arm_sort_f32(&S,inp,inp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(input);
+
+ ASSERT_EQ(input,ref);
+
+} 
+
+void SupportTestsF32::test_radix_sort_const_f32()
+{
+ float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_ASCENDING);
+
+ arm_sort_f32(&S,inp,outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ ASSERT_EQ(output,ref);
+
+} 
+
+void SupportTestsF32::test_radix_sort_desc_f32()
+{
+ float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ arm_sort_instance_f32 S;
+
+ arm_sort_init_f32(&S, ARM_SORT_RADIX, ARM_SORT_DESCENDING);
+
+ arm_sort_f32(&S,inp,outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(output);
+
+ ASSERT_EQ(output,ref);
+
+} 
+
+void SupportTestsF32::test_argsort_f32()
+{
+ const float32_t *inp = input.ptr();
+ int32_t *outp = index.ptr();
+ arm_argsort_instance_f32 S;
+
+ arm_argsort_init_f32(&S, ARM_SORT_ASCENDING, (uint32_t*)work.ptr());
+
+ arm_argsort_f32(&S,inp,(uint32_t*)outp,this->nbSamples);
+ 
+ ASSERT_EMPTY_TAIL(index);
+
+ ASSERT_EQ(index,refIndex);
+
+} 
+
+void SupportTestsF32::test_topk_f32()
+{
+ const float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ int32_t *indexp = index.ptr();
+
+ arm_topk_f32(inp,this->nbSamples,ref.nbSamples(),ARM_SORT_DESCENDING,outp,(uint32_t*)indexp);
+ 
+ ASSERT_EMPTY_TAIL(output);
+ ASSERT_EMPTY_TAIL(index);
+
+ ASSERT_EQ(output,ref);
+ ASSERT_EQ(index,refIndex);
+
+} 
+
+void SupportTestsF32::test_convert_affine_f32_q31()
+{
+ const float32_t *inp = input.ptr();
+ q31_t *outp = outputQ31.ptr();
+
+
+ arm_convert_affine_f32_q31(inp, 0.8f, -0.1f, outp, this->nbSamples);
+
+
+ ASSERT_NEAR_EQ(refQ31,outputQ31,ABS_AFFINE_Q31_ERROR);
+ ASSERT_EMPTY_TAIL(outputQ31);
+
+} 
+
+void SupportTestsF32::test_convert_affine_f32_q15()
+{
+ const float32_t *inp = input.ptr();
+ q15_t *outp = outputQ15.ptr();
+
+
+ arm_convert_affine_f32_q15(inp, 0.8f, -0.1f, outp, this->nbSamples);
+
+
+ ASSERT_NEAR_EQ(refQ15,outputQ15,ABS_Q15_ERROR);
+ ASSERT_EMPTY_TAIL(outputQ15);
+
+} 
+
+void SupportTestsF32::test_convert_affine_f32_q7()
+{
+ const float32_t *inp = input.ptr();
+ q7_t *outp = outputQ7.ptr();
+
+
+ arm_convert_affine_f32_q7(inp, 0.8f, -0.1f, outp, this->nbSamples);
+
+
+ ASSERT_NEAR_EQ(refQ7,outputQ7,ABS_Q7_ERROR);
+ ASSERT_EMPTY_TAIL(outputQ7);
+
+} 
+
+void SupportTestsF32::test_convert_affine_sat_f32()
+{
+ /* Inputs several orders of magnitude outside of the fixed-point ranges */
+ const float32_t inp[6] = {1.0e8f, -1.0e8f, 2.0e7f, 1.0e30f, -1.0e30f, 0.5f};
+ const q31_t refQ31Sat[6] = {0x7FFFFFFF, (q31_t)0x80000000, 0x7FFFFFFF, 0x7FFFFFFF, (q31_t)0x80000000, 0x40000000};
+ const q15_t refQ15Sat[6] = {0x7FFF, (q15_t)0x8000, 0x7FFF, 0x7FFF, (q15_t)0x8000, 0x4000};
+ const q7_t refQ7Sat[6] = {0x7F, (q7_t)0x80, 0x7F, 0x7F, (q7_t)0x80, 0x40};
+
+ q31_t *outQ31 = outputQ31.ptr();
+ q15_t *outQ15 = outputQ15.ptr();
+ q7_t *outQ7 = outputQ7.ptr();
+
+ arm_convert_affine_f32_q31(inp, 1.0f, 0.0f, outQ31, 6);
+ arm_convert_affine_f32_q15(inp, 1.0f, 0.0f, outQ15, 6);
+ arm_convert_affine_f32_q7(inp, 1.0f, 0.0f, outQ7, 6);
+
+ for(int i=0; i < 6; i++)
+ {
+    ASSERT_TRUE(outQ31[i] == refQ31Sat[i]);
+    ASSERT_TRUE(outQ15[i] == refQ15Sat[i]);
+    ASSERT_TRUE(outQ7[i] == refQ7Sat[i]);
+ }
+
+} 
+
+void SupportTestsF32::test_deinterleave_f32()
+{
+ const float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ int i, ch;
+
+
+ arm_deinterleave_f32(inp, this->nbChannels, outp, this->nbSamples);
+
+
+ for(ch=0 ; ch < this->nbChannels; ch++)
+ {
+    for(i=0 ; i < this->nbSamples; i++)
+    {
+       ASSERT_EQ(inp[i * this->nbChannels + ch],outp[ch * this->nbSamples + i]);
+    }
+ }
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
+void SupportTestsF32::test_interleave_f32()
+{
+ const float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ int i, ch;
+
+
+ arm_interleave_f32(inp, this->nbChannels, outp, this->nbSamples);
+
+
+ for(ch=0 ; ch < this->nbChannels; ch++)
+ {
+    for(i=0 ; i < this->nbSamples; i++)
+    {
+       ASSERT_EQ(inp[ch * this->nbSamples + i],outp[i * this->nbChannels + ch]);
+    }
+ }
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
+void SupportTestsF32::test_cmplx_split_f32()
+{
+ const float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ int i;
+
+
+ arm_cmplx_split_f32(inp, outp, outp + this->nbSamples, this->nbSamples);
+
+
+ for(i=0 ; i < this->nbSamples; i++)
+ {
+    ASSERT_EQ(inp[2 * i],outp[i]);
+    ASSERT_EQ(inp[2 * i + 1],outp[this->nbSamples + i]);
+ }
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
+void SupportTestsF32::test_cmplx_merge_f32()
+{
+ const float32_t *inp = input.ptr();
+ float32_t *outp = output.ptr();
+ int i;
+
+
+ arm_cmplx_merge_f32(inp, inp + this->nbSamples, outp, this->nbSamples);
+
+
+ for(i=0 ; i < this->nbSamples; i++)
+ {
+    ASSERT_EQ(inp[i],outp[2 * i]);
+    ASSERT_EQ(inp[this->nbSamples + i],outp[2 * i + 1]);
+ }
+ ASSERT_EMPTY_TAIL(output);
+
+} 
+
 
 void SupportTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
 {
@@ -720,6 +963,147 @@ void SupportTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>&
     output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
     break;
 
+    case TEST_RADIX_SORT_OUT_F32_40:
+    this->nbSamples = 600;
+    input.reload(SupportTestsF32::INPUT_RADIX_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_RADIX_SORT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
+    case TEST_RADIX_SORT_IN_F32_41:
+    this->nbSamples = 600;
+    input.reload(SupportTestsF32::INPUT_RADIX_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_RADIX_SORT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
+    case TEST_RADIX_SORT_CONST_F32_42:
+    this->nbSamples = 16;
+    input.reload(SupportTestsF32::INPUT_SORT_CONST_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_SORT_CONST_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
+    case TEST_RADIX_SORT_DESC_F32_43:
+    this->nbSamples = 600;
+    input.reload(SupportTestsF32::INPUT_RADIX_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_RADIX_SORT_DESC_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr); 
+    break;
+
+    case TEST_ARGSORT_F32_44:
+    this->nbSamples = 600;
+    input.reload(SupportTestsF32::INPUT_RADIX_SORT_F32_ID,mgr,this->nbSamples);
+    refIndex.reload(SupportTestsF32::REF_ARGSORT_S32_ID,mgr);
+    index.create(this->nbSamples,SupportTestsF32::OUT_S32_ID,mgr); 
+    work.create(3*this->nbSamples,SupportTestsF32::OUT_S32_ID,mgr); 
+    break;
+
+    case TEST_TOPK_F32_45:
+    this->nbSamples = 600;
+    input.reload(SupportTestsF32::INPUT_RADIX_SORT_F32_ID,mgr,this->nbSamples);
+    ref.reload(SupportTestsF32::REF_TOPK_F32_ID,mgr);
+    refIndex.reload(SupportTestsF32::REF_TOPK_INDEX_S32_ID,mgr);
+    output.create(ref.nbSamples(),SupportTestsF32::OUT_F32_ID,mgr); 
+    index.create(refIndex.nbSamples(),SupportTestsF32::OUT_S32_ID,mgr); 
+    break;
+
+    case TEST_CONVERT_AFFINE_F32_Q31_46:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF32::INPUT_AFFINE_F32_ID,mgr,this->nbSamples);
+    refQ31.reload(SupportTestsF32::REF_AFFINE_Q31_ID,mgr,this->nbSamples);
+    outputQ31.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_F32_Q15_47:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF32::INPUT_AFFINE_F32_ID,mgr,this->nbSamples);
+    refQ15.reload(SupportTestsF32::REF_AFFINE_Q15_ID,mgr,this->nbSamples);
+    outputQ15.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_F32_Q7_48:
+    this->nbSamples = 255;
+    input.reload(SupportTestsF32::INPUT_AFFINE_F32_ID,mgr,this->nbSamples);
+    refQ7.reload(SupportTestsF32::REF_AFFINE_Q7_ID,mgr,this->nbSamples);
+    outputQ7.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_DEINTERLEAVE_F32_49:
+    this->nbSamples = 23;
+    this->nbChannels = 2;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_DEINTERLEAVE_F32_50:
+    this->nbSamples = 23;
+    this->nbChannels = 4;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_DEINTERLEAVE_F32_51:
+    this->nbSamples = 23;
+    this->nbChannels = 5;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_INTERLEAVE_F32_52:
+    this->nbSamples = 23;
+    this->nbChannels = 2;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_INTERLEAVE_F32_53:
+    this->nbSamples = 23;
+    this->nbChannels = 4;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_INTERLEAVE_F32_54:
+    this->nbSamples = 23;
+    this->nbChannels = 5;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_CMPLX_SPLIT_F32_55:
+    this->nbSamples = 23;
+    this->nbChannels = 2;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_CMPLX_MERGE_F32_56:
+    this->nbSamples = 23;
+    this->nbChannels = 2;
+    input.reload(SupportTestsF32::SAMPLES_F32_ID,mgr,this->nbChannels*this->nbSamples);
+    output.create(this->nbChannels*this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
+
+    case TEST_CONVERT_AFFINE_SAT_F32_57:
+    this->nbSamples = 6;
+    outputQ31.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+    outputQ15.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+    outputQ7.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+    output.create(this->nbSamples,SupportTestsF32::OUT_F32_ID,mgr);
+
+    break;
 
 
   }       
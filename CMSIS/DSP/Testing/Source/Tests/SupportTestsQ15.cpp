@@ -8,6 +8,7 @@
 #define ABS_Q15_ERROR ((q15_t)10)
 #define ABS_Q31_ERROR ((q31_t)40000)
 #define ABS_Q7_ERROR ((q7_t)10)
+#define ABS_AFFINE_F32_ERROR ((float32_t)1.0e-6)
 
 #if defined ( __CC_ARM )
 #pragma diag_suppress 170
@@ -151,6 +152,128 @@
          ASSERT_TRUE(testWriteQ15[1] == 1);
     }
 
+    void SupportTestsQ15::test_convert_affine_q15_f32()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       float32_t *outp = outputF32.ptr();
+       
+      
+       arm_convert_affine_q15_f32(inp, 0.7f, 0.1f, outp,this->nbSamples);
+         
+          
+       ASSERT_NEAR_EQ(refF32,outputF32,ABS_AFFINE_F32_ERROR);
+       ASSERT_EMPTY_TAIL(outputF32);
+
+    } 
+
+    void SupportTestsQ15::test_convert_affine_q15_q31()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       q31_t *outp = outputQ31.ptr();
+       
+      
+       arm_convert_affine_q15_q31(inp, 0x6000, 1, 0x01000000, outp,this->nbSamples);
+         
+          
+       ASSERT_EQ(refQ31,outputQ31);
+       ASSERT_EMPTY_TAIL(outputQ31);
+
+    } 
+
+    void SupportTestsQ15::test_convert_affine_q15_q7()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       q7_t *outp = outputQ7.ptr();
+       
+      
+       arm_convert_affine_q15_q7(inp, 0x6000, 1, 2, outp,this->nbSamples);
+         
+          
+       ASSERT_EQ(refQ7,outputQ7);
+       ASSERT_EMPTY_TAIL(outputQ7);
+
+    } 
+
+    void SupportTestsQ15::test_deinterleave_q15()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       q15_t *outp = outputQ15.ptr();
+       int i, ch;
+      
+
+       arm_deinterleave_q15(inp, this->nbChannels, outp, this->nbSamples);
+         
+          
+       for(ch=0 ; ch < this->nbChannels; ch++)
+       {
+          for(i=0 ; i < this->nbSamples; i++)
+          {
+             ASSERT_EQ(inp[i * this->nbChannels + ch],outp[ch * this->nbSamples + i]);
+          }
+       }
+       ASSERT_EMPTY_TAIL(outputQ15);
+
+    } 
+
+    void SupportTestsQ15::test_interleave_q15()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       q15_t *outp = outputQ15.ptr();
+       int i, ch;
+      
+
+       arm_interleave_q15(inp, this->nbChannels, outp, this->nbSamples);
+         
+          
+       for(ch=0 ; ch < this->nbChannels; ch++)
+       {
+          for(i=0 ; i < this->nbSamples; i++)
+          {
+             ASSERT_EQ(inp[ch * this->nbSamples + i],outp[i * this->nbChannels + ch]);
+          }
+       }
+       ASSERT_EMPTY_TAIL(outputQ15);
+
+    } 
+
+    void SupportTestsQ15::test_cmplx_split_q15()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       q15_t *outp = outputQ15.ptr();
+       int i;
+      
+
+       arm_cmplx_split_q15(inp, outp, outp + this->nbSamples, this->nbSamples);
+         
+          
+       for(i=0 ; i < this->nbSamples; i++)
+       {
+          ASSERT_EQ(inp[2 * i],outp[i]);
+          ASSERT_EQ(inp[2 * i + 1],outp[this->nbSamples + i]);
+       }
+       ASSERT_EMPTY_TAIL(outputQ15);
+
+    } 
+
+    void SupportTestsQ15::test_cmplx_merge_q15()
+    {
+       const q15_t *inp = inputQ15.ptr();
+       q15_t *outp = outputQ15.ptr();
+       int i;
+      
+
+       arm_cmplx_merge_q15(inp, inp + this->nbSamples, outp, this->nbSamples);
+         
+          
+       for(i=0 ; i < this->nbSamples; i++)
+       {
+          ASSERT_EQ(inp[i],outp[2 * i]);
+          ASSERT_EQ(inp[this->nbSamples + i],outp[2 * i + 1]);
+       }
+       ASSERT_EMPTY_TAIL(outputQ15);
+
+    } 
+
   
     void SupportTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -276,6 +399,94 @@
 
             break;
 
+            case TEST_CONVERT_AFFINE_Q15_F32_21:
+              this->nbSamples = 255;
+              inputQ15.reload(SupportTestsQ15::INPUT_AFFINE_Q15_ID,mgr,this->nbSamples);
+              refF32.reload(SupportTestsQ15::REF_AFFINE_F32_ID,mgr,this->nbSamples);
+              outputF32.create(this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CONVERT_AFFINE_Q15_Q31_22:
+              this->nbSamples = 255;
+              inputQ15.reload(SupportTestsQ15::INPUT_AFFINE_Q15_ID,mgr,this->nbSamples);
+              refQ31.reload(SupportTestsQ15::REF_AFFINE_Q31_ID,mgr,this->nbSamples);
+              outputQ31.create(this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CONVERT_AFFINE_Q15_Q7_23:
+              this->nbSamples = 255;
+              inputQ15.reload(SupportTestsQ15::INPUT_AFFINE_Q15_ID,mgr,this->nbSamples);
+              refQ7.reload(SupportTestsQ15::REF_AFFINE_Q7_ID,mgr,this->nbSamples);
+              outputQ7.create(this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_DEINTERLEAVE_Q15_24:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_DEINTERLEAVE_Q15_25:
+              this->nbSamples = 23;
+              this->nbChannels = 4;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_DEINTERLEAVE_Q15_26:
+              this->nbSamples = 23;
+              this->nbChannels = 5;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_INTERLEAVE_Q15_27:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_INTERLEAVE_Q15_28:
+              this->nbSamples = 23;
+              this->nbChannels = 4;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_INTERLEAVE_Q15_29:
+              this->nbSamples = 23;
+              this->nbChannels = 5;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CMPLX_SPLIT_Q15_30:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CMPLX_MERGE_Q15_31:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ15.reload(SupportTestsQ15::SAMPLES_Q15_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ15.create(this->nbChannels*this->nbSamples,SupportTestsQ15::OUT_ID,mgr);
+
+            break;
+
         }
 
        
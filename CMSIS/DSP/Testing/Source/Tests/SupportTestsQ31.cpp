@@ -8,6 +8,7 @@
 #define ABS_Q15_ERROR ((q15_t)10)
 #define ABS_Q31_ERROR ((q31_t)80)
 #define ABS_Q7_ERROR ((q7_t)10)
+#define ABS_AFFINE_F32_ERROR ((float32_t)1.0e-6)
 
     void SupportTestsQ31::test_copy_q31()
     {
@@ -83,6 +84,128 @@
 
     } 
 
+    void SupportTestsQ31::test_convert_affine_q31_f32()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       float32_t *outp = outputF32.ptr();
+       
+      
+       arm_convert_affine_q31_f32(inp, 2.0f, -0.25f, outp,this->nbSamples);
+         
+          
+       ASSERT_NEAR_EQ(refF32,outputF32,ABS_AFFINE_F32_ERROR);
+       ASSERT_EMPTY_TAIL(outputF32);
+
+    } 
+
+    void SupportTestsQ31::test_convert_affine_q31_q15()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       q15_t *outp = outputQ15.ptr();
+       
+      
+       arm_convert_affine_q31_q15(inp, 0x60000000, 1, -100, outp,this->nbSamples);
+         
+          
+       ASSERT_EQ(refQ15,outputQ15);
+       ASSERT_EMPTY_TAIL(outputQ15);
+
+    } 
+
+    void SupportTestsQ31::test_convert_affine_q31_q7()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       q7_t *outp = outputQ7.ptr();
+       
+      
+       arm_convert_affine_q31_q7(inp, 0x40000000, 0, 3, outp,this->nbSamples);
+         
+          
+       ASSERT_EQ(refQ7,outputQ7);
+       ASSERT_EMPTY_TAIL(outputQ7);
+
+    } 
+
+    void SupportTestsQ31::test_deinterleave_q31()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       q31_t *outp = outputQ31.ptr();
+       int i, ch;
+      
+
+       arm_deinterleave_q31(inp, this->nbChannels, outp, this->nbSamples);
+         
+          
+       for(ch=0 ; ch < this->nbChannels; ch++)
+       {
+          for(i=0 ; i < this->nbSamples; i++)
+          {
+             ASSERT_EQ(inp[i * this->nbChannels + ch],outp[ch * this->nbSamples + i]);
+          }
+       }
+       ASSERT_EMPTY_TAIL(outputQ31);
+
+    } 
+
+    void SupportTestsQ31::test_interleave_q31()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       q31_t *outp = outputQ31.ptr();
+       int i, ch;
+      
+
+       arm_interleave_q31(inp, this->nbChannels, outp, this->nbSamples);
+         
+          
+       for(ch=0 ; ch < this->nbChannels; ch++)
+       {
+          for(i=0 ; i < this->nbSamples; i++)
+          {
+             ASSERT_EQ(inp[ch * this->nbSamples + i],outp[i * this->nbChannels + ch]);
+          }
+       }
+       ASSERT_EMPTY_TAIL(outputQ31);
+
+    } 
+
+    void SupportTestsQ31::test_cmplx_split_q31()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       q31_t *outp = outputQ31.ptr();
+       int i;
+      
+
+       arm_cmplx_split_q31(inp, outp, outp + this->nbSamples, this->nbSamples);
+         
+          
+       for(i=0 ; i < this->nbSamples; i++)
+       {
+          ASSERT_EQ(inp[2 * i],outp[i]);
+          ASSERT_EQ(inp[2 * i + 1],outp[this->nbSamples + i]);
+       }
+       ASSERT_EMPTY_TAIL(outputQ31);
+
+    } 
+
+    void SupportTestsQ31::test_cmplx_merge_q31()
+    {
+       const q31_t *inp = inputQ31.ptr();
+       q31_t *outp = outputQ31.ptr();
+       int i;
+      
+
+       arm_cmplx_merge_q31(inp, inp + this->nbSamples, outp, this->nbSamples);
+         
+          
+       for(i=0 ; i < this->nbSamples; i++)
+       {
+          ASSERT_EQ(inp[i],outp[2 * i]);
+          ASSERT_EQ(inp[this->nbSamples + i],outp[2 * i + 1]);
+       }
+       ASSERT_EMPTY_TAIL(outputQ31);
+
+    } 
+
   
     void SupportTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -208,6 +331,94 @@
 
             break;
 
+            case TEST_CONVERT_AFFINE_Q31_F32_16:
+              this->nbSamples = 255;
+              inputQ31.reload(SupportTestsQ31::INPUT_AFFINE_Q31_ID,mgr,this->nbSamples);
+              refF32.reload(SupportTestsQ31::REF_AFFINE_F32_ID,mgr,this->nbSamples);
+              outputF32.create(this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CONVERT_AFFINE_Q31_Q15_17:
+              this->nbSamples = 255;
+              inputQ31.reload(SupportTestsQ31::INPUT_AFFINE_Q31_ID,mgr,this->nbSamples);
+              refQ15.reload(SupportTestsQ31::REF_AFFINE_Q15_ID,mgr,this->nbSamples);
+              outputQ15.create(this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CONVERT_AFFINE_Q31_Q7_18:
+              this->nbSamples = 255;
+              inputQ31.reload(SupportTestsQ31::INPUT_AFFINE_Q31_ID,mgr,this->nbSamples);
+              refQ7.reload(SupportTestsQ31::REF_AFFINE_Q7_ID,mgr,this->nbSamples);
+              outputQ7.create(this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_DEINTERLEAVE_Q31_19:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_DEINTERLEAVE_Q31_20:
+              this->nbSamples = 23;
+              this->nbChannels = 4;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_DEINTERLEAVE_Q31_21:
+              this->nbSamples = 23;
+              this->nbChannels = 5;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_INTERLEAVE_Q31_22:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_INTERLEAVE_Q31_23:
+              this->nbSamples = 23;
+              this->nbChannels = 4;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_INTERLEAVE_Q31_24:
+              this->nbSamples = 23;
+              this->nbChannels = 5;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CMPLX_SPLIT_Q31_25:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CMPLX_MERGE_Q31_26:
+              this->nbSamples = 23;
+              this->nbChannels = 2;
+              inputQ31.reload(SupportTestsQ31::SAMPLES_Q31_ID,mgr,this->nbChannels*this->nbSamples);
+              outputQ31.create(this->nbChannels*this->nbSamples,SupportTestsQ31::OUT_ID,mgr);
+
+            break;
+
         }
 
        
@@ -8,6 +8,7 @@
 #define ABS_Q15_ERROR ((q15_t)(1<<8))
 #define ABS_Q31_ERROR ((q31_t)(1<<24))
 #define ABS_Q7_ERROR ((q7_t)10)
+#define ABS_AFFINE_F32_ERROR ((float32_t)1.0e-6)
 
 #if defined ( __CC_ARM )
 #pragma diag_suppress 170
@@ -135,6 +136,48 @@
 
     }
 
+    void SupportTestsQ7::test_convert_affine_q7_f32()
+    {
+       const q7_t *inp = inputQ7.ptr();
+       float32_t *outp = outputF32.ptr();
+       
+      
+       arm_convert_affine_q7_f32(inp, 0.5f, 0.25f, outp,this->nbSamples);
+         
+          
+       ASSERT_NEAR_EQ(refF32,outputF32,ABS_AFFINE_F32_ERROR);
+       ASSERT_EMPTY_TAIL(outputF32);
+
+    } 
+
+    void SupportTestsQ7::test_convert_affine_q7_q15()
+    {
+       const q7_t *inp = inputQ7.ptr();
+       q15_t *outp = outputQ15.ptr();
+       
+      
+       arm_convert_affine_q7_q15(inp, 0x6000, 1, 0x100, outp,this->nbSamples);
+         
+          
+       ASSERT_EQ(refQ15,outputQ15);
+       ASSERT_EMPTY_TAIL(outputQ15);
+
+    } 
+
+    void SupportTestsQ7::test_convert_affine_q7_q31()
+    {
+       const q7_t *inp = inputQ7.ptr();
+       q31_t *outp = outputQ31.ptr();
+       
+      
+       arm_convert_affine_q7_q31(inp, 0x4000, 0, -0x10000, outp,this->nbSamples);
+         
+          
+       ASSERT_EQ(refQ31,outputQ31);
+       ASSERT_EMPTY_TAIL(outputQ31);
+
+    } 
+
   
     void SupportTestsQ7::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
     {
@@ -260,6 +303,30 @@
 
             break;
 
+            case TEST_CONVERT_AFFINE_Q7_F32_19:
+              this->nbSamples = 255;
+              inputQ7.reload(SupportTestsQ7::INPUT_AFFINE_Q7_ID,mgr,this->nbSamples);
+              refF32.reload(SupportTestsQ7::REF_AFFINE_F32_ID,mgr,this->nbSamples);
+              outputF32.create(this->nbSamples,SupportTestsQ7::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CONVERT_AFFINE_Q7_Q15_20:
+              this->nbSamples = 255;
+              inputQ7.reload(SupportTestsQ7::INPUT_AFFINE_Q7_ID,mgr,this->nbSamples);
+              refQ15.reload(SupportTestsQ7::REF_AFFINE_Q15_ID,mgr,this->nbSamples);
+              outputQ15.create(this->nbSamples,SupportTestsQ7::OUT_ID,mgr);
+
+            break;
+
+            case TEST_CONVERT_AFFINE_Q7_Q31_21:
+              this->nbSamples = 255;
+              inputQ7.reload(SupportTestsQ7::INPUT_AFFINE_Q7_ID,mgr,this->nbSamples);
+              refQ31.reload(SupportTestsQ7::REF_AFFINE_Q31_ID,mgr,this->nbSamples);
+              outputQ31.create(this->nbSamples,SupportTestsQ7::OUT_ID,mgr);
+
+            break;
+
         }
 
        
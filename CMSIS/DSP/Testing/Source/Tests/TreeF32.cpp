@@ -0,0 +1,90 @@
+#include "TreeF32.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+
+    void TreeF32::test_tree_ensemble_predict_f32()
+    {
+       arm_tree_ensemble_predict_f32(&tree, 
+             input.ptr(), 
+             this->nbPatterns,
+             output.ptr());
+
+       ASSERT_CLOSE_ERROR(output,ref,(float32_t)1e-6,(float32_t)1e-5);
+    } 
+
+  
+    void TreeF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+       (void)paramsArgs;
+
+       switch(id)
+       {
+          case TreeF32::TEST_TREE_ENSEMBLE_PREDICT_F32_1:
+            dims.reload(TreeF32::DIMS1_S16_ID,mgr);
+            structure.reload(TreeF32::STRUCTURE1_S16_ID,mgr);
+            nodes.reload(TreeF32::NODES1_U32_ID,mgr);
+            input.reload(TreeF32::INPUTS1_F32_ID,mgr);
+            thresholds.reload(TreeF32::THRESHOLDS1_F32_ID,mgr);
+            leaves.reload(TreeF32::LEAVES1_F32_ID,mgr);
+            base.reload(TreeF32::BASE1_F32_ID,mgr);
+            ref.reload(TreeF32::REF1_F32_ID,mgr);
+          break;
+
+          case TreeF32::TEST_TREE_ENSEMBLE_PREDICT_F32_2:
+            dims.reload(TreeF32::DIMS2_S16_ID,mgr);
+            structure.reload(TreeF32::STRUCTURE2_S16_ID,mgr);
+            nodes.reload(TreeF32::NODES2_U32_ID,mgr);
+            input.reload(TreeF32::INPUTS2_F32_ID,mgr);
+            thresholds.reload(TreeF32::THRESHOLDS2_F32_ID,mgr);
+            leaves.reload(TreeF32::LEAVES2_F32_ID,mgr);
+            base.reload(TreeF32::BASE2_F32_ID,mgr);
+            ref.reload(TreeF32::REF2_F32_ID,mgr);
+          break;
+
+          case TreeF32::TEST_TREE_ENSEMBLE_PREDICT_F32_3:
+            dims.reload(TreeF32::DIMS3_S16_ID,mgr);
+            structure.reload(TreeF32::STRUCTURE3_S16_ID,mgr);
+            nodes.reload(TreeF32::NODES3_U32_ID,mgr);
+            input.reload(TreeF32::INPUTS3_F32_ID,mgr);
+            thresholds.reload(TreeF32::THRESHOLDS3_F32_ID,mgr);
+            leaves.reload(TreeF32::LEAVES3_F32_ID,mgr);
+            base.reload(TreeF32::BASE3_F32_ID,mgr);
+            ref.reload(TreeF32::REF3_F32_ID,mgr);
+          break;
+       }
+
+       /* Dims : nbPatterns, vecDim, nbTrees, nbNodes, nbOutputs, nbLeafValues */
+       const int16_t *dimsp = dims.ptr();
+       const uint16_t *structp = (const uint16_t*)structure.ptr();
+       const uint32_t *nodesp = nodes.ptr();
+
+       this->nbPatterns = dimsp[0];
+
+       tree.vectorDimension = dimsp[1];
+       tree.numberOfTrees = dimsp[2];
+       tree.numberOfNodes = dimsp[3];
+       tree.numberOfOutputs = dimsp[4];
+       tree.numberOfLeafValues = dimsp[5];
+
+       tree.treeDepths = structp;
+       tree.treeOutputs = structp + tree.numberOfTrees;
+       tree.featureIndexes = structp + 2*tree.numberOfTrees;
+
+       tree.treeRoots = nodesp;
+       tree.leftChildren = nodesp + tree.numberOfTrees;
+       tree.leafIndexes = nodesp + tree.numberOfTrees + tree.numberOfNodes;
+
+       tree.thresholds = thresholds.ptr();
+       tree.leafValues = leaves.ptr();
+       tree.baseValues = base.ptr();
+
+       output.create(this->nbPatterns*tree.numberOfOutputs,TreeF32::OUT_F32_ID,mgr);
+    }
+
+    void TreeF32::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
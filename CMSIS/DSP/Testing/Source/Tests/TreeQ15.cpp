@@ -0,0 +1,90 @@
+#include "TreeQ15.h"
+#include <stdio.h>
+#include "Error.h"
+#include "Test.h"
+
+
+    void TreeQ15::test_tree_ensemble_predict_q15()
+    {
+       arm_tree_ensemble_predict_q15(&tree, 
+             input.ptr(), 
+             this->nbPatterns,
+             output.ptr());
+
+       ASSERT_EQ(output,ref);
+    } 
+
+  
+    void TreeQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& paramsArgs,Client::PatternMgr *mgr)
+    {
+       (void)paramsArgs;
+
+       switch(id)
+       {
+          case TreeQ15::TEST_TREE_ENSEMBLE_PREDICT_Q15_1:
+            dims.reload(TreeQ15::DIMS1_S16_ID,mgr);
+            structure.reload(TreeQ15::STRUCTURE1_S16_ID,mgr);
+            nodes.reload(TreeQ15::NODES1_U32_ID,mgr);
+            input.reload(TreeQ15::INPUTS1_Q15_ID,mgr);
+            thresholds.reload(TreeQ15::THRESHOLDS1_Q15_ID,mgr);
+            leaves.reload(TreeQ15::LEAVES1_Q15_ID,mgr);
+            base.reload(TreeQ15::BASE1_Q31_ID,mgr);
+            ref.reload(TreeQ15::REF1_Q31_ID,mgr);
+          break;
+
+          case TreeQ15::TEST_TREE_ENSEMBLE_PREDICT_Q15_2:
+            dims.reload(TreeQ15::DIMS2_S16_ID,mgr);
+            structure.reload(TreeQ15::STRUCTURE2_S16_ID,mgr);
+            nodes.reload(TreeQ15::NODES2_U32_ID,mgr);
+            input.reload(TreeQ15::INPUTS2_Q15_ID,mgr);
+            thresholds.reload(TreeQ15::THRESHOLDS2_Q15_ID,mgr);
+            leaves.reload(TreeQ15::LEAVES2_Q15_ID,mgr);
+            base.reload(TreeQ15::BASE2_Q31_ID,mgr);
+            ref.reload(TreeQ15::REF2_Q31_ID,mgr);
+          break;
+
+          case TreeQ15::TEST_TREE_ENSEMBLE_PREDICT_Q15_3:
+            dims.reload(TreeQ15::DIMS3_S16_ID,mgr);
+            structure.reload(TreeQ15::STRUCTURE3_S16_ID,mgr);
+            nodes.reload(TreeQ15::NODES3_U32_ID,mgr);
+            input.reload(TreeQ15::INPUTS3_Q15_ID,mgr);
+            thresholds.reload(TreeQ15::THRESHOLDS3_Q15_ID,mgr);
+            leaves.reload(TreeQ15::LEAVES3_Q15_ID,mgr);
+            base.reload(TreeQ15::BASE3_Q31_ID,mgr);
+            ref.reload(TreeQ15::REF3_Q31_ID,mgr);
+          break;
+       }
+
+       /* Dims : nbPatterns, vecDim, nbTrees, nbNodes, nbOutputs, nbLeafValues */
+       const int16_t *dimsp = dims.ptr();
+       const uint16_t *structp = (const uint16_t*)structure.ptr();
+       const uint32_t *nodesp = nodes.ptr();
+
+       this->nbPatterns = dimsp[0];
+
+       tree.vectorDimension = dimsp[1];
+       tree.numberOfTrees = dimsp[2];
+       tree.numberOfNodes = dimsp[3];
+       tree.numberOfOutputs = dimsp[4];
+       tree.numberOfLeafValues = dimsp[5];
+
+       tree.treeDepths = structp;
+       tree.treeOutputs = structp + tree.numberOfTrees;
+       tree.featureIndexes = structp + 2*tree.numberOfTrees;
+
+       tree.treeRoots = nodesp;
+       tree.leftChildren = nodesp + tree.numberOfTrees;
+       tree.leafIndexes = nodesp + tree.numberOfTrees + tree.numberOfNodes;
+
+       tree.thresholds = thresholds.ptr();
+       tree.leafValues = leaves.ptr();
+       tree.baseValues = base.ptr();
+
+       output.create(this->nbPatterns*tree.numberOfOutputs,TreeQ15::OUT_Q31_ID,mgr);
+    }
+
+    void TreeQ15::tearDown(Testing::testID_t id,Client::PatternMgr *mgr)
+    {
+        (void)id;
+        output.dump(mgr);
+    }
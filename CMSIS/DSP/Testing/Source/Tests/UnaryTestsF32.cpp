@@ -43,6 +43,11 @@ Comparison for Cholesky
 #define REL_ERROR_LDLT_SPDO (1e-5)
 #define ABS_ERROR_LDLT_SDPO (2e-1)
 
+/* Eigen and singular value decompositions */
+
+#define REL_ERROR_EIG (1e-4)
+#define ABS_ERROR_EIG (1e-4)
+
 /* Upper bound of maximum matrix dimension used by Python */
 #define MAXMATRIXDIM 40
 
@@ -667,6 +672,233 @@ void UnaryTestsF32::test_mat_inverse_f32()
 
 
   
+    }
+
+    void UnaryTestsF32::test_mat_eig_sym_f32()
+    {
+      float32_t *ap=a.ptr();
+      float32_t *vp=c.ptr();
+      float32_t *scratchp=d.ptr();
+      const float32_t *inp1=input1.ptr();
+
+      float32_t *outp=output.ptr();
+
+      outa=outputa.ptr();
+      outb=outputb.ptr();
+
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples();
+
+      int rows,columns;
+      int i;
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = rows;
+
+          in1.numRows=rows;
+          in1.numCols=columns;
+          memcpy((void*)ap,(const void*)inp1,sizeof(float32_t)*rows*columns);
+          in1.pData = ap;
+
+          out.numRows=rows;
+          out.numCols=columns;
+          out.pData = vp;
+
+          status=arm_mat_eig_sym_f32(&this->in1,&this->out,outp,scratchp);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* Eigenvectors are defined up to a sign so V D V^t is compared
+             with the input matrix */
+          for(int r=0; r < rows; r++)
+          {
+            for(int k=0; k < columns; k++)
+            {
+               float64_t acc = 0.0;
+               for(int w=0; w < columns; w++)
+               {
+                 acc += (float64_t)vp[r*columns + w] * outp[w] * vp[k*columns + w];
+               }
+               outa[r*columns + k] = acc;
+               outb[r*columns + k] = inp1[r*columns + k];
+            }
+          }
+
+          outp += rows;
+          outa += (rows * columns);
+          outb += (rows * columns);
+          inp1 += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+      ASSERT_EMPTY_TAIL(outputa);
+      ASSERT_EMPTY_TAIL(outputb);
+
+      ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR_EIG,REL_ERROR_EIG);
+
+      ASSERT_CLOSE_ERROR(outputb,outputa,ABS_ERROR_EIG,REL_ERROR_EIG);
+    }
+
+    void UnaryTestsF32::test_mat_svd_f32()
+    {
+      float32_t *ap=a.ptr();
+      float32_t *up=b.ptr();
+      float32_t *vp=c.ptr();
+      float32_t *scratchp=d.ptr();
+      const float32_t *inp1=input1.ptr();
+
+      float32_t *outp=output.ptr();
+
+      outa=outputa.ptr();
+      outb=outputb.ptr();
+
+      int16_t *dimsp = dims.ptr();
+      int nbMatrixes = dims.nbSamples() >> 1;
+
+      int rows,columns;
+      int i;
+      arm_status status;
+      arm_matrix_instance_f32 outu;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          in1.numRows=rows;
+          in1.numCols=columns;
+          memcpy((void*)ap,(const void*)inp1,sizeof(float32_t)*rows*columns);
+          in1.pData = ap;
+
+          outu.numRows=rows;
+          outu.numCols=columns;
+          outu.pData = up;
+
+          out.numRows=columns;
+          out.numCols=columns;
+          out.pData = vp;
+
+          status=arm_mat_svd_f32(&this->in1,&outu,outp,&this->out,scratchp);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          /* Singular vectors are defined up to a sign so U S V^t is compared
+             with the input matrix */
+          for(int r=0; r < rows; r++)
+          {
+            for(int k=0; k < columns; k++)
+            {
+               float64_t acc = 0.0;
+               for(int w=0; w < columns; w++)
+               {
+                 acc += (float64_t)up[r*columns + w] * outp[w] * vp[k*columns + w];
+               }
+               outa[r*columns + k] = acc;
+               outb[r*columns + k] = inp1[r*columns + k];
+            }
+          }
+
+          outp += columns;
+          outa += (rows * columns);
+          outb += (rows * columns);
+          inp1 += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+      ASSERT_EMPTY_TAIL(outputa);
+      ASSERT_EMPTY_TAIL(outputb);
+
+      ASSERT_CLOSE_ERROR(ref,output,ABS_ERROR_EIG,REL_ERROR_EIG);
+
+      ASSERT_CLOSE_ERROR(outputb,outputa,ABS_ERROR_EIG,REL_ERROR_EIG);
+    }
+
+    void UnaryTestsF32::test_mat_add_ext_f32()
+    {     
+      LOADDATA2();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_ext_f32(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_f32(&this->in2ext,this->in2.numRows,this->in2.numCols,this->in2.pData);
+          arm_mat_init_ext_f32(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_add_ext_f32(&this->in1ext,&this->in2ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    }
+
+void UnaryTestsF32::test_mat_trans_ext_f32()
+    {     
+      LOADDATA1();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_ext_f32(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_f32(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_trans_ext_f32(&this->in1ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
+    }
+
+void UnaryTestsF32::test_mat_vec_mult_ext_f32()
+    {     
+      LOADVECDATA2();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_ext_f32(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+
+          arm_mat_vec_mult_ext_f32(&this->in1ext, bp, outp);
+
+          outp += rows ;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(float32_t)SNR_THRESHOLD);
+
+      ASSERT_CLOSE_ERROR(output,ref,ABS_ERROR,REL_ERROR);
+
     }
 
     void UnaryTestsF32::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
@@ -835,6 +1067,73 @@ void UnaryTestsF32::test_mat_inverse_f32()
 
          break;
 
+         case TEST_MAT_EIG_SYM_F32_13:
+            input1.reload(UnaryTestsF32::INPUTSEIG1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSEIG1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFEIGVAL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+
+            outputa.create(input1.nbSamples(),UnaryTestsF32::OUTA_F64_ID,mgr);
+            outputb.create(input1.nbSamples(),UnaryTestsF32::OUTB_F64_ID,mgr);
+
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+            d.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPD_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_SVD_F32_14:
+            input1.reload(UnaryTestsF32::INPUTSSVD1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSSVD1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFSVD_S1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+
+            outputa.create(input1.nbSamples(),UnaryTestsF32::OUTA_F64_ID,mgr);
+            outputb.create(input1.nbSamples(),UnaryTestsF32::OUTB_F64_ID,mgr);
+
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+            c.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPC_F32_ID,mgr);
+            d.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPD_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_ADD_EXT_F32_15:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTS2_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFADD1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_EXT_F32_16:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFTRANS1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_EXT_F32_17:
+            input1.reload(UnaryTestsF32::INPUTS1_F32_ID,mgr);
+            input2.reload(UnaryTestsF32::INPUTVEC1_F32_ID,mgr);
+            dims.reload(UnaryTestsF32::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsF32::REFVECMUL1_F32_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsF32::OUT_F32_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsF32::TMPA_F32_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsF32::TMPB_F32_ID,mgr);
+         break;
+
       }
        
 
@@ -278,6 +278,93 @@ void UnaryTestsQ15::test_mat_cmplx_trans_q15()
     }
 
 
+    void UnaryTestsQ15::test_mat_add_ext_q15()
+    {     
+      LOADDATA2();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_ext_q15(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_q15(&this->in2ext,this->in2.numRows,this->in2.numCols,this->in2.pData);
+          arm_mat_init_ext_q15(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_add_ext_q15(&this->in1ext,&this->in2ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    }
+
+void UnaryTestsQ15::test_mat_trans_ext_q15()
+    {     
+      LOADDATA1();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_ext_q15(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_q15(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_trans_ext_q15(&this->in1ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    }
+
+    void UnaryTestsQ15::test_mat_vec_mult_ext_q15()
+    {     
+
+
+      LOADVECDATA2();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_ext_q15(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+
+          arm_mat_vec_mult_ext_q15(&this->in1ext, bp, outp);
+
+          outp += rows ;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q15_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q15);
+
+    }
+
     void UnaryTestsQ15::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -351,6 +438,40 @@ void UnaryTestsQ15::test_mat_cmplx_trans_q15()
             a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
          break;
 
+         case TEST_MAT_ADD_EXT_Q15_7:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(UnaryTestsQ15::INPUTS2_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFADD1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPB_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_EXT_Q15_8:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFTRANS1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_EXT_Q15_9:
+            input1.reload(UnaryTestsQ15::INPUTS1_Q15_ID,mgr);
+            input2.reload(UnaryTestsQ15::INPUTVEC1_Q15_ID,mgr);
+            dims.reload(UnaryTestsQ15::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ15::REFVECMUL1_Q15_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ15::OUT_Q15_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ15::TMPA_Q15_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsQ15::TMPB_Q15_ID,mgr);
+         break;
+
         
       }
        
@@ -276,6 +276,91 @@ void UnaryTestsQ31::test_mat_cmplx_trans_q31()
     } 
 
 
+    void UnaryTestsQ31::test_mat_add_ext_q31()
+    {     
+      LOADDATA2();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA2();
+          arm_mat_init_ext_q31(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_q31(&this->in2ext,this->in2.numRows,this->in2.numCols,this->in2.pData);
+          arm_mat_init_ext_q31(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_add_ext_q31(&this->in1ext,&this->in2ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    }
+
+void UnaryTestsQ31::test_mat_trans_ext_q31()
+    {     
+      LOADDATA1();
+      arm_status status;
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          columns = *dimsp++;
+
+          PREPAREDATA1(true);
+          arm_mat_init_ext_q31(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+          arm_mat_init_ext_q31(&this->outext,this->out.numRows,this->out.numCols,this->out.pData);
+
+          status=arm_mat_trans_ext_q31(&this->in1ext,&this->outext);
+          ASSERT_TRUE(status==ARM_MATH_SUCCESS);
+
+          outp += (rows * columns);
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    }
+
+    void UnaryTestsQ31::test_mat_vec_mult_ext_q31()
+    {     
+      LOADVECDATA2();
+
+      for(i=0;i < nbMatrixes ; i ++)
+      {
+          rows = *dimsp++;
+          internal = *dimsp++;
+
+          PREPAREVECDATA2();
+          arm_mat_init_ext_q31(&this->in1ext,this->in1.numRows,this->in1.numCols,this->in1.pData);
+
+          arm_mat_vec_mult_ext_q31(&this->in1ext, bp, outp);
+
+          outp += rows ;
+
+      }
+
+      ASSERT_EMPTY_TAIL(output);
+
+      ASSERT_SNR(output,ref,(q31_t)SNR_THRESHOLD);
+
+      ASSERT_NEAR_EQ(output,ref,ABS_ERROR_Q31);
+
+    }
+
     void UnaryTestsQ31::setUp(Testing::testID_t id,std::vector<Testing::param_t>& params,Client::PatternMgr *mgr)
     {
 
@@ -349,6 +434,40 @@ void UnaryTestsQ31::test_mat_cmplx_trans_q31()
             a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
          break;
 
+         case TEST_MAT_ADD_EXT_Q31_7:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(UnaryTestsQ31::INPUTS2_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFADD1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPB_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_TRANS_EXT_Q31_8:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFTRANS1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+         break;
+
+         case TEST_MAT_VEC_MULT_EXT_Q31_9:
+            input1.reload(UnaryTestsQ31::INPUTS1_Q31_ID,mgr);
+            input2.reload(UnaryTestsQ31::INPUTVEC1_Q31_ID,mgr);
+            dims.reload(UnaryTestsQ31::DIMSUNARY1_S16_ID,mgr);
+
+            ref.reload(UnaryTestsQ31::REFVECMUL1_Q31_ID,mgr);
+
+            output.create(ref.nbSamples(),UnaryTestsQ31::OUT_Q31_ID,mgr);
+            a.create(MAXMATRIXDIM*MAXMATRIXDIM,UnaryTestsQ31::TMPA_Q31_ID,mgr);
+            b.create(MAXMATRIXDIM,UnaryTestsQ31::TMPB_Q31_ID,mgr);
+         break;
+
         
       }
        